@@ -37,7 +37,7 @@
  ** 3. Project-Specific Components (Local)
  ******************************************************************************
  ******************************************************************************/
-// None (minigui.h is the entry point for this component)
+#include "minigui_config.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,16 +49,51 @@ extern "C" {
  ******************************************************************************
  ******************************************************************************/
 
+/**
+ * @brief Screen list: X(id, title, menu label, creator)
+ *
+ * Single source for the screen enum, status bar titles, creator table and
+ * menu buttons. Screens disabled in minigui_config.h drop out of every one
+ * of them, so their creators are never referenced.
+ */
+#if MINIGUI_ENABLE_HOME
+#define MINIGUI_SCREEN_X_HOME(X)     X(HOME, "Home", "Home", create_screen_home)
+#else
+#define MINIGUI_SCREEN_X_HOME(X)
+#endif
+
+#if MINIGUI_ENABLE_LOGS
+#define MINIGUI_SCREEN_X_LOGS(X)     X(LOGS, "System Logs", "Logs", create_screen_logs)
+#else
+#define MINIGUI_SCREEN_X_LOGS(X)
+#endif
+
+#if MINIGUI_ENABLE_SETTINGS
+#define MINIGUI_SCREEN_X_SETTINGS(X) X(SETTINGS, "Settings", "Settings", create_screen_settings)
+#else
+#define MINIGUI_SCREEN_X_SETTINGS(X)
+#endif
+
+#define MINIGUI_SCREEN_LIST(X) \
+    MINIGUI_SCREEN_X_HOME(X)   \
+    MINIGUI_SCREEN_X_LOGS(X)   \
+    MINIGUI_SCREEN_X_SETTINGS(X)
+
 /**
  * @brief Available screens in the application
  */
 typedef enum {
-    MINIGUI_SCREEN_HOME,
-    MINIGUI_SCREEN_LOGS,
-    MINIGUI_SCREEN_SETTINGS,
+#define MINIGUI_SCREEN_ENUM(id, title, label, creator) MINIGUI_SCREEN_##id,
+    MINIGUI_SCREEN_LIST(MINIGUI_SCREEN_ENUM)
+#undef MINIGUI_SCREEN_ENUM
     MINIGUI_SCREEN_COUNT
 } minigui_screen_t;
 
+/**
+ * @brief Screen shown after minigui_init() (first enabled screen)
+ */
+#define MINIGUI_SCREEN_DEFAULT ((minigui_screen_t)0)
+
 /**
  * @brief Maximum number of log entries to retain
  */
@@ -110,6 +145,11 @@ typedef struct {
     char password[128];   /**< WPA/WPA2 Password */
 } minigui_wifi_credentials_t;
 
+/**
+ * @brief Maximum number of networks shown after a WiFi scan
+ */
+#define MINIGUI_MAX_WIFI_NETWORKS 32
+
 /**
  * @brief WiFi network info for scanning
  */
@@ -175,13 +215,14 @@ typedef void (*minigui_network_status_provider_t)(minigui_network_status_t *stat
 
 /******************************************************************************
  ******************************************************************************
- * @brief Initialize the UI manager dynamically and set up flex layouts.
+ * @brief Initialize the UI manager on the default display.
  *
  * @section call_site
- * Called from `app_main` or similar entry point.
+ * Called from `app_main` or similar entry point. Multi-display devices call
+ * `minigui_ctx_create()` (minigui_ctx.h) once per panel instead.
  *
  * @section dependencies
- * - `minigui_menu.h`: For menu initialization.
+ * - `minigui_ctx.h`: The default context.
  * - `lvgl.h`: Core graphics processing and thread-safe locking.
  *
  * @param None
@@ -195,11 +236,9 @@ typedef void (*minigui_network_status_provider_t)(minigui_network_status_t *stat
  * @return void
  *
  * Implementation Steps
- * 1. Log initialization start.
- * 2. Acquire LVGL lock (`lv_lock`) for thread safety.
- * 3. Initialize the UI components and flex layouts.
- * 4. Release LVGL lock (`lv_unlock`).
- * 5. Default to the Home screen by calling `minigui_switch_screen`.
+ * 1. Return if the default context already exists.
+ * 2. Create a context on the default display (skeleton, menu, clock) and
+ *    show MINIGUI_SCREEN_DEFAULT in it.
  ******************************************************************************/
 void minigui_init(void);
 
@@ -234,19 +273,20 @@ void minigui_set_log_provider(minigui_log_provider_t provider);
  * @return void
  *
  * Implementation Steps
- * 1. Store the provider globally.
+ * 1. Store the provider globally (shared by all contexts).
  * 2. Acquire LVGL lock (`lv_lock`).
- * 3. Immediately update the clock via `update_clock_cb`.
+ * 3. Immediately update every clock via `update_clock_cb`.
  * 4. Release LVGL lock (`lv_unlock`).
  ******************************************************************************/
 void minigui_set_time_provider(minigui_time_provider_t provider);
 
 /******************************************************************************
  ******************************************************************************
- * @brief Switch the active screen rendered in the main content area.
+ * @brief Switch the active screen rendered in the default context's content area.
  *
  * @section call_site
- * Called by the menu system, navigation buttons, or externally to change the active view.
+ * Called externally to change the active view. Menu buttons switch their
+ * own context with `minigui_ctx_switch_screen()`.
  *
  * @section dependencies
  * - `lvgl.h`: Core graphics processing and thread-safe locking.
@@ -262,10 +302,8 @@ void minigui_set_time_provider(minigui_time_provider_t provider);
  * @return void
  *
  * Implementation Steps
- * 1. Validate the screen ID.
- * 2. Acquire LVGL lock (`lv_lock`) to prevent concurrent drawing issues.
- * 3. Render the new screen in the content area.
- * 4. Release LVGL lock (`lv_unlock`).
+ * 1. Delegate to `minigui_ctx_switch_screen()` on the default context, which
+ *    validates the ID, takes the LVGL lock and renders the new screen.
  ******************************************************************************/
 void minigui_switch_screen(minigui_screen_t screen);
 
@@ -293,11 +331,13 @@ void minigui_set_brightness(uint8_t brightness);
  * @brief Internal helper to trigger the WiFi save callback.
  *
  * @section call_site
- * Called by the Settings screen when user submits WiFi credentials.
+ * Called by minigui_wifi_apply() when no asynchronous apply handler is
+ * registered (see minigui_wifi.h); the callback runs synchronously.
  *
  * @param creds Pointer to the collected credentials
+ * @return true if a save callback is registered
  */
-void minigui_save_wifi_credentials(const minigui_wifi_credentials_t *creds);
+bool minigui_save_wifi_credentials(const minigui_wifi_credentials_t *creds);
 
 /**
  * @brief Register a callback for WiFi configuration saving
@@ -372,12 +412,13 @@ void minigui_register_network_status_provider(minigui_network_status_provider_t
 void minigui_get_network_status(minigui_network_status_t *status);
 
 /**
- * @brief Internal helper to get the main content area (stage).
+ * @brief Internal helper to get the default context's content area (stage).
  *
  * @section call_site
- * Used by screen creators to attach their content.
+ * Used by benchmarks and perf hooks; screen creators receive their own
+ * content area as the creator argument.
  *
- * @return Pointer to the main content container
+ * @return Pointer to the main content container (NULL before minigui_init)
  */
 lv_obj_t *minigui_get_content_area(void);
 
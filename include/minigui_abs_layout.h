@@ -0,0 +1,145 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Absolute Layout Mode.
+ **
+ **            For fixed-resolution products (MINIGUI_ABSOLUTE_LAYOUT) the flex
+ **            result of every view is computed once, recorded as absolute
+ **            coordinates and replayed on later builds with the flex layouts
+ **            switched off. The layout pass counter works in both modes so the
+ **            effect can be measured.
+ **
+ **            @section minigui_abs_layout.h - Frozen layout interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_ABS_LAYOUT_H
+#define MINIGUI_ABS_LAYOUT_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Number of views whose frozen layout can be cached
+ */
+#ifndef MINIGUI_ABS_LAYOUT_SLOTS
+#define MINIGUI_ABS_LAYOUT_SLOTS 16
+#endif
+
+/**
+ * @brief Cache keys for the views minigui builds (0 is reserved)
+ */
+#define MINIGUI_ABS_KEY_SKELETON          0xFFFFu
+#define MINIGUI_ABS_KEY_SCREEN(id)        (0x100u + (uint32_t)(id))
+#define MINIGUI_ABS_KEY_SETTINGS_CAT(cat) (0x200u + (uint32_t)(cat))
+
+/**
+ * @brief Layout pass statistics
+ */
+typedef struct {
+    uint32_t frames;          /**< Display refreshes observed */
+    uint32_t passes;          /**< Flex passes in total (inside and outside frames) */
+    uint32_t max_per_frame;   /**< Most flex passes in one refresh */
+    uint32_t recorded;        /**< Views measured and recorded (absolute mode) */
+    uint32_t replayed;        /**< Views built from a recorded layout (absolute mode) */
+} minigui_layout_pass_stats_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Freeze (or replay) the layout of a freshly built view.
+ *
+ * @section call_site
+ * Called by minigui right after a view is built, with the LVGL lock held.
+ * With MINIGUI_ABSOLUTE_LAYOUT off it only instruments the view for the
+ * layout pass counter.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Layout update, coordinates, local styles.
+ * - `minigui_alloc.h`: Record storage (internal pool).
+ *
+ * @param root View root; its descendants are frozen, not the root position.
+ * @param key  Cache key (MINIGUI_ABS_KEY_*).
+ *
+ * @section pointers
+ * - `root`: Owned by LVGL.
+ *
+ * @section variables
+ * - None
+ *
+ * @return void
+ *
+ * Implementation Steps
+ * 1. Re-enable the root's own flex layout if an earlier freeze disabled it.
+ * 2. Hash the subtree shape (child counts and layouts).
+ * 3. Same key, shape and resolution as the cache: replay the coordinates.
+ * 4. Otherwise run the layout once, record children of flex containers,
+ *    then replay. Replaying sets positions (and sizes of flex-grow items)
+ *    and switches the flex containers to LV_LAYOUT_NONE.
+ ******************************************************************************/
+void minigui_abs_layout_apply(lv_obj_t *root, uint32_t key);
+
+/**
+ * @brief Drop every recorded layout (e.g. after a resolution change)
+ */
+void minigui_abs_layout_reset(void);
+
+/**
+ * @brief Start counting flex passes per refresh of @p disp (NULL = default)
+ *
+ * Instruments every flex container of the active screen and the top layer;
+ * views built later are instrumented by minigui_abs_layout_apply().
+ */
+void minigui_abs_layout_stats_begin(lv_display_t *disp);
+
+/**
+ * @brief Stop counting and detach from the display
+ */
+void minigui_abs_layout_stats_end(void);
+
+/**
+ * @brief Read the counters
+ *
+ * @param out Output statistics
+ */
+void minigui_abs_layout_stats_get(minigui_layout_pass_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_ABS_LAYOUT_H
@@ -0,0 +1,238 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Threshold Alerts.
+ **
+ **            Rules such as "voltage below 4.8 V for 10 s" or "more than 5
+ **            ERROR logs per minute" are evaluated when a sample or log line
+ **            is ingested, not by screens polling. Rules live in a constant
+ **            table (20 bytes per rule on 32-bit targets); each has a small
+ **            state block (hysteresis, debounce, rate window). Per metric,
+ **            an index chains the rules that watch it, so one sample costs
+ **            O(rules on that metric).
+ **
+ **            @section minigui_alert.h - Alert engine interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_ALERT_H
+#define MINIGUI_ALERT_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Rule table capacity
+ */
+#ifndef MINIGUI_ALERT_MAX_RULES
+#define MINIGUI_ALERT_MAX_RULES 32
+#endif
+
+/**
+ * @brief Metric ids (built-in ones, then application metrics)
+ */
+#ifndef MINIGUI_ALERT_MAX_METRICS
+#define MINIGUI_ALERT_MAX_METRICS 16
+#endif
+
+/**
+ * @brief Sub-buckets of a rate window (resolution window / N)
+ */
+#define MINIGUI_ALERT_RATE_SLOTS 8
+
+/**
+ * @brief Period of the engine's own minigui_get_system_stats() sampling
+ *
+ * Only runs while a rule watches a system stats metric and nothing else
+ * (Monitor panel, history sampler) fed one within the period, so it adds
+ * at most one provider call and four ingestions per period. The provider
+ * then runs on the LVGL task with the LVGL lock held: it must return
+ * cached values without blocking, or the UI stalls for as long as it takes
+ * (see poll_max_ms in the stats). 0 disables it.
+ */
+#ifndef MINIGUI_ALERT_SAMPLE_MS
+#define MINIGUI_ALERT_SAMPLE_MS 1000
+#endif
+
+/**
+ * @brief Show raised alerts as toasts (critical ones stay until cleared)
+ */
+#ifndef MINIGUI_ALERT_TOASTS
+#define MINIGUI_ALERT_TOASTS 1
+#endif
+
+typedef enum {
+    MINIGUI_METRIC_VOLTAGE_MV = 0,    /**< Fed by minigui_get_system_stats() */
+    MINIGUI_METRIC_CPU_PCT,
+    MINIGUI_METRIC_RAM_USED_KB,
+    MINIGUI_METRIC_FLASH_USED_KB,
+    MINIGUI_METRIC_LOG_ERRORS,        /**< Events: ERROR lines pushed to the log store */
+    MINIGUI_METRIC_LOG_WARNINGS,      /**< Events: WARN lines pushed to the log store */
+    MINIGUI_METRIC_USER               /**< First application metric (up to MINIGUI_ALERT_MAX_METRICS - 1) */
+} minigui_metric_t;
+
+typedef enum {
+    MINIGUI_ALERT_ABOVE = 0,          /**< Sample > threshold; clears at <= threshold - hysteresis */
+    MINIGUI_ALERT_BELOW,              /**< Sample < threshold; clears at >= threshold + hysteresis */
+    MINIGUI_ALERT_RATE                /**< Events in window > threshold; clears at <= threshold - hysteresis */
+} minigui_alert_kind_t;
+
+typedef enum {
+    MINIGUI_ALERT_INFO = 0,
+    MINIGUI_ALERT_WARNING,
+    MINIGUI_ALERT_CRITICAL
+} minigui_alert_severity_t;
+
+/**
+ * @brief One rule (keep tables const so they stay in flash)
+ */
+typedef struct {
+    uint8_t metric;                   /**< minigui_metric_t or application id */
+    uint8_t kind;                     /**< minigui_alert_kind_t */
+    uint8_t severity;                 /**< minigui_alert_severity_t */
+    uint8_t reserved;
+    int32_t threshold;
+    int32_t hysteresis;               /**< Distance back past the threshold before clearing */
+    uint16_t hold_s;                  /**< Condition must hold this long before raising (debounce) */
+    uint16_t window_s;                /**< RATE: counting window */
+    const char *message;              /**< Static text for banners and logs */
+} minigui_alert_rule_t;
+
+/**
+ * @brief Rule initializers
+ */
+#define MINIGUI_ALERT_RULE_ABOVE(metric, threshold, hysteresis, hold_s, severity, message) \
+    { (metric), MINIGUI_ALERT_ABOVE, (severity), 0, (threshold), (hysteresis), (hold_s), 0, (message) }
+#define MINIGUI_ALERT_RULE_BELOW(metric, threshold, hysteresis, hold_s, severity, message) \
+    { (metric), MINIGUI_ALERT_BELOW, (severity), 0, (threshold), (hysteresis), (hold_s), 0, (message) }
+#define MINIGUI_ALERT_RULE_RATE(metric, count, window_s, hysteresis, severity, message) \
+    { (metric), MINIGUI_ALERT_RATE, (severity), 0, (count), (hysteresis), 0, (window_s), (message) }
+
+/**
+ * @brief A rule changed state
+ */
+typedef struct {
+    const minigui_alert_rule_t *rule;
+    uint8_t index;                    /**< Position in the rule table */
+    bool raised;                      /**< true: raised, false: cleared */
+    int32_t value;                    /**< Sample or window count that caused it */
+    uint32_t time_ms;                 /**< lv_tick_get() */
+} minigui_alert_event_t;
+
+/**
+ * @brief Alert listener
+ *
+ * Runs on the ingesting task with the LVGL lock held; hand heavy work off.
+ */
+typedef void (*minigui_alert_cb_t)(const minigui_alert_event_t *event);
+
+/**
+ * @brief Engine counters
+ */
+typedef struct {
+    uint32_t samples;                 /**< Values and event counts ingested */
+    uint32_t evaluations;             /**< Rule checks they caused */
+    uint32_t raised;
+    uint32_t cleared;
+    uint8_t active;                   /**< Rules currently raised */
+    uint32_t polls;                   /**< System stats samples taken by the engine itself */
+    uint32_t poll_max_ms;             /**< Longest of them (the UI is blocked meanwhile) */
+} minigui_alert_stats_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Install a rule table.
+ *
+ * @section call_site
+ * Called once at startup (again to replace the table).
+ *
+ * @section dependencies
+ * - `minigui_alloc.h`: Rule state (internal pool).
+ * - `lvgl.h`: Housekeeping timer.
+ *
+ * @param table Rule table, NULL to remove all rules.
+ * @param count Entries (at most MINIGUI_ALERT_MAX_RULES).
+ *
+ * @section pointers
+ * - `table`: Referenced, must stay valid (usually a const array).
+ *
+ * @section variables
+ * - None
+ *
+ * @return false if the table is too large, a metric id is out of range or
+ *         memory is short (no rules installed).
+ *
+ * Implementation Steps
+ * 1. Validate; allocate one state block per rule.
+ * 2. Chain the rules per metric.
+ * 3. Start the 1 s timer that ages rate windows, expires hold times and,
+ *    when rules watch system stats, samples minigui_get_system_stats()
+ *    every MINIGUI_ALERT_SAMPLE_MS no other caller did.
+ ******************************************************************************/
+bool minigui_alert_set_rules(const minigui_alert_rule_t *table, uint8_t count);
+
+/** @brief Feed one sample of a gauge metric (any task) */
+void minigui_alert_ingest(uint8_t metric, int32_t value);
+
+/** @brief Count @p n events of a rate metric (any task) */
+void minigui_alert_count(uint8_t metric, uint32_t n);
+
+/** @brief Register the alert listener (one, NULL to remove) */
+void minigui_register_alert_cb(minigui_alert_cb_t cb);
+
+/**
+ * @brief Subject that changes on every raise or clear
+ *
+ * Observers read the event with minigui_alert_get_last().
+ */
+lv_subject_t *minigui_alert_subject(void);
+
+/** @brief Copy the latest event; false if none happened yet */
+bool minigui_alert_get_last(minigui_alert_event_t *event);
+
+/** @brief Whether rule @p index is raised */
+bool minigui_alert_is_active(uint8_t index);
+
+/** @brief Copy the engine counters */
+void minigui_alert_get_stats(minigui_alert_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_ALERT_H
@@ -0,0 +1,200 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Memory Pools & Allocator Hooks.
+ **
+ **            Every buffer minigui allocates for itself goes through this
+ **            interface, tagged with the pool it belongs to (internal RAM,
+ **            PSRAM, DMA-capable). The application can redirect the pools to
+ **            its own allocator, or build with MINIGUI_STATIC_POOLS so all
+ **            buffers come from compile-time-sized arenas and minigui never
+ **            touches the system heap.
+ **
+ **            @section minigui_alloc.h - Pool allocator interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_ALLOC_H
+#define MINIGUI_ALLOC_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None required for this header
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Static arena sizes (bytes) used when MINIGUI_STATIC_POOLS is defined
+ *
+ * A size of 0 disables the pool. The internal arena covers the worst case
+ * of everything that can be allocated at once, at the default sizes:
+ * - Log table fetch buffer: 50 x 298 B = 15 KB while the Logs screen is open
+ *   (16 KB with block headers)
+ * - Settings store: 128 entries at the key/value limits x 96 B + 512 B
+ *   index = 13 KB
+ * - Screenshot job: 2.2 KB while a capture runs (3 KB)
+ * - Alert rule state: 32 x 36 B = 1.2 KB (2 KB)
+ * - Contexts, screen views, virtual lists, draw lists and the settings
+ *   state of the built-in schema: under 3 KB for one display
+ * - Update job: 4.2 KB while an update runs, with MINIGUI_ENABLE_FIRMWARE
+ *   (5 KB)
+ *
+ * Recompute when changing MINIGUI_MAX_LOGS, MINIGUI_STORE_MAX_ENTRIES,
+ * MINIGUI_STORE_VALUE_MAX, MINIGUI_SCREENSHOT_CHUNK, MINIGUI_ALERT_MAX_RULES
+ * or MINIGUI_UPDATE_CHUNK, and per extra display or large custom schema.
+ */
+#ifndef MINIGUI_POOL_INTERNAL_SIZE
+#if MINIGUI_ENABLE_FIRMWARE
+#define MINIGUI_POOL_INTERNAL_SIZE ((16 + 13 + 3 + 2 + 3 + 5) * 1024)
+#else
+#define MINIGUI_POOL_INTERNAL_SIZE ((16 + 13 + 3 + 2 + 3) * 1024)
+#endif
+#endif
+
+/**
+ * @brief PSRAM arena, sized for the long-lived buffers at their default sizes
+ *
+ * - Log store ring: 128 x 304 B = 38 KB (+ block headers, 40 KB)
+ * - Metrics history: 64 x 1 KB = 64 KB, from minigui_history_start()
+ * - Mirror staging frame: 64 KB, with MINIGUI_ENABLE_MIRROR
+ *
+ * Recompute when changing MINIGUI_LOG_STORE_CAPACITY, MINIGUI_HISTORY_BLOCKS,
+ * MINIGUI_HISTORY_BLOCK_BYTES or MINIGUI_MIRROR_BUF_SIZE.
+ */
+#ifndef MINIGUI_POOL_PSRAM_SIZE
+#if MINIGUI_ENABLE_MIRROR
+#define MINIGUI_POOL_PSRAM_SIZE ((40 + 64 + 64) * 1024)
+#else
+#define MINIGUI_POOL_PSRAM_SIZE ((40 + 64) * 1024)
+#endif
+#endif
+
+#ifndef MINIGUI_POOL_DMA_SIZE
+#define MINIGUI_POOL_DMA_SIZE 0
+#endif
+
+/**
+ * @brief Purpose-based memory pools
+ */
+typedef enum {
+    MINIGUI_POOL_INTERNAL = 0,  /**< Fast internal RAM (short-lived scratch buffers) */
+    MINIGUI_POOL_PSRAM,         /**< Large, long-lived buffers (stores, caches) */
+    MINIGUI_POOL_DMA,           /**< DMA-capable memory (snapshots, transfer buffers) */
+    MINIGUI_POOL_COUNT
+} minigui_pool_t;
+
+/**
+ * @brief Application allocator
+ *
+ * Both callbacks receive the pool so one allocator can route each purpose
+ * to the right heap.
+ */
+typedef struct {
+    void *(*alloc)(minigui_pool_t pool, size_t size, void *user);  /**< Return NULL on failure */
+    void (*free)(minigui_pool_t pool, void *ptr, void *user);      /**< Release a block from alloc */
+    void *user;                                                    /**< Passed to both callbacks */
+} minigui_allocator_t;
+
+/**
+ * @brief Usage counters of one pool
+ */
+typedef struct {
+    size_t   capacity;    /**< Arena size in static mode, 0 when backed by a heap */
+    size_t   in_use;      /**< Bytes currently allocated (payload) */
+    size_t   peak;        /**< Highest in_use observed */
+    uint32_t allocs;      /**< Successful allocations */
+    uint32_t frees;       /**< Releases */
+    uint32_t failures;    /**< Failed allocations */
+} minigui_pool_stats_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Redirect minigui allocations to an application allocator.
+ *
+ * @section call_site
+ * Called once before `minigui_init()`. Blocks allocated under a previous
+ * allocator must not be outstanding.
+ *
+ * @section dependencies
+ * - None
+ *
+ * @param allocator Allocator to use (copied), or NULL to restore the default
+ *                  (heap_caps on ESP-IDF, malloc elsewhere).
+ *
+ * @section pointers
+ * - `allocator`: Read-only, copied.
+ *
+ * @section variables
+ * - None
+ *
+ * @return bool: false in MINIGUI_STATIC_POOLS builds, where pools are fixed.
+ *
+ * Implementation Steps
+ * 1. Reject the call in static mode.
+ * 2. Copy the allocator (or clear it) under the LVGL lock.
+ ******************************************************************************/
+bool minigui_set_allocator(const minigui_allocator_t *allocator);
+
+/**
+ * @brief Allocate a block from a pool
+ *
+ * @param pool Pool the buffer belongs to
+ * @param size Size in bytes
+ * @return Pointer to the block, or NULL (counted as a failure)
+ */
+void *minigui_malloc(minigui_pool_t pool, size_t size);
+
+/**
+ * @brief Release a block obtained from minigui_malloc()
+ *
+ * @param pool Pool the block was allocated from
+ * @param ptr Block, NULL is ignored
+ */
+void minigui_free(minigui_pool_t pool, void *ptr);
+
+/**
+ * @brief Read the usage counters of a pool
+ *
+ * @param pool Pool to query
+ * @param stats Output counters
+ */
+void minigui_get_pool_stats(minigui_pool_t pool, minigui_pool_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_ALLOC_H
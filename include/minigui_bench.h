@@ -0,0 +1,417 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Benchmark API.
+ **
+ **            This header defines benchmark entry points that the simulator or
+ **            a firmware test command can run against a live minigui instance.
+ **            Each benchmark fills a plain result structure; printing and
+ **            pass/fail decisions are left to the caller. The log pipeline
+ **            benchmark needs MINIGUI_ENABLE_LOGS.
+ **
+ **            @section minigui_bench.h - Benchmark interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_BENCH_H
+#define MINIGUI_BENCH_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Log pipeline benchmark configuration
+ */
+typedef struct {
+    uint32_t total_lines;      /**< Lines to ingest in total */
+    uint32_t lines_per_sec;    /**< Target ingestion rate, 0 = unthrottled */
+    uint16_t msg_len_min;      /**< Shortest generated message (chars) */
+    uint16_t msg_len_max;      /**< Longest generated message (chars) */
+    uint8_t  long_msg_pct;     /**< Share of messages forced to msg_len_max (bimodal sizes) */
+    uint16_t frame_period_ms;  /**< UI frame cadence while flooding, 0 = 33 ms */
+    uint32_t seed;             /**< PRNG seed for reproducible runs */
+} minigui_bench_log_cfg_t;
+
+/**
+ * @brief Log pipeline benchmark results
+ */
+typedef struct {
+    uint32_t lines_pushed;     /**< Lines ingested */
+    uint32_t elapsed_us;       /**< Wall time of the whole run */
+    uint32_t lines_per_sec;    /**< Sustained ingestion rate incl. UI work */
+    uint32_t ingest_p50_us;    /**< Median push latency */
+    uint32_t ingest_p99_us;    /**< 99th percentile push latency */
+    uint32_t ingest_max_us;    /**< Worst push latency */
+    uint32_t bytes_per_entry;  /**< Memory per retained entry */
+    uint32_t retained;         /**< Entries left in the store */
+    uint32_t dropped;          /**< Entries overwritten/dropped */
+    uint32_t frames;           /**< UI frames rendered while flooding */
+    uint32_t bind_avg_us;      /**< Average filter + index + table bind time */
+    uint32_t frame_avg_us;     /**< Average bind + render time per frame */
+    uint32_t frame_max_us;     /**< Worst bind + render time per frame */
+} minigui_bench_log_result_t;
+
+/**
+ * @brief Per-profile layout benchmark results
+ */
+typedef struct {
+    int32_t  hor_res;          /**< Profile design resolution */
+    int32_t  ver_res;
+    uint8_t  profile;          /**< Profile selected by minigui_layout_get() */
+    uint32_t resolve_us;       /**< First minigui_layout_get() (select + derive) */
+    uint32_t cached_us;        /**< Second minigui_layout_get() (cache hit) */
+    uint32_t views;            /**< Screens + Settings categories measured */
+    uint32_t build_us_total;   /**< Sum of build times over all views */
+    uint32_t build_us_max;     /**< Slowest view build */
+    uint32_t render_us_total;  /**< Sum of render times over all views */
+    uint32_t render_us_max;    /**< Slowest view render */
+    uint32_t obj_count_total;  /**< Objects created over all views */
+} minigui_bench_layout_result_t;
+
+/**
+ * @brief Formatting benchmark results (snprintf vs minigui_fmt)
+ */
+typedef struct {
+    uint32_t iterations;       /**< Sample sets formatted by each side */
+    uint32_t strings;          /**< Strings per sample set */
+    uint32_t snprintf_us;      /**< Total time with snprintf/strftime */
+    uint32_t fmt_us;           /**< Total time with minigui_fmt */
+    uint32_t mismatches;       /**< Strings where the two outputs differ */
+} minigui_bench_fmt_result_t;
+
+/**
+ * @brief Cost of one view built with one primitive variant
+ */
+typedef struct {
+    uint32_t obj_count;        /**< Objects in the content area */
+    uint32_t ram_bytes;        /**< LVGL heap + internal pool bytes in use after build */
+    uint32_t build_us;         /**< Screen creator time */
+    uint32_t layout_us;        /**< Full relayout of the screen (every object marked dirty) */
+    uint32_t render_us;        /**< Full refresh time */
+} minigui_bench_draw_side_t;
+
+/**
+ * @brief Per-view comparison of label objects against draw-only primitives
+ */
+typedef struct {
+    int32_t screen;                   /**< minigui_screen_t value */
+    int32_t category;                 /**< Settings category or MINIGUI_PERF_CATEGORY_DEFAULT */
+    minigui_bench_draw_side_t objects;  /**< Primitives created as objects */
+    minigui_bench_draw_side_t drawn;    /**< Primitives drawn by their host */
+} minigui_bench_draw_result_t;
+
+/**
+ * @brief Theme switch benchmark results
+ */
+typedef struct {
+    uint32_t switches;         /**< Theme switches performed */
+    uint32_t apply_avg_us;     /**< Average minigui_theme_apply() time */
+    uint32_t apply_max_us;     /**< Worst minigui_theme_apply() time */
+    uint32_t frame_avg_us;     /**< Average time of the first frame after a switch */
+    uint32_t frame_max_us;     /**< Worst time of the first frame after a switch */
+    uint32_t objects_before;   /**< Objects on the active screen before the run */
+    uint32_t objects_after;    /**< Objects on the active screen after the run */
+    bool rebuilt;              /**< Content area was recreated (must be false) */
+} minigui_bench_theme_result_t;
+
+/**
+ * @brief Settings schema benchmark results
+ */
+typedef struct {
+    uint16_t items;            /**< Items in the synthetic group */
+    uint32_t screen_build_us;  /**< Build time of the built-in Screen panel (reference) */
+    uint32_t screen_render_us;
+    uint32_t screen_objects;
+    uint32_t group_build_us;   /**< Build time of the synthetic group panel */
+    uint32_t group_render_us;
+    uint32_t group_objects;
+    uint32_t search_avg_us;    /**< Average minigui_settings_search() time */
+    uint32_t search_hits;      /**< Hits of the last query (sanity check) */
+} minigui_bench_schema_result_t;
+
+/**
+ * @brief Metrics history benchmark results
+ */
+typedef struct {
+    uint32_t rows;             /**< Rows appended (1 Hz, MINIGUI_HISTORY_SERIES values each) */
+    uint32_t rows_kept;        /**< Rows still held (the ring drops the oldest blocks) */
+    uint16_t blocks;           /**< Blocks holding them */
+    uint32_t raw_bytes;        /**< Kept rows uncompressed (timestamp + values) */
+    uint32_t stored_bytes;     /**< Kept rows compressed, block headers included */
+    uint32_t ratio_x100;       /**< raw_bytes / stored_bytes, x100 */
+    uint32_t bytes_per_row_x100; /**< stored_bytes per kept row, x100 */
+    uint32_t append_avg_ns;    /**< Average minigui_history_append() time */
+    uint32_t decode_us;        /**< Decoding every kept block */
+    uint32_t decode_rows_per_s;
+    uint32_t chart_day_us;     /**< Whole range into 240 points (every block) */
+    uint32_t chart_hour_us;    /**< Last hour into 240 points (block lookup) */
+    uint32_t mismatches;       /**< Decoded values differing from the input (must be 0) */
+} minigui_bench_history_result_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Flood the log pipeline and measure it end to end.
+ *
+ * @section call_site
+ * Called from the simulator main loop or a firmware console command after
+ * `minigui_init()`. Switches to the Logs screen and clears the log store.
+ *
+ * @section dependencies
+ * - `minigui_log_store.h`: Ingestion path.
+ * - `minigui_perf.h`: Microsecond clock.
+ * - `screen_logs.h`: Filter and table binding.
+ *
+ * @param cfg Benchmark configuration.
+ * @param result Output measurements.
+ *
+ * @section pointers
+ * - `cfg`, `result`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return true if the run completed.
+ *
+ * Implementation Steps
+ * 1. Clear the store and open the Logs screen.
+ * 2. Per frame: push the frame's share of synthetic lines, timing each push.
+ * 3. Rebind the table with a rotating source filter and render one frame.
+ * 4. Pace to the target rate, then derive throughput and percentiles.
+ ******************************************************************************/
+#if MINIGUI_ENABLE_LOGS
+bool minigui_bench_log_pipeline(const minigui_bench_log_cfg_t *cfg, minigui_bench_log_result_t *result);
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Build and render every view once per layout profile.
+ *
+ * @section call_site
+ * Called from the host simulator after `minigui_init()`. The display must
+ * accept `lv_display_set_resolution()` up to the largest profile.
+ *
+ * @section dependencies
+ * - `minigui_layout.h`: Profile table and metric cache.
+ * - `minigui_perf.h`: Per-view build/render measurement.
+ *
+ * @param disp Display to resize (NULL = default display).
+ * @param results Output array, one entry per profile.
+ * @param max_results Capacity of @p results.
+ *
+ * @section pointers
+ * - `results`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return Number of profiles measured.
+ *
+ * Implementation Steps
+ * 1. For each profile, resize the display and time the metric resolution and
+ *    a cached lookup.
+ * 2. Measure every screen and Settings category with `minigui_perf_measure`.
+ * 3. Restore the original resolution and the default screen.
+ ******************************************************************************/
+uint32_t minigui_bench_layout_profiles(lv_display_t *disp, minigui_bench_layout_result_t *results,
+                                       uint32_t max_results);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Compare snprintf against the minigui_fmt formatters.
+ *
+ * @section call_site
+ * Called from the host simulator or a firmware console command. Needs no
+ * UI and takes no lock.
+ *
+ * @section dependencies
+ * - `minigui_fmt.h`: Formatters under test.
+ * - `minigui_perf.h`: Microsecond clock.
+ *
+ * @param iterations Sample sets to format (0 = 10000).
+ * @param result Output measurements.
+ *
+ * @section pointers
+ * - `result`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return true if the run completed.
+ *
+ * Implementation Steps
+ * 1. Per sample set, format the Monitor panel lines (voltage, CPU, flash,
+ *    RAM), a byte size and the status bar clock with snprintf/strftime,
+ *    timing the whole run.
+ * 2. Repeat with minigui_fmt on the same samples.
+ * 3. Compare both outputs string by string.
+ ******************************************************************************/
+bool minigui_bench_format(uint32_t iterations, minigui_bench_fmt_result_t *result);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Measure every view with object-backed and drawn primitives.
+ *
+ * @section call_site
+ * Called from the host simulator or a firmware console command after
+ * `minigui_init()`. Rebuilds every view twice.
+ *
+ * @section dependencies
+ * - `minigui_draw.h`: Object mode switch.
+ * - `minigui_perf.h`: Per-view build/render measurement.
+ * - `minigui_alloc.h`: Internal pool usage.
+ *
+ * @param results Output array, one entry per view.
+ * @param max_results Capacity of @p results.
+ *
+ * @section pointers
+ * - `results`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return Number of views measured.
+ *
+ * Implementation Steps
+ * 1. For each screen and Settings category, build and measure it with
+ *    `minigui_draw_set_object_mode(true)`, then again with drawing.
+ * 2. After each build, time a forced relayout of the whole screen and read
+ *    the LVGL heap and internal pool usage.
+ * 3. Restore the previous mode and the default screen.
+ ******************************************************************************/
+uint32_t minigui_bench_draw_primitives(minigui_bench_draw_result_t *results, uint32_t max_results);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Alternate the built-in themes on the current screen.
+ *
+ * @section call_site
+ * Called from the host simulator or a firmware console command after
+ * `minigui_init()`, with the screen to test already shown.
+ *
+ * @section dependencies
+ * - `minigui_theme.h`: Theme switching.
+ * - `minigui_perf.h`: Microsecond clock.
+ *
+ * @param switches Number of switches (0 = 20).
+ * @param result Output measurements.
+ *
+ * @section pointers
+ * - `result`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return true if the run completed and no object was recreated.
+ *
+ * Implementation Steps
+ * 1. Count the objects of the active screen and remember the content area.
+ * 2. Per switch, time minigui_theme_apply() and the following full frame.
+ * 3. Restore the original theme and compare object count and content area.
+ ******************************************************************************/
+bool minigui_bench_theme_switch(uint32_t switches, minigui_bench_theme_result_t *result);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Open a large generated settings group next to the Screen panel.
+ *
+ * @section call_site
+ * Called from the host simulator or a firmware console command after
+ * `minigui_init()`. The registered schema is replaced for the run and
+ * registered again afterwards, which resets its values to the defaults.
+ *
+ * @section dependencies
+ * - `minigui_settings.h`: Schema registration and search.
+ * - `minigui_perf.h`: Per-view build/render measurement.
+ *
+ * @param items Items in the generated group (0 = 150).
+ * @param result Output measurements.
+ *
+ * @section pointers
+ * - `result`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return true if the run completed.
+ *
+ * Implementation Steps
+ * 1. Generate one group of mixed item types and register it.
+ * 2. Measure the Screen panel and the group panel (build, render, objects).
+ * 3. Time a set of search queries over the word index.
+ * 4. Restore the previous schema, rebuild Settings, free the generated data.
+ ******************************************************************************/
+#if MINIGUI_ENABLE_SETTINGS
+bool minigui_bench_settings_schema(uint16_t items, minigui_bench_schema_result_t *result);
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Fill a metrics history with synthetic 1 Hz rows and measure it.
+ *
+ * @section call_site
+ * Called from the host simulator or a firmware console command. Uses its
+ * own store; the sampler's history is not touched.
+ *
+ * @section dependencies
+ * - `minigui_history.h`: Store under test.
+ * - `minigui_perf.h`: Microsecond clock.
+ *
+ * @param hours Hours of rows to generate (0 = 24).
+ * @param result Output measurements.
+ *
+ * @section pointers
+ * - `result`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return true if the run completed without mismatches.
+ *
+ * Implementation Steps
+ * 1. Create a store of MINIGUI_HISTORY_BLOCKS and append the rows: slow
+ *    random walks and rare events, like device health metrics.
+ * 2. Decode every block, comparing against the regenerated input.
+ * 3. Time a whole-range and a last-hour chart read.
+ ******************************************************************************/
+bool minigui_bench_history(uint32_t hours, minigui_bench_history_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_BENCH_H
@@ -0,0 +1,266 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Build Configuration.
+ **
+ **            Resolves the compile-time feature set into MINIGUI_ENABLE_*
+ **            flags (0/1). On ESP-IDF the values come from Kconfig
+ **            (`idf.py menuconfig` -> MiniGUI). Host builds get them from the
+ **            CMake options of the same name; a plain compile with nothing
+ **            configured enables every feature.
+ **
+ **            @section minigui_config.h - Feature selection.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_CONFIG_H
+#define MINIGUI_CONFIG_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None required for this header
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ * KCONFIG MAPPING
+ ******************************************************************************
+ ******************************************************************************/
+
+// CONFIG_MINIGUI_KCONFIG is a hidden, always-on symbol: its presence means the
+// component's Kconfig was parsed, so an undefined bool really means "disabled".
+#ifdef CONFIG_MINIGUI_KCONFIG
+
+#ifdef CONFIG_MINIGUI_ENABLE_HOME
+#define MINIGUI_ENABLE_HOME 1
+#else
+#define MINIGUI_ENABLE_HOME 0
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_LOGS
+#define MINIGUI_ENABLE_LOGS 1
+#else
+#define MINIGUI_ENABLE_LOGS 0
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_SETTINGS
+#define MINIGUI_ENABLE_SETTINGS 1
+#else
+#define MINIGUI_ENABLE_SETTINGS 0
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_NETWORK
+#define MINIGUI_ENABLE_NETWORK 1
+#else
+#define MINIGUI_ENABLE_NETWORK 0
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_WIFI_FORM
+#define MINIGUI_ENABLE_WIFI_FORM 1
+#else
+#define MINIGUI_ENABLE_WIFI_FORM 0
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_NETDIAG
+#define MINIGUI_ENABLE_NETDIAG 1
+#else
+#define MINIGUI_ENABLE_NETDIAG 0
+#endif
+
+#ifdef CONFIG_MINIGUI_NETDIAG_ENDPOINT
+#define MINIGUI_NETDIAG_ENDPOINT CONFIG_MINIGUI_NETDIAG_ENDPOINT
+#endif
+
+#ifdef CONFIG_MINIGUI_WIFI_APPLY_TIMEOUT_MS
+#define MINIGUI_WIFI_APPLY_TIMEOUT_MS CONFIG_MINIGUI_WIFI_APPLY_TIMEOUT_MS
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_FIRMWARE
+#define MINIGUI_ENABLE_FIRMWARE 1
+#else
+#define MINIGUI_ENABLE_FIRMWARE 0
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_MONITOR
+#define MINIGUI_ENABLE_MONITOR 1
+#else
+#define MINIGUI_ENABLE_MONITOR 0
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_MOCKS
+#define MINIGUI_ENABLE_MOCKS 1
+#else
+#define MINIGUI_ENABLE_MOCKS 0
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_METRICS
+#define MINIGUI_ENABLE_METRICS 1
+#else
+#define MINIGUI_ENABLE_METRICS 0
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_DEV_TOOLS
+#define MINIGUI_ENABLE_DEV_TOOLS 1
+#else
+#define MINIGUI_ENABLE_DEV_TOOLS 0
+#endif
+
+#ifdef CONFIG_MINIGUI_ENABLE_MIRROR
+#define MINIGUI_ENABLE_MIRROR 1
+#else
+#define MINIGUI_ENABLE_MIRROR 0
+#endif
+
+#if defined(CONFIG_MINIGUI_USE_MOCK_LOGS) && !defined(MINIGUI_USE_MOCK_LOGS)
+#define MINIGUI_USE_MOCK_LOGS 1
+#endif
+
+#ifdef CONFIG_MINIGUI_TITLE_FONT_24
+#define MINIGUI_FONT_TITLE (&lv_font_montserrat_24)
+#endif
+
+#ifdef CONFIG_MINIGUI_ABSOLUTE_LAYOUT
+#define MINIGUI_ABSOLUTE_LAYOUT 1
+#endif
+
+#endif // CONFIG_MINIGUI_KCONFIG
+
+/******************************************************************************
+ ******************************************************************************
+ * DEFAULTS (everything enabled)
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Screens (each one drops its source file, menu entry and fonts)
+ */
+#ifndef MINIGUI_ENABLE_HOME
+#define MINIGUI_ENABLE_HOME 1
+#endif
+
+#ifndef MINIGUI_ENABLE_LOGS
+#define MINIGUI_ENABLE_LOGS 1
+#endif
+
+#ifndef MINIGUI_ENABLE_SETTINGS
+#define MINIGUI_ENABLE_SETTINGS 1
+#endif
+
+/**
+ * @brief Settings panels
+ */
+#ifndef MINIGUI_ENABLE_NETWORK
+#define MINIGUI_ENABLE_NETWORK 1        /**< Network panel (connection status) */
+#endif
+
+#ifndef MINIGUI_ENABLE_WIFI_FORM
+#define MINIGUI_ENABLE_WIFI_FORM 1      /**< Scan/password/save form and the on-screen keyboard */
+#endif
+
+#ifndef MINIGUI_ENABLE_NETDIAG
+#define MINIGUI_ENABLE_NETDIAG 1        /**< Latency/throughput diagnostics in the Network panel */
+#endif
+
+#ifndef MINIGUI_NETDIAG_ENDPOINT
+#define MINIGUI_NETDIAG_ENDPOINT "192.168.1.1"  /**< Diagnostics endpoint until one is stored */
+#endif
+
+#ifndef MINIGUI_ENABLE_FIRMWARE
+#define MINIGUI_ENABLE_FIRMWARE 1       /**< Firmware section of the System panel */
+#endif
+
+#ifndef MINIGUI_WIFI_APPLY_TIMEOUT_MS
+#define MINIGUI_WIFI_APPLY_TIMEOUT_MS 30000  /**< Credential apply without a final stage ends as Timed out */
+#endif
+
+#ifndef MINIGUI_ENABLE_MONITOR
+#define MINIGUI_ENABLE_MONITOR 1        /**< Monitor panel and its refresh timer */
+#endif
+
+/**
+ * @brief Built-in mock providers used when no hardware provider is registered
+ */
+#ifndef MINIGUI_ENABLE_MOCKS
+#define MINIGUI_ENABLE_MOCKS 1
+#endif
+
+/**
+ * @brief Frame/provider timings and the Prometheus dump (minigui_metrics.h)
+ */
+#ifndef MINIGUI_ENABLE_METRICS
+#define MINIGUI_ENABLE_METRICS 1
+#endif
+
+/**
+ * @brief Perf hooks, benchmarks and simulators (minigui_perf.h, minigui_bench.h, minigui_sim.h)
+ */
+#ifndef MINIGUI_ENABLE_DEV_TOOLS
+#define MINIGUI_ENABLE_DEV_TOOLS 1
+#endif
+
+/**
+ * @brief Remote screen mirror over a socket (minigui_mirror.h)
+ */
+#ifndef MINIGUI_ENABLE_MIRROR
+#define MINIGUI_ENABLE_MIRROR 0
+#endif
+
+/**
+ * @brief Status bar title font (24 px lets Montserrat 36 drop out when Home is off)
+ */
+#ifndef MINIGUI_FONT_TITLE
+#define MINIGUI_FONT_TITLE (&lv_font_montserrat_36)
+#endif
+
+/**
+ * @brief Replay recorded flex results as absolute positions (fixed-resolution products)
+ */
+#ifndef MINIGUI_ABSOLUTE_LAYOUT
+#define MINIGUI_ABSOLUTE_LAYOUT 0
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * CONSISTENCY CHECKS
+ ******************************************************************************
+ ******************************************************************************/
+
+#if !MINIGUI_ENABLE_HOME && !MINIGUI_ENABLE_LOGS && !MINIGUI_ENABLE_SETTINGS
+#error "minigui: at least one screen must be enabled"
+#endif
+
+// Panels only exist inside their parents
+#if !MINIGUI_ENABLE_SETTINGS
+#undef MINIGUI_ENABLE_NETWORK
+#define MINIGUI_ENABLE_NETWORK 0
+#undef MINIGUI_ENABLE_FIRMWARE
+#define MINIGUI_ENABLE_FIRMWARE 0
+#undef MINIGUI_ENABLE_MONITOR
+#define MINIGUI_ENABLE_MONITOR 0
+#endif
+
+#if !MINIGUI_ENABLE_NETWORK
+#undef MINIGUI_ENABLE_WIFI_FORM
+#define MINIGUI_ENABLE_WIFI_FORM 0
+#undef MINIGUI_ENABLE_NETDIAG
+#define MINIGUI_ENABLE_NETDIAG 0
+#endif
+
+#endif // MINIGUI_CONFIG_H
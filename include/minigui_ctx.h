@@ -0,0 +1,201 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Instance Contexts.
+ **
+ **            A context is one complete UI (status bar, menu drawer, content
+ **            area and the open screen) bound to one lv_display_t. Several
+ **            contexts can run side by side, one per panel. Providers, the
+ **            log store and other data sources stay process-wide and are
+ **            shared by every context; each context only owns its views.
+ **
+ **            The legacy single-display API (minigui_init,
+ **            minigui_switch_screen, ...) operates on the default context.
+ **
+ **            @section minigui_ctx.h - Multi-display instance interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_CTX_H
+#define MINIGUI_CTX_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Maximum number of contexts alive at once
+ */
+#ifndef MINIGUI_MAX_CONTEXTS
+#define MINIGUI_MAX_CONTEXTS 2
+#endif
+
+/**
+ * @brief Opaque UI instance bound to one display
+ */
+typedef struct minigui_ctx minigui_ctx_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Create a UI instance on a display.
+ *
+ * @section call_site
+ * Called once per panel at startup, after the display has been created.
+ * `minigui_init()` calls it for the default display.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Display screen and top layer.
+ * - `minigui_alloc.h`: Context storage (internal pool).
+ *
+ * @param disp Display to bind to, or NULL for the default display.
+ *
+ * @section pointers
+ * - `disp`: Owned by the application; must outlive the context.
+ *
+ * @section variables
+ * - None
+ *
+ * @return The context, or NULL if the display already has one, all
+ *         MINIGUI_MAX_CONTEXTS slots are taken, or allocation failed.
+ *
+ * Implementation Steps
+ * 1. Acquire the LVGL lock and reject duplicates / full registry.
+ * 2. Build the skeleton on the display's active screen and the menu on its
+ *    top layer, sized from that display's layout profile.
+ * 3. Register the context; the first one becomes the default.
+ * 4. Start the shared clock timer if this is the first context.
+ * 5. Show MINIGUI_SCREEN_DEFAULT.
+ ******************************************************************************/
+minigui_ctx_t *minigui_ctx_create(lv_display_t *disp);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Destroy a UI instance and every object it created.
+ *
+ * @section call_site
+ * Called when a panel is unplugged or shut down.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Object deletion.
+ *
+ * @param ctx Context to destroy (NULL is ignored).
+ *
+ * @section pointers
+ * - `ctx`: Invalid after the call.
+ *
+ * @section variables
+ * - None
+ *
+ * @return void
+ *
+ * Implementation Steps
+ * 1. Unregister the context so view callbacks no longer resolve it.
+ * 2. Delete the skeleton (views free their state on LV_EVENT_DELETE) and
+ *    the menu.
+ * 3. Stop the shared clock timer with the last context.
+ ******************************************************************************/
+void minigui_ctx_destroy(minigui_ctx_t *ctx);
+
+/**
+ * @brief Show a screen in a context's content area
+ *
+ * @param ctx Target context
+ * @param screen Screen ID
+ */
+void minigui_ctx_switch_screen(minigui_ctx_t *ctx, minigui_screen_t screen);
+
+/**
+ * @brief Open or close a context's navigation drawer
+ */
+void minigui_ctx_toggle_menu(minigui_ctx_t *ctx);
+
+/**
+ * @brief Context used by the legacy single-display API (NULL before init)
+ */
+minigui_ctx_t *minigui_ctx_get_default(void);
+
+/**
+ * @brief Context that owns an object, resolved through the object's display
+ *
+ * Event handlers use this to find their instance without per-object state.
+ *
+ * @param obj Any object on a context's screen or top layer
+ * @return The context, or NULL if the display has none
+ */
+minigui_ctx_t *minigui_ctx_from_obj(const lv_obj_t *obj);
+
+/**
+ * @brief Display a context is bound to
+ */
+lv_display_t *minigui_ctx_get_display(const minigui_ctx_t *ctx);
+
+/**
+ * @brief Content area of a context
+ */
+lv_obj_t *minigui_ctx_get_content_area(const minigui_ctx_t *ctx);
+
+/**
+ * @brief Screen currently shown by a context
+ */
+minigui_screen_t minigui_ctx_get_screen(const minigui_ctx_t *ctx);
+
+/**
+ * @brief Attach the open screen's state to its context
+ *
+ * Called by screen creators. The screen owns @p view and frees it when its
+ * objects are deleted; minigui drops the reference before every screen
+ * switch.
+ *
+ * @param ctx Context the screen was built in
+ * @param view Screen state, or NULL to detach
+ */
+void minigui_ctx_set_view(minigui_ctx_t *ctx, void *view);
+
+/**
+ * @brief State of the open screen, if it is @p screen
+ *
+ * @param ctx Context (NULL returns NULL)
+ * @param screen Expected screen ID
+ * @return The view registered by that screen, or NULL
+ */
+void *minigui_ctx_get_view(const minigui_ctx_t *ctx, minigui_screen_t screen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_CTX_H
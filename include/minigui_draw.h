@@ -0,0 +1,157 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Draw-Only Primitives.
+ **
+ **            Static text blocks, key/value rows and separators that are
+ **            painted in their host object's draw event instead of being
+ **            objects of their own. A panel of N status lines costs one
+ **            object plus a small item array, and there is nothing for the
+ **            flex layout or the style system to process per line.
+ **
+ **            Items without an alignment flow top to bottom in the host's
+ **            content area, separated by the host's row gap (like a flex
+ **            column); aligned items are placed inside the content area and
+ **            do not take part in the flow. The host reports the flow's size
+ **            as its self size, so LV_SIZE_CONTENT works.
+ **
+ **            @section minigui_draw.h - Draw-only primitive interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_DRAW_H
+#define MINIGUI_DRAW_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Capacity of a key/value row's value (including the terminator)
+ *
+ * Fits a 32-byte SSID and the Monitor panel's "used / total KB (pct%)".
+ */
+#ifndef MINIGUI_DRAW_VALUE_LEN
+#define MINIGUI_DRAW_VALUE_LEN 40
+#endif
+
+/**
+ * @brief Opaque item list attached to a host object
+ */
+typedef struct minigui_draw_list minigui_draw_list_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Attach an item list to a host object.
+ *
+ * @section call_site
+ * Called by panel builders right after creating the host container.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Draw and self-size events.
+ * - `minigui_alloc.h`: Item storage (internal pool).
+ *
+ * @param host     Object whose draw event paints the items.
+ * @param capacity Maximum number of items.
+ *
+ * @section pointers
+ * - `host`: The list is freed on the host's LV_EVENT_DELETE.
+ *
+ * @section variables
+ * - None
+ *
+ * @return The list, or NULL if allocation failed.
+ *
+ * Implementation Steps
+ * 1. Allocate the list header and item array in one block.
+ * 2. Hook LV_EVENT_DRAW_MAIN, LV_EVENT_GET_SELF_SIZE and LV_EVENT_DELETE
+ *    (in object mode only LV_EVENT_DELETE, and the host becomes a flex
+ *    column for the fallback objects).
+ ******************************************************************************/
+minigui_draw_list_t *minigui_draw_attach(lv_obj_t *host, uint8_t capacity);
+
+/**
+ * @brief Add a static text block (not copied; may contain '\n')
+ *
+ * @param font NULL for the host's font
+ * @param align LV_ALIGN_DEFAULT to flow, otherwise placed in the content area
+ * @param margin_bottom Extra space below a flowing item
+ * @return Item index, or -1 if the list is full
+ */
+int32_t minigui_draw_add_text(minigui_draw_list_t *list, const char *text, const lv_font_t *font,
+                              lv_align_t align, int32_t margin_bottom);
+
+/**
+ * @brief Add a flowing "key value" row in the host's font
+ *
+ * The key is static (not copied) and measured once; the value is copied
+ * and can be replaced with minigui_draw_set_value().
+ *
+ * @return Item index, or -1 if the list is full
+ */
+int32_t minigui_draw_add_kv(minigui_draw_list_t *list, const char *key, const char *value,
+                            int32_t margin_bottom);
+
+/**
+ * @brief Add a flowing 1px full-width separator
+ *
+ * @return Item index, or -1 if the list is full
+ */
+int32_t minigui_draw_add_separator(minigui_draw_list_t *list, int32_t margin_top, int32_t margin_bottom);
+
+/**
+ * @brief Replace a key/value row's value and invalidate only that row
+ */
+void minigui_draw_set_value(minigui_draw_list_t *list, int32_t item, const char *value);
+
+/**
+ * @brief Create real label/separator objects instead of drawing (A/B measurement)
+ *
+ * Affects lists attached afterwards; existing lists keep their mode.
+ */
+void minigui_draw_set_object_mode(bool enable);
+
+/**
+ * @brief Whether new lists create real objects
+ */
+bool minigui_draw_get_object_mode(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_DRAW_H
@@ -0,0 +1,147 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Number Formatting.
+ **
+ **            Integer-only formatters for the values the UI shows every second
+ **            (voltages, percentages, sizes, clock and durations). They write
+ **            into caller buffers without going through the printf machinery,
+ **            so the float printf support in newlib is never pulled in by the
+ **            UI and no format string is parsed at run time.
+ **
+ **            Every function writes at most size - 1 characters, always
+ **            terminates the buffer (if size > 0) and returns the number of
+ **            characters written, so calls can be chained:
+ **
+ **                n  = minigui_fmt_str(buf, sizeof(buf), "Voltage: ");
+ **                n += minigui_fmt_fixed(buf + n, sizeof(buf) - n, mv / 10, 2);
+ **
+ **            @section minigui_fmt.h - Fixed-point formatting interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_FMT_H
+#define MINIGUI_FMT_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Copy a string
+ */
+size_t minigui_fmt_str(char *buf, size_t size, const char *str);
+
+/**
+ * @brief Unsigned decimal
+ */
+size_t minigui_fmt_u32(char *buf, size_t size, uint32_t value);
+
+/**
+ * @brief Signed decimal
+ */
+size_t minigui_fmt_i32(char *buf, size_t size, int32_t value);
+
+/**
+ * @brief Unsigned decimal, zero-padded to at least @p width digits
+ */
+size_t minigui_fmt_u32_pad(char *buf, size_t size, uint32_t value, uint8_t width);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Fixed-point decimal.
+ *
+ * @section call_site
+ * Used for values kept as scaled integers (millivolts, tenths of a degree).
+ *
+ * @section dependencies
+ * - None
+ *
+ * @param buf      Output buffer.
+ * @param size     Capacity of @p buf.
+ * @param value    Value scaled by 10^decimals (e.g. 330 with 2 -> "3.30").
+ * @param decimals Digits after the decimal point (0..9).
+ *
+ * @section pointers
+ * - `buf`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return Characters written.
+ *
+ * Implementation Steps
+ * 1. Emit the sign, then the integer part of |value| / 10^decimals.
+ * 2. Emit the point and the fraction zero-padded to @p decimals digits.
+ ******************************************************************************/
+size_t minigui_fmt_fixed(char *buf, size_t size, int32_t value, uint8_t decimals);
+
+/**
+ * @brief Float rounded half away from zero to @p decimals digits (0..6)
+ *
+ * Converts once to a scaled integer and calls minigui_fmt_fixed(), which
+ * costs one float multiply instead of printf's float path. Values outside
+ * the int32 range after scaling are clamped.
+ */
+size_t minigui_fmt_float(char *buf, size_t size, float value, uint8_t decimals);
+
+/**
+ * @brief Percentage "NN%" of @p part in @p total, truncated; "0%" if total is 0
+ */
+size_t minigui_fmt_percent(char *buf, size_t size, uint32_t part, uint32_t total);
+
+/**
+ * @brief Byte size with a binary unit: "512 B", "1.5 KB", "23.4 MB", "120 MB"
+ *
+ * One decimal (rounded) below 100 units, whole units above.
+ */
+size_t minigui_fmt_bytes(char *buf, size_t size, uint64_t bytes);
+
+/**
+ * @brief "HH:MM:SS" (hours grow beyond two digits if needed)
+ */
+size_t minigui_fmt_hms(char *buf, size_t size, uint32_t seconds);
+
+/**
+ * @brief Short duration: "45s", "2m 05s", "1h 05m", "3d 04h"
+ */
+size_t minigui_fmt_duration(char *buf, size_t size, uint32_t seconds);
+
+/**
+ * @brief Status bar clock: "Sat 02/07 12:08:45" (strftime "%a %m/%d %H:%M:%S")
+ */
+size_t minigui_fmt_clock(char *buf, size_t size, const struct tm *tm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_FMT_H
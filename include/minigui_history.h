@@ -0,0 +1,273 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Metrics History.
+ **
+ **            Long-term time series of up to MINIGUI_HISTORY_SERIES metrics
+ **            sampled together. Rows are compressed into fixed-size blocks:
+ **            timestamps as delta-of-delta, values as XOR against the
+ **            previous value with a reused bit window. Every block starts
+ **            with raw values, so a chart can decode just the blocks covering
+ **            its time range. When the ring is full the oldest block is
+ **            dropped.
+ **
+ **            @section minigui_history.h - Metrics history interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_HISTORY_H
+#define MINIGUI_HISTORY_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Values per row
+ *
+ * Series ids follow minigui_metric_t (minigui_alert.h): the sampler fills
+ * voltage, CPU, RAM and flash; the rest are set by the application.
+ */
+#ifndef MINIGUI_HISTORY_SERIES
+#define MINIGUI_HISTORY_SERIES 8
+#endif
+
+/**
+ * @brief Block size in bytes (header included, multiple of 4, at most 8192)
+ */
+#ifndef MINIGUI_HISTORY_BLOCK_BYTES
+#define MINIGUI_HISTORY_BLOCK_BYTES 1024
+#endif
+
+/**
+ * @brief Blocks of the sampler's store (PSRAM pool)
+ */
+#ifndef MINIGUI_HISTORY_BLOCKS
+#define MINIGUI_HISTORY_BLOCKS 64
+#endif
+
+/**
+ * @brief Sampler period
+ */
+#ifndef MINIGUI_HISTORY_PERIOD_MS
+#define MINIGUI_HISTORY_PERIOD_MS 1000
+#endif
+
+/**
+ * @brief A history store (opaque)
+ */
+typedef struct minigui_history minigui_history_t;
+
+/**
+ * @brief One decoded row
+ */
+typedef void (*minigui_history_row_cb_t)(void *ctx, uint32_t time_s, const int32_t *values);
+
+/**
+ * @brief One block, for random access
+ */
+typedef struct {
+    uint32_t first_s;                 /**< Time of the first row */
+    uint32_t last_s;                  /**< Time of the last row */
+    uint16_t rows;
+    uint16_t bytes;                   /**< Header and compressed rows */
+} minigui_history_block_t;
+
+/**
+ * @brief Aggregate of one series over one step (chart point)
+ */
+typedef struct {
+    uint32_t time_s;                  /**< Start of the step */
+    int32_t min;
+    int32_t max;
+    int32_t avg;
+    uint16_t rows;
+} minigui_history_point_t;
+
+/**
+ * @brief Store counters
+ */
+typedef struct {
+    uint32_t rows;                    /**< Rows held */
+    uint32_t rows_total;              /**< Rows appended since creation */
+    uint32_t raw_bytes;               /**< Rows held x (timestamp + values), uncompressed */
+    uint32_t used_bytes;              /**< Header and payload bytes of the held blocks */
+    uint32_t capacity_bytes;
+    uint16_t blocks;                  /**< Blocks in use */
+    uint16_t dropped_blocks;          /**< Oldest blocks overwritten */
+    uint32_t first_s;                 /**< Oldest row held */
+    uint32_t last_s;                  /**< Newest row */
+} minigui_history_stats_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Create a store of @p blocks x MINIGUI_HISTORY_BLOCK_BYTES (PSRAM pool)
+ *
+ * Stores are not locked; use each one from a single task (the sampler's
+ * store from the LVGL task).
+ *
+ * @return NULL if memory is short
+ */
+minigui_history_t *minigui_history_create(uint16_t blocks);
+
+/** @brief Free a store (NULL is ignored) */
+void minigui_history_destroy(minigui_history_t *history);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Append one row.
+ *
+ * @section call_site
+ * Called by the sampler timer, the benchmark or application code.
+ *
+ * @section dependencies
+ * - None
+ *
+ * @param history Store.
+ * @param time_s Row time in seconds, not older than the previous row (use
+ *               a clock that does not wrap, e.g. minigui_history_now_s()).
+ * @param values MINIGUI_HISTORY_SERIES values.
+ *
+ * @section pointers
+ * - `values`: Read-only, copied into the block.
+ *
+ * @section variables
+ * - None
+ *
+ * @return false if @p time_s goes backwards.
+ *
+ * Implementation Steps
+ * 1. Encode the row into the open block.
+ * 2. If it does not fit, roll it back and open a new block (dropping the
+ *    oldest when the ring is full) that holds the row raw in its header.
+ ******************************************************************************/
+bool minigui_history_append(minigui_history_t *history, uint32_t time_s, const int32_t *values);
+
+/** @brief Blocks in use (index 0 is the oldest) */
+uint16_t minigui_history_block_count(const minigui_history_t *history);
+
+/** @brief Describe block @p index; false if out of range */
+bool minigui_history_block_info(const minigui_history_t *history, uint16_t index, minigui_history_block_t *info);
+
+/**
+ * @brief Index of the first block whose rows reach @p time_s (binary search)
+ *
+ * @return Block index, or minigui_history_block_count() if all rows are older
+ */
+uint16_t minigui_history_find_block(const minigui_history_t *history, uint32_t time_s);
+
+/**
+ * @brief Decode block @p index, calling @p cb for each row in time order
+ *
+ * @return Rows decoded
+ */
+uint32_t minigui_history_decode_block(const minigui_history_t *history, uint16_t index,
+                                      minigui_history_row_cb_t cb, void *ctx);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Aggregate one series into chart points.
+ *
+ * @section call_site
+ * Called by chart code.
+ *
+ * @section dependencies
+ * - None
+ *
+ * @param history Store.
+ * @param series Series index.
+ * @param from_s First second of the range.
+ * @param to_s Last second of the range (inclusive).
+ * @param step_s Seconds per point (0 = 1).
+ * @param points Output points.
+ * @param max Capacity of @p points.
+ *
+ * @section pointers
+ * - `points`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return Points written. Steps without rows are skipped; use time_s to
+ *         place the points.
+ *
+ * Implementation Steps
+ * 1. Find the first block reaching @p from_s.
+ * 2. Decode blocks until one starts after @p to_s, folding each row into
+ *    the min/max/avg of its step.
+ ******************************************************************************/
+size_t minigui_history_read(const minigui_history_t *history, uint8_t series, uint32_t from_s, uint32_t to_s,
+                            uint32_t step_s, minigui_history_point_t *points, size_t max);
+
+/** @brief Copy the store counters */
+void minigui_history_get_stats(const minigui_history_t *history, minigui_history_stats_t *stats);
+
+/**
+ * @brief Start sampling minigui_get_system_stats() into the default store
+ *
+ * Creates the store (MINIGUI_HISTORY_BLOCKS) on first use and appends a
+ * row every MINIGUI_HISTORY_PERIOD_MS, timestamped with
+ * minigui_history_now_s().
+ * Voltage is recorded in mV.
+ *
+ * @return false if memory is short
+ */
+bool minigui_history_start(void);
+
+/**
+ * @brief Uptime in seconds, carried across the lv_tick wrap (~49.7 days)
+ *
+ * The sampler's timestamps; use it for the ranges passed to
+ * minigui_history_read(). Must be called at least once per wrap period,
+ * which the running sampler does.
+ */
+uint32_t minigui_history_now_s(void);
+
+/** @brief Stop sampling (the store and its rows are kept) */
+void minigui_history_stop(void);
+
+/** @brief Default store, NULL before minigui_history_start() */
+minigui_history_t *minigui_history_get(void);
+
+/** @brief Set an application series; the sampler records it until changed (any task) */
+void minigui_history_set(uint8_t series, int32_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_HISTORY_H
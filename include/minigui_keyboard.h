@@ -0,0 +1,102 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI On-Screen Keyboard Service.
+ **
+ **            One keyboard per display, created the first time a text area
+ **            on that display is focused and kept on the display's top layer
+ **            afterwards. Screens do not own a keyboard; they hand their text
+ **            areas to the service, which attaches the cached keyboard to
+ **            whichever one asks and detaches it when that text area is
+ **            deleted. Screens that are never typed into cost nothing.
+ **
+ **            @section minigui_keyboard.h - Shared keyboard interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_KEYBOARD_H
+#define MINIGUI_KEYBOARD_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Show the display's keyboard and attach it to a text area.
+ *
+ * @section call_site
+ * Called from a text area's LV_EVENT_FOCUSED handler (or use
+ * `minigui_keyboard_focus_cb` directly as that handler).
+ *
+ * @section dependencies
+ * - `lvgl.h`: Keyboard widget, display top layer.
+ *
+ * @param ta Text area to type into.
+ *
+ * @section pointers
+ * - `ta`: Owned by its screen; the keyboard detaches on its LV_EVENT_DELETE.
+ *
+ * @section variables
+ * - None
+ *
+ * @return void
+ *
+ * Implementation Steps
+ * 1. Find the keyboard slot of @p ta's display, creating the keyboard on
+ *    the top layer (below the menu drawer) on first use.
+ * 2. Move the delete hook from the previous text area to @p ta.
+ * 3. Attach and unhide the keyboard.
+ ******************************************************************************/
+void minigui_keyboard_show(lv_obj_t *ta);
+
+/**
+ * @brief Hide a display's keyboard and detach it from its text area
+ *
+ * @param disp Display, or NULL for the default display
+ */
+void minigui_keyboard_hide(lv_display_t *disp);
+
+/**
+ * @brief Ready-made LV_EVENT_FOCUSED handler for text areas (node tables)
+ */
+void minigui_keyboard_focus_cb(lv_event_t *e);
+
+/**
+ * @brief Whether a display's keyboard has been created yet
+ *
+ * @param disp Display, or NULL for the default display
+ */
+bool minigui_keyboard_is_created(lv_display_t *disp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_KEYBOARD_H
@@ -0,0 +1,183 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Layout Profiles.
+ **
+ **            Pixel metrics (status bar, menu drawer, home cards, Logs header
+ **            and columns, Settings navigation) come from a profile table
+ **            covering 480x272 to 1280x800. The metrics are resolved once per
+ **            display resolution and cached; screen builders read the cached
+ **            values instead of hard-coded 800x480 positions.
+ **
+ **            @section minigui_layout.h - Resolution-dependent metrics.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_LAYOUT_H
+#define MINIGUI_LAYOUT_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Padding of the Logs header container (px)
+ */
+#define MINIGUI_LAYOUT_LOGS_HEADER_PAD 5
+
+/**
+ * @brief Number of resolutions cached at once (one per driven display)
+ */
+#ifndef MINIGUI_LAYOUT_CACHE_SLOTS
+#define MINIGUI_LAYOUT_CACHE_SLOTS 2
+#endif
+
+/**
+ * @brief Resolved layout metrics for one display resolution
+ *
+ * Fixed sizes come from the selected profile; positions that depend on the
+ * screen edge (right-aligned Logs controls) are derived from the actual
+ * resolution.
+ */
+typedef struct {
+    int16_t hor_res;              /**< Resolution the metrics were resolved for */
+    int16_t ver_res;
+    uint8_t profile;              /**< Index of the selected profile */
+
+    // Status bar
+    uint8_t status_bar_pct;       /**< Status bar height, % of screen height */
+    int16_t clock_w;              /**< Clock label width */
+
+    // Menu drawer
+    int16_t drawer_w;             /**< Drawer width (also its hidden x offset) */
+    int16_t menu_btn_h;           /**< Navigation button height */
+    int16_t menu_btn_top;         /**< Y of the first navigation button */
+    int16_t menu_btn_pitch;       /**< Distance between navigation buttons */
+
+    // Home screen
+    int16_t card_w;               /**< Info card width */
+    int16_t card_h;               /**< Info card height */
+
+    // Logs screen
+    int16_t logs_header_h;        /**< Header bar height */
+    int16_t logs_header_label_w;  /**< Column caption width */
+    int16_t logs_ctrl_y;          /**< Y of caption, filter and refresh */
+    int16_t logs_ctrl_h;          /**< Height of caption, filter and refresh */
+    int16_t logs_filter_w;        /**< Filter dropdown width */
+    int16_t logs_filter_x;        /**< Filter dropdown x (derived) */
+    int16_t logs_refresh_w;       /**< Refresh button width */
+    int16_t logs_refresh_x;       /**< Refresh button x (derived) */
+    int16_t logs_col_time;        /**< Time column width */
+    int16_t logs_col_source;      /**< Source column width */
+    int16_t logs_col_level;       /**< Level column width */
+
+    // Settings screen
+    int16_t nav_pane_w;           /**< Category navigation pane width */
+} minigui_layout_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Layout metrics for a display.
+ *
+ * @section call_site
+ * Called by screen builders with the LVGL lock held, passing the display
+ * their parent object lives on.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Display resolution.
+ *
+ * @param disp Display, or NULL for the default display.
+ *
+ * @section pointers
+ * - `disp`: Owned by LVGL.
+ * - Returned pointer refers to an internal cache slot, valid until more
+ *   distinct resolutions than MINIGUI_LAYOUT_CACHE_SLOTS have been seen.
+ *
+ * @section variables
+ * - None
+ *
+ * @return Cached metrics (computed once per resolution).
+ *
+ * Implementation Steps
+ * 1. Read the display's resolution (800x480 if there is none).
+ * 2. Return the slot resolved for the same resolution, if any.
+ * 3. Otherwise call `minigui_layout_compute` into a free or recycled slot.
+ ******************************************************************************/
+const minigui_layout_t *minigui_layout_get_for(lv_display_t *disp);
+
+/**
+ * @brief Layout metrics for the default display (minigui_layout_get_for(NULL))
+ */
+const minigui_layout_t *minigui_layout_get(void);
+
+/**
+ * @brief Resolve metrics for an arbitrary resolution (no caching)
+ *
+ * Selects the largest profile that fits inside @p hor_res x @p ver_res, or
+ * the smallest profile for displays below 480x272.
+ *
+ * @param hor_res Horizontal resolution (px)
+ * @param ver_res Vertical resolution (px)
+ * @param out Output metrics
+ */
+void minigui_layout_compute(int32_t hor_res, int32_t ver_res, minigui_layout_t *out);
+
+/**
+ * @brief Drop the cached metrics so the next minigui_layout_get() recomputes
+ */
+void minigui_layout_invalidate(void);
+
+/**
+ * @brief Number of entries in the profile table
+ */
+uint32_t minigui_layout_get_profile_count(void);
+
+/**
+ * @brief Design resolution of a profile
+ *
+ * @param index Profile index
+ * @param hor_res Output horizontal resolution
+ * @param ver_res Output vertical resolution
+ * @return false if @p index is out of range
+ */
+bool minigui_layout_get_profile_resolution(uint32_t index, int32_t *hor_res, int32_t *ver_res);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_LAYOUT_H
@@ -0,0 +1,243 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Locking & Lock Contention Profiler.
+ **
+ **            All minigui code takes the LVGL lock through MINIGUI_LOCK() /
+ **            MINIGUI_UNLOCK(). In normal builds these are plain lv_lock() /
+ **            lv_unlock(). With MINIGUI_LOCK_PROFILING defined they record
+ **            wait time, hold time, holder identity and recursion depth per
+ **            call site, and can report the worst offenders.
+ **
+ **            @section minigui_lock.h - Lock wrapper and profiler interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_LOCK_H
+#define MINIGUI_LOCK_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Maximum number of distinct call sites tracked by the profiler
+ */
+#ifndef MINIGUI_LOCK_PROF_MAX_SITES
+#define MINIGUI_LOCK_PROF_MAX_SITES 32
+#endif
+
+/**
+ * @brief Wait time (us) above which an acquisition counts as contended
+ */
+#ifndef MINIGUI_LOCK_PROF_CONTENDED_US
+#define MINIGUI_LOCK_PROF_CONTENDED_US 1000
+#endif
+
+/**
+ * @brief Callback returning an identity for the calling task/thread
+ */
+typedef void *(*minigui_lock_thread_id_cb_t)(void);
+
+/**
+ * @brief Microsecond clock for wait and hold times
+ */
+typedef uint32_t (*minigui_lock_clock_t)(void);
+
+/**
+ * @brief Callback receiving one line of the profiler report
+ * @param line Null-terminated text line (no trailing newline)
+ * @param user User pointer passed to minigui_lock_prof_report()
+ */
+typedef void (*minigui_lock_report_cb_t)(const char *line, void *user);
+
+/**
+ * @brief Per call site lock statistics
+ */
+typedef struct {
+    const char *site;          /**< Function that took the lock */
+    uint32_t acquisitions;     /**< Times the lock was taken here */
+    uint32_t nested;           /**< Acquisitions while the lock was already held (recursive path) */
+    uint32_t contended;        /**< Acquisitions that waited >= MINIGUI_LOCK_PROF_CONTENDED_US */
+    uint32_t ui_thread;        /**< Acquisitions made from the registered UI thread */
+    uint32_t wait_total_us;    /**< Accumulated wait time */
+    uint32_t wait_max_us;      /**< Worst wait time */
+    uint32_t hold_total_us;    /**< Accumulated hold time */
+    uint32_t hold_max_us;      /**< Worst hold time */
+    uint8_t  max_depth;        /**< Deepest recursion level observed */
+    void    *last_holder;      /**< Identity of the last holder */
+} minigui_lock_site_stats_t;
+
+/******************************************************************************
+ ******************************************************************************
+ * LOCK MACROS
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifdef MINIGUI_LOCK_PROFILING
+#define MINIGUI_LOCK()   minigui_lock_prof_acquire(__func__)
+#define MINIGUI_UNLOCK() minigui_lock_prof_release()
+#else
+#define MINIGUI_LOCK()   lv_lock()
+#define MINIGUI_UNLOCK() lv_unlock()
+#endif
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Take the LVGL lock and record statistics for a call site.
+ *
+ * @section call_site
+ * Via MINIGUI_LOCK() when MINIGUI_LOCK_PROFILING is defined.
+ *
+ * @section dependencies
+ * - `lvgl.h`: The underlying recursive lock.
+ * - None
+ *
+ * @param site Static name of the calling function (`__func__`).
+ *
+ * @section pointers
+ * - `site`: Must have static storage duration; stored by reference.
+ *
+ * @section variables
+ * - None
+ *
+ * @return void
+ *
+ * Implementation Steps
+ * 1. Time lv_lock() to obtain the wait time.
+ * 2. Increase the recursion depth and remember site and hold start.
+ * 3. Update acquisition, nesting, contention and holder statistics.
+ ******************************************************************************/
+void minigui_lock_prof_acquire(const char *site);
+
+/**
+ * @brief Release the LVGL lock and record the hold time
+ *
+ * @section call_site
+ * Via MINIGUI_UNLOCK() when MINIGUI_LOCK_PROFILING is defined.
+ */
+void minigui_lock_prof_release(void);
+
+/**
+ * @brief Run lv_timer_handler() as a profiled lock site
+ *
+ * @section call_site
+ * Call from the LVGL task loop instead of lv_timer_handler(). Event callbacks
+ * that re-enter public minigui APIs (e.g. nav_btn_cb -> minigui_switch_screen)
+ * then show up as nested acquisitions.
+ *
+ * @return Value returned by lv_timer_handler()
+ */
+uint32_t minigui_lock_prof_timer_handler(void);
+
+/**
+ * @brief Register a microsecond clock (e.g. esp_timer_get_time), NULL for lv_tick
+ *
+ * @param clock Clock callback
+ */
+void minigui_lock_prof_set_clock(minigui_lock_clock_t clock);
+
+/**
+ * @brief Register a callback identifying the calling task (e.g. xTaskGetCurrentTaskHandle)
+ *
+ * @param cb Identity callback, NULL to disable holder tracking
+ */
+void minigui_lock_prof_set_thread_id_cb(minigui_lock_thread_id_cb_t cb);
+
+/**
+ * @brief Tell the profiler which identity belongs to the LVGL/UI task
+ *
+ * @param ui_thread Identity returned by the thread id callback on the UI task
+ */
+void minigui_lock_prof_set_ui_thread(void *ui_thread);
+
+/**
+ * @brief Copy the statistics of one call site
+ *
+ * @param index Site index (0 .. minigui_lock_prof_site_count() - 1)
+ * @param out Output statistics
+ * @return true if @p index was valid
+ */
+bool minigui_lock_prof_get(size_t index, minigui_lock_site_stats_t *out);
+
+/**
+ * @brief Number of call sites seen so far
+ *
+ * @return Site count
+ */
+size_t minigui_lock_prof_site_count(void);
+
+/**
+ * @brief Clear all statistics (site names are kept)
+ */
+void minigui_lock_prof_reset(void);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Write a report of the worst lock call sites.
+ *
+ * @section call_site
+ * Called from a debug console command or at simulator exit.
+ *
+ * @section dependencies
+ * - `stdio.h`: Line formatting.
+ *
+ * @param cb Line sink.
+ * @param user Passed through to @p cb.
+ *
+ * @section pointers
+ * - `user`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return void
+ *
+ * Implementation Steps
+ * 1. Order sites by worst hold time plus worst wait time.
+ * 2. Emit one line per site with counts, averages and maxima.
+ * 3. Flag sites that should move to non-blocking paths: nested acquisitions
+ *    (already inside an LVGL callback) and contended producer-side calls.
+ ******************************************************************************/
+void minigui_lock_prof_report(minigui_lock_report_cb_t cb, void *user);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_LOCK_H
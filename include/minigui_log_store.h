@@ -0,0 +1,135 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Log Store API.
+ **
+ **            This header defines the in-memory log ring that producers push
+ **            into and the Logs screen reads from when no external log
+ **            provider is registered.
+ **
+ **            @section minigui_log_store.h - Log ingestion interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_LOG_STORE_H
+#define MINIGUI_LOG_STORE_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None required for this header
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Number of entries retained by the log ring (oldest are overwritten)
+ */
+#ifndef MINIGUI_LOG_STORE_CAPACITY
+#define MINIGUI_LOG_STORE_CAPACITY 128
+#endif
+
+/**
+ * @brief Log store counters
+ */
+typedef struct {
+    uint32_t pushed;          /**< Entries ingested since start/clear */
+    uint32_t dropped;         /**< Entries lost (overwritten or allocation failure) */
+    uint32_t retained;        /**< Entries currently held */
+    uint32_t capacity;        /**< Ring capacity in entries */
+    uint32_t bytes_per_entry; /**< Memory cost of one retained entry incl. index */
+} minigui_log_store_stats_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Append one log entry to the ring.
+ *
+ * @section call_site
+ * Called from any task producing logs (log bridge, vprintf hook, ...).
+ *
+ * @section dependencies
+ * - `lvgl.h`: Thread-safe locking.
+ *
+ * @param entry The entry to copy into the store.
+ *
+ * @section pointers
+ * - `entry`: Read-only, copied before return.
+ *
+ * @section variables
+ * - None
+ *
+ * @return true if stored, false if the ring could not be allocated.
+ *
+ * Implementation Steps
+ * 1. Lazily allocate the ring on first use.
+ * 2. Acquire LVGL lock (`lv_lock`).
+ * 3. Copy the entry and its source index hash into the head slot.
+ * 4. Release LVGL lock (`lv_unlock`).
+ ******************************************************************************/
+bool minigui_log_store_push(const minigui_log_entry_t *entry);
+
+/**
+ * @brief Read the newest entries matching a source filter (newest first)
+ *
+ * @section call_site
+ * Used as the default log provider for the Logs screen. Has the same
+ * signature as minigui_log_provider_t.
+ *
+ * @param logs Output buffer
+ * @param max_count Capacity of the buffer
+ * @param filter Source filter, NULL or "ALL" for every entry
+ * @return Number of entries written
+ */
+size_t minigui_log_store_query(minigui_log_entry_t *logs, size_t max_count, const char *filter);
+
+/**
+ * @brief Drop all retained entries and reset the counters
+ *
+ * @section call_site
+ * Called by benchmarks and on user request.
+ */
+void minigui_log_store_clear(void);
+
+/**
+ * @brief Snapshot the store counters
+ *
+ * @param stats Output structure
+ */
+void minigui_log_store_get_stats(minigui_log_store_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_LOG_STORE_H
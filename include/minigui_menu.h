@@ -37,6 +37,20 @@
 extern "C" {
 #endif
 
+/******************************************************************************
+ ******************************************************************************
+ ** ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Drawer and dimmer of one UI instance (embedded in its context)
+ */
+typedef struct {
+    lv_obj_t *drawer;   /**< Sliding panel with the navigation buttons */
+    lv_obj_t *blocker;  /**< Full-screen dimmer, closes the drawer on click */
+} minigui_menu_t;
+
 /******************************************************************************
  ******************************************************************************
  ** PUBLIC API FUNCTIONS
@@ -45,18 +59,20 @@ extern "C" {
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Initializes the global navigation menu.
+ ** @brief Creates a navigation menu on a display's top layer.
  **
  ** @section call_site Called from:
- ** - minigui_init() during system startup.
+ ** - minigui_ctx_create() for every UI instance.
  **
  ** @section dependencies Required Headers:
  ** - lvgl.h (to create the drawer and blocker objects)
  **
- ** @param None
+ ** @param menu (minigui_menu_t*): Handles to fill.
+ ** @param disp (lv_display_t*): Display whose top layer hosts the menu.
  **
  ** @section pointers 
- ** - None
+ ** - menu: Owned by the context; must stay valid while the menu exists.
+ ** - disp: Owned by LVGL.
  **
  ** @section variables 
  ** - None
@@ -64,7 +80,12 @@ extern "C" {
  ** @return void
  ******************************************************************************
  ******************************************************************************/
-void minigui_menu_init(void);
+void minigui_menu_init(minigui_menu_t *menu, lv_display_t *disp);
+
+/**
+ * @brief Deletes the drawer and blocker of a menu
+ */
+void minigui_menu_deinit(minigui_menu_t *menu);
 
 /******************************************************************************
  ******************************************************************************
@@ -77,10 +98,10 @@ void minigui_menu_init(void);
  ** @section dependencies Required Headers:
  ** - lvgl.h (to animate the drawer position)
  **
- ** @param None
+ ** @param menu (minigui_menu_t*): Menu to open or close.
  **
  ** @section pointers 
- ** - None
+ ** - menu: Owned by the context.
  **
  ** @section variables 
  ** - None
@@ -88,7 +109,7 @@ void minigui_menu_init(void);
  ** @return void
  ******************************************************************************
  ******************************************************************************/
-void minigui_menu_toggle(void);
+void minigui_menu_toggle(minigui_menu_t *menu);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,179 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Metrics Exposition.
+ **
+ **            Running timings (frames, screen builds, provider calls) and
+ **            cache counters, plus a dump of every counter and gauge minigui
+ **            keeps, in the Prometheus text exposition format. The dump is
+ **            written through a callback in small chunks, so a serial shell
+ **            or socket can stream it without a large buffer.
+ **
+ **            @section minigui_metrics.h - Metrics interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_METRICS_H
+#define MINIGUI_METRICS_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Histogram buckets per timing (upper edges in the source, last is +Inf)
+ */
+#define MINIGUI_METRICS_BUCKETS 10
+
+/**
+ * @brief Chunk size handed to the write callback
+ */
+#ifndef MINIGUI_METRICS_CHUNK
+#define MINIGUI_METRICS_CHUNK 128
+#endif
+
+typedef enum {
+    MINIGUI_METRICS_FRAME = 0,                  /**< Display refresh, REFR_START to REFR_READY */
+    MINIGUI_METRICS_SCREEN_BUILD,               /**< Screen switch: clear, create, freeze */
+    MINIGUI_METRICS_PROVIDER_SYSTEM_STATS,
+    MINIGUI_METRICS_PROVIDER_NETWORK_STATUS,
+    MINIGUI_METRICS_PROVIDER_WIFI_SCAN,
+    MINIGUI_METRICS_PROVIDER_LOGS,
+    MINIGUI_METRICS_PROVIDER_TIME,
+    MINIGUI_METRICS_TIMING_COUNT
+} minigui_metrics_timing_t;
+
+typedef enum {
+    MINIGUI_METRICS_LAYOUT_CACHE_HIT = 0,       /**< minigui_layout_get_for() served from cache */
+    MINIGUI_METRICS_LAYOUT_CACHE_MISS,
+    MINIGUI_METRICS_COUNTER_COUNT
+} minigui_metrics_counter_t;
+
+/**
+ * @brief One timing
+ */
+typedef struct {
+    uint32_t buckets[MINIGUI_METRICS_BUCKETS];  /**< Per bucket, not cumulative */
+    uint32_t count;
+    uint64_t sum_us;
+    uint32_t max_us;
+} minigui_metrics_timing_stats_t;
+
+/**
+ * @brief Microsecond clock for the timings
+ */
+typedef uint32_t (*minigui_metrics_clock_t)(void);
+
+/**
+ * @brief Receives the dump, one chunk at a time (not NUL-terminated)
+ */
+typedef void (*minigui_metrics_write_cb_t)(const char *text, size_t len, void *user);
+
+/**
+ * @brief Instrumentation points (compile to nothing without MINIGUI_ENABLE_METRICS)
+ */
+#if MINIGUI_ENABLE_METRICS
+#define MINIGUI_METRICS_START()          minigui_metrics_now_us()
+#define MINIGUI_METRICS_STOP(id, t0)     minigui_metrics_observe((id), minigui_metrics_now_us() - (t0))
+#define MINIGUI_METRICS_COUNT(id)        minigui_metrics_inc(id)
+#else
+#define MINIGUI_METRICS_START()          0u
+#define MINIGUI_METRICS_STOP(id, t0)     ((void)(t0))
+#define MINIGUI_METRICS_COUNT(id)        ((void)0)
+#endif
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Register a microsecond clock (e.g. esp_timer_get_time), NULL for lv_tick
+ */
+void minigui_metrics_set_clock(minigui_metrics_clock_t clock);
+
+/** @brief Current time from the registered clock */
+uint32_t minigui_metrics_now_us(void);
+
+/** @brief Record one duration (any task) */
+void minigui_metrics_observe(minigui_metrics_timing_t id, uint32_t us);
+
+/** @brief Count one event (any task) */
+void minigui_metrics_inc(minigui_metrics_counter_t id);
+
+/** @brief Time the refreshes of @p disp (done by minigui_ctx_create()) */
+void minigui_metrics_attach_display(lv_display_t *disp);
+
+/** @brief Stop timing the refreshes of @p disp */
+void minigui_metrics_detach_display(lv_display_t *disp);
+
+/** @brief Copy one timing; false if @p id is out of range */
+bool minigui_metrics_get_timing(minigui_metrics_timing_t id, minigui_metrics_timing_stats_t *stats);
+
+/** @brief Clear the timings and counters kept here */
+void minigui_metrics_reset(void);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Write every counter and gauge in the Prometheus text format.
+ *
+ * @section call_site
+ * Called by a shell command, HTTP handler or scraper task (any task).
+ *
+ * @section dependencies
+ * - `minigui_alloc.h`, `minigui_log_store.h`, `minigui_store.h`,
+ *   `minigui_alert.h`, `minigui_history.h`, `minigui_lock.h`: Sources.
+ *
+ * @param cb Receives the text in chunks of at most MINIGUI_METRICS_CHUNK.
+ * @param user Passed to @p cb.
+ *
+ * @section pointers
+ * - Chunks are valid during the callback only.
+ *
+ * @section variables
+ * - None
+ *
+ * @return Bytes written.
+ *
+ * Implementation Steps
+ * 1. Timings as histograms in seconds, with a max gauge.
+ * 2. Cache counters, log ingestion, memory pools and the LVGL heap.
+ * 3. Settings store, alerts, history and, when profiling, lock sites.
+ ******************************************************************************/
+size_t minigui_metrics_dump(minigui_metrics_write_cb_t cb, void *user);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_METRICS_H
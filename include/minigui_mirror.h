@@ -0,0 +1,226 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Screen Mirror.
+ **
+ **            Streams the dirty rectangles of a display to one remote viewer
+ **            (service laptop) over a TCP or UNIX socket. Rectangles are
+ **            captured at flush time, compressed with a small QOI-style
+ **            run/index codec and sent without ever blocking the UI. While
+ **            the viewer is still receiving a frame, newer frames are not
+ **            encoded; their areas are merged and redrawn once the link has
+ **            drained, so a slow viewer skips intermediate frames.
+ **
+ **            @section minigui_mirror.h - Remote framebuffer mirror interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_MIRROR_H
+#define MINIGUI_MIRROR_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Size of the frame staging buffer (PSRAM pool)
+ *
+ * Rectangles that do not fit are deferred to the next frame, so this bounds
+ * memory, not correctness.
+ */
+#ifndef MINIGUI_MIRROR_BUF_SIZE
+#define MINIGUI_MIRROR_BUF_SIZE (64 * 1024)
+#endif
+
+/**
+ * @brief Pending (skipped) areas tracked before they collapse into one box
+ */
+#ifndef MINIGUI_MIRROR_MAX_DAMAGE
+#define MINIGUI_MIRROR_MAX_DAMAGE 8
+#endif
+
+/**
+ * @brief Socket service period (accept, send, drain detection) in ms
+ */
+#ifndef MINIGUI_MIRROR_POLL_MS
+#define MINIGUI_MIRROR_POLL_MS 20
+#endif
+
+/**
+ * @brief Wire format identifiers
+ */
+#define MINIGUI_MIRROR_MAGIC   0x464D474Du  /**< "MGMF" little-endian */
+#define MINIGUI_MIRROR_VERSION 1
+
+/**
+ * @brief Codec tags (upper two bits of a tag byte)
+ *
+ * - INDEX: low 6 bits select one of 64 recently seen pixels.
+ * - RAW:   low 6 bits + 1 literal pixels follow.
+ * - RUN:   previous pixel repeated low 6 bits + 1 times.
+ */
+#define MINIGUI_MIRROR_OP_INDEX 0x00u
+#define MINIGUI_MIRROR_OP_RAW   0x80u
+#define MINIGUI_MIRROR_OP_RUN   0xC0u
+#define MINIGUI_MIRROR_OP_MASK  0xC0u
+
+/**
+ * @brief Transport the mirror listens on
+ */
+typedef enum {
+    MINIGUI_MIRROR_TCP = 0,  /**< IPv4 TCP, any interface */
+    MINIGUI_MIRROR_UNIX,     /**< UNIX domain stream socket (host builds only) */
+} minigui_mirror_transport_t;
+
+/**
+ * @brief Mirror configuration
+ */
+typedef struct {
+    lv_display_t *disp;                    /**< Display to mirror, NULL for the default */
+    minigui_mirror_transport_t transport;
+    uint16_t port;                         /**< TCP port */
+    const char *path;                      /**< UNIX socket path */
+} minigui_mirror_config_t;
+
+/**
+ * @brief Mirror counters
+ */
+typedef struct {
+    uint32_t frames_sent;      /**< Frames fully written to the socket */
+    uint32_t frames_skipped;   /**< Refreshes folded into a later frame */
+    uint32_t rects_sent;       /**< Rectangles encoded */
+    uint32_t rects_deferred;   /**< Rectangles that did not fit the staging buffer */
+    uint64_t bytes_raw;        /**< Pixel bytes captured */
+    uint64_t bytes_sent;       /**< Bytes written to the socket (headers included) */
+    uint32_t clients;          /**< Viewers accepted since start */
+    bool connected;            /**< A viewer is attached */
+} minigui_mirror_stats_t;
+
+/*
+ * Wire format (all fields little-endian):
+ *
+ *   frame header  u32 magic, u8 version, u8 bytes per pixel, u16 rect count,
+ *                 u32 sequence, u16 hor_res, u16 ver_res, u8 lv_color_format_t,
+ *                 u8 reserved[3]
+ *   per rect      u16 x, u16 y, u16 w, u16 h, u32 payload length, payload
+ *
+ * The payload is the rectangle's pixels (row-major, no padding) encoded with
+ * the MINIGUI_MIRROR_OP_* codec. The index hash of a pixel is the sum of its
+ * bytes times their position (1, 3, 5, ...) modulo 64; both sides reset the
+ * index and the previous pixel (all zero bytes) at every rectangle.
+ */
+#define MINIGUI_MIRROR_FRAME_HDR_SIZE 20
+#define MINIGUI_MIRROR_RECT_HDR_SIZE  12
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Start mirroring a display.
+ *
+ * @section call_site
+ * Called from the application when remote support is enabled, after the
+ * display has been created.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Display flush/refresh events, timers.
+ * - `sys/socket.h`: Listening socket (lwIP on ESP-IDF).
+ * - `minigui_alloc.h`: Staging buffer (PSRAM pool).
+ *
+ * @param cfg Transport and display.
+ *
+ * @section pointers
+ * - `cfg`: Read-only, copied. `cfg->path` is copied too.
+ *
+ * @section variables
+ * - None
+ *
+ * @return true if the socket is listening, false on error or if a mirror
+ *         is already running.
+ *
+ * Implementation Steps
+ * 1. Open a non-blocking listening socket.
+ * 2. Allocate the staging buffer.
+ * 3. Hook LV_EVENT_REFR_START, LV_EVENT_FLUSH_START and LV_EVENT_REFR_READY
+ *    on the display and start the poll timer.
+ ******************************************************************************/
+bool minigui_mirror_start(const minigui_mirror_config_t *cfg);
+
+/**
+ * @brief Stop mirroring, close the sockets and free the staging buffer
+ */
+void minigui_mirror_stop(void);
+
+/**
+ * @brief Snapshot the counters
+ *
+ * @param stats Output structure
+ */
+void minigui_mirror_get_stats(minigui_mirror_stats_t *stats);
+
+/**
+ * @brief Encode pixels with the mirror codec
+ *
+ * @param src Pixels, @p count * @p bpp bytes, rows already packed
+ * @param count Number of pixels
+ * @param bpp Bytes per pixel (1..4)
+ * @param dst Output buffer
+ * @param dst_size Capacity of @p dst
+ * @return Encoded length, or 0 if @p dst is too small
+ */
+size_t minigui_mirror_encode(const uint8_t *src, uint32_t count, uint8_t bpp,
+                             uint8_t *dst, size_t dst_size);
+
+/**
+ * @brief Decode a payload produced by minigui_mirror_encode()
+ *
+ * Reference decoder for viewers linking the library.
+ *
+ * @param src Encoded payload
+ * @param src_len Payload length
+ * @param bpp Bytes per pixel (1..4)
+ * @param dst Output pixels
+ * @param count Number of pixels expected
+ * @return true if exactly @p count pixels were decoded
+ */
+bool minigui_mirror_decode(const uint8_t *src, size_t src_len, uint8_t bpp,
+                           uint8_t *dst, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_MIRROR_H
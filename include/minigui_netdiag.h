@@ -0,0 +1,332 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Network Diagnostics.
+ **
+ **            Latency and throughput probes against a configurable endpoint.
+ **            The probes run in a pluggable transport on its own task; the
+ **            transport reports every sample back from there. Samples are
+ **            binned into fixed histograms as they arrive, so the panel can
+ **            show them live. A loopback phase measures the device's own
+ **            network path first, which separates "slow device" from "slow
+ **            network".
+ **
+ **            @section minigui_netdiag.h - Network diagnostics interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_NETDIAG_H
+#define MINIGUI_NETDIAG_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Endpoint capacity (including the terminator)
+ */
+#define MINIGUI_NETDIAG_ENDPOINT_MAX 64
+
+/**
+ * @brief Store key of the endpoint (minigui_store.h)
+ */
+#define MINIGUI_NETDIAG_STORE_KEY "diag.host"
+
+/**
+ * @brief Latency probes per phase (samples are kept for exact percentiles)
+ */
+#ifndef MINIGUI_NETDIAG_MAX_PROBES
+#define MINIGUI_NETDIAG_MAX_PROBES 64
+#endif
+
+/**
+ * @brief Default run parameters
+ */
+#ifndef MINIGUI_NETDIAG_PROBES
+#define MINIGUI_NETDIAG_PROBES 20
+#endif
+
+#ifndef MINIGUI_NETDIAG_INTERVAL_MS
+#define MINIGUI_NETDIAG_INTERVAL_MS 200
+#endif
+
+#ifndef MINIGUI_NETDIAG_PROBE_TIMEOUT_MS
+#define MINIGUI_NETDIAG_PROBE_TIMEOUT_MS 1000
+#endif
+
+#ifndef MINIGUI_NETDIAG_TRANSFER_BYTES
+#define MINIGUI_NETDIAG_TRANSFER_BYTES (1024u * 1024u)
+#endif
+
+/**
+ * @brief A run that has not reported done by then ends as timed out
+ */
+#ifndef MINIGUI_NETDIAG_RUN_TIMEOUT_MS
+#define MINIGUI_NETDIAG_RUN_TIMEOUT_MS 60000
+#endif
+
+/**
+ * @brief Minimum interval between notifications for throughput samples
+ */
+#ifndef MINIGUI_NETDIAG_UI_MS
+#define MINIGUI_NETDIAG_UI_MS 250
+#endif
+
+/**
+ * @brief Verdict thresholds
+ */
+#ifndef MINIGUI_NETDIAG_DEVICE_SLOW_US
+#define MINIGUI_NETDIAG_DEVICE_SLOW_US 5000     /**< Loopback median above this: the device is slow */
+#endif
+
+#ifndef MINIGUI_NETDIAG_NET_SLOW_US
+#define MINIGUI_NETDIAG_NET_SLOW_US 150000      /**< Endpoint p95 above this: the network is slow */
+#endif
+
+#ifndef MINIGUI_NETDIAG_LOSS_PCT
+#define MINIGUI_NETDIAG_LOSS_PCT 5              /**< Endpoint loss at or above this: the network is lossy */
+#endif
+
+/**
+ * @brief Histogram buckets (fixed edges, see minigui_netdiag_bucket_label())
+ */
+#define MINIGUI_NETDIAG_BUCKETS 10
+
+/**
+ * @brief RTT value reporting a lost probe
+ */
+#define MINIGUI_NETDIAG_LOST UINT32_MAX
+
+typedef enum {
+    MINIGUI_NETDIAG_LOOPBACK = 0,     /**< Probes to the device itself */
+    MINIGUI_NETDIAG_LATENCY,          /**< Probes to the endpoint */
+    MINIGUI_NETDIAG_THROUGHPUT,       /**< Transfer from the endpoint */
+    MINIGUI_NETDIAG_PHASE_COUNT
+} minigui_netdiag_phase_t;
+
+typedef enum {
+    MINIGUI_NETDIAG_IDLE = 0,
+    MINIGUI_NETDIAG_RUNNING,
+    MINIGUI_NETDIAG_DONE,
+    MINIGUI_NETDIAG_FAILED,           /**< Transport error, see status error */
+    MINIGUI_NETDIAG_TIMEOUT,
+    MINIGUI_NETDIAG_CANCELLED
+} minigui_netdiag_state_t;
+
+typedef enum {
+    MINIGUI_NETDIAG_VERDICT_NONE = 0, /**< Not enough data */
+    MINIGUI_NETDIAG_VERDICT_OK,
+    MINIGUI_NETDIAG_VERDICT_DEVICE,   /**< The device's own path is slow */
+    MINIGUI_NETDIAG_VERDICT_NETWORK   /**< Device fine, endpoint slow or lossy */
+} minigui_netdiag_verdict_t;
+
+/**
+ * @brief What the transport should run
+ */
+typedef struct {
+    char endpoint[MINIGUI_NETDIAG_ENDPOINT_MAX];  /**< Host, host:port or URL; the transport decides */
+    uint16_t probes;                              /**< Latency probes per phase */
+    uint16_t interval_ms;                         /**< Gap between probes */
+    uint16_t timeout_ms;                          /**< Probe without a reply by then is lost */
+    uint32_t transfer_bytes;                      /**< Throughput transfer size */
+} minigui_netdiag_config_t;
+
+/**
+ * @brief Probe transport
+ *
+ * @c start copies the config, hands the run to the transport's own task and
+ * returns without blocking. That task runs the phases in order (loopback
+ * probes, endpoint probes, transfer), calls the report functions below and
+ * finally minigui_netdiag_report_done(). @c stop is called on cancel and
+ * timeout; later reports for that run are ignored.
+ */
+typedef struct {
+    bool (*start)(void *ctx, const minigui_netdiag_config_t *cfg, uint32_t run);
+    void (*stop)(void *ctx, uint32_t run);
+    void *ctx;
+} minigui_netdiag_transport_t;
+
+/**
+ * @brief Samples of one phase
+ *
+ * Latency phases bin RTTs in microseconds; the throughput phase bins
+ * per-sample rates in bytes per second.
+ */
+typedef struct {
+    uint32_t buckets[MINIGUI_NETDIAG_BUCKETS];
+    uint32_t count;                   /**< Samples received (latency: replies) */
+    uint32_t lost;                    /**< Latency: probes without a reply */
+    uint32_t min;
+    uint32_t max;
+    uint32_t p50;                     /**< Exact for latency, bucket edge for throughput */
+    uint32_t p95;
+    uint32_t avg;                     /**< Throughput: total bytes / total time */
+} minigui_netdiag_hist_t;
+
+/**
+ * @brief Progress and results of the current or last run
+ */
+typedef struct {
+    minigui_netdiag_state_t state;
+    minigui_netdiag_phase_t phase;    /**< Phase of the last sample */
+    minigui_netdiag_verdict_t verdict;
+    const char *error;                /**< Reason when FAILED */
+    uint32_t transferred;             /**< Throughput bytes so far */
+    minigui_netdiag_hist_t hist[MINIGUI_NETDIAG_PHASE_COUNT];
+} minigui_netdiag_status_t;
+
+/**
+ * @brief In-process stand-in behaviour (see minigui_netdiag_loopback_transport())
+ */
+typedef struct {
+    uint16_t latency_ms;              /**< Endpoint base RTT */
+    uint16_t jitter_ms;               /**< Added uniform random RTT (0..jitter) */
+    uint8_t  loss_pct;                /**< Chance (0-100) that an endpoint probe is lost */
+    uint16_t device_us;               /**< Loopback RTT */
+    uint32_t rate_bps;                /**< Transfer rate, bytes per second */
+} minigui_netdiag_loopback_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Register the probe transport (NULL restores the stand-in, if mocks are enabled)
+ *
+ * @param transport Must stay valid while registered.
+ */
+void minigui_register_netdiag_transport(const minigui_netdiag_transport_t *transport);
+
+/**
+ * @brief Set and persist the endpoint (copied, truncated to fit)
+ */
+void minigui_netdiag_set_endpoint(const char *endpoint);
+
+/**
+ * @brief Current endpoint: stored value, else MINIGUI_NETDIAG_ENDPOINT
+ */
+const char *minigui_netdiag_get_endpoint(void);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Start a diagnostics run.
+ *
+ * @section call_site
+ * Called by the Settings network panel or application code.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Run timeout timer, subject.
+ *
+ * @param None
+ *
+ * @section pointers
+ * - None
+ *
+ * @section variables
+ * - None
+ *
+ * @return Run id (never 0), or 0 if no transport is available or it
+ *         refused the run (status FAILED).
+ *
+ * Implementation Steps
+ * 1. Cancel a running run; clear the results.
+ * 2. Build the config from the endpoint and the defaults.
+ * 3. Arm the run timeout and hand the run to the transport.
+ ******************************************************************************/
+uint32_t minigui_netdiag_start(void);
+
+/** @brief Stop the running run (state CANCELLED), results so far are kept */
+void minigui_netdiag_cancel(void);
+
+/** @brief Whether a run is in progress */
+bool minigui_netdiag_is_running(void);
+
+/**
+ * @brief Report one latency probe (any task)
+ *
+ * @param phase MINIGUI_NETDIAG_LOOPBACK or MINIGUI_NETDIAG_LATENCY
+ * @param rtt_us Round trip in microseconds, or MINIGUI_NETDIAG_LOST
+ */
+void minigui_netdiag_report_rtt(uint32_t run, minigui_netdiag_phase_t phase, uint32_t rtt_us);
+
+/**
+ * @brief Report transfer progress (any task)
+ *
+ * @param bytes Bytes received since the previous report
+ * @param elapsed_us Time those bytes took
+ */
+void minigui_netdiag_report_bytes(uint32_t run, uint32_t bytes, uint32_t elapsed_us);
+
+/**
+ * @brief End a run (any task)
+ *
+ * @param error NULL on success, otherwise a static reason (state FAILED)
+ */
+void minigui_netdiag_report_done(uint32_t run, const char *error);
+
+/** @brief Copy the current status */
+void minigui_netdiag_get_status(minigui_netdiag_status_t *status);
+
+/**
+ * @brief Subject that changes on every notification
+ *
+ * Observers read the details with minigui_netdiag_get_status(). They run
+ * on the reporting task with the LVGL lock held.
+ */
+lv_subject_t *minigui_netdiag_subject(void);
+
+/**
+ * @brief Short bucket label ("<1", "5", "1M", ">500") for a phase's histogram
+ *
+ * Latency labels are upper edges in ms, throughput labels lower edges in
+ * bytes per second.
+ */
+const char *minigui_netdiag_bucket_label(minigui_netdiag_phase_t phase, uint8_t bucket);
+
+/** @brief One-line verdict text */
+const char *minigui_netdiag_verdict_text(minigui_netdiag_verdict_t verdict);
+
+/**
+ * @brief In-process stand-in transport for tests and the simulator
+ *
+ * Produces samples from @p behaviour on an LVGL timer (so, unlike a real
+ * transport, on the UI task). Single static instance; @p behaviour is
+ * copied.
+ */
+const minigui_netdiag_transport_t *minigui_netdiag_loopback_transport(const minigui_netdiag_loopback_t *behaviour);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_NETDIAG_H
@@ -0,0 +1,211 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Performance & Visual Regression API.
+ **
+ **            This header defines the measurement hooks used by the headless
+ **            regression runner: per-screen build/render timing, object and
+ **            heap accounting, frame hashing against golden images, pixel
+ **            diffs and baseline budget checks.
+ **
+ **            @section minigui_perf.h - Performance instrumentation interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_PERF_H
+#define MINIGUI_PERF_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Category value meaning "use the screen's default view".
+ */
+#define MINIGUI_PERF_CATEGORY_DEFAULT (-1)
+
+/**
+ * @brief Regression flags returned by minigui_perf_check()
+ */
+#define MINIGUI_PERF_FAIL_HASH    (1u << 0)  /**< Frame hash differs from golden */
+#define MINIGUI_PERF_FAIL_BUILD   (1u << 1)  /**< Build time over budget */
+#define MINIGUI_PERF_FAIL_RENDER  (1u << 2)  /**< Render time over budget */
+#define MINIGUI_PERF_FAIL_OBJECTS (1u << 3)  /**< Object count over budget */
+#define MINIGUI_PERF_FAIL_HEAP    (1u << 4)  /**< Heap usage over budget */
+
+/**
+ * @brief Microsecond clock used for all timing measurements
+ * @return Monotonic time in microseconds (wrap-around is tolerated)
+ */
+typedef uint32_t (*minigui_perf_clock_t)(void);
+
+/**
+ * @brief Measurements taken for a single screen / category view
+ */
+typedef struct {
+    uint32_t build_us;    /**< Time spent in the screen creator (us) */
+    uint32_t render_us;   /**< Time for one full-screen refresh (us) */
+    uint32_t obj_count;   /**< Objects in the content area subtree */
+    uint32_t heap_used;   /**< LVGL heap bytes in use after build (0 if unknown) */
+    uint32_t frame_hash;  /**< FNV-1a hash of the rendered content area */
+} minigui_perf_sample_t;
+
+/**
+ * @brief One line of the stored baseline (golden hash + budgets)
+ */
+typedef struct {
+    int32_t screen;          /**< minigui_screen_t value */
+    int32_t category;        /**< Settings category or MINIGUI_PERF_CATEGORY_DEFAULT */
+    uint32_t max_build_us;   /**< Build time budget (us) */
+    uint32_t max_render_us;  /**< Render time budget (us) */
+    uint32_t max_obj_count;  /**< Object count budget */
+    uint32_t max_heap_used;  /**< Heap budget (bytes) */
+    uint32_t frame_hash;     /**< Golden frame hash */
+} minigui_perf_baseline_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Register a high resolution clock for measurements
+ *
+ * @section call_site
+ * Called by the host harness (e.g. clock_gettime) or the firmware
+ * (e.g. esp_timer_get_time) before any measurement. Falls back to lv_tick.
+ *
+ * @param clock Function returning microseconds, or NULL for lv_tick fallback
+ */
+void minigui_perf_set_clock(minigui_perf_clock_t clock);
+
+/**
+ * @brief Read the measurement clock
+ *
+ * @section call_site
+ * Used by every instrumented module of minigui.
+ *
+ * @return Current time in microseconds
+ */
+uint32_t minigui_perf_now_us(void);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Build, render and measure one screen (and settings category).
+ *
+ * @section call_site
+ * Called by the regression runner once per screen/category under test.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Snapshot, refresh and memory monitor APIs.
+ *
+ * @param screen Screen to build.
+ * @param category Settings category index or MINIGUI_PERF_CATEGORY_DEFAULT.
+ * @param settle_ms Time to run LVGL timers after building (deferred loads).
+ * @param out Output sample.
+ * @param frame_out Optional; receives the rendered content area snapshot.
+ *
+ * @section pointers
+ * - `out`: Owned by caller.
+ * - `frame_out`: Ownership of the draw buffer passes to the caller, who must
+ *   release it with `lv_draw_buf_destroy`.
+ *
+ * @return true if the screen was built and rendered.
+ ******************************************************************************/
+bool minigui_perf_measure(minigui_screen_t screen, int32_t category, uint32_t settle_ms,
+                          minigui_perf_sample_t *out, lv_draw_buf_t **frame_out);
+
+/**
+ * @brief Hash the visible pixels of a draw buffer (stride padding excluded)
+ *
+ * @param buf Rendered frame
+ * @return 32-bit FNV-1a hash
+ */
+uint32_t minigui_perf_hash_frame(const lv_draw_buf_t *buf);
+
+/**
+ * @brief Compare two frames pixel by pixel and optionally build a diff image
+ *
+ * @section call_site
+ * Called by the regression runner when a frame hash does not match.
+ *
+ * @param golden Reference frame
+ * @param actual Newly rendered frame
+ * @param diff Optional output of identical geometry; differing pixels are
+ *             written as 0xFF bytes, identical pixels as 0x00 bytes
+ * @return Number of differing pixels (UINT32_MAX if geometry mismatches)
+ */
+uint32_t minigui_perf_frame_diff(const lv_draw_buf_t *golden, const lv_draw_buf_t *actual,
+                                 lv_draw_buf_t *diff);
+
+/**
+ * @brief Check a sample against its baseline with a relative tolerance
+ *
+ * @param baseline Stored budgets and golden hash
+ * @param sample Fresh measurement
+ * @param tolerance_pct Allowed overshoot of each budget in percent
+ * @return Bitmask of MINIGUI_PERF_FAIL_* flags, 0 when within budget
+ */
+uint32_t minigui_perf_check(const minigui_perf_baseline_t *baseline,
+                            const minigui_perf_sample_t *sample, uint8_t tolerance_pct);
+
+/**
+ * @brief Parse one baseline file line
+ *
+ * Format: `screen category build_us render_us objects heap hash_hex`.
+ * Blank lines and lines starting with '#' are rejected.
+ *
+ * @param line Null-terminated text line
+ * @param out Parsed baseline
+ * @return true if the line held a baseline entry
+ */
+bool minigui_perf_parse_baseline(const char *line, minigui_perf_baseline_t *out);
+
+/**
+ * @brief Format a sample as a baseline file line, newline included (to regenerate goldens)
+ *
+ * @param buf Output buffer
+ * @param len Capacity of the buffer
+ * @param screen Screen the sample belongs to
+ * @param category Category the sample belongs to
+ * @param sample Measurement to record
+ * @return Number of characters written (excluding terminator)
+ */
+int minigui_perf_format_baseline(char *buf, size_t len, minigui_screen_t screen,
+                                 int32_t category, const minigui_perf_sample_t *sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_PERF_H
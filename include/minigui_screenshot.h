@@ -0,0 +1,123 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Screenshot Capture.
+ **
+ **            Re-renders a display and encodes it as QOI or PNG while the
+ **            rows come out of the draw buffer. In partial render mode the
+ **            display's own buffer delivers the screen in horizontal strips,
+ **            so no frame-sized buffer is ever allocated; the encoder only
+ **            keeps a small output chunk.
+ **
+ **            @section minigui_screenshot.h - Streaming screenshot interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_SCREENSHOT_H
+#define MINIGUI_SCREENSHOT_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Encoder output chunk (internal pool); also the PNG IDAT chunk size
+ */
+#ifndef MINIGUI_SCREENSHOT_CHUNK
+#define MINIGUI_SCREENSHOT_CHUNK 2048
+#endif
+
+/**
+ * @brief Image format
+ */
+typedef enum {
+    MINIGUI_SCREENSHOT_QOI = 0,  /**< QOI, 3 channels (smallest, fastest) */
+    MINIGUI_SCREENSHOT_PNG,      /**< PNG, RGB8, Sub filter + run-length deflate */
+} minigui_screenshot_format_t;
+
+/**
+ * @brief Receives the encoded file in order
+ *
+ * @param data Encoded bytes (valid during the call only)
+ * @param len Number of bytes
+ * @param user User pointer passed to minigui_screenshot()
+ * @return false to abort the capture
+ */
+typedef bool (*minigui_screenshot_write_cb_t)(const void *data, size_t len, void *user);
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Capture a display into an image stream.
+ *
+ * @section call_site
+ * Called from any task (e.g. a support console command or an HTTP handler
+ * writing to a socket or file). Blocks for one full refresh.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Display invalidation, refresh and flush events.
+ * - `minigui_alloc.h`: Encoder state (internal pool).
+ *
+ * @param disp     Display, NULL for the default display.
+ * @param format   QOI or PNG.
+ * @param write_cb Sink for the encoded bytes.
+ * @param user     Passed to @p write_cb.
+ *
+ * @section pointers
+ * - `write_cb` is called with the LVGL lock held; it must not call LVGL.
+ *
+ * @section variables
+ * - None
+ *
+ * @return true if the whole image was written; false for unsupported
+ *         color formats or rotation, allocation failure, or when
+ *         @p write_cb aborted.
+ *
+ * Implementation Steps
+ * 1. Acquire the LVGL lock and hook LV_EVENT_FLUSH_START.
+ * 2. Invalidate the screen and refresh it now; every flushed strip is
+ *    converted to RGB and encoded row by row straight from the draw buffer.
+ * 3. Finish the stream (QOI end marker / PNG trailer) and unhook.
+ ******************************************************************************/
+bool minigui_screenshot(lv_display_t *disp, minigui_screenshot_format_t format,
+                        minigui_screenshot_write_cb_t write_cb, void *user);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_SCREENSHOT_H
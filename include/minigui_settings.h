@@ -0,0 +1,297 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Settings Schema.
+ **
+ **            Configurable parameters are described by the application as a
+ **            constant schema: typed items (on/off, integer range, option
+ **            list, text) in named groups, with defaults, ranges and an
+ **            optional validation hook. MiniGUI keeps the current values,
+ **            rejects invalid ones and generates the Settings panels for the
+ **            groups on demand, so adding a parameter is one table line.
+ **
+ **            Items are addressed by a dense id (schema order, group after
+ **            group) or looked up by their key. Item names are indexed by
+ **            word, so search is a binary search instead of a scan over
+ **            every label.
+ **
+ **            @section minigui_settings.h - Settings schema interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_SETTINGS_H
+#define MINIGUI_SETTINGS_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Value type of a setting
+ */
+typedef enum {
+    MINIGUI_SETTING_TYPE_BOOL = 0,   /**< On/off */
+    MINIGUI_SETTING_TYPE_INT,        /**< Integer in [min, max], multiple of step from min */
+    MINIGUI_SETTING_TYPE_ENUM,       /**< Index into a '\n'-separated option list */
+    MINIGUI_SETTING_TYPE_STRING,     /**< Text of at most max characters */
+} minigui_setting_type_t;
+
+typedef struct minigui_setting_item minigui_setting_item_t;
+
+/**
+ * @brief Extra validation hook
+ *
+ * @param item The item being set
+ * @param value New value (BOOL, INT, ENUM)
+ * @param text New text (STRING), NULL otherwise
+ * @return true to accept the value
+ */
+typedef bool (*minigui_setting_validate_cb_t)(const minigui_setting_item_t *item, int32_t value, const char *text);
+
+/**
+ * @brief One configurable parameter (declare with the MINIGUI_SETTING_* macros)
+ */
+struct minigui_setting_item {
+    const char *key;                          /**< Unique, stable identifier (e.g. "disp.timeout") */
+    const char *label;                        /**< Name shown in the panel and searched */
+    minigui_setting_type_t type;
+    int32_t min;                              /**< INT: lower bound */
+    int32_t max;                              /**< INT: upper bound, STRING: maximum length (<= MINIGUI_SETTING_TEXT_MAX) */
+    int32_t step;                             /**< INT: increment */
+    int32_t def;                              /**< BOOL/INT/ENUM: default value */
+    const char *text;                         /**< ENUM: options, STRING: default text */
+    const char *unit;                         /**< INT: unit shown after the value, or NULL */
+    minigui_setting_validate_cb_t validate;   /**< Optional extra check */
+};
+
+#define MINIGUI_SETTING_BOOL(key, label, def) \
+    { (key), (label), MINIGUI_SETTING_TYPE_BOOL, 0, 1, 1, (def), NULL, NULL, NULL }
+
+#define MINIGUI_SETTING_INT(key, label, min, max, step, def, unit) \
+    { (key), (label), MINIGUI_SETTING_TYPE_INT, (min), (max), (step), (def), NULL, (unit), NULL }
+
+#define MINIGUI_SETTING_ENUM(key, label, options, def) \
+    { (key), (label), MINIGUI_SETTING_TYPE_ENUM, 0, 0, 1, (def), (options), NULL, NULL }
+
+#define MINIGUI_SETTING_STRING(key, label, max_len, def_text) \
+    { (key), (label), MINIGUI_SETTING_TYPE_STRING, 0, (max_len), 1, 0, (def_text), NULL, NULL }
+
+/**
+ * @brief Named group of items, shown as one Settings category
+ */
+typedef struct {
+    const char *name;                         /**< Navigation label */
+    const minigui_setting_item_t *items;
+    uint16_t count;
+} minigui_setting_group_t;
+
+#define MINIGUI_SETTING_GROUP(name, item_array) \
+    { (name), (item_array), (uint16_t)(sizeof(item_array) / sizeof((item_array)[0])) }
+
+/**
+ * @brief Complete schema
+ */
+typedef struct {
+    const minigui_setting_group_t *groups;
+    uint8_t group_count;
+} minigui_settings_schema_t;
+
+/**
+ * @brief Called after a value changed (LVGL lock held)
+ *
+ * @param id Item id
+ * @param item The item
+ */
+typedef void (*minigui_settings_change_cb_t)(uint16_t id, const minigui_setting_item_t *item);
+
+/**
+ * @brief Longest text of a STRING item
+ */
+#ifndef MINIGUI_SETTING_TEXT_MAX
+#define MINIGUI_SETTING_TEXT_MAX 63
+#endif
+
+/**
+ * @brief Result of an id lookup that found nothing
+ */
+#define MINIGUI_SETTING_NONE 0xFFFFu
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Register the schema and load every value (stored or default).
+ *
+ * @section call_site
+ * Called once at startup, before Settings is shown (the navigation pane
+ * lists the groups when the screen is built) and after minigui_store_init()
+ * if values should persist. Changed values are written to the settings
+ * store under the item key (keys longer than MINIGUI_STORE_KEY_MAX are not
+ * persisted).
+ *
+ * @section dependencies
+ * - `minigui_alloc.h`: Value and index storage (internal pool).
+ *
+ * @param schema Schema to use, or NULL to remove the current one.
+ *
+ * @section pointers
+ * - `schema`: Referenced, not copied; must stay valid (normally const data).
+ *
+ * @section variables
+ * - None
+ *
+ * @return false if the schema is invalid (bad range or default, duplicate
+ *         key, more than 65534 items) or storage could not be allocated; the
+ *         previous schema is dropped either way.
+ *
+ * Implementation Steps
+ * 1. Check every item and size the storage (values, text, indexes).
+ * 2. Allocate one block and fill the values with the defaults.
+ * 3. Sort the key index and reject duplicate keys.
+ * 4. Build and sort the word index over the item names.
+ * 5. Replace defaults with stored values that pass the item's checks.
+ ******************************************************************************/
+bool minigui_settings_register(const minigui_settings_schema_t *schema);
+
+/**
+ * @brief Registered schema, or NULL
+ */
+const minigui_settings_schema_t *minigui_settings_get_schema(void);
+
+/**
+ * @brief Number of items in the registered schema
+ */
+uint16_t minigui_settings_get_count(void);
+
+/**
+ * @brief Item by id, or NULL if out of range
+ */
+const minigui_setting_item_t *minigui_settings_get_item(uint16_t id);
+
+/**
+ * @brief Id of a group's first item (its items follow contiguously)
+ *
+ * @return MINIGUI_SETTING_NONE if the group does not exist
+ */
+uint16_t minigui_settings_group_first(uint8_t group);
+
+/**
+ * @brief Id of the item with a key, or MINIGUI_SETTING_NONE
+ */
+uint16_t minigui_settings_find(const char *key);
+
+/**
+ * @brief Current BOOL/INT/ENUM value (0 for unknown ids and STRING items)
+ */
+int32_t minigui_settings_get_int(uint16_t id);
+
+/**
+ * @brief Copy the current text of a STRING item
+ *
+ * @return Characters copied (0 for unknown ids and other types)
+ */
+size_t minigui_settings_get_str(uint16_t id, char *buf, size_t size);
+
+/**
+ * @brief Set a BOOL/INT/ENUM value
+ *
+ * @return false if the id, type, range, step or validation hook rejects it
+ */
+bool minigui_settings_set_int(uint16_t id, int32_t value);
+
+/**
+ * @brief Set the text of a STRING item
+ *
+ * @return false if the id, type, length or validation hook rejects it
+ */
+bool minigui_settings_set_str(uint16_t id, const char *text);
+
+/**
+ * @brief Restore every default (reports each changed item)
+ */
+void minigui_settings_reset(void);
+
+/**
+ * @brief Format a value as shown in the panel ("On", "30 s", option text)
+ *
+ * @return Characters written
+ */
+size_t minigui_settings_format(uint16_t id, char *buf, size_t size);
+
+/**
+ * @brief Number of options of an ENUM item (0 for other types)
+ */
+uint16_t minigui_settings_option_count(const minigui_setting_item_t *item);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Find items whose name contains a word starting with a query.
+ *
+ * @section call_site
+ * Called by the Settings search field on every edit.
+ *
+ * @section dependencies
+ * - None
+ *
+ * @param query Case-insensitive prefix; may span words ("wifi pow").
+ * @param ids Output ids, ascending.
+ * @param max Capacity of @p ids.
+ *
+ * @section pointers
+ * - `ids`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return Number of ids written (0 for an empty query).
+ *
+ * Implementation Steps
+ * 1. Binary-search the first word index entry not below the query.
+ * 2. Collect ids while the entries start with the query.
+ * 3. Sort and drop duplicates (a name can match at several words).
+ ******************************************************************************/
+uint16_t minigui_settings_search(const char *query, uint16_t *ids, uint16_t max);
+
+/**
+ * @brief Register the change callback (NULL to remove)
+ */
+void minigui_settings_register_change_cb(minigui_settings_change_cb_t cb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_SETTINGS_H
@@ -0,0 +1,89 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI SHA-256.
+ **
+ **            Incremental SHA-256 (FIPS 180-4) with a fixed 104-byte state,
+ **            so data of any length can be hashed chunk by chunk as it
+ **            streams past.
+ **
+ **            @section minigui_sha256.h - Incremental hash interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_SHA256_H
+#define MINIGUI_SHA256_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Digest length in bytes
+ */
+#define MINIGUI_SHA256_SIZE 32
+
+/**
+ * @brief Hash state
+ */
+typedef struct {
+    uint32_t state[8];
+    uint64_t bytes;        /**< Total bytes hashed */
+    uint8_t block[64];     /**< Partial block */
+} minigui_sha256_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/** @brief Start a new hash */
+void minigui_sha256_init(minigui_sha256_t *ctx);
+
+/** @brief Add @p len bytes */
+void minigui_sha256_update(minigui_sha256_t *ctx, const void *data, size_t len);
+
+/** @brief Finish and write the digest (the state must be re-initialized to reuse it) */
+void minigui_sha256_final(minigui_sha256_t *ctx, uint8_t digest[MINIGUI_SHA256_SIZE]);
+
+/**
+ * @brief Digest as 64 lowercase hex characters plus terminator
+ *
+ * @param out At least 65 bytes
+ */
+void minigui_sha256_hex(const uint8_t digest[MINIGUI_SHA256_SIZE], char *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_SHA256_H
@@ -0,0 +1,136 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Synthetic Load Providers.
+ **
+ **            This header defines configurable stand-ins for the hardware data
+ **            providers. Unlike the built-in mocks they stall, jitter, fail,
+ **            disconnect and burst, so simulator builds and benchmarks see
+ **            production-like load.
+ **
+ **            @section minigui_sim.h - Synthetic provider interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_SIM_H
+#define MINIGUI_SIM_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None required for this header
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Synthetic provider behaviour
+ */
+typedef struct {
+    uint16_t latency_ms;           /**< Base stall of every provider call */
+    uint16_t jitter_ms;            /**< Additional uniform random stall (0..jitter) */
+    uint8_t  failure_pct;          /**< Chance (0-100) that a provider call fails */
+    uint16_t wifi_count;           /**< Networks reported by a scan */
+    uint8_t  disconnect_pct;       /**< Chance per status query that the link flips */
+    uint16_t log_burst_size;       /**< Lines pushed to the log store per burst */
+    uint16_t log_burst_period_ms;  /**< Burst interval, 0 disables bursts */
+    uint8_t  cpu_step_pct;         /**< Max CPU random-walk step per sample */
+    uint16_t ram_step_kb;          /**< Max RAM random-walk step per sample */
+    uint16_t voltage_step_mv;      /**< Max voltage random-walk step per sample */
+    uint32_t seed;                 /**< PRNG seed, 0 picks a fixed default */
+} minigui_sim_cfg_t;
+
+/**
+ * @brief Counters describing the load the providers generated
+ */
+typedef struct {
+    uint32_t calls;          /**< Provider invocations */
+    uint32_t failures;       /**< Injected failures */
+    uint32_t disconnects;    /**< Link state flips */
+    uint32_t log_lines;      /**< Lines pushed by bursts */
+    uint32_t stall_ms;       /**< Total injected latency */
+} minigui_sim_stats_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Fill a configuration with moderate production-like defaults
+ *
+ * @param cfg Output configuration
+ */
+void minigui_sim_default_cfg(minigui_sim_cfg_t *cfg);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Register the synthetic providers and start log bursts.
+ *
+ * @section call_site
+ * Called by the simulator or a benchmark after `minigui_init()`, in place of
+ * the hardware provider registrations.
+ *
+ * @section dependencies
+ * - `minigui.h`: Provider registration.
+ * - `minigui_log_store.h`: Destination of log bursts.
+ *
+ * @param cfg Behaviour to simulate (copied).
+ *
+ * @section pointers
+ * - `cfg`: Read-only, copied.
+ *
+ * @section variables
+ * - None
+ *
+ * @return void
+ *
+ * Implementation Steps
+ * 1. Copy the configuration and seed the generator.
+ * 2. Register scan, stats and network status providers, and an
+ *    asynchronous Wi-Fi apply handler that walks through the stages.
+ * 3. Start the log burst timer if a period is configured.
+ ******************************************************************************/
+void minigui_sim_install(const minigui_sim_cfg_t *cfg);
+
+/**
+ * @brief Unregister the providers and stop log bursts
+ */
+void minigui_sim_uninstall(void);
+
+/**
+ * @brief Read the generated-load counters
+ *
+ * @param stats Output counters
+ */
+void minigui_sim_get_stats(minigui_sim_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_SIM_H
@@ -0,0 +1,271 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Settings Store.
+ **
+ **            Write-behind key/value store for persisted settings. Values
+ **            live in a RAM shadow, so reads never touch flash. Changes only
+ **            mark entries dirty; a timer writes all dirty entries to the
+ **            backend in one batch once the changes have settled (or after a
+ **            maximum delay), so dragging a slider or editing several
+ **            settings costs one commit instead of one per event.
+ **
+ **            @section minigui_store.h - Settings store interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_STORE_H
+#define MINIGUI_STORE_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Maximum number of entries
+ */
+#ifndef MINIGUI_STORE_MAX_ENTRIES
+#define MINIGUI_STORE_MAX_ENTRIES 128
+#endif
+
+/**
+ * @brief Longest key (NVS keys are limited to 15 characters)
+ */
+#ifndef MINIGUI_STORE_KEY_MAX
+#define MINIGUI_STORE_KEY_MAX 15
+#endif
+
+/**
+ * @brief Largest value in bytes
+ */
+#ifndef MINIGUI_STORE_VALUE_MAX
+#define MINIGUI_STORE_VALUE_MAX 64
+#endif
+
+/**
+ * @brief Quiet time after the last change before dirty entries are committed
+ */
+#ifndef MINIGUI_STORE_FLUSH_DELAY_MS
+#define MINIGUI_STORE_FLUSH_DELAY_MS 5000
+#endif
+
+/**
+ * @brief Longest time a change stays uncommitted while changes keep coming
+ */
+#ifndef MINIGUI_STORE_FLUSH_MAX_MS
+#define MINIGUI_STORE_FLUSH_MAX_MS 30000
+#endif
+
+/**
+ * @brief Key of the display brightness (0-100) set via minigui_set_brightness()
+ */
+#define MINIGUI_STORE_KEY_BRIGHTNESS "disp.bright"
+
+/**
+ * @brief Receives one entry (backend load, minigui_store_foreach())
+ */
+typedef void (*minigui_store_entry_cb_t)(const char *key, const void *data, size_t len, void *user);
+
+/**
+ * @brief Persistence backend
+ *
+ * A flush calls @c write once per dirty entry, then @c commit once. Backends
+ * that rewrite a whole file leave @c write NULL and dump every entry with
+ * minigui_store_foreach() in @c commit. Callbacks run in the LVGL task with
+ * the LVGL lock held and must not call back into minigui_store_set().
+ */
+typedef struct {
+    bool (*load)(void *ctx, minigui_store_entry_cb_t emit, void *user);     /**< Feed persisted entries to emit */
+    bool (*write)(void *ctx, const char *key, const void *data, size_t len); /**< Optional per-entry write */
+    bool (*commit)(void *ctx);                                               /**< Make the batch durable */
+    void *ctx;
+} minigui_store_backend_t;
+
+/**
+ * @brief Store counters
+ */
+typedef struct {
+    uint16_t entries;
+    uint16_t dirty;              /**< Entries changed since the last commit */
+    uint32_t bytes;              /**< RAM used by entries */
+    uint32_t sets;               /**< Calls that changed a value */
+    uint32_t writes;             /**< Entries handed to the backend */
+    uint32_t commits;            /**< Successful commits since init */
+    uint32_t commits_last_hour;
+    uint32_t failures;           /**< Failed flushes (retried later) */
+} minigui_store_stats_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Attach a backend and load its entries into RAM.
+ *
+ * @section call_site
+ * Called once at startup after minigui_init() and before
+ * minigui_settings_register(), so registered settings pick up stored values.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Flush timer.
+ * - `minigui_alloc.h`: Entry storage (internal pool).
+ *
+ * @param backend Backend, or NULL for a RAM-only store.
+ *
+ * @section pointers
+ * - `backend`: Referenced (must stay valid until minigui_store_deinit()).
+ *
+ * @section variables
+ * - None
+ *
+ * @return true if the store is ready. A failed load is logged and the store
+ *         starts empty.
+ *
+ * Implementation Steps
+ * 1. Flush and drop a previous store.
+ * 2. Allocate the entry table and create the paused flush timer.
+ * 3. Load the backend's entries as clean entries.
+ ******************************************************************************/
+bool minigui_store_init(const minigui_store_backend_t *backend);
+
+/**
+ * @brief Commit pending changes, then free all entries and detach the backend
+ */
+void minigui_store_deinit(void);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Set a value in RAM and schedule a commit.
+ *
+ * @section call_site
+ * Called from any task.
+ *
+ * @section dependencies
+ * - `minigui_lock.h`: LVGL lock.
+ *
+ * @param key  Key (up to MINIGUI_STORE_KEY_MAX characters).
+ * @param data Value bytes.
+ * @param len  Value length (up to MINIGUI_STORE_VALUE_MAX).
+ *
+ * @section pointers
+ * - `key`, `data`: Copied.
+ *
+ * @section variables
+ * - None
+ *
+ * @return false if the store is not initialized, the key or value is too
+ *         long, or the store is full.
+ *
+ * Implementation Steps
+ * 1. Return early if the value is unchanged (no write, no commit).
+ * 2. Insert or resize the entry, copy the value, mark it dirty.
+ * 3. Restart the quiet-time countdown unless the oldest pending change has
+ *    reached MINIGUI_STORE_FLUSH_MAX_MS.
+ ******************************************************************************/
+bool minigui_store_set(const char *key, const void *data, size_t len);
+
+/**
+ * @brief Copy a value from RAM (no I/O)
+ *
+ * @return Stored length (the copy is truncated to @p size), -1 if absent
+ */
+int32_t minigui_store_get(const char *key, void *data, size_t size);
+
+/** @brief Store a 32-bit integer */
+bool minigui_store_set_i32(const char *key, int32_t value);
+
+/** @brief Stored 32-bit integer, or @p def if absent or not an integer */
+int32_t minigui_store_get_i32(const char *key, int32_t def);
+
+/** @brief Store a string (without terminator) */
+bool minigui_store_set_str(const char *key, const char *str);
+
+/**
+ * @brief Stored string, terminated and truncated to @p size
+ *
+ * @return Characters copied, or 0 (buffer set to "") if absent
+ */
+size_t minigui_store_get_str(const char *key, char *buf, size_t size);
+
+/**
+ * @brief Commit all dirty entries now (e.g. before a reboot or deep sleep)
+ *
+ * @return true if nothing was pending or the commit succeeded
+ */
+bool minigui_store_flush(void);
+
+/**
+ * @brief Visit every entry in key order
+ *
+ * Runs under the LVGL lock; @p cb must not modify the store.
+ */
+void minigui_store_foreach(minigui_store_entry_cb_t cb, void *user);
+
+/** @brief Current counters */
+void minigui_store_get_stats(minigui_store_stats_t *stats);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Backend that keeps all entries in one text file.
+ *
+ * @section call_site
+ * Passed to minigui_store_init() on the host simulator, or on a device with
+ * a mounted VFS (LittleFS, FAT).
+ *
+ * @section dependencies
+ * - `stdio.h`: File I/O.
+ *
+ * @param path File path.
+ *
+ * @section pointers
+ * - `path`: Referenced, not copied.
+ *
+ * @section variables
+ * - None
+ *
+ * @return Backend (a single static instance).
+ *
+ * Implementation Steps
+ * 1. Load parses one "key hex" line per entry and skips malformed lines.
+ * 2. Commit writes every entry to "<path>.tmp" and renames it over
+ *    @p path, so a crash leaves either the old or the new file.
+ ******************************************************************************/
+const minigui_store_backend_t *minigui_store_file_backend(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_STORE_H
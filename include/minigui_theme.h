@@ -0,0 +1,153 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Themes.
+ **
+ **            All colors of the UI chrome (backgrounds, bars, borders, text,
+ **            controls) live in one small set of shared styles, one per role.
+ **            Objects reference the role styles instead of carrying local
+ **            color properties, so switching the theme rewrites those styles
+ **            in place and refreshes every object once. No screen is rebuilt
+ **            and the change shows up on the next frame.
+ **
+ **            @section minigui_theme.h - Runtime theme interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_THEME_H
+#define MINIGUI_THEME_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Shared style roles
+ */
+typedef enum {
+    MINIGUI_THEME_SCREEN = 0,        /**< Screen and content backgrounds */
+    MINIGUI_THEME_STATUS_BAR,        /**< Status bar background */
+    MINIGUI_THEME_MENU_BUTTON,       /**< Status bar menu button (background, divider) */
+    MINIGUI_THEME_TITLE,             /**< Status bar title text */
+    MINIGUI_THEME_CLOCK,             /**< Status bar clock text */
+    MINIGUI_THEME_DRAWER,            /**< Menu drawer background */
+    MINIGUI_THEME_PANEL,             /**< Settings screen background */
+    MINIGUI_THEME_NAV,               /**< Settings navigation pane (background, divider) */
+    MINIGUI_THEME_HEADER,            /**< Header strips (background, text) */
+    MINIGUI_THEME_CONTROL,           /**< Flat controls (background, text) */
+    MINIGUI_THEME_CONTROL_PRESSED,   /**< Flat controls, LV_STATE_PRESSED */
+    MINIGUI_THEME_TABLE,             /**< Tables (background, text) */
+    MINIGUI_THEME_TABLE_ITEMS,       /**< Table cells, LV_PART_ITEMS (grid lines) */
+    MINIGUI_THEME_SEPARATOR,         /**< 1px separator lines */
+    MINIGUI_THEME_CARD,              /**< Text on accent-colored cards */
+    MINIGUI_THEME_ROLE_COUNT
+} minigui_theme_role_t;
+
+/**
+ * @brief Theme palette (RGB hex values)
+ */
+typedef struct {
+    const char *name;
+    bool dark;                  /**< Mode of the LVGL default theme for stock widgets */
+    uint32_t bg;                /**< Screen background */
+    uint32_t bar;               /**< Status bar */
+    uint32_t drawer;            /**< Menu drawer and menu button */
+    uint32_t panel;             /**< Settings background */
+    uint32_t nav;               /**< Settings navigation pane */
+    uint32_t header;            /**< Header strips */
+    uint32_t border;            /**< Dividers and grid lines */
+    uint32_t control;           /**< Flat control background */
+    uint32_t control_pressed;   /**< Flat control background while pressed */
+    uint32_t separator;         /**< Separator lines */
+    uint32_t text;              /**< Primary text */
+    uint32_t text_muted;        /**< Secondary text (clock) */
+    uint32_t on_accent;         /**< Text on accent-colored cards */
+} minigui_theme_t;
+
+/**
+ * @brief Built-in palettes
+ */
+extern const minigui_theme_t minigui_theme_dark;
+extern const minigui_theme_t minigui_theme_light;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Shared style for a role, initialized from the active theme on first use
+ *
+ * Add it with lv_obj_add_style() (LV_PART_ITEMS / LV_STATE_PRESSED for the
+ * roles documented that way). The style lives as long as the program.
+ */
+lv_style_t *minigui_theme_style(minigui_theme_role_t role);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Switch every display to another theme.
+ *
+ * @section call_site
+ * Called from any task (e.g. a Settings control or a day/night schedule).
+ *
+ * @section dependencies
+ * - `lvgl.h`: Style setters, style change report, default theme.
+ *
+ * @param theme Palette to activate (must stay valid while active).
+ *
+ * @section pointers
+ * - `theme`: Referenced, not copied.
+ *
+ * @section variables
+ * - None
+ *
+ * @return void
+ *
+ * Implementation Steps
+ * 1. Acquire the LVGL lock; return if @p theme is already active.
+ * 2. Rewrite the color properties of every role style in place.
+ * 3. Refresh all objects once: through the LVGL default theme when its
+ *    dark/light mode changes (it re-inits its own styles and reports the
+ *    change), with lv_obj_report_style_change(NULL) otherwise.
+ ******************************************************************************/
+void minigui_theme_apply(const minigui_theme_t *theme);
+
+/**
+ * @brief Active palette (minigui_theme_dark until minigui_theme_apply())
+ */
+const minigui_theme_t *minigui_theme_get(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_THEME_H
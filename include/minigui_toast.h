@@ -0,0 +1,186 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Toast Notifications.
+ **
+ **            Transient messages ("Saved", "Scan failed", alert banners)
+ **            shown on the top layer of every display with a context. Any task posts
+ **            without taking the LVGL lock; the UI task drains the posts into
+ **            a bounded priority queue, merges repeats of a message into one
+ **            toast with a count, and shows at most MINIGUI_TOAST_VISIBLE
+ **            toasts from a pool of reusable objects.
+ **
+ **            @section minigui_toast.h - Toast interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_TOAST_H
+#define MINIGUI_TOAST_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Longest message kept (bytes, terminator included)
+ */
+#ifndef MINIGUI_TOAST_TEXT_LEN
+#define MINIGUI_TOAST_TEXT_LEN 64
+#endif
+
+/**
+ * @brief Posts that can wait for the UI task
+ */
+#ifndef MINIGUI_TOAST_INBOX
+#define MINIGUI_TOAST_INBOX 16
+#endif
+
+/**
+ * @brief Toasts waiting for a free place on screen
+ */
+#ifndef MINIGUI_TOAST_QUEUE
+#define MINIGUI_TOAST_QUEUE 8
+#endif
+
+/**
+ * @brief Toasts on screen at once (size of the object pool)
+ */
+#ifndef MINIGUI_TOAST_VISIBLE
+#define MINIGUI_TOAST_VISIBLE 3
+#endif
+
+/**
+ * @brief Display time when a post passes 0
+ */
+#ifndef MINIGUI_TOAST_DURATION_MS
+#define MINIGUI_TOAST_DURATION_MS 3000
+#endif
+
+/**
+ * @brief How often the UI task picks up posts and expires toasts
+ */
+#ifndef MINIGUI_TOAST_POLL_MS
+#define MINIGUI_TOAST_POLL_MS 50
+#endif
+
+/**
+ * @brief Duration of a toast that stays until tapped or dismissed
+ */
+#define MINIGUI_TOAST_FOREVER UINT32_MAX
+
+/**
+ * @brief Toast levels, in priority order
+ */
+typedef enum {
+    MINIGUI_TOAST_INFO = 0,
+    MINIGUI_TOAST_SUCCESS,
+    MINIGUI_TOAST_WARNING,
+    MINIGUI_TOAST_ERROR,
+    MINIGUI_TOAST_LEVEL_COUNT
+} minigui_toast_level_t;
+
+/**
+ * @brief Toast counters
+ */
+typedef struct {
+    uint32_t posted;                  /**< Accepted posts */
+    uint32_t dropped;                 /**< Posts lost: inbox full, queue full of higher levels, or cleared */
+    uint32_t coalesced;               /**< Posts merged into a queued or visible toast */
+    uint32_t evicted;                 /**< Queued toasts discarded to make room for a post */
+    uint32_t shown;                   /**< Toasts put on screen */
+} minigui_toast_stats_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Post a toast.
+ *
+ * @section call_site
+ * Called from any task, without the LVGL lock (and from inside it).
+ *
+ * @section dependencies
+ * - None
+ *
+ * @param level Priority and color.
+ * @param text Message, truncated to MINIGUI_TOAST_TEXT_LEN - 1 bytes.
+ * @param duration_ms Display time, 0 for MINIGUI_TOAST_DURATION_MS or
+ *                    MINIGUI_TOAST_FOREVER.
+ *
+ * @section pointers
+ * - `text`: Copied.
+ *
+ * @section variables
+ * - None
+ *
+ * @return false if the inbox is full (the post is dropped and counted).
+ *
+ * Implementation Steps
+ * 1. Claim a free inbox slot with an atomic compare-and-swap.
+ * 2. Copy the message and publish the slot; the UI task picks it up
+ *    within MINIGUI_TOAST_POLL_MS.
+ ******************************************************************************/
+bool minigui_toast_post(minigui_toast_level_t level, const char *text, uint32_t duration_ms);
+
+/** @brief Remove the toasts showing or waiting with @p text (any task, lock-free, never dropped) */
+bool minigui_toast_dismiss(const char *text);
+
+/** @brief Remove every toast and waiting post (waiting posts count as dropped) */
+void minigui_toast_clear(void);
+
+/** @brief Copy the counters */
+void minigui_toast_get_stats(minigui_toast_stats_t *stats);
+
+/**
+ * @brief Start showing toasts on the top layer of @p disp (NULL: default display)
+ *
+ * Called by minigui_ctx_create(). Every display shows the same toasts.
+ * Posts made before are kept.
+ */
+void minigui_toast_start(lv_display_t *disp);
+
+/**
+ * @brief Delete the toast objects of @p disp (minigui_ctx_destroy())
+ *
+ * The last display also stops the poll timer and drops the toasts.
+ */
+void minigui_toast_stop(lv_display_t *disp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_TOAST_H
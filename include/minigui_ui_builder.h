@@ -0,0 +1,190 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Declarative UI Builder.
+ **
+ **            Describes a widget tree as a `static const` node table (type,
+ **            parent index, style, text, event) that is instantiated by one
+ **            loop. Tables live in flash, text is attached without copying,
+ **            and styles are shared constant styles instead of per-object
+ **            local style calls.
+ **
+ **            @section minigui_ui_builder.h - Node table builder interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_UI_BUILDER_H
+#define MINIGUI_UI_BUILDER_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Widget types a node can create
+ */
+typedef enum {
+    MINIGUI_UI_OBJ = 0,    /**< Plain container / separator */
+    MINIGUI_UI_LABEL,      /**< Label, text attached with lv_label_set_text_static */
+    MINIGUI_UI_BUTTON,     /**< Button, non-NULL text adds a centered static label */
+    MINIGUI_UI_SLIDER,     /**< Slider */
+    MINIGUI_UI_DROPDOWN,   /**< Dropdown, text is the static option list */
+    MINIGUI_UI_TEXTAREA,   /**< Textarea, text is the placeholder */
+    MINIGUI_UI_BAR,        /**< Progress bar (0..100) */
+    MINIGUI_UI_CHART       /**< Bar chart, points and series added by the caller */
+} minigui_ui_type_t;
+
+/**
+ * @brief Node flags
+ */
+enum {
+    MINIGUI_UI_F_HIDDEN   = 0x01,  /**< Create hidden */
+    MINIGUI_UI_F_ONE_LINE = 0x02,  /**< Textarea: single line */
+    MINIGUI_UI_F_PASSWORD = 0x04   /**< Textarea: password mode */
+};
+
+/**
+ * @brief Parent index meaning "the parent passed to minigui_ui_build()"
+ */
+#define MINIGUI_UI_ROOT (-1)
+
+/**
+ * @brief One widget in a node table
+ *
+ * Parents must appear before their children. Event IDs index the table's
+ * handler array starting at 1; 0 means no event.
+ */
+typedef struct {
+    uint8_t type;               /**< minigui_ui_type_t */
+    int8_t  parent;             /**< Index of an earlier node, or MINIGUI_UI_ROOT */
+    uint8_t flags;              /**< MINIGUI_UI_F_* */
+    uint8_t event;              /**< Handler ID (1-based), 0 for none */
+    uint8_t event_code;         /**< lv_event_code_t that triggers the handler */
+    const lv_style_t *style;    /**< Shared (usually constant) style, NULL for none */
+    const char *text;           /**< Static text, options or placeholder */
+} minigui_ui_node_t;
+
+/**
+ * @brief A node table plus the event handlers it refers to
+ */
+typedef struct {
+    const minigui_ui_node_t *nodes;   /**< Node table */
+    uint16_t count;                   /**< Number of nodes */
+    const lv_event_cb_t *handlers;    /**< handlers[event - 1] */
+    uint8_t handler_count;            /**< Entries in handlers */
+} minigui_ui_desc_t;
+
+/**
+ * @brief Node initializer helpers
+ */
+#define MINIGUI_UI_NODE_OBJ(parent, style) \
+    { MINIGUI_UI_OBJ, (parent), 0, 0, 0, (style), NULL }
+#define MINIGUI_UI_NODE_LABEL(parent, style, text) \
+    { MINIGUI_UI_LABEL, (parent), 0, 0, 0, (style), (text) }
+#define MINIGUI_UI_NODE_BUTTON(parent, style, text, event) \
+    { MINIGUI_UI_BUTTON, (parent), 0, (event), LV_EVENT_CLICKED, (style), (text) }
+#define MINIGUI_UI_NODE_SLIDER(parent, style, event) \
+    { MINIGUI_UI_SLIDER, (parent), 0, (event), LV_EVENT_VALUE_CHANGED, (style), NULL }
+#define MINIGUI_UI_NODE_DROPDOWN(parent, style, options) \
+    { MINIGUI_UI_DROPDOWN, (parent), 0, 0, 0, (style), (options) }
+#define MINIGUI_UI_NODE_TEXTAREA(parent, style, placeholder, flags, event) \
+    { MINIGUI_UI_TEXTAREA, (parent), (flags), (event), LV_EVENT_FOCUSED, (style), (placeholder) }
+#define MINIGUI_UI_NODE_BAR(parent, style, flags) \
+    { MINIGUI_UI_BAR, (parent), (flags), 0, 0, (style), NULL }
+#define MINIGUI_UI_NODE_CHART(parent, style) \
+    { MINIGUI_UI_CHART, (parent), 0, 0, 0, (style), NULL }
+
+/**
+ * @brief Build a descriptor from a node array and a handler array
+ */
+#define MINIGUI_UI_DESC(node_array, handler_array) \
+    { (node_array), (uint16_t)(sizeof(node_array) / sizeof((node_array)[0])), \
+      (handler_array), (uint8_t)(sizeof(handler_array) / sizeof((handler_array)[0])) }
+
+/**
+ * @brief Descriptor for a table without event handlers
+ */
+#define MINIGUI_UI_DESC_NO_EVENTS(node_array) \
+    { (node_array), (uint16_t)(sizeof(node_array) / sizeof((node_array)[0])), NULL, 0 }
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Instantiate a node table under a parent.
+ *
+ * @section call_site
+ * Called by screen and panel builders with the LVGL lock held.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Widget creation.
+ *
+ * @param parent Object that MINIGUI_UI_ROOT nodes attach to.
+ * @param desc   Node table and handlers.
+ * @param objs   Output handles, one per node (`desc->count` entries). This is
+ *               the builder's only working memory, sized by the table at
+ *               compile time.
+ *
+ * @section pointers
+ * - `desc`: Read-only; node text must stay valid for the widget lifetime.
+ * - `objs`: Owned by caller.
+ *
+ * @section variables
+ * - None
+ *
+ * @return bool: false if a node references an invalid parent or handler
+ *         (nodes created so far are kept).
+ *
+ * Implementation Steps
+ * 1. For each node, resolve the parent from @p objs.
+ * 2. Create the widget for its type and add its shared style.
+ * 3. Attach static text / options / placeholder and apply flags.
+ * 4. Register the node's handler for its event code.
+ ******************************************************************************/
+bool minigui_ui_build(lv_obj_t *parent, const minigui_ui_desc_t *desc, lv_obj_t **objs);
+
+/**
+ * @brief Number of LVGL objects a table creates (including button labels)
+ *
+ * @param desc Node table
+ * @return Object count
+ */
+uint32_t minigui_ui_count_objects(const minigui_ui_desc_t *desc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_UI_BUILDER_H
@@ -0,0 +1,296 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Firmware Update Pipeline.
+ **
+ **            Streams an image from a chunk source into a sink, hashing it
+ **            with SHA-256 on the way. The work runs in an LVGL timer in
+ **            short time slices, so the UI keeps rendering and taking input
+ **            while the image streams. Memory use is one chunk buffer plus
+ **            the hash state, independent of the image size. Progress
+ **            (bytes, throughput, ETA) is published through an LVGL subject
+ **            at most every MINIGUI_UPDATE_UI_MS.
+ **
+ **            @section minigui_update.h - Firmware update interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_UPDATE_H
+#define MINIGUI_UPDATE_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_sha256.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Bytes read from the source per call (the only image buffer)
+ */
+#ifndef MINIGUI_UPDATE_CHUNK
+#define MINIGUI_UPDATE_CHUNK 4096
+#endif
+
+/**
+ * @brief Timer period and the work budget of each tick
+ */
+#ifndef MINIGUI_UPDATE_TICK_MS
+#define MINIGUI_UPDATE_TICK_MS 10
+#endif
+
+#ifndef MINIGUI_UPDATE_SLICE_MS
+#define MINIGUI_UPDATE_SLICE_MS 6
+#endif
+
+/**
+ * @brief Minimum interval between progress notifications
+ */
+#ifndef MINIGUI_UPDATE_UI_MS
+#define MINIGUI_UPDATE_UI_MS 250
+#endif
+
+/**
+ * @brief Source read result: end of image
+ */
+#define MINIGUI_UPDATE_END (-1)
+
+/**
+ * @brief Chunk source (local file, HTTP stream, ...)
+ *
+ * @c read returns the bytes written to @p buf, 0 if no data is available
+ * yet (polled again after MINIGUI_UPDATE_TICK_MS), MINIGUI_UPDATE_END at
+ * the end of the image, or another negative value on error.
+ *
+ * Without a worker (minigui_update_set_worker()) every call runs on the
+ * LVGL task under the LVGL lock and must return within
+ * MINIGUI_UPDATE_SLICE_MS; longer calls are logged once per update.
+ */
+typedef struct {
+    bool (*open)(void *ctx, uint32_t *size);                 /**< *size = image size, 0 if unknown */
+    int32_t (*read)(void *ctx, uint8_t *buf, size_t max);
+    void (*close)(void *ctx);
+    void *ctx;
+} minigui_update_source_t;
+
+/**
+ * @brief Image sink (OTA partition, file, ...)
+ *
+ * @c finish is called once per started update: with @p commit true after
+ * the image arrived and verified, false to discard it (error, digest
+ * mismatch, cancel).
+ *
+ * Sinks that block (an OTA partition erases flash in @c begin and in
+ * @c write) need a worker; without one they freeze the UI.
+ */
+typedef struct {
+    bool (*begin)(void *ctx, uint32_t size);
+    bool (*write)(void *ctx, const uint8_t *data, size_t len);
+    bool (*finish)(void *ctx, bool commit);
+    void *ctx;
+} minigui_update_sink_t;
+
+/**
+ * @brief An available update
+ */
+typedef struct {
+    const char *version;                      /**< Shown to the user */
+    const minigui_update_source_t *source;
+    const minigui_update_sink_t *sink;
+    const uint8_t *sha256;                    /**< Expected digest (copied at start), NULL to skip the check */
+} minigui_update_offer_t;
+
+/**
+ * @brief Fill @p offer and return true if an update is available
+ *
+ * Called on the LVGL task; answer from a cached manifest rather than
+ * blocking on the network.
+ */
+typedef bool (*minigui_update_check_cb_t)(minigui_update_offer_t *offer);
+
+/**
+ * @brief Signals the worker task to call minigui_update_run()
+ *
+ * Called from minigui_update_start() without the LVGL lock; must not
+ * block (give a semaphore, notify a task).
+ */
+typedef void (*minigui_update_wake_cb_t)(void);
+
+typedef enum {
+    MINIGUI_UPDATE_IDLE = 0,
+    MINIGUI_UPDATE_RUNNING,
+    MINIGUI_UPDATE_DONE,          /**< Verified and committed */
+    MINIGUI_UPDATE_FAILED,
+    MINIGUI_UPDATE_CANCELLED
+} minigui_update_state_t;
+
+/**
+ * @brief Progress of the current or last update
+ */
+typedef struct {
+    minigui_update_state_t state;
+    const char *version;
+    uint32_t received;                        /**< Bytes written to the sink */
+    uint32_t total;                           /**< Image size, 0 if unknown */
+    uint32_t bytes_per_s;                     /**< Smoothed throughput */
+    uint32_t eta_s;                           /**< UINT32_MAX while unknown */
+    uint32_t elapsed_ms;
+    const char *error;                        /**< Reason when FAILED */
+    uint8_t sha256[MINIGUI_SHA256_SIZE];      /**< Digest of the image once it is complete */
+} minigui_update_status_t;
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/** @brief Register the update check (NULL restores the mock, if enabled) */
+void minigui_register_update_check_cb(minigui_update_check_cb_t cb);
+
+/**
+ * @brief Ask the registered check for an update
+ *
+ * With MINIGUI_ENABLE_MOCKS and no check registered, every other call
+ * offers a synthetic image streamed at a modem-like rate into a discarding
+ * sink.
+ *
+ * @return true if @p offer was filled
+ */
+bool minigui_update_check(minigui_update_offer_t *offer);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Start streaming an update.
+ *
+ * @section call_site
+ * Called by the Settings System panel or application code (any task).
+ *
+ * @section dependencies
+ * - `lvgl.h`: Work timer, subject.
+ * - `minigui_alloc.h`: Job state (internal pool, freed at the end).
+ *
+ * @param offer Update to install.
+ *
+ * @section pointers
+ * - `offer`: Source, sink and version must stay valid until the update
+ *   ends; the expected digest is copied.
+ *
+ * @section variables
+ * - None
+ *
+ * @return false if an update is running, the offer is incomplete, memory is
+ *         short or, without a worker, the source/sink could not be opened
+ *         (status FAILED). A worker reports open failures through the
+ *         status instead.
+ *
+ * Implementation Steps
+ * 1. Allocate the job (chunk buffer and hash state).
+ * 2. With a worker: publish RUNNING and call the wake callback.
+ * 3. Otherwise open the source, begin the sink, start the work timer and
+ *    publish RUNNING.
+ ******************************************************************************/
+bool minigui_update_start(const minigui_update_offer_t *offer);
+
+/** @brief Stop a running update; the sink discards the partial image */
+void minigui_update_cancel(void);
+
+/**
+ * @brief Stream updates on an application task instead of the LVGL task
+ *
+ * @p wake is called when an update starts; the woken task calls
+ * minigui_update_run(). NULL returns to time-sliced streaming on an LVGL
+ * timer. Takes effect for the next update.
+ */
+void minigui_update_set_worker(minigui_update_wake_cb_t wake);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Stream the started update on the calling task.
+ *
+ * @section call_site
+ * Called by the worker task registered with minigui_update_set_worker(),
+ * without the LVGL lock.
+ *
+ * @section dependencies
+ * - `minigui_lock.h`: Held only to publish progress.
+ *
+ * @param None
+ *
+ * @section pointers
+ * - None
+ *
+ * @section variables
+ * - None
+ *
+ * @return void (returns at once if no update is waiting for a worker).
+ *
+ * Implementation Steps
+ * 1. Open the source and begin the sink.
+ * 2. Read, hash and write until the end of the image, an error or a
+ *    cancel; sources and sinks may block here.
+ * 3. Verify, commit or discard, and publish the final state.
+ ******************************************************************************/
+void minigui_update_run(void);
+
+/** @brief Whether an update is running */
+bool minigui_update_is_running(void);
+
+/** @brief Copy the current progress */
+void minigui_update_get_status(minigui_update_status_t *status);
+
+/**
+ * @brief Subject that changes on every progress notification
+ *
+ * Observers read the details with minigui_update_get_status(). They run
+ * with the LVGL lock held: on the LVGL task, or on the worker task while
+ * minigui_update_run() streams (see minigui_update_set_worker()). Keep
+ * them short; they stall the UI like any locked section.
+ */
+lv_subject_t *minigui_update_subject(void);
+
+/**
+ * @brief Source reading a local image file (host stand-in for a download)
+ *
+ * Single static instance; @p path is referenced.
+ */
+const minigui_update_source_t *minigui_update_file_source(const char *path);
+
+/**
+ * @brief Sink writing to "<path>.part", renamed to @p path on commit
+ *
+ * Single static instance; @p path is referenced.
+ */
+const minigui_update_sink_t *minigui_update_file_sink(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_UPDATE_H
@@ -0,0 +1,134 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Virtualized List.
+ **
+ **            A scrollable list of fixed-height rows where only the rows in
+ **            view exist as objects. The list reports count x row height as
+ **            its content size, so the scrollbar and scroll range behave as
+ **            if every row existed; while scrolling, rows that leave the view
+ **            are moved to the other end and rebound to a new index. A list
+ **            of 1000 entries costs the same objects as one of 10.
+ **
+ **            @section minigui_vlist.h - Virtualized list interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_VLIST_H
+#define MINIGUI_VLIST_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Maximum number of row objects per list (rows in view + 1)
+ */
+#ifndef MINIGUI_VLIST_MAX_ROWS
+#define MINIGUI_VLIST_MAX_ROWS 24
+#endif
+
+/**
+ * @brief Creates one row object as a child of @p list (size and position are set by the list)
+ */
+typedef lv_obj_t *(*minigui_vlist_create_cb_t)(lv_obj_t *list, void *user_data);
+
+/**
+ * @brief Fills a row with the data of entry @p index
+ */
+typedef void (*minigui_vlist_bind_cb_t)(lv_obj_t *row, uint32_t index, void *user_data);
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Create a virtualized list.
+ *
+ * @section call_site
+ * Called by panel builders; size the list like any other object (e.g.
+ * flex grow), rows are created once its height is known.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Scroll, size and self-size events.
+ * - `minigui_alloc.h`: List state (internal pool).
+ *
+ * @param parent    Parent object.
+ * @param row_h     Row height in pixels.
+ * @param create_cb Row factory.
+ * @param bind_cb   Row binder.
+ * @param user_data Passed to both callbacks.
+ *
+ * @section pointers
+ * - `user_data`: Must outlive the list.
+ * - The user data of row objects is reserved by the list.
+ *
+ * @section variables
+ * - None
+ *
+ * @return The list object, or NULL if the state could not be allocated.
+ *
+ * Implementation Steps
+ * 1. Create a plain scrollable object without layout.
+ * 2. Allocate the state; free it on LV_EVENT_DELETE.
+ * 3. Size the row pool on LV_EVENT_SIZE_CHANGED, rebind on LV_EVENT_SCROLL
+ *    and report the virtual height on LV_EVENT_GET_SELF_SIZE.
+ ******************************************************************************/
+lv_obj_t *minigui_vlist_create(lv_obj_t *parent, int32_t row_h, minigui_vlist_create_cb_t create_cb,
+                               minigui_vlist_bind_cb_t bind_cb, void *user_data);
+
+/**
+ * @brief Set the number of entries, scroll to the top and rebind every row
+ */
+void minigui_vlist_set_count(lv_obj_t *list, uint32_t count);
+
+/**
+ * @brief Rebind the rows in view (the entries' data changed)
+ */
+void minigui_vlist_refresh(lv_obj_t *list);
+
+/**
+ * @brief Entry index a row is bound to
+ */
+uint32_t minigui_vlist_get_index(const lv_obj_t *row);
+
+/**
+ * @brief Number of row objects the list has created
+ */
+uint32_t minigui_vlist_get_row_count(const lv_obj_t *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_VLIST_H
@@ -0,0 +1,178 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Wi-Fi Apply Flow.
+ **
+ **            Asynchronous hand-off of Wi-Fi credentials. The UI starts an
+ **            apply request and returns at once; the integration saves and
+ **            connects on its own task and reports each stage back with
+ **            minigui_wifi_apply_report(). Stages are published through an
+ **            LVGL subject, so status widgets update through their observer
+ **            and are unsubscribed automatically when deleted. A request can
+ **            be cancelled and times out after MINIGUI_WIFI_APPLY_TIMEOUT_MS.
+ **
+ **            @section minigui_wifi.h - Wi-Fi apply interface.
+ ******************************************************************************
+ ******************************************************************************/
+
+#ifndef MINIGUI_WIFI_H
+#define MINIGUI_WIFI_H
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * ENUMS & TYPEDEFS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Progress of the current (or last) apply request
+ */
+typedef enum {
+    MINIGUI_WIFI_APPLY_IDLE = 0,      /**< Nothing applied yet */
+    MINIGUI_WIFI_APPLY_SAVING,        /**< Handed to the integration */
+    MINIGUI_WIFI_APPLY_SAVED,         /**< Credentials persisted */
+    MINIGUI_WIFI_APPLY_ASSOCIATING,   /**< Connecting to the access point */
+    MINIGUI_WIFI_APPLY_DHCP,          /**< Associated, waiting for an address */
+    MINIGUI_WIFI_APPLY_CONNECTED,     /**< Done (final) */
+    MINIGUI_WIFI_APPLY_FAILED,        /**< Rejected or connection failed (final) */
+    MINIGUI_WIFI_APPLY_TIMEOUT,       /**< No final stage in time (final) */
+    MINIGUI_WIFI_APPLY_CANCELLED,     /**< Cancelled by the user (final) */
+    MINIGUI_WIFI_APPLY_STAGE_COUNT
+} minigui_wifi_apply_stage_t;
+
+/**
+ * @brief Starts applying credentials for request @p request
+ *
+ * Runs on the LVGL task with the LVGL lock held and must not block: copy
+ * the credentials, queue the work to another task and return. Return false
+ * to reject the request at once (reported as FAILED).
+ */
+typedef bool (*minigui_wifi_apply_cb_t)(const minigui_wifi_credentials_t *creds, uint32_t request);
+
+/**
+ * @brief Abandons request @p request (cancelled or timed out)
+ */
+typedef void (*minigui_wifi_cancel_cb_t)(uint32_t request);
+
+
+/******************************************************************************
+ ******************************************************************************
+ * PUBLIC API FUNCTIONS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Register the asynchronous apply handler (NULL, NULL to remove)
+ *
+ * Without a handler, minigui_wifi_apply() falls back to the synchronous
+ * callback of minigui_register_wifi_save_cb() and ends at SAVED.
+ */
+void minigui_register_wifi_apply_cb(minigui_wifi_apply_cb_t apply, minigui_wifi_cancel_cb_t cancel);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Start applying credentials.
+ *
+ * @section call_site
+ * Called by the Settings Wi-Fi form (LVGL task) or application code.
+ *
+ * @section dependencies
+ * - `lvgl.h`: Timeout timer, subject.
+ *
+ * @param creds Credentials (only read during the call).
+ *
+ * @section pointers
+ * - `creds`: Not retained.
+ *
+ * @section variables
+ * - None
+ *
+ * @return Request id (never 0) to report stages against.
+ *
+ * Implementation Steps
+ * 1. Cancel a request that is still running.
+ * 2. Publish SAVING and arm the timeout.
+ * 3. Hand the credentials to the apply handler, or to the legacy save
+ *    callback; a rejected request ends as FAILED.
+ ******************************************************************************/
+uint32_t minigui_wifi_apply(const minigui_wifi_credentials_t *creds);
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Report the progress of a request.
+ *
+ * @section call_site
+ * Called from any task (Wi-Fi event handler, connection task).
+ *
+ * @section dependencies
+ * - `minigui_lock.h`: LVGL lock.
+ *
+ * @param request Id returned by minigui_wifi_apply() / passed to the handler.
+ * @param stage   SAVED through FAILED.
+ *
+ * @section pointers
+ * - None
+ *
+ * @section variables
+ * - None
+ *
+ * @return void
+ *
+ * Implementation Steps
+ * 1. Ignore stale requests (cancelled, timed out or replaced).
+ * 2. Publish the stage; a final stage ends the request and its timeout.
+ ******************************************************************************/
+void minigui_wifi_apply_report(uint32_t request, minigui_wifi_apply_stage_t stage);
+
+/**
+ * @brief Cancel the running request (calls the cancel handler)
+ */
+void minigui_wifi_apply_cancel(void);
+
+/** @brief Stage of the current or last request */
+minigui_wifi_apply_stage_t minigui_wifi_apply_get_stage(void);
+
+/** @brief Whether a request is running */
+bool minigui_wifi_apply_is_busy(void);
+
+/** @brief Short status text for a stage ("Connecting...") */
+const char *minigui_wifi_apply_stage_text(minigui_wifi_apply_stage_t stage);
+
+/**
+ * @brief Integer subject holding the current stage
+ *
+ * Bind status widgets with lv_subject_add_observer_obj(); observers run
+ * under the LVGL lock on the task that reported the stage.
+ */
+lv_subject_t *minigui_wifi_apply_subject(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MINIGUI_WIFI_H
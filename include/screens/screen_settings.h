@@ -67,6 +67,53 @@ extern "C" {
  ******************************************************************************/
 void create_screen_settings(lv_obj_t *parent);
 
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Shows a settings category on the currently open Settings screen.
+ **
+ ** @section call_site Called from:
+ ** - Regression runner / external navigation (e.g. deep links).
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (thread-safe locking)
+ **
+ ** @param category (uint32_t): Category index below
+ **                             screen_settings_get_category_count().
+ **
+ ** @section pointers 
+ ** - None
+ **
+ ** @section variables 
+ ** - None
+ **
+ ** @return void
+ ******************************************************************************
+ ******************************************************************************/
+void screen_settings_show_category(uint32_t category);
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Returns the number of settings categories.
+ **
+ ** @section call_site Called from:
+ ** - Regression runner to enumerate every category.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param None
+ **
+ ** @section pointers 
+ ** - None
+ **
+ ** @section variables 
+ ** - None
+ **
+ ** @return uint32_t: Category count.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t screen_settings_get_category_count(void);
+
 #ifdef __cplusplus
 }
 #endif
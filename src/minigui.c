@@ -16,7 +16,6 @@
  ******************************************************************************
  ******************************************************************************/
 #include <time.h>
-#include <stdio.h>
 #include <string.h>
 
 /******************************************************************************
@@ -32,10 +31,28 @@
  ******************************************************************************
  ******************************************************************************/
 #include "minigui.h"
+#include "minigui_lock.h"
+#include "minigui_abs_layout.h"
+#include "minigui_alert.h"
+#include "minigui_alloc.h"
+#include "minigui_ctx.h"
+#include "minigui_fmt.h"
+#include "minigui_layout.h"
 #include "minigui_menu.h"
+#include "minigui_metrics.h"
+#include "minigui_store.h"
+#include "minigui_theme.h"
+#include "minigui_toast.h"
+#include "minigui_ui_builder.h"
+#if MINIGUI_ENABLE_HOME
 #include "screens/screen_home.h"
+#endif
+#if MINIGUI_ENABLE_LOGS
 #include "screens/screen_logs.h"
+#endif
+#if MINIGUI_ENABLE_SETTINGS
 #include "screens/screen_settings.h"
+#endif
 
 /******************************************************************************
  ******************************************************************************
@@ -45,68 +62,57 @@
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Reference to the main flex container.
+ ** @brief One UI instance: the views built on one display.
  **
  ** @section scope Internal Scope:
- ** - Internal to minigui.c.
- **
- ** @section rationale Rationale:
- ** - Acts as the root parent for all UI elements created by this module.
- ******************************************************************************
- ******************************************************************************/
-static lv_obj_t *main_container = NULL;
-
-/******************************************************************************
- ******************************************************************************
- ** @brief Reference to the top status bar.
- **
- ** @section scope Internal Scope:
- ** - Internal to minigui.c.
+ ** - Layout is internal to minigui.c; other modules use minigui_ctx.h.
  **
  ** @section rationale Rationale:
- ** - Holds the menu button, title, and clock.
+ ** - Everything a display needs to render its own UI lives here, so a
+ **   second panel costs one context plus its LVGL objects. Providers and
+ **   data stores below stay file-global and are shared.
  ******************************************************************************
  ******************************************************************************/
-static lv_obj_t *status_bar = NULL;
-
-/******************************************************************************
- ******************************************************************************
- ** @brief Reference to the dynamic content area.
- **
- ** @section scope Internal Scope:
- ** - Internal to minigui.c.
- **
- ** @section rationale Rationale:
- ** - This is where different screens (Home, Logs, etc.) inject their content.
- ******************************************************************************
- ******************************************************************************/
-static lv_obj_t *content_area = NULL;
+struct minigui_ctx {
+    lv_display_t *disp;           // Display the views are built on
+    lv_obj_t *main_container;     // Root parent for all UI elements of this instance
+    lv_obj_t *status_bar;         // Holds the menu button, title, and clock
+    lv_obj_t *content_area;       // Where screens (Home, Logs, etc.) inject their content
+    lv_obj_t *lbl_title;          // Reflects the current view name
+    lv_obj_t *lbl_clock;          // Updated every second by the shared clock timer
+    minigui_menu_t menu;          // Drawer and dimmer on the display's top layer
+    minigui_screen_t screen;      // Screen shown in content_area
+    void *view;                   // State registered by that screen (owned by it)
+};
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Reference to the screen title label.
+ ** @brief Registry of live contexts.
  **
  ** @section scope Internal Scope:
  ** - Internal to minigui.c.
  **
  ** @section rationale Rationale:
- ** - Updated whenever the screen changes to reflect the current view name.
+ ** - Event handlers resolve their instance by display (minigui_ctx_from_obj),
+ **   so widgets need no per-object back pointers.
+ ** - @c default_ctx backs the legacy single-display API.
  ******************************************************************************
  ******************************************************************************/
-static lv_obj_t *lbl_title = NULL;
+static minigui_ctx_t *contexts[MINIGUI_MAX_CONTEXTS];
+static minigui_ctx_t *default_ctx = NULL;
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Reference to the clock label.
+ ** @brief Timer driving every context's clock label.
  **
  ** @section scope Internal Scope:
  ** - Internal to minigui.c.
  **
  ** @section rationale Rationale:
- ** - Updated every second by a timer to show current time.
+ ** - One timer and one time query per second regardless of display count.
  ******************************************************************************
  ******************************************************************************/
-static lv_obj_t *lbl_clock = NULL;
+static lv_timer_t *clock_timer = NULL;
 
 // Callback hooks
 /******************************************************************************
@@ -196,13 +202,21 @@ static minigui_network_status_provider_t network_status_provider = NULL;
  **
  ** @section rationale Rationale:
  ** - Decouples screen switching logic from individual implementations.
+ ** - Generated from MINIGUI_SCREEN_LIST so disabled screens are never linked.
  ******************************************************************************
  ******************************************************************************/
+#define SCREEN_CREATOR_ENTRY(id, title, label, creator) [MINIGUI_SCREEN_##id] = creator,
 static const ui_screen_creator_t screen_creators[MINIGUI_SCREEN_COUNT] = {
-    [MINIGUI_SCREEN_HOME]     = create_screen_home,
-    [MINIGUI_SCREEN_LOGS]     = create_screen_logs,
-    [MINIGUI_SCREEN_SETTINGS] = create_screen_settings
+    MINIGUI_SCREEN_LIST(SCREEN_CREATOR_ENTRY)
+};
+#undef SCREEN_CREATOR_ENTRY
+
+// Status bar titles, indexed by minigui_screen_t
+#define SCREEN_TITLE_ENTRY(id, title, label, creator) [MINIGUI_SCREEN_##id] = title,
+static const char *const screen_titles[MINIGUI_SCREEN_COUNT] = {
+    MINIGUI_SCREEN_LIST(SCREEN_TITLE_ENTRY)
 };
+#undef SCREEN_TITLE_ENTRY
 
 // ============================================================================
 // PRIVATE HELPER FUNCTIONS
@@ -210,7 +224,7 @@ static const ui_screen_creator_t screen_creators[MINIGUI_SCREEN_COUNT] = {
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Updates the clock label with current system time.
+ ** @brief Updates every context's clock label with current system time.
  **
  ** @section call_site Called from:
  ** - lv_timer every 1000ms.
@@ -218,6 +232,7 @@ static const ui_screen_creator_t screen_creators[MINIGUI_SCREEN_COUNT] = {
  **
  ** @section dependencies Required Headers:
  ** - time.h (for standard time functions when no provider is set)
+ ** - minigui_fmt.h (clock formatting without strftime)
  **
  ** @param timer (lv_timer_t*): The LVGL timer instance triggering this callback.
  **
@@ -227,37 +242,47 @@ static const ui_screen_creator_t screen_creators[MINIGUI_SCREEN_COUNT] = {
  ** @section variables Internal Variables:
  ** - @c buf (char[32]): Storage for the formatted time string.
  ** - @c now (time_t): Epoch time from system clock.
- ** - @c tm_info (struct tm*): Broken down time structure.
+ ** - @c tm_info (struct tm): Broken down time structure.
  **
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Check if the clock label exists; return if not.
+ ** 1. Return if no context is alive.
  ** 2. If a global time provider is registered, use it to populate the buffer.
  ** 3. Otherwise, fall back to standard C time and localtime.
- ** 4. Format the time as "%a %m/%d %H:%M:%S".
- ** 5. Update the LVGL label text.
+ ** 4. Format the time as "%a %m/%d %H:%M:%S" with minigui_fmt_clock().
+ ** 5. Set the same text on every context's clock label.
  ******************************************************************************
  ******************************************************************************/
 static void update_clock_cb(lv_timer_t *timer) {
     (void)timer;
-    if (!lbl_clock) return;
+
+    bool any = false;
+    for (uint32_t i = 0; i < MINIGUI_MAX_CONTEXTS; i++) {
+        if (contexts[i]) any = true;
+    }
+    if (!any) return;
 
     char buf[32];
 
     // 1. Try the registered time provider first
     if (global_time_provider) {
+        uint32_t t0 = MINIGUI_METRICS_START();
         global_time_provider(buf, sizeof(buf));
+        MINIGUI_METRICS_STOP(MINIGUI_METRICS_PROVIDER_TIME, t0);
     }
     // 2. Fall back to standard C time library
     else {
         time_t now = time(NULL);
-        struct tm *tm_info = localtime(&now);
+        struct tm tm_info;
+        localtime_r(&now, &tm_info);
         // Format: "Sat 02/07 12:08:45"
-        strftime(buf, sizeof(buf), "%a %m/%d %H:%M:%S", tm_info);
+        minigui_fmt_clock(buf, sizeof(buf), &tm_info);
     }
 
-    lv_label_set_text(lbl_clock, buf);
+    for (uint32_t i = 0; i < MINIGUI_MAX_CONTEXTS; i++) {
+        if (contexts[i]) lv_label_set_text(contexts[i]->lbl_clock, buf);
+    }
 }
 
 /******************************************************************************
@@ -268,7 +293,7 @@ static void update_clock_cb(lv_timer_t *timer) {
  ** - Hamburger button's LV_EVENT_CLICKED.
  **
  ** @section dependencies Required Headers:
- ** - minigui_menu.h (for minigui_menu_toggle)
+ ** - minigui_ctx.h (to resolve the button's context)
  **
  ** @param e (lv_event_t*): LVGL event object.
  **
@@ -282,12 +307,12 @@ static void update_clock_cb(lv_timer_t *timer) {
  **
  ** Implementation Steps:
  ** 1. Log the user interaction using LV_LOG_USER.
- ** 2. Call minigui_menu_toggle() to show/hide the sidebar.
+ ** 2. Toggle the sidebar of the context that owns the button.
  ******************************************************************************
  ******************************************************************************/
 static void menu_btn_event_cb(lv_event_t * e) {
     LV_LOG_USER("Hamburger menu toggled");
-    minigui_menu_toggle();
+    minigui_ctx_toggle_menu(minigui_ctx_from_obj(lv_event_get_target(e)));
 }
 
 /******************************************************************************
@@ -328,184 +353,477 @@ static void sync_square_size_cb(lv_event_t * e) {
     }
 }
 
+// ============================================================================
+// LAYOUT TABLES
+// ============================================================================
+
+/**
+ * @brief Constant styles for the application skeleton (flash-resident)
+ */
+static const lv_style_const_prop_t main_container_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_HEIGHT(LV_PCT(100)),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX), LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_PAD_TOP(0), LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0), LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0), LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_BORDER_WIDTH(0), LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_main_container, main_container_props);
+
+static const lv_style_const_prop_t status_bar_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), // Height comes from the layout profile
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX), LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_BORDER_WIDTH(0), LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_PAD_TOP(0), LV_STYLE_CONST_PAD_BOTTOM(0), LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(15), // Padding for the clock on the right
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_status_bar, status_bar_props);
+
+static const lv_style_const_prop_t menu_button_props[] = {
+    LV_STYLE_CONST_HEIGHT(LV_PCT(100)), LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_BORDER_WIDTH(1), LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_RIGHT),
+    LV_STYLE_CONST_SHADOW_WIDTH(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_menu_button, menu_button_props);
+
+static const lv_style_const_prop_t title_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(MINIGUI_FONT_TITLE),
+    LV_STYLE_CONST_FLEX_GROW(1), // Pushes the clock to the right
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_title, title_props);
+
+static const lv_style_const_prop_t clock_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_LEFT),
+    LV_STYLE_CONST_MARGIN_RIGHT(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_clock, clock_props);
+
+static const lv_style_const_prop_t content_area_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_FLEX_GROW(1),
+    LV_STYLE_CONST_BORDER_WIDTH(0), LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_PAD_TOP(0), LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0), LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_content_area, content_area_props);
+
+/**
+ * @brief Application skeleton: main column, status bar, content area
+ */
+enum {
+    UI_MAIN_CONTAINER,
+    UI_STATUS_BAR,
+    UI_BTN_MENU,
+    UI_TITLE,
+    UI_CLOCK,
+    UI_CONTENT_AREA,
+    UI_NODE_COUNT
+};
+
+enum { UI_EV_MENU = 1 };
+
+static const minigui_ui_node_t skeleton_nodes[UI_NODE_COUNT] = {
+    [UI_MAIN_CONTAINER] = MINIGUI_UI_NODE_OBJ(MINIGUI_UI_ROOT, &style_main_container),
+    [UI_STATUS_BAR]     = MINIGUI_UI_NODE_OBJ(UI_MAIN_CONTAINER, &style_status_bar),
+    [UI_BTN_MENU]       = MINIGUI_UI_NODE_BUTTON(UI_STATUS_BAR, &style_menu_button, LV_SYMBOL_LIST, UI_EV_MENU),
+    [UI_TITLE]          = MINIGUI_UI_NODE_LABEL(UI_STATUS_BAR, &style_title, "Dashboard"),
+    [UI_CLOCK]          = MINIGUI_UI_NODE_LABEL(UI_STATUS_BAR, &style_clock, NULL),
+    [UI_CONTENT_AREA]   = MINIGUI_UI_NODE_OBJ(UI_MAIN_CONTAINER, &style_content_area),
+};
+
+static const lv_event_cb_t skeleton_handlers[] = {
+    [UI_EV_MENU - 1] = menu_btn_event_cb,
+};
+
+static const minigui_ui_desc_t skeleton_desc = MINIGUI_UI_DESC(skeleton_nodes, skeleton_handlers);
+
+/**
+ * @brief Theme role of each skeleton node (colors are not in the constant styles)
+ */
+static const uint8_t skeleton_roles[UI_NODE_COUNT] = {
+    [UI_MAIN_CONTAINER] = MINIGUI_THEME_SCREEN,
+    [UI_STATUS_BAR]     = MINIGUI_THEME_STATUS_BAR,
+    [UI_BTN_MENU]       = MINIGUI_THEME_MENU_BUTTON,
+    [UI_TITLE]          = MINIGUI_THEME_TITLE,
+    [UI_CLOCK]          = MINIGUI_THEME_CLOCK,
+    [UI_CONTENT_AREA]   = MINIGUI_THEME_SCREEN,
+};
+
 // ============================================================================
 // PUBLIC API FUNCTIONS
 // ============================================================================
 
 /******************************************************************************
  ******************************************************************************
- * @brief Initialize the UI manager dynamically and set up flex layouts.
+ * @brief Create a UI instance on a display.
  *
  * @section call_site
- * Called from `app_main` or similar entry point.
+ * Called once per panel, and by `minigui_init()` for the default display.
  *
  * @section dependencies
- * - `minigui_menu.h`: For menu initialization.
+ * - `minigui_menu.h`: For the per-instance menu.
+ * - `minigui_alloc.h`: Context storage (internal pool).
  * - `lvgl`: For all UI creation and thread-safe locks (`lv_lock`).
  *
- * @param None
+ * @param disp Display to bind to (NULL = default display).
  *
  * @section pointers
- * - None
+ * - `disp`: Owned by the application.
  *
  * @section variables
- * - `scr`: Pointer to the active LVGL screen. Rationale: Root parent for UI elements.
- * - `btn_menu`: Pointer to hamburger button. Rationale: Toggles the sideline menu.
- * - `label_menu`: Pointer to hamburger icon label. Rationale: Displays LV_SYMBOL_LIST.
+ * - `scr`: The display's active screen. Rationale: Root parent for UI elements.
+ * - `ui`: Node handles for `skeleton_desc`. Rationale: Sized by the table at compile time.
+ * - `slot`: Free registry index.
  *
- * @return void
+ * @return The new context, or NULL.
  *
  * Implementation Steps
- * 1. Log initialization start.
- * 2. Acquire LVGL lock (`lv_lock`) for thread safety.
- * 3. Initialize the side menu system.
+ * 1. Resolve the display and acquire the LVGL lock (`MINIGUI_LOCK`).
+ * 2. Reject a display that already has a context, or a full registry.
+ * 3. Allocate the context and build its menu on the display's top layer.
  * 4. Configure the active screen background to black.
- * 5. Create the `main_container` with a vertical flex layout to hold status bar and content.
- * 6. Create the `status_bar` with a horizontal flex layout.
- * 7. Create the hamburger button and attach the square-size sync callback.
- * 8. Create the title label with flex-grow to push the clock to the right.
- * 9. Create the clock label and perform an initial update.
- * 10. Create a 1-second timer to keep the clock updated.
- * 11. Create the `content_area` container which will hold screen-specific widgets.
- * 12. Release LVGL lock (`lv_unlock`).
- * 13. Default to the Home screen by calling `minigui_switch_screen`.
+ * 5. Build `skeleton_desc` (main column, status bar with hamburger button,
+ *    title and clock, content area) in one pass with `minigui_ui_build`.
+ * 6. Apply the display's profile status bar height and clock width, and
+ *    attach the square-size sync callback to the hamburger button.
+ * 7. Freeze the skeleton layout (MINIGUI_ABSOLUTE_LAYOUT).
+ * 8. Register the context (first one becomes default), start the shared
+ *    clock timer and toasts if needed and perform an initial clock update.
+ * 9. Release LVGL lock (`MINIGUI_UNLOCK`).
+ * 10. Show MINIGUI_SCREEN_DEFAULT with `minigui_ctx_switch_screen`.
  ******************************************************************************/
-void minigui_init(void) {
-    // Using LVGL native logging instead of ESP_LOG
+minigui_ctx_t *minigui_ctx_create(lv_display_t *disp) {
+    if (!disp) disp = lv_display_get_default();
+    if (!disp) return NULL;
+
     LV_LOG_INFO("MiniGUI: Initializing nested flex layout...");
 
-    lv_lock();
-
-    minigui_menu_init();
-
-    lv_obj_t *scr = lv_screen_active();
-    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
-
-    // 1. MAIN CONTAINER (Vertical Flex Box)
-    main_container = lv_obj_create(scr);
-    lv_obj_set_size(main_container, lv_pct(100), lv_pct(100));
-    lv_obj_set_flex_flow(main_container, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_pad_all(main_container, 0, 0);
-    lv_obj_set_style_pad_gap(main_container, 0, 0);
-    lv_obj_set_style_border_width(main_container, 0, 0);
-    lv_obj_set_style_radius(main_container, 0, 0);
-    lv_obj_set_style_bg_color(main_container, lv_color_black(), 0);
-
-    // 2. STATUS BAR (Flex Row)
-    status_bar = lv_obj_create(main_container);
-    lv_obj_set_size(status_bar, lv_pct(100), lv_pct(12));
-    lv_obj_set_flex_flow(status_bar, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(status_bar, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_bg_color(status_bar, lv_color_hex(0x202020), 0);
-    lv_obj_set_style_border_width(status_bar, 0, 0);
-    lv_obj_set_style_radius(status_bar, 0, 0);
-    lv_obj_set_style_pad_all(status_bar, 0, 0);
-    lv_obj_set_style_pad_right(status_bar, 15, 0); // Padding for the clock on the right
-    lv_obj_set_scrollbar_mode(status_bar, LV_SCROLLBAR_MODE_OFF);
-
-    // 3. HAMBURGER BUTTON
-    lv_obj_t *btn_menu = lv_button_create(status_bar);
-    lv_obj_set_height(btn_menu, lv_pct(100));
-    lv_obj_add_event_cb(btn_menu, sync_square_size_cb, LV_EVENT_SIZE_CHANGED, NULL);
-    lv_obj_set_style_radius(btn_menu, 0, 0);
-    lv_obj_set_style_bg_color(btn_menu, lv_color_hex(0x222222), 0);
-    lv_obj_set_style_border_width(btn_menu, 1, 0);
-    lv_obj_set_style_border_side(btn_menu, LV_BORDER_SIDE_RIGHT, 0);
-    lv_obj_set_style_border_color(btn_menu, lv_color_hex(0x444444), 0);
-    lv_obj_set_style_shadow_width(btn_menu, 0, 0);
-
-    lv_obj_t *label_menu = lv_label_create(btn_menu);
-    lv_label_set_text(label_menu, LV_SYMBOL_LIST);
-    lv_obj_center(label_menu);
-    lv_obj_add_event_cb(btn_menu, menu_btn_event_cb, LV_EVENT_CLICKED, NULL);
-
-    // 4. TITLE (Flex grow will push neighbors aside)
-    lbl_title = lv_label_create(status_bar);
-    lv_label_set_text(lbl_title, "Dashboard");
-    lv_obj_set_style_text_font(lbl_title, &lv_font_montserrat_36, 0);
-    lv_obj_set_style_text_color(lbl_title, lv_color_white(), 0);
-    lv_obj_set_flex_grow(lbl_title, 1);
-    lv_obj_set_style_text_align(lbl_title, LV_TEXT_ALIGN_CENTER, 0);
-
-    // 5. CLOCK (Placed after title, will be on the right)
-    lbl_clock = lv_label_create(status_bar);
-    lv_obj_set_style_text_font(lbl_clock, &lv_font_montserrat_20, 0);
-    lv_obj_set_style_text_color(lbl_clock, lv_color_hex(0xAAAAAA), 0);
-    lv_obj_set_width(lbl_clock, 180); // INCREASED WIDTH for longer date format
-    lv_obj_set_style_text_align(lbl_clock, LV_TEXT_ALIGN_LEFT, 0);
-    lv_obj_set_style_margin_right(lbl_clock, 10, 0);
+    MINIGUI_LOCK();
+
+    int32_t slot = -1;
+    for (int32_t i = MINIGUI_MAX_CONTEXTS - 1; i >= 0; i--) {
+        if (!contexts[i]) {
+            slot = i;
+        } else if (contexts[i]->disp == disp) {
+            LV_LOG_WARN("MiniGUI: display already has a context");
+            MINIGUI_UNLOCK();
+            return NULL;
+        }
+    }
+    if (slot < 0) {
+        LV_LOG_ERROR("MiniGUI: all %d contexts in use", MINIGUI_MAX_CONTEXTS);
+        MINIGUI_UNLOCK();
+        return NULL;
+    }
+
+    minigui_ctx_t *ctx = (minigui_ctx_t *)minigui_malloc(MINIGUI_POOL_INTERNAL, sizeof(*ctx));
+    if (!ctx) {
+        LV_LOG_ERROR("MiniGUI: context allocation failed");
+        MINIGUI_UNLOCK();
+        return NULL;
+    }
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->disp = disp;
+    ctx->screen = MINIGUI_SCREEN_COUNT; // Nothing shown yet
+
+    minigui_menu_init(&ctx->menu, disp);
+
+    lv_obj_t *scr = lv_display_get_screen_active(disp);
+    lv_obj_add_style(scr, minigui_theme_style(MINIGUI_THEME_SCREEN), 0);
+
+    // 1. SKELETON (main column, status bar with menu/title/clock, content area)
+    lv_obj_t *ui[UI_NODE_COUNT];
+    minigui_ui_build(scr, &skeleton_desc, ui);
+    for (int i = 0; i < UI_NODE_COUNT; i++) {
+        if (skeleton_roles[i] != MINIGUI_THEME_ROLE_COUNT) {
+            lv_obj_add_style(ui[i], minigui_theme_style(skeleton_roles[i]), 0);
+        }
+    }
+
+    ctx->main_container = ui[UI_MAIN_CONTAINER];
+    ctx->status_bar = ui[UI_STATUS_BAR];
+    ctx->lbl_title = ui[UI_TITLE];
+    ctx->lbl_clock = ui[UI_CLOCK];
+    ctx->content_area = ui[UI_CONTENT_AREA];
+
+    const minigui_layout_t *layout = minigui_layout_get_for(disp);
+    lv_obj_set_height(ctx->status_bar, lv_pct(layout->status_bar_pct));
+    lv_obj_set_width(ctx->lbl_clock, layout->clock_w); // Wide enough for the long date format
+    lv_obj_set_scrollbar_mode(ctx->status_bar, LV_SCROLLBAR_MODE_OFF);
+    lv_obj_add_event_cb(ui[UI_BTN_MENU], sync_square_size_cb, LV_EVENT_SIZE_CHANGED, NULL);
+    minigui_abs_layout_apply(ctx->main_container, MINIGUI_ABS_KEY_SKELETON);
+
+    contexts[slot] = ctx;
+    if (!default_ctx) default_ctx = ctx;
+
+#if MINIGUI_ENABLE_METRICS
+    minigui_metrics_attach_display(disp);
+#endif
+
+    // Create timer for 1s updates (shared by all contexts)
+    if (!clock_timer) clock_timer = lv_timer_create(update_clock_cb, 1000, NULL);
+    minigui_toast_start(disp);
 
     // Initial update
     update_clock_cb(NULL);
 
-    // Create timer for 1s updates
-    lv_timer_create(update_clock_cb, 1000, NULL);
+    MINIGUI_UNLOCK();
+
+    minigui_ctx_switch_screen(ctx, MINIGUI_SCREEN_DEFAULT);
+    return ctx;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Destroy a UI instance.
+ **
+ ** @section call_site Called from:
+ ** - Application (panel removed or shut down).
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (object and timer deletion)
+ **
+ ** @param ctx (minigui_ctx_t*): Context to destroy.
+ **
+ ** @section pointers 
+ ** - ctx: Freed; invalid after the call.
+ **
+ ** @section variables Internal Variables:
+ ** - @c any (bool): Whether another context is still alive.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Acquire LVGL lock (MINIGUI_LOCK).
+ ** 2. Unregister the context first so view delete handlers see no context.
+ ** 3. Delete the skeleton (views free their own state) and the menu.
+ ** 4. Remove the display's toasts. Promote another context to default, or
+ **    stop the clock timer when none is left.
+ ** 5. Release LVGL lock and free the context.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_ctx_destroy(minigui_ctx_t *ctx) {
+    if (!ctx) return;
+
+    MINIGUI_LOCK();
+
+    for (uint32_t i = 0; i < MINIGUI_MAX_CONTEXTS; i++) {
+        if (contexts[i] == ctx) contexts[i] = NULL;
+    }
+    ctx->view = NULL;
+
+    lv_obj_delete(ctx->main_container);
+    minigui_menu_deinit(&ctx->menu);
+#if MINIGUI_ENABLE_METRICS
+    minigui_metrics_detach_display(ctx->disp);
+#endif
+
+    bool any = false;
+    if (default_ctx == ctx) default_ctx = NULL;
+    for (uint32_t i = 0; i < MINIGUI_MAX_CONTEXTS; i++) {
+        if (!contexts[i]) continue;
+        any = true;
+        if (!default_ctx) default_ctx = contexts[i];
+    }
 
-    // 6. CONTENT AREA
-    content_area = lv_obj_create(main_container);
-    lv_obj_set_width(content_area, lv_pct(100));
-    lv_obj_set_flex_grow(content_area, 1);
-    lv_obj_set_style_bg_color(content_area, lv_color_black(), 0);
-    lv_obj_set_style_bg_opa(content_area, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(content_area, 0, 0);
-    lv_obj_set_style_radius(content_area, 0, 0);
-    lv_obj_set_style_pad_all(content_area, 0, 0);
+    if (!any && clock_timer) {
+        lv_timer_delete(clock_timer);
+        clock_timer = NULL;
+    }
+    minigui_toast_stop(ctx->disp);
 
-    lv_unlock();
+    MINIGUI_UNLOCK();
 
-    minigui_switch_screen(MINIGUI_SCREEN_HOME);
+    minigui_free(MINIGUI_POOL_INTERNAL, ctx);
 }
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Switch the active screen rendered in the main content area.
+ ** @brief Switch the screen rendered in a context's content area.
  **
  ** @section call_site Called from:
- ** - minigui_init() for initial screen set.
- ** - Menu system interaction.
- ** - External navigation triggers.
+ ** - minigui_ctx_create() for the initial screen.
+ ** - Menu navigation buttons (context of the clicked button).
+ ** - minigui_switch_screen() for the default context.
  **
  ** @section dependencies Required Headers:
  ** - lvgl.h (for UI cleanup and creation)
  **
+ ** @param ctx (minigui_ctx_t*): Target context.
  ** @param screen_type (minigui_screen_t): The ID of the screen to switch to.
  **
  ** @section pointers 
- ** - None
+ ** - ctx: Owned by the application.
  **
  ** @section variables Internal Variables:
- ** - @c titles (const char*[]): Array of screen display titles.
+ ** - @c screen_titles (const char*[]): Screen display titles (file scope).
  **
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Validate the screen ID and existence of content_area.
+ ** 1. Validate the context and screen ID.
  ** 2. Log the screen switch event.
- ** 3. Acquire LVGL lock (lv_lock).
- ** 4. Clear all children from content_area.
- ** 5. Reset scroll and flex properties on content_area.
+ ** 3. Acquire LVGL lock (MINIGUI_LOCK).
+ ** 4. Drop the old view reference, then clear the content area (the old
+ **    screen frees its state from LV_EVENT_DELETE).
+ ** 5. Reset scroll and flex properties on the content area.
  ** 6. Update the title label text.
- ** 7. Invoke the creator function for the requested screen if it exists.
- ** 8. Release LVGL lock (lv_unlock).
+ ** 7. Record the new screen and invoke its creator if it exists, then freeze
+ **    its layout (MINIGUI_ABSOLUTE_LAYOUT).
+ ** 8. Release LVGL lock (MINIGUI_UNLOCK).
  ******************************************************************************
  ******************************************************************************/
-void minigui_switch_screen(minigui_screen_t screen_type) {
-    if (screen_type >= MINIGUI_SCREEN_COUNT || !content_area) return;
+void minigui_ctx_switch_screen(minigui_ctx_t *ctx, minigui_screen_t screen_type) {
+    if (!ctx || screen_type >= MINIGUI_SCREEN_COUNT) return;
 
     LV_LOG_INFO("MiniGUI: Switching to screen ID %d", screen_type);
 
-    lv_lock();
-    lv_obj_clean(content_area);
-    lv_obj_set_style_flex_flow(content_area, 0, 0);
-    lv_obj_set_scrollbar_mode(content_area, LV_SCROLLBAR_MODE_AUTO);
+    MINIGUI_LOCK();
+    uint32_t t0 = MINIGUI_METRICS_START();
+    ctx->view = NULL;
+    lv_obj_clean(ctx->content_area);
+    lv_obj_set_style_flex_flow(ctx->content_area, 0, 0);
+    lv_obj_set_scrollbar_mode(ctx->content_area, LV_SCROLLBAR_MODE_AUTO);
 
-    const char *titles[] = {"Home", "System Logs", "Settings"};
-    lv_label_set_text(lbl_title, titles[screen_type]);
+    lv_label_set_text(ctx->lbl_title, screen_titles[screen_type]);
 
+    ctx->screen = screen_type;
     if (screen_creators[screen_type]) {
-        screen_creators[screen_type](content_area);
+        screen_creators[screen_type](ctx->content_area);
+        minigui_abs_layout_apply(ctx->content_area, MINIGUI_ABS_KEY_SCREEN(screen_type));
+    }
+    MINIGUI_METRICS_STOP(MINIGUI_METRICS_SCREEN_BUILD, t0);
+    MINIGUI_UNLOCK();
+}
+
+void minigui_ctx_toggle_menu(minigui_ctx_t *ctx) {
+    if (!ctx) return;
+    MINIGUI_LOCK();
+    minigui_menu_toggle(&ctx->menu);
+    MINIGUI_UNLOCK();
+}
+
+minigui_ctx_t *minigui_ctx_get_default(void) { return default_ctx; }
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Context that owns an object.
+ **
+ ** @section call_site Called from:
+ ** - Event handlers of the skeleton, menu and screens.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_obj_get_display)
+ **
+ ** @param obj (const lv_obj_t*): Object on a context's screen or top layer.
+ **
+ ** @section pointers 
+ ** - obj: Owned by LVGL.
+ **
+ ** @section variables Internal Variables:
+ ** - @c disp (lv_display_t*): Display the object is rendered on.
+ **
+ ** @return minigui_ctx_t*: Matching context or NULL.
+ **
+ ** Implementation Steps:
+ ** 1. Resolve the object's display.
+ ** 2. Match it against the registry (an unregistered, dying context never
+ **    matches, so its delete handlers cannot reach another instance).
+ ******************************************************************************
+ ******************************************************************************/
+minigui_ctx_t *minigui_ctx_from_obj(const lv_obj_t *obj) {
+    if (!obj) return NULL;
+
+    lv_display_t *disp = lv_obj_get_display(obj);
+    for (uint32_t i = 0; i < MINIGUI_MAX_CONTEXTS; i++) {
+        if (contexts[i] && contexts[i]->disp == disp) return contexts[i];
     }
-    lv_unlock();
+    return NULL;
+}
+
+lv_display_t *minigui_ctx_get_display(const minigui_ctx_t *ctx) { return ctx ? ctx->disp : NULL; }
+
+lv_obj_t *minigui_ctx_get_content_area(const minigui_ctx_t *ctx) { return ctx ? ctx->content_area : NULL; }
+
+minigui_screen_t minigui_ctx_get_screen(const minigui_ctx_t *ctx) {
+    return ctx ? ctx->screen : MINIGUI_SCREEN_COUNT;
+}
+
+void minigui_ctx_set_view(minigui_ctx_t *ctx, void *view) {
+    if (ctx) ctx->view = view;
+}
+
+void *minigui_ctx_get_view(const minigui_ctx_t *ctx, minigui_screen_t screen) {
+    if (!ctx || ctx->screen != screen) return NULL;
+    return ctx->view;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ * @brief Initialize the UI manager on the default display.
+ *
+ * @section call_site
+ * Called from `app_main` or similar entry point.
+ *
+ * @section dependencies
+ * - `minigui_ctx.h`: The default context.
+ *
+ * @param None
+ *
+ * @section pointers
+ * - None
+ *
+ * @section variables
+ * - None
+ *
+ * @return void
+ *
+ * Implementation Steps
+ * 1. Ignore repeated calls.
+ * 2. Create a context on the default display; being the first, it becomes
+ *    the default context behind the legacy API.
+ ******************************************************************************/
+void minigui_init(void) {
+    if (default_ctx) return;
+    minigui_ctx_create(NULL);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Switch the active screen of the default context.
+ **
+ ** @section call_site Called from:
+ ** - External navigation triggers, benchmarks.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param screen_type (minigui_screen_t): The ID of the screen to switch to.
+ **
+ ** @section pointers 
+ ** - None
+ **
+ ** @section variables 
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Delegate to minigui_ctx_switch_screen() (no-op before minigui_init).
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_switch_screen(minigui_screen_t screen_type) {
+    minigui_ctx_switch_screen(default_ctx, screen_type);
 }
 
 /******************************************************************************
@@ -667,17 +985,17 @@ void minigui_register_network_status_provider(minigui_network_status_provider_t
  * @return void
  *
  * Implementation Steps
- * 1. Store the provider globally.
- * 2. Acquire LVGL lock (`lv_lock`).
- * 3. Immediately update the clock via `update_clock_cb` to reflect new source.
- * 4. Release LVGL lock (`lv_unlock`).
+ * 1. Store the provider globally (shared by all contexts).
+ * 2. Acquire LVGL lock (`MINIGUI_LOCK`).
+ * 3. Immediately update the clocks via `update_clock_cb` to reflect new source.
+ * 4. Release LVGL lock (`MINIGUI_UNLOCK`).
  ******************************************************************************/
 void minigui_set_time_provider(minigui_time_provider_t provider) {
     global_time_provider = provider;
     // Update immediately if possible
-    lv_lock();
-    if (lbl_clock) update_clock_cb(NULL);
-    lv_unlock();
+    MINIGUI_LOCK();
+    update_clock_cb(NULL);
+    MINIGUI_UNLOCK();
 }
 
 /******************************************************************************
@@ -688,7 +1006,7 @@ void minigui_set_time_provider(minigui_time_provider_t provider) {
  ** - Settings screen brightness slider.
  **
  ** @section dependencies Required Headers:
- ** - None
+ ** - minigui_store.h (persisted value)
  **
  ** @param brightness (uint8_t): Target brightness value (0-255).
  **
@@ -701,18 +1019,21 @@ void minigui_set_time_provider(minigui_time_provider_t provider) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Check if a callback is registered in @c brightness_cb.
- ** 2. If present, invoke it with the new brightness value.
+ ** 1. Record the value in the settings store (committed write-behind).
+ ** 2. If a callback is registered in @c brightness_cb, invoke it.
  ******************************************************************************
  ******************************************************************************/
-void minigui_set_brightness(uint8_t brightness) { if (brightness_cb) brightness_cb(brightness); }
+void minigui_set_brightness(uint8_t brightness) {
+    minigui_store_set_i32(MINIGUI_STORE_KEY_BRIGHTNESS, brightness);
+    if (brightness_cb) brightness_cb(brightness);
+}
 
 /******************************************************************************
  ******************************************************************************
  ** @brief Internal helper to trigger the WiFi save callback.
  **
  ** @section call_site Called from:
- ** - Settings screen WiFi panel submission.
+ ** - minigui_wifi_apply() when no asynchronous handler is registered.
  **
  ** @section dependencies Required Headers:
  ** - None
@@ -725,15 +1046,17 @@ void minigui_set_brightness(uint8_t brightness) { if (brightness_cb) brightness_
  ** @section variables 
  ** - None
  **
- ** @return void
+ ** @return bool: true if a callback was registered and ran.
  **
  ** Implementation Steps:
  ** 1. Check if @c wifi_save_cb is registered.
  ** 2. Execute the callback with the provided credentials.
  ******************************************************************************
  ******************************************************************************/
-void minigui_save_wifi_credentials(const minigui_wifi_credentials_t *creds) {
-    if (wifi_save_cb) wifi_save_cb(creds);
+bool minigui_save_wifi_credentials(const minigui_wifi_credentials_t *creds) {
+    if (!wifi_save_cb) return false;
+    wifi_save_cb(creds);
+    return true;
 }
 
 /******************************************************************************
@@ -760,16 +1083,20 @@ void minigui_save_wifi_credentials(const minigui_wifi_credentials_t *creds) {
  **
  ** Implementation Steps:
  ** 1. If a real provider is registered, delegate the scan to it.
- ** 2. Otherwise, use simulated mock network data.
- ** 3. Populate caller buffer with mock SSIDs and RSSIs.
+ ** 2. Otherwise, use simulated mock network data (MINIGUI_ENABLE_MOCKS).
+ ** 3. Populate caller buffer with mock SSIDs and RSSIs, or report none.
  ** 4. Return the result count.
  ******************************************************************************
  ******************************************************************************/
 size_t minigui_scan_wifi(minigui_wifi_network_t *networks, size_t max_count) {
     if (wifi_scan_provider) {
-        return wifi_scan_provider(networks, max_count);
+        uint32_t t0 = MINIGUI_METRICS_START();
+        size_t count = wifi_scan_provider(networks, max_count);
+        MINIGUI_METRICS_STOP(MINIGUI_METRICS_PROVIDER_WIFI_SCAN, t0);
+        return count;
     }
 
+#if MINIGUI_ENABLE_MOCKS
     // Default Mock Scan Provider (for simulator)
     const char *mock_ssids[] = {"Home_WiFi_2.4G", "Office_Secure", "CoffeeShop_Free", "Starlink_99", "Guest_Lounge"};
     size_t count = (5 < max_count) ? 5 : max_count;
@@ -781,6 +1108,9 @@ size_t minigui_scan_wifi(minigui_wifi_network_t *networks, size_t max_count) {
     }
 
     return count;
+#else
+    return 0;
+#endif
 }
 
 /******************************************************************************
@@ -805,22 +1135,34 @@ size_t minigui_scan_wifi(minigui_wifi_network_t *networks, size_t max_count) {
  **
  ** Implementation Steps:
  ** 1. If a real provider is registered, delegate the request.
- ** 2. Otherwise, fill the structure with mock data fluctuating based on ticks.
+ ** 2. Otherwise, fill the structure with mock data fluctuating based on ticks
+ **    (MINIGUI_ENABLE_MOCKS), or zeros.
+ ** 3. Feed the values to the alert rules.
  ******************************************************************************
  ******************************************************************************/
 void minigui_get_system_stats(minigui_system_stats_t *stats) {
     if (system_stats_provider) {
+        uint32_t t0 = MINIGUI_METRICS_START();
         system_stats_provider(stats);
-        return;
+        MINIGUI_METRICS_STOP(MINIGUI_METRICS_PROVIDER_SYSTEM_STATS, t0);
+    } else {
+#if MINIGUI_ENABLE_MOCKS
+        // Default Mock Stats Provider (for simulator)
+        stats->voltage = 5.0f + ((float)(lv_tick_get() % 100) / 100.0f); // Simulate 5.0-5.1V
+        stats->cpu_usage = 15 + (lv_tick_get() % 40); // Simulate 15-55%
+        stats->flash_used_kb = 512;
+        stats->flash_total_kb = 4096;
+        stats->ram_used_kb = 128;
+        stats->ram_total_kb = 520;
+#else
+        memset(stats, 0, sizeof(*stats));
+#endif
     }
 
-    // Default Mock Stats Provider (for simulator)
-    stats->voltage = 5.0f + ((float)(lv_tick_get() % 100) / 100.0f); // Simulate 5.0-5.1V
-    stats->cpu_usage = 15 + (lv_tick_get() % 40); // Simulate 15-55%
-    stats->flash_used_kb = 512;
-    stats->flash_total_kb = 4096;
-    stats->ram_used_kb = 128;
-    stats->ram_total_kb = 520;
+    minigui_alert_ingest(MINIGUI_METRIC_VOLTAGE_MV, (int32_t)(stats->voltage * 1000.0f + 0.5f));
+    minigui_alert_ingest(MINIGUI_METRIC_CPU_PCT, (int32_t)stats->cpu_usage);
+    minigui_alert_ingest(MINIGUI_METRIC_RAM_USED_KB, (int32_t)stats->ram_used_kb);
+    minigui_alert_ingest(MINIGUI_METRIC_FLASH_USED_KB, (int32_t)stats->flash_used_kb);
 }
 
 /******************************************************************************
@@ -845,15 +1187,19 @@ void minigui_get_system_stats(minigui_system_stats_t *stats) {
  **
  ** Implementation Steps:
  ** 1. If a real provider is registered, delegate the request.
- ** 2. Otherwise, populate with mock "Connected" status.
+ ** 2. Otherwise, populate with mock "Connected" status (MINIGUI_ENABLE_MOCKS),
+ **    or report "not connected".
  ******************************************************************************
  ******************************************************************************/
 void minigui_get_network_status(minigui_network_status_t *status) {
     if (network_status_provider) {
+        uint32_t t0 = MINIGUI_METRICS_START();
         network_status_provider(status);
+        MINIGUI_METRICS_STOP(MINIGUI_METRICS_PROVIDER_NETWORK_STATUS, t0);
         return;
     }
 
+#if MINIGUI_ENABLE_MOCKS
     // Default Mock Network Status (for simulator)
     status->connected = true;
     strncpy(status->ssid, "Home_WiFi_2.4G", sizeof(status->ssid) - 1);
@@ -862,14 +1208,17 @@ void minigui_get_network_status(minigui_network_status_t *status) {
     status->ip_address[sizeof(status->ip_address) - 1] = '\0';
     strncpy(status->mac_address, "AA:BB:CC:DD:EE:FF", sizeof(status->mac_address) - 1);
     status->mac_address[sizeof(status->mac_address) - 1] = '\0';
+#else
+    memset(status, 0, sizeof(*status));
+#endif
 }
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Internal helper to get the main content area (stage).
+ ** @brief Internal helper to get the default context's content area (stage).
  **
  ** @section call_site Called from:
- ** - Screen creators to attach widgets.
+ ** - Benchmarks and perf hooks (single-display callers).
  **
  ** @section dependencies Required Headers:
  ** - lvgl.h (for lv_obj_t handle)
@@ -879,10 +1228,10 @@ void minigui_get_network_status(minigui_network_status_t *status) {
  ** @section pointers 
  ** - None
  **
- ** @return lv_obj_t*: Pointer to the static content area container.
+ ** @return lv_obj_t*: The default context's content area, or NULL.
  **
  ** Implementation Steps:
- ** 1. Return the static @c content_area pointer.
+ ** 1. Return the default context's content area.
  ******************************************************************************
  ******************************************************************************/
-lv_obj_t *minigui_get_content_area(void) { return content_area; }
+lv_obj_t *minigui_get_content_area(void) { return minigui_ctx_get_content_area(default_ctx); }
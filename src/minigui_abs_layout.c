@@ -0,0 +1,509 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Absolute Layout Mode Implementation.
+ **
+ **            Records the flex result of a view once per resolution and
+ **            replays it as absolute positions on later builds. Also counts
+ **            flex passes per display refresh via LV_EVENT_LAYOUT_CHANGED,
+ **            which the flex layout sends after every pass.
+ **
+ **            @section minigui_abs_layout.c - Frozen layouts and pass counter.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None directly here, lvgl is included via minigui_abs_layout.h
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_abs_layout.h"
+#include "minigui_alloc.h"
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Recorded geometry of one flex item
+ */
+typedef struct {
+    int16_t x, y, w, h;
+} abs_rect_t;
+
+/**
+ * @brief Recorded layout of one view
+ */
+typedef struct {
+    uint32_t key;             /**< MINIGUI_ABS_KEY_*, 0 = free slot */
+    uint32_t shape;           /**< Subtree shape hash */
+    int16_t hor_res;          /**< Resolution at recording time */
+    int16_t ver_res;
+    uint16_t count;           /**< Entries in rects */
+    abs_rect_t *rects;        /**< Flex items in depth-first order */
+} abs_slot_t;
+
+/**
+ * @brief Walk state shared by the shape, record and replay passes
+ */
+typedef struct {
+    abs_rect_t *rects;
+    uint16_t n;
+    uint16_t cap;
+    uint32_t hash;
+} abs_walk_t;
+
+#if MINIGUI_ABSOLUTE_LAYOUT
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Recorded views.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_abs_layout.c.
+ **
+ ** @section rationale Rationale:
+ ** - A handful of views (skeleton, screens, Settings categories) cover the
+ **   whole UI; a fixed table avoids any lookup structure.
+ ******************************************************************************
+ ******************************************************************************/
+static abs_slot_t slots[MINIGUI_ABS_LAYOUT_SLOTS];
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Layout pass counters and the display they observe.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_abs_layout.c.
+ **
+ ** @section rationale Rationale:
+ ** - Lets the same build report passes per frame with and without
+ **   MINIGUI_ABSOLUTE_LAYOUT.
+ ******************************************************************************
+ ******************************************************************************/
+static struct {
+    lv_display_t *disp;
+    uint32_t frame_passes;
+    minigui_layout_pass_stats_t stats;
+} counter;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static void layout_changed_cb(lv_event_t *e) {
+    (void)e;
+    counter.stats.passes++;
+    counter.frame_passes++;
+}
+
+static void refr_start_cb(lv_event_t *e) {
+    (void)e;
+    counter.frame_passes = 0;
+}
+
+static void refr_ready_cb(lv_event_t *e) {
+    (void)e;
+    counter.stats.frames++;
+    if (counter.frame_passes > counter.stats.max_per_frame) {
+        counter.stats.max_per_frame = counter.frame_passes;
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Whether a container's flex result can be frozen.
+ **
+ ** @section call_site Called from:
+ ** - The shape, record and replay walks.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (style and flag queries)
+ **
+ ** @param obj (lv_obj_t*): Container.
+ **
+ ** @section pointers
+ ** - obj: Owned by LVGL.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return bool: true for flex containers without hidden children.
+ **
+ ** Implementation Steps:
+ ** 1. Require LV_LAYOUT_FLEX.
+ ** 2. Reject containers with hidden children: flex reflows siblings when
+ **    they are shown, which a frozen layout cannot do.
+ ******************************************************************************
+ ******************************************************************************/
+static bool is_freezable(lv_obj_t *obj) {
+    if (lv_obj_get_style_layout(obj, LV_PART_MAIN) != LV_LAYOUT_FLEX) return false;
+
+    uint32_t cnt = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < cnt; i++) {
+        if (lv_obj_has_flag(lv_obj_get_child(obj, (int32_t)i), LV_OBJ_FLAG_HIDDEN)) return false;
+    }
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Hashes a subtree and counts its flex items.
+ **
+ ** @section call_site Called from:
+ ** - minigui_abs_layout_apply(), minigui_abs_layout_stats_begin().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (tree traversal)
+ **
+ ** @param obj (lv_obj_t*): Subtree root.
+ ** @param w (abs_walk_t*): Accumulates hash and item count.
+ **
+ ** @section pointers
+ ** - w: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c freeze (bool): Whether children of @p obj are flex items.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Mix child count and freezability into an FNV-1a hash.
+ ** 2. Attach the pass counter to flex containers while counting is active.
+ ** 3. Recurse depth-first.
+ ******************************************************************************
+ ******************************************************************************/
+static void shape_walk(lv_obj_t *obj, abs_walk_t *w) {
+    uint32_t cnt = lv_obj_get_child_count(obj);
+    bool freeze = is_freezable(obj);
+
+    w->hash = (w->hash ^ (cnt * 2u + (freeze ? 1u : 0u))) * 16777619u;
+
+    if (counter.disp && lv_obj_get_style_layout(obj, LV_PART_MAIN) == LV_LAYOUT_FLEX) {
+        lv_obj_remove_event_cb(obj, layout_changed_cb);
+        lv_obj_add_event_cb(obj, layout_changed_cb, LV_EVENT_LAYOUT_CHANGED, NULL);
+    }
+
+    for (uint32_t i = 0; i < cnt; i++) {
+        if (freeze) w->n++;
+        shape_walk(lv_obj_get_child(obj, (int32_t)i), w);
+    }
+}
+
+#if MINIGUI_ABSOLUTE_LAYOUT
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Records the laid-out geometry of every flex item.
+ **
+ ** @section call_site Called from:
+ ** - minigui_abs_layout_apply() after lv_obj_update_layout().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (coordinates)
+ **
+ ** @param obj (lv_obj_t*): Subtree root.
+ ** @param w (abs_walk_t*): Output records.
+ **
+ ** @section pointers
+ ** - w: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. For children of freezable containers, store x/y/w/h.
+ ** 2. Recurse depth-first (same order as shape_walk and replay_walk).
+ ******************************************************************************
+ ******************************************************************************/
+static void record_walk(lv_obj_t *obj, abs_walk_t *w) {
+    uint32_t cnt = lv_obj_get_child_count(obj);
+    bool freeze = is_freezable(obj);
+
+    for (uint32_t i = 0; i < cnt; i++) {
+        lv_obj_t *child = lv_obj_get_child(obj, (int32_t)i);
+        if (freeze && w->n < w->cap) {
+            abs_rect_t *r = &w->rects[w->n++];
+            r->x = (int16_t)lv_obj_get_x(child);
+            r->y = (int16_t)lv_obj_get_y(child);
+            r->w = (int16_t)lv_obj_get_width(child);
+            r->h = (int16_t)lv_obj_get_height(child);
+        }
+        record_walk(child, w);
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Applies recorded geometry and switches flex off.
+ **
+ ** @section call_site Called from:
+ ** - minigui_abs_layout_apply().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (position, size, local layout style)
+ **
+ ** @param obj (lv_obj_t*): Subtree root.
+ ** @param w (abs_walk_t*): Records to replay.
+ **
+ ** @section pointers
+ ** - w: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c freeze (bool): Evaluated before any child is modified.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Position each flex item; flex-grow items also get their grown size.
+ ** 2. Recurse, then set the container's layout to LV_LAYOUT_NONE.
+ ******************************************************************************
+ ******************************************************************************/
+static void replay_walk(lv_obj_t *obj, abs_walk_t *w) {
+    uint32_t cnt = lv_obj_get_child_count(obj);
+    bool freeze = is_freezable(obj);
+
+    for (uint32_t i = 0; i < cnt; i++) {
+        lv_obj_t *child = lv_obj_get_child(obj, (int32_t)i);
+        if (freeze && w->n < w->cap) {
+            const abs_rect_t *r = &w->rects[w->n++];
+            lv_obj_set_pos(child, r->x, r->y);
+            if (lv_obj_get_style_flex_grow(child, LV_PART_MAIN) > 0) {
+                lv_obj_set_size(child, r->w, r->h);
+            }
+        }
+        replay_walk(child, w);
+    }
+
+    if (freeze) lv_obj_set_style_layout(obj, LV_LAYOUT_NONE, 0);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Finds the slot for a key, or a free one.
+ **
+ ** @section call_site Called from:
+ ** - minigui_abs_layout_apply().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param key (uint32_t): View key.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return abs_slot_t*: Matching or free slot, NULL if the table is full.
+ **
+ ** Implementation Steps:
+ ** 1. Return the slot holding @p key.
+ ** 2. Otherwise return the first free slot.
+ ******************************************************************************
+ ******************************************************************************/
+static abs_slot_t *find_slot(uint32_t key) {
+    abs_slot_t *free_slot = NULL;
+    for (uint32_t i = 0; i < MINIGUI_ABS_LAYOUT_SLOTS; i++) {
+        if (slots[i].key == key) return &slots[i];
+        if (!free_slot && slots[i].key == 0) free_slot = &slots[i];
+    }
+    return free_slot;
+}
+#endif // MINIGUI_ABSOLUTE_LAYOUT
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Freeze (or replay) the layout of a freshly built view.
+ **
+ ** @section call_site Called from:
+ ** - minigui_init() (skeleton), minigui_switch_screen(), Settings
+ **   switch_category().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (layout, coordinates)
+ ** - minigui_alloc.h (record storage)
+ **
+ ** @param root (lv_obj_t*): View root.
+ ** @param key (uint32_t): Cache key.
+ **
+ ** @section pointers
+ ** - root: Owned by LVGL.
+ **
+ ** @section variables Internal Variables:
+ ** - @c w (abs_walk_t): Walk state.
+ ** - @c slot (abs_slot_t*): Cache entry for @p key.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Restore the root's own flex (a parent view may have frozen it).
+ ** 2. Hash the subtree and instrument it for the pass counter.
+ ** 3. Without MINIGUI_ABSOLUTE_LAYOUT, stop here (return at once when the
+ **    counter is not running either).
+ ** 4. On a cache miss (key, shape or resolution), run the layout once and
+ **    record the flex items into a buffer from the internal pool.
+ ** 5. Replay the record.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_abs_layout_apply(lv_obj_t *root, uint32_t key) {
+    if (!root) return;
+
+#if MINIGUI_ABSOLUTE_LAYOUT
+    lv_obj_remove_local_style_prop(root, LV_STYLE_LAYOUT, 0);
+#else
+    if (!counter.disp) return; // Nothing to instrument
+#endif
+
+    abs_walk_t w = { NULL, 0, 0, 2166136261u };
+    shape_walk(root, &w);
+
+#if MINIGUI_ABSOLUTE_LAYOUT
+    if (w.n == 0) return;
+
+    lv_display_t *disp = lv_obj_get_display(root);
+    int16_t hor = (int16_t)lv_display_get_horizontal_resolution(disp);
+    int16_t ver = (int16_t)lv_display_get_vertical_resolution(disp);
+
+    abs_slot_t *slot = find_slot(key);
+    if (!slot) return; // Table full: this view keeps its flex layout
+
+    if (slot->key != key || slot->shape != w.hash || slot->count != w.n ||
+        slot->hor_res != hor || slot->ver_res != ver) {
+        if (slot->count != w.n) {
+            minigui_free(MINIGUI_POOL_INTERNAL, slot->rects);
+            slot->rects = minigui_malloc(MINIGUI_POOL_INTERNAL, w.n * sizeof(abs_rect_t));
+            if (!slot->rects) {
+                memset(slot, 0, sizeof(*slot));
+                return;
+            }
+        }
+
+        lv_obj_update_layout(root);
+
+        abs_walk_t rec = { slot->rects, 0, w.n, 0 };
+        record_walk(root, &rec);
+
+        slot->key = key;
+        slot->shape = w.hash;
+        slot->count = w.n;
+        slot->hor_res = hor;
+        slot->ver_res = ver;
+        counter.stats.recorded++;
+    } else {
+        counter.stats.replayed++;
+    }
+
+    abs_walk_t rep = { slot->rects, 0, slot->count, 0 };
+    replay_walk(root, &rep);
+#else
+    (void)key;
+#endif
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Drop every recorded layout.
+ **
+ ** @section call_site Called from:
+ ** - Resolution changes, benchmarks.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_alloc.h (release records)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Free every record buffer and clear the slot table.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_abs_layout_reset(void) {
+#if MINIGUI_ABSOLUTE_LAYOUT
+    for (uint32_t i = 0; i < MINIGUI_ABS_LAYOUT_SLOTS; i++) {
+        minigui_free(MINIGUI_POOL_INTERNAL, slots[i].rects);
+    }
+    memset(slots, 0, sizeof(slots));
+#endif
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Start counting flex passes per refresh.
+ **
+ ** @section call_site Called from:
+ ** - Host harness / console command around a measured interaction.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (display events)
+ **
+ ** @param disp (lv_display_t*): Display, NULL for the default.
+ **
+ ** @section pointers
+ ** - disp: Owned by LVGL.
+ **
+ ** @section variables Internal Variables:
+ ** - @c w (abs_walk_t): Used only to instrument existing containers.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Detach from a previous display and clear the counters.
+ ** 2. Hook REFR_START/REFR_READY to delimit frames.
+ ** 3. Instrument the active screen and the top layer.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_abs_layout_stats_begin(lv_display_t *disp) {
+    if (!disp) disp = lv_display_get_default();
+    if (!disp) return;
+
+    minigui_abs_layout_stats_end();
+    memset(&counter, 0, sizeof(counter));
+    counter.disp = disp;
+
+    lv_display_add_event_cb(disp, refr_start_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+
+    abs_walk_t w = { NULL, 0, 0, 0 };
+    shape_walk(lv_display_get_screen_active(disp), &w);
+    shape_walk(lv_display_get_layer_top(disp), &w);
+}
+
+void minigui_abs_layout_stats_end(void) {
+    if (!counter.disp) return;
+    lv_display_remove_event_cb_with_user_data(counter.disp, refr_start_cb, NULL);
+    lv_display_remove_event_cb_with_user_data(counter.disp, refr_ready_cb, NULL);
+    counter.disp = NULL;
+}
+
+void minigui_abs_layout_stats_get(minigui_layout_pass_stats_t *out) {
+    if (out) *out = counter.stats;
+}
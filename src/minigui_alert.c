@@ -0,0 +1,433 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Threshold Alerts Implementation.
+ **
+ **            The rule table stays where the caller put it (normally flash);
+ **            only a small state block per rule is allocated. Rules are
+ **            chained per metric at install time, so a sample walks just the
+ **            rules watching its metric. Rate rules count events in a ring
+ **            of MINIGUI_ALERT_RATE_SLOTS sub-windows; a 1 s timer ages
+ **            those windows, expires hold times of samples that stopped
+ **            arriving and polls the system stats when no screen does.
+ **
+ **            @section minigui_alert.c - Alert rule evaluation.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None (lvgl included via header)
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui.h"
+#include "minigui_alert.h"
+#include "minigui_alloc.h"
+#include "minigui_lock.h"
+#include "minigui_toast.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+#define HOUSEKEEPING_MS 1000
+
+/**
+ * @brief Runtime state of one rule
+ */
+typedef struct {
+    int32_t last;                             // Latest sample (gauges)
+    uint32_t since_ms;                        // Condition true since (while pending)
+    uint32_t slot_start_ms;                   // RATE: start of the current sub-window
+    uint32_t total;                           // RATE: events in the whole window
+    uint16_t slots[MINIGUI_ALERT_RATE_SLOTS]; // RATE: events per sub-window
+    uint8_t slot;                             // RATE: current sub-window
+    uint8_t next;                             // Next rule on the same metric + 1, 0 = end
+    bool pending;                             // Condition true, hold time running
+    bool active;
+} rule_state_t;
+
+static const minigui_alert_rule_t *rules;
+static uint8_t rule_count;
+static rule_state_t *states;
+static uint8_t first_rule[MINIGUI_ALERT_MAX_METRICS];   // First rule + 1, 0 = none
+
+static lv_timer_t *housekeeping_timer;
+static bool watch_stats;                                // A rule watches a system stats metric
+static uint32_t stats_ms;                               // Last system stats sample
+static minigui_alert_cb_t alert_cb;
+static minigui_alert_event_t last_event;
+static bool has_event;
+static minigui_alert_stats_t stats;
+
+static lv_subject_t alert_subject;
+static bool subject_ready;
+static int32_t notify_seq;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static lv_subject_t *subject(void) {
+    if (!subject_ready) {
+        lv_subject_init_int(&alert_subject, 0);
+        subject_ready = true;
+    }
+    return &alert_subject;
+}
+
+/**
+ * @brief Drops rate sub-windows that fell out of the window
+ */
+static void rate_advance(const minigui_alert_rule_t *r, rule_state_t *s, uint32_t now) {
+    uint32_t width = (uint32_t)r->window_s * 1000u / MINIGUI_ALERT_RATE_SLOTS;
+    if (width == 0) width = 1;
+
+    uint32_t elapsed = now - s->slot_start_ms;
+    if (elapsed >= width * MINIGUI_ALERT_RATE_SLOTS) {
+        memset(s->slots, 0, sizeof(s->slots));
+        s->total = 0;
+        s->slot_start_ms = now;
+        return;
+    }
+    while (elapsed >= width) {
+        s->slot = (uint8_t)((s->slot + 1) % MINIGUI_ALERT_RATE_SLOTS);
+        s->total -= s->slots[s->slot];
+        s->slots[s->slot] = 0;
+        s->slot_start_ms += width;
+        elapsed -= width;
+    }
+}
+
+/**
+ * @brief Raised alerts become toasts, cleared ones take their toast away
+ */
+static void toast(const minigui_alert_rule_t *r, bool raised) {
+#if MINIGUI_ALERT_TOASTS
+    if (!r->message) return;
+    if (!raised) {
+        minigui_toast_dismiss(r->message);
+    } else if (r->severity >= MINIGUI_ALERT_CRITICAL) {
+        minigui_toast_post(MINIGUI_TOAST_ERROR, r->message, MINIGUI_TOAST_FOREVER);
+    } else {
+        minigui_toast_post(r->severity == MINIGUI_ALERT_WARNING ? MINIGUI_TOAST_WARNING : MINIGUI_TOAST_INFO,
+                           r->message, 0);
+    }
+#else
+    (void)r;
+    (void)raised;
+#endif
+}
+
+static void emit(uint8_t index, bool raised, int32_t value, uint32_t now) {
+    const minigui_alert_rule_t *r = &rules[index];
+
+    states[index].active = raised;
+    if (raised) {
+        stats.raised++;
+        stats.active++;
+        LV_LOG_WARN("Alert raised: %s (%ld)", r->message ? r->message : "?", (long)value);
+    } else {
+        stats.cleared++;
+        stats.active--;
+        LV_LOG_USER("Alert cleared: %s (%ld)", r->message ? r->message : "?", (long)value);
+    }
+
+    last_event.rule = r;
+    last_event.index = index;
+    last_event.raised = raised;
+    last_event.value = value;
+    last_event.time_ms = now;
+    has_event = true;
+
+    toast(r, raised);
+    if (alert_cb) alert_cb(&last_event);
+    lv_subject_set_int(subject(), ++notify_seq);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Checks one rule against its latest value.
+ **
+ ** @section call_site Called from:
+ ** - minigui_alert_ingest(), minigui_alert_count(), housekeeping_cb().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param index (uint8_t): Rule to check.
+ ** @param now (uint32_t): Current tick.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c value (int32_t): Latest sample, or the window count for RATE.
+ ** - @c on (bool): Raise condition holds.
+ ** - @c off (bool): Clear condition (threshold minus hysteresis) holds.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Inactive: start the hold time when the condition becomes true,
+ **    raise once it held for hold_s, reset when it turns false.
+ ** 2. Active: clear only once the value is back past the threshold by the
+ **    hysteresis, so a value hovering at the threshold does not flap.
+ ******************************************************************************
+ ******************************************************************************/
+static void evaluate(uint8_t index, uint32_t now) {
+    const minigui_alert_rule_t *r = &rules[index];
+    rule_state_t *s = &states[index];
+    int32_t value = s->last;
+    bool on, off;
+
+    stats.evaluations++;
+    switch (r->kind) {
+        case MINIGUI_ALERT_BELOW:
+            on = value < r->threshold;
+            off = value >= r->threshold + r->hysteresis;
+            break;
+        case MINIGUI_ALERT_RATE:
+            value = (int32_t)s->total;
+            /* fall through */
+        default:
+            on = value > r->threshold;
+            off = value <= r->threshold - r->hysteresis;
+            break;
+    }
+
+    if (s->active) {
+        if (off) emit(index, false, value, now);
+        return;
+    }
+    if (!on) {
+        s->pending = false;
+        return;
+    }
+    if (!s->pending) {
+        s->pending = true;
+        s->since_ms = now;
+    }
+    if (now - s->since_ms >= (uint32_t)r->hold_s * 1000u) {
+        s->pending = false;
+        emit(index, true, value, now);
+    }
+}
+
+static bool is_stats_metric(uint8_t metric) {
+    return metric <= MINIGUI_METRIC_FLASH_USED_KB;
+}
+
+/**
+ * @brief Samples the system stats if due, ages rate windows and expires hold
+ *        times without new samples
+ *
+ * Only rules that are pending, active or counting are touched. The sample
+ * is skipped while another poller feeds the stats (half a period of jitter
+ * is allowed so a 1 s period is not stretched to 2 s); the ones taken are
+ * counted and timed, as the provider blocks the LVGL task.
+ */
+static void housekeeping_cb(lv_timer_t *timer) {
+    (void)timer;
+
+    MINIGUI_LOCK();
+#if MINIGUI_ALERT_SAMPLE_MS
+    if (watch_stats && lv_tick_get() - stats_ms + HOUSEKEEPING_MS / 2 >= MINIGUI_ALERT_SAMPLE_MS) {
+        minigui_system_stats_t sys;
+        uint32_t t0 = lv_tick_get();
+        minigui_get_system_stats(&sys);   // Ingests (and stamps stats_ms)
+        uint32_t took = lv_tick_elaps(t0);
+        stats.polls++;
+        if (took > stats.poll_max_ms) stats.poll_max_ms = took;
+    }
+#endif
+
+    uint32_t now = lv_tick_get();
+    for (uint8_t i = 0; i < rule_count; i++) {
+        const minigui_alert_rule_t *r = &rules[i];
+        rule_state_t *s = &states[i];
+        if (r->kind == MINIGUI_ALERT_RATE) {
+            if (!s->total && !s->active) continue;
+            rate_advance(r, s, now);
+        } else if (!s->pending) {
+            continue;
+        }
+        evaluate(i, now);
+    }
+    MINIGUI_UNLOCK();
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Install a rule table.
+ **
+ ** @section call_site Called from:
+ ** - Application startup.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_alloc.h (state blocks)
+ ** - lvgl.h (housekeeping timer)
+ **
+ ** @param table (const minigui_alert_rule_t*): Rules, NULL to remove all.
+ ** @param count (uint8_t): Entries in the table.
+ **
+ ** @section pointers
+ ** - table: Referenced for as long as it is installed.
+ **
+ ** @section variables Internal Variables:
+ ** - @c fresh (rule_state_t*): State blocks of the new table.
+ ** - @c watch (bool): Table watches a system stats metric.
+ **
+ ** @return bool: false if the table is invalid or memory is short.
+ **
+ ** Implementation Steps:
+ ** 1. Validate sizes and metric ids; allocate zeroed state blocks.
+ ** 2. Take the toasts of raised alerts away (no rule of the old table can
+ **    clear them any more), swap in the table, free the old state, reset
+ **    the counters.
+ ** 3. Chain the rules per metric (table order is kept).
+ ** 4. Keep the housekeeping timer while there are rules; it also samples
+ **    the system stats when the table watches them.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_alert_set_rules(const minigui_alert_rule_t *table, uint8_t count) {
+    if (!table) count = 0;
+    if (count > MINIGUI_ALERT_MAX_RULES) {
+        LV_LOG_ERROR("Alert table too large (%u > %u)", count, MINIGUI_ALERT_MAX_RULES);
+        return false;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        if (table[i].metric >= MINIGUI_ALERT_MAX_METRICS) {
+            LV_LOG_ERROR("Alert rule %u: metric %u out of range", i, table[i].metric);
+            return false;
+        }
+    }
+
+    bool watch = false;
+    for (uint8_t i = 0; i < count; i++) {
+        if (table[i].kind != MINIGUI_ALERT_RATE && is_stats_metric(table[i].metric)) watch = true;
+    }
+
+    rule_state_t *fresh = NULL;
+    if (count) {
+        fresh = (rule_state_t *)minigui_malloc(MINIGUI_POOL_INTERNAL, count * sizeof(rule_state_t));
+        if (!fresh) {
+            LV_LOG_ERROR("Alert state allocation failed");
+            return false;
+        }
+        memset(fresh, 0, count * sizeof(rule_state_t));
+    }
+
+    MINIGUI_LOCK();
+    for (uint8_t i = 0; i < rule_count; i++) {
+        if (states[i].active) toast(&rules[i], false);
+    }
+    minigui_free(MINIGUI_POOL_INTERNAL, states);
+    states = fresh;
+    rules = table;
+    rule_count = count;
+    watch_stats = watch;
+    stats.active = 0;
+    memset(first_rule, 0, sizeof(first_rule));
+
+    uint32_t now = lv_tick_get();
+    for (uint8_t i = count; i-- > 0;) {
+        states[i].next = first_rule[table[i].metric];
+        states[i].slot_start_ms = now;
+        first_rule[table[i].metric] = (uint8_t)(i + 1);
+    }
+
+    if (count && !housekeeping_timer) {
+        housekeeping_timer = lv_timer_create(housekeeping_cb, HOUSEKEEPING_MS, NULL);
+    } else if (!count && housekeeping_timer) {
+        lv_timer_delete(housekeeping_timer);
+        housekeeping_timer = NULL;
+    }
+    MINIGUI_UNLOCK();
+    return true;
+}
+
+void minigui_alert_ingest(uint8_t metric, int32_t value) {
+    if (metric >= MINIGUI_ALERT_MAX_METRICS) return;
+
+    MINIGUI_LOCK();
+    stats.samples++;
+    uint32_t now = lv_tick_get();
+    if (is_stats_metric(metric)) stats_ms = now;
+    for (uint8_t i = first_rule[metric]; i; i = states[i - 1].next) {
+        if (rules[i - 1].kind == MINIGUI_ALERT_RATE) continue;
+        states[i - 1].last = value;
+        evaluate((uint8_t)(i - 1), now);
+    }
+    MINIGUI_UNLOCK();
+}
+
+void minigui_alert_count(uint8_t metric, uint32_t n) {
+    if (metric >= MINIGUI_ALERT_MAX_METRICS || n == 0) return;
+
+    MINIGUI_LOCK();
+    stats.samples++;
+    uint32_t now = lv_tick_get();
+    for (uint8_t i = first_rule[metric]; i; i = states[i - 1].next) {
+        const minigui_alert_rule_t *r = &rules[i - 1];
+        rule_state_t *s = &states[i - 1];
+        if (r->kind != MINIGUI_ALERT_RATE) continue;
+        rate_advance(r, s, now);
+        uint32_t room = UINT16_MAX - s->slots[s->slot];
+        uint32_t add = n < room ? n : room;
+        s->slots[s->slot] += (uint16_t)add;
+        s->total += add;
+        evaluate((uint8_t)(i - 1), now);
+    }
+    MINIGUI_UNLOCK();
+}
+
+void minigui_register_alert_cb(minigui_alert_cb_t cb) {
+    MINIGUI_LOCK();
+    alert_cb = cb;
+    MINIGUI_UNLOCK();
+}
+
+lv_subject_t *minigui_alert_subject(void) {
+    return subject();
+}
+
+bool minigui_alert_get_last(minigui_alert_event_t *event) {
+    if (!event) return false;
+    MINIGUI_LOCK();
+    bool ok = has_event;
+    if (ok) *event = last_event;
+    MINIGUI_UNLOCK();
+    return ok;
+}
+
+bool minigui_alert_is_active(uint8_t index) {
+    MINIGUI_LOCK();
+    bool active = index < rule_count && states[index].active;
+    MINIGUI_UNLOCK();
+    return active;
+}
+
+void minigui_alert_get_stats(minigui_alert_stats_t *out) {
+    if (!out) return;
+    MINIGUI_LOCK();
+    *out = stats;
+    MINIGUI_UNLOCK();
+}
@@ -0,0 +1,517 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Memory Pools Implementation.
+ **
+ **            Heap mode forwards each pool to the application allocator or to
+ **            heap_caps (ESP-IDF) / malloc (host). Static mode
+ **            (MINIGUI_STATIC_POOLS) serves each pool from its own arena with a
+ **            first-fit allocator that coalesces neighbours on free. Both modes
+ **            keep a small header in front of every block so usage counters
+ **            stay exact.
+ **
+ **            @section minigui_alloc.c - Pool allocator implementation.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdlib.h>  // For malloc/free (host heap mode)
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_alloc.h"
+#include "minigui_lock.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+/**
+ * @brief Header stored in front of every block
+ *
+ * Heap mode only uses @c size (the requested size). Static mode stores the
+ * full block size with bit 0 as the in-use flag, plus the size of the
+ * physically preceding block so free() can merge backwards in O(1).
+ */
+typedef struct {
+    uint32_t size;
+    uint32_t prev_size;
+} block_hdr_t;
+
+#define BLOCK_HDR_SIZE   ((uint32_t)sizeof(block_hdr_t))
+#define BLOCK_USED       1u
+#define BLOCK_ALIGN(n)   (((n) + 7u) & ~(size_t)7u)
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Per-pool usage counters.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_alloc.c, read via minigui_get_pool_stats().
+ **
+ ** @section rationale Rationale:
+ ** - Lets safety builds prove that pools never fail and that the static
+ **   arenas are sized with headroom.
+ ******************************************************************************
+ ******************************************************************************/
+static minigui_pool_stats_t pool_stats[MINIGUI_POOL_COUNT];
+
+#ifdef MINIGUI_STATIC_POOLS
+
+#ifndef EXT_RAM_BSS_ATTR
+#define EXT_RAM_BSS_ATTR
+#endif
+
+// Arena storage in 8-byte words (one spare word so a size of 0 still compiles)
+#define POOL_WORDS(bytes) (((bytes) + 7u) / 8u + 1u)
+
+static uint64_t arena_internal[POOL_WORDS(MINIGUI_POOL_INTERNAL_SIZE)];
+static EXT_RAM_BSS_ATTR uint64_t arena_psram[POOL_WORDS(MINIGUI_POOL_PSRAM_SIZE)];
+static uint64_t arena_dma[POOL_WORDS(MINIGUI_POOL_DMA_SIZE)];
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Arena descriptors, indexed by minigui_pool_t.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_alloc.c.
+ **
+ ** @section rationale Rationale:
+ ** - Every minigui buffer is accounted for at link time; no runtime malloc.
+ ******************************************************************************
+ ******************************************************************************/
+static struct {
+    uint8_t *base;
+    size_t   size;
+    bool     ready;
+} arenas[MINIGUI_POOL_COUNT] = {
+    [MINIGUI_POOL_INTERNAL] = { (uint8_t *)arena_internal, MINIGUI_POOL_INTERNAL_SIZE, false },
+    [MINIGUI_POOL_PSRAM]    = { (uint8_t *)arena_psram, MINIGUI_POOL_PSRAM_SIZE, false },
+    [MINIGUI_POOL_DMA]      = { (uint8_t *)arena_dma, MINIGUI_POOL_DMA_SIZE, false },
+};
+
+#else
+
+// Application allocator, all NULL selects the platform default
+static minigui_allocator_t app_allocator = { NULL, NULL, NULL };
+
+#endif // MINIGUI_STATIC_POOLS
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+#ifdef MINIGUI_STATIC_POOLS
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Block following @p b in its arena, or NULL at the end.
+ **
+ ** @section call_site Called from:
+ ** - arena_alloc() and arena_free().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param pool (minigui_pool_t): Arena owning the block.
+ ** @param b (block_hdr_t*): Current block.
+ **
+ ** @section pointers
+ ** - b: Inside the arena.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return block_hdr_t*: Next block or NULL.
+ **
+ ** Implementation Steps:
+ ** 1. Step over the block size and check the arena bound.
+ ******************************************************************************
+ ******************************************************************************/
+static block_hdr_t *next_block(minigui_pool_t pool, block_hdr_t *b) {
+    uint8_t *next = (uint8_t *)b + (b->size & ~BLOCK_USED);
+    return (next < arenas[pool].base + arenas[pool].size) ? (block_hdr_t *)next : NULL;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief First-fit allocation from a static arena.
+ **
+ ** @section call_site Called from:
+ ** - minigui_malloc() with the lock held.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param pool (minigui_pool_t): Arena to allocate from.
+ ** @param size (size_t): Requested payload size.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c need (size_t): Aligned block size including the header.
+ **
+ ** @return block_hdr_t*: Allocated block, or NULL.
+ **
+ ** Implementation Steps:
+ ** 1. Format the arena as one free block on first use.
+ ** 2. Walk blocks and take the first free one large enough.
+ ** 3. Split off the remainder when it can hold a minimal block.
+ ******************************************************************************
+ ******************************************************************************/
+static block_hdr_t *arena_alloc(minigui_pool_t pool, size_t size) {
+    if (arenas[pool].size < 2 * BLOCK_HDR_SIZE) return NULL;
+
+    if (!arenas[pool].ready) {
+        block_hdr_t *first = (block_hdr_t *)arenas[pool].base;
+        first->size = (uint32_t)(arenas[pool].size & ~(size_t)7u);
+        first->prev_size = 0;
+        arenas[pool].ready = true;
+    }
+
+    size_t need = BLOCK_ALIGN(size) + BLOCK_HDR_SIZE;
+
+    for (block_hdr_t *b = (block_hdr_t *)arenas[pool].base; b; b = next_block(pool, b)) {
+        if ((b->size & BLOCK_USED) || b->size < need) continue;
+
+        uint32_t remain = b->size - (uint32_t)need;
+        if (remain >= 2 * BLOCK_HDR_SIZE) {
+            b->size = (uint32_t)need;
+            block_hdr_t *split = next_block(pool, b);
+            split->size = remain;
+            split->prev_size = (uint32_t)need;
+
+            block_hdr_t *after = next_block(pool, split);
+            if (after) after->prev_size = remain;
+        }
+        b->size |= BLOCK_USED;
+        return b;
+    }
+    return NULL;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Return a block to its arena and merge free neighbours.
+ **
+ ** @section call_site Called from:
+ ** - minigui_free() with the lock held.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param pool (minigui_pool_t): Arena owning the block.
+ ** @param b (block_hdr_t*): Block to free.
+ **
+ ** @section pointers
+ ** - b: Inside the arena.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Clear the in-use flag.
+ ** 2. Absorb the following block if it is free.
+ ** 3. Let the preceding block absorb this one if it is free.
+ ** 4. Fix the prev_size link of the block after the merged region.
+ ******************************************************************************
+ ******************************************************************************/
+static void arena_free(minigui_pool_t pool, block_hdr_t *b) {
+    b->size &= ~BLOCK_USED;
+
+    block_hdr_t *next = next_block(pool, b);
+    if (next && !(next->size & BLOCK_USED)) {
+        b->size += next->size;
+    }
+
+    if (b->prev_size) {
+        block_hdr_t *prev = (block_hdr_t *)((uint8_t *)b - b->prev_size);
+        if (!(prev->size & BLOCK_USED)) {
+            prev->size += b->size;
+            b = prev;
+        }
+    }
+
+    block_hdr_t *after = next_block(pool, b);
+    if (after) after->prev_size = b->size;
+}
+
+#else
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Platform default allocation for a pool.
+ **
+ ** @section call_site Called from:
+ ** - minigui_malloc() when no application allocator is set.
+ **
+ ** @section dependencies Required Headers:
+ ** - esp_heap_caps.h (ESP-IDF) / stdlib.h (host)
+ **
+ ** @param pool (minigui_pool_t): Pool purpose.
+ ** @param size (size_t): Size in bytes.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void*: Block or NULL.
+ **
+ ** Implementation Steps:
+ ** 1. On ESP-IDF map the pool to heap capabilities (PSRAM falls back to
+ **    internal RAM on boards without it).
+ ** 2. Elsewhere use malloc().
+ ******************************************************************************
+ ******************************************************************************/
+static void *default_alloc(minigui_pool_t pool, size_t size) {
+#ifdef ESP_PLATFORM
+    switch (pool) {
+        case MINIGUI_POOL_PSRAM:
+            return heap_caps_malloc_prefer(size, 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+                                           MALLOC_CAP_DEFAULT);
+        case MINIGUI_POOL_DMA:
+            return heap_caps_malloc(size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        default:
+            return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+#else
+    (void)pool;
+    return malloc(size);
+#endif
+}
+
+#endif // MINIGUI_STATIC_POOLS
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Redirect minigui allocations to an application allocator.
+ **
+ ** @section call_site Called from:
+ ** - Application startup, before minigui_init().
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_lock.h (MINIGUI_LOCK)
+ **
+ ** @param allocator (const minigui_allocator_t*): Allocator or NULL.
+ **
+ ** @section pointers
+ ** - allocator: Read-only, copied.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return bool: false in static pool builds.
+ **
+ ** Implementation Steps:
+ ** 1. Reject in MINIGUI_STATIC_POOLS builds.
+ ** 2. Copy or clear the allocator under the lock.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_set_allocator(const minigui_allocator_t *allocator) {
+#ifdef MINIGUI_STATIC_POOLS
+    (void)allocator;
+    LV_LOG_WARN("minigui_set_allocator ignored: built with MINIGUI_STATIC_POOLS");
+    return false;
+#else
+    MINIGUI_LOCK();
+    if (allocator && allocator->alloc && allocator->free) {
+        app_allocator = *allocator;
+    } else {
+        memset(&app_allocator, 0, sizeof(app_allocator));
+    }
+    MINIGUI_UNLOCK();
+    return true;
+#endif
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Allocate a block from a pool.
+ **
+ ** @section call_site Called from:
+ ** - All minigui modules that need a buffer.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_lock.h (MINIGUI_LOCK)
+ **
+ ** @param pool (minigui_pool_t): Pool purpose.
+ ** @param size (size_t): Size in bytes.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c hdr (block_hdr_t*): Header in front of the returned payload.
+ ** - @c payload (size_t): Bytes charged to the pool.
+ **
+ ** @return void*: Payload pointer or NULL.
+ **
+ ** Implementation Steps:
+ ** 1. Acquire the lock (counters and arenas are shared).
+ ** 2. Allocate header + payload from the arena or heap.
+ ** 3. Update allocation/failure counters and the peak.
+ ** 4. Release the lock and return the payload.
+ ******************************************************************************
+ ******************************************************************************/
+void *minigui_malloc(minigui_pool_t pool, size_t size) {
+    if (pool >= MINIGUI_POOL_COUNT || size == 0 || size > UINT32_MAX / 2) return NULL;
+
+    MINIGUI_LOCK();
+
+#ifdef MINIGUI_STATIC_POOLS
+    block_hdr_t *hdr = arena_alloc(pool, size);
+    size_t payload = hdr ? (hdr->size & ~BLOCK_USED) - BLOCK_HDR_SIZE : 0;
+#else
+    block_hdr_t *hdr = app_allocator.alloc
+        ? (block_hdr_t *)app_allocator.alloc(pool, size + BLOCK_HDR_SIZE, app_allocator.user)
+        : (block_hdr_t *)default_alloc(pool, size + BLOCK_HDR_SIZE);
+    size_t payload = size;
+    if (hdr) hdr->size = (uint32_t)size;
+#endif
+
+    minigui_pool_stats_t *st = &pool_stats[pool];
+    if (hdr) {
+        st->allocs++;
+        st->in_use += payload;
+        if (st->in_use > st->peak) st->peak = st->in_use;
+    } else {
+        st->failures++;
+    }
+
+    MINIGUI_UNLOCK();
+
+    if (!hdr) {
+        LV_LOG_WARN("minigui pool %d: failed to allocate %zu bytes", (int)pool, size);
+        return NULL;
+    }
+    return (uint8_t *)hdr + BLOCK_HDR_SIZE;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Release a block obtained from minigui_malloc().
+ **
+ ** @section call_site Called from:
+ ** - All minigui modules that allocate buffers.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_lock.h (MINIGUI_LOCK)
+ **
+ ** @param pool (minigui_pool_t): Pool the block came from.
+ ** @param ptr (void*): Payload pointer.
+ **
+ ** @section pointers
+ ** - ptr: Invalid after the call.
+ **
+ ** @section variables Internal Variables:
+ ** - @c hdr (block_hdr_t*): Block header.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Step back to the header and read the charged size.
+ ** 2. Return the block to its arena or heap.
+ ** 3. Update the counters.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_free(minigui_pool_t pool, void *ptr) {
+    if (!ptr || pool >= MINIGUI_POOL_COUNT) return;
+
+    block_hdr_t *hdr = (block_hdr_t *)((uint8_t *)ptr - BLOCK_HDR_SIZE);
+
+    MINIGUI_LOCK();
+
+#ifdef MINIGUI_STATIC_POOLS
+    size_t payload = (hdr->size & ~BLOCK_USED) - BLOCK_HDR_SIZE;
+    arena_free(pool, hdr);
+#else
+    size_t payload = hdr->size;
+    if (app_allocator.free) {
+        app_allocator.free(pool, hdr, app_allocator.user);
+    } else {
+#ifdef ESP_PLATFORM
+        heap_caps_free(hdr);
+#else
+        free(hdr);
+#endif
+    }
+#endif
+
+    pool_stats[pool].frees++;
+    pool_stats[pool].in_use -= payload;
+
+    MINIGUI_UNLOCK();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Read the usage counters of a pool.
+ **
+ ** @section call_site Called from:
+ ** - Diagnostics, benchmarks and metrics export.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_lock.h (MINIGUI_LOCK)
+ **
+ ** @param pool (minigui_pool_t): Pool to query.
+ ** @param stats (minigui_pool_stats_t*): Output counters.
+ **
+ ** @section pointers
+ ** - stats: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Copy the counters under the lock.
+ ** 2. Report the arena size as capacity in static mode.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_get_pool_stats(minigui_pool_t pool, minigui_pool_stats_t *stats) {
+    if (!stats) return;
+    memset(stats, 0, sizeof(*stats));
+    if (pool >= MINIGUI_POOL_COUNT) return;
+
+    MINIGUI_LOCK();
+    *stats = pool_stats[pool];
+#ifdef MINIGUI_STATIC_POOLS
+    stats->capacity = arenas[pool].size;
+#endif
+    MINIGUI_UNLOCK();
+}
@@ -0,0 +1,1195 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Benchmarks.
+ **
+ **            Benchmark drivers that exercise minigui subsystems against the
+ **            live UI and report throughput, latency percentiles and frame
+ **            times. Timing uses the minigui_perf microsecond clock.
+ **
+ **            @section minigui_bench.c - Benchmark implementation.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>  // For qsort
+#include <string.h>
+#include <time.h>    // For struct tm, strftime
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_bench.h"
+#include "minigui.h"
+#include "minigui_alloc.h"
+#include "minigui_draw.h"
+#include "minigui_fmt.h"
+#include "minigui_history.h"
+#include "minigui_lock.h"
+#include "minigui_layout.h"
+#include "minigui_perf.h"
+#include "minigui_settings.h"
+#include "minigui_theme.h"
+#if MINIGUI_ENABLE_LOGS
+#include "minigui_log_store.h"
+#include "screens/screen_logs.h"
+#endif
+#if MINIGUI_ENABLE_SETTINGS
+#include "screens/screen_settings.h"
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+#if MINIGUI_ENABLE_LOGS
+/**
+ * @brief Size of the push-latency reservoir used for percentiles
+ */
+#define BENCH_LATENCY_SAMPLES 1024
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Reservoir of push latencies.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_bench.c.
+ **
+ ** @section rationale Rationale:
+ ** - A fixed reservoir keeps memory constant however many lines are pushed
+ **   while still giving representative percentiles.
+ ******************************************************************************
+ ******************************************************************************/
+static uint32_t latency_samples[BENCH_LATENCY_SAMPLES];
+#endif
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief xorshift32 pseudo random generator.
+ **
+ ** @section call_site Called from:
+ ** - Synthetic data generation and reservoir sampling.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param state (uint32_t*): Generator state (must be non-zero).
+ **
+ ** @section pointers
+ ** - state: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return uint32_t: Next pseudo random value.
+ **
+ ** Implementation Steps:
+ ** 1. Apply the 13/17/5 xorshift sequence.
+ ******************************************************************************
+ ******************************************************************************/
+static uint32_t bench_rand(uint32_t *state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+#if MINIGUI_ENABLE_LOGS
+/******************************************************************************
+ ******************************************************************************
+ ** @brief qsort comparator for uint32_t.
+ **
+ ** @section call_site Called from:
+ ** - minigui_bench_log_pipeline() when computing percentiles.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdlib.h (qsort)
+ **
+ ** @param a (const void*): Left operand.
+ ** @param b (const void*): Right operand.
+ **
+ ** @section pointers
+ ** - a/b: Elements of the sample array.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return int: Ordering of the two values.
+ **
+ ** Implementation Steps:
+ ** 1. Compare without subtraction to avoid overflow.
+ ******************************************************************************
+ ******************************************************************************/
+static int cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Generates one synthetic log entry.
+ **
+ ** @section call_site Called from:
+ ** - minigui_bench_log_pipeline() before each timed push.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdio.h (snprintf for the timestamp)
+ **
+ ** @param entry (minigui_log_entry_t*): Output entry.
+ ** @param seq (uint32_t): Sequence number of the line.
+ ** @param cfg (const minigui_bench_log_cfg_t*): Size distribution.
+ ** @param rng (uint32_t*): PRNG state.
+ **
+ ** @section pointers
+ ** - entry/rng: Owned by caller.
+ ** - cfg: Read-only.
+ **
+ ** @section variables Internal Variables:
+ ** - @c len (uint32_t): Chosen message length.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Derive a timestamp from the sequence number.
+ ** 2. Pick a random source and level.
+ ** 3. Choose a message length (uniform, or max for the long share).
+ ** 4. Fill the message with word-like text.
+ ******************************************************************************
+ ******************************************************************************/
+static void make_entry(minigui_log_entry_t *entry, uint32_t seq,
+                       const minigui_bench_log_cfg_t *cfg, uint32_t *rng) {
+    static const char *sources[] = {"ESP", "LVGL", "USER", "WIFI"};
+    static const char *levels[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+
+    snprintf(entry->timestamp, sizeof(entry->timestamp), "%02lu:%02lu:%02lu",
+             (unsigned long)((seq / 3600) % 24), (unsigned long)((seq / 60) % 60),
+             (unsigned long)(seq % 60));
+    strcpy(entry->source, sources[bench_rand(rng) % 4]);
+    strcpy(entry->level, levels[bench_rand(rng) % 4]);
+
+    uint32_t lo = cfg->msg_len_min;
+    uint32_t hi = cfg->msg_len_max < lo ? lo : cfg->msg_len_max;
+    uint32_t len;
+    if (cfg->long_msg_pct && (bench_rand(rng) % 100) < cfg->long_msg_pct) {
+        len = hi;
+    } else {
+        len = lo + bench_rand(rng) % (hi - lo + 1);
+    }
+    if (len > sizeof(entry->message) - 1) len = sizeof(entry->message) - 1;
+
+    for (uint32_t i = 0; i < len; i++) {
+        entry->message[i] = ((i & 7) == 7) ? ' ' : (char)('a' + (seq + i) % 26);
+    }
+    entry->message[len] = '\0';
+}
+#endif // MINIGUI_ENABLE_LOGS
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Measures one view and folds it into a profile result.
+ **
+ ** @section call_site Called from:
+ ** - minigui_bench_layout_profiles() for every screen and category.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_perf.h (minigui_perf_measure)
+ **
+ ** @param screen (minigui_screen_t): Screen to build.
+ ** @param category (int32_t): Settings category or MINIGUI_PERF_CATEGORY_DEFAULT.
+ ** @param result (minigui_bench_layout_result_t*): Accumulator.
+ **
+ ** @section pointers
+ ** - result: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c sample (minigui_perf_sample_t): One measurement.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Measure the view (no frame capture).
+ ** 2. Add build/render/object figures and track the maxima.
+ ******************************************************************************
+ ******************************************************************************/
+static void measure_view(minigui_screen_t screen, int32_t category, minigui_bench_layout_result_t *result) {
+    minigui_perf_sample_t sample;
+    if (!minigui_perf_measure(screen, category, 200, &sample, NULL)) return;
+
+    result->views++;
+    result->build_us_total += sample.build_us;
+    result->render_us_total += sample.render_us;
+    result->obj_count_total += sample.obj_count;
+    if (sample.build_us > result->build_us_max) result->build_us_max = sample.build_us;
+    if (sample.render_us > result->render_us_max) result->render_us_max = sample.render_us;
+}
+
+static uint32_t count_tree(lv_obj_t *obj) {
+    uint32_t count = 1;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < child_cnt; i++) count += count_tree(lv_obj_get_child(obj, (int32_t)i));
+    return count;
+}
+
+static void mark_layout_dirty(lv_obj_t *obj) {
+    lv_obj_mark_layout_as_dirty(obj);
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < child_cnt; i++) mark_layout_dirty(lv_obj_get_child(obj, (int32_t)i));
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Builds one view with the current primitive mode and measures it.
+ **
+ ** @section call_site Called from:
+ ** - minigui_bench_draw_primitives(), once per mode and view.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_perf.h (minigui_perf_measure)
+ ** - minigui_alloc.h (internal pool usage)
+ **
+ ** @param screen (minigui_screen_t): Screen to build.
+ ** @param category (int32_t): Settings category or MINIGUI_PERF_CATEGORY_DEFAULT.
+ ** @param side (minigui_bench_draw_side_t*): Output.
+ **
+ ** @section pointers
+ ** - side: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c sample (minigui_perf_sample_t): Build/render/object measurement.
+ ** - @c pool (minigui_pool_stats_t): Draw lists live in the internal pool,
+ **   not the LVGL heap, so both are added.
+ **
+ ** @return bool: false if the view could not be built.
+ **
+ ** Implementation Steps:
+ ** 1. Measure the view (no frame capture).
+ ** 2. Mark every object of the screen dirty and time lv_obj_update_layout().
+ ** 3. Add the internal pool usage to the LVGL heap figure.
+ ******************************************************************************
+ ******************************************************************************/
+static bool measure_draw_side(minigui_screen_t screen, int32_t category, minigui_bench_draw_side_t *side) {
+    minigui_perf_sample_t sample;
+    if (!minigui_perf_measure(screen, category, 200, &sample, NULL)) return false;
+
+    MINIGUI_LOCK();
+    lv_obj_t *scr = lv_screen_active();
+    mark_layout_dirty(scr);
+    uint32_t t0 = minigui_perf_now_us();
+    lv_obj_update_layout(scr);
+    side->layout_us = minigui_perf_now_us() - t0;
+    MINIGUI_UNLOCK();
+
+    minigui_pool_stats_t pool;
+    minigui_get_pool_stats(MINIGUI_POOL_INTERNAL, &pool);
+
+    side->obj_count = sample.obj_count;
+    side->ram_bytes = sample.heap_used + (uint32_t)pool.in_use;
+    side->build_us = sample.build_us;
+    side->render_us = sample.render_us;
+    return true;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+#if MINIGUI_ENABLE_LOGS
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Flood the log pipeline and measure it end to end.
+ **
+ ** @section call_site Called from:
+ ** - Simulator or firmware console after minigui_init().
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_log_store.h (ingestion)
+ ** - screen_logs.h (refresh_log_table for filter/bind)
+ ** - minigui_perf.h (timing)
+ **
+ ** @param cfg (const minigui_bench_log_cfg_t*): Configuration.
+ ** @param result (minigui_bench_log_result_t*): Output.
+ **
+ ** @section pointers
+ ** - cfg: Read-only.
+ ** - result: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c per_frame (uint32_t): Lines pushed between two UI frames.
+ ** - @c entry (minigui_log_entry_t): Generated line (static, 298 bytes).
+ ** - @c frame_total/bind_total (uint64_t): Accumulated frame costs.
+ **
+ ** @return bool: true if the run completed.
+ **
+ ** Implementation Steps:
+ ** 1. Validate configuration, clear the store, open the Logs screen.
+ ** 2. For each frame, push the frame's lines and time each push into the
+ **    latency reservoir.
+ ** 3. Rebind the table (rotating filter) and render one frame, timing both.
+ ** 4. Run LVGL timers and sleep out the remainder of the frame period when
+ **    a rate is configured.
+ ** 5. Sort the reservoir and derive throughput, percentiles and averages.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_bench_log_pipeline(const minigui_bench_log_cfg_t *cfg, minigui_bench_log_result_t *result) {
+    if (!cfg || !result || cfg->total_lines == 0) return false;
+    memset(result, 0, sizeof(*result));
+
+    static const char *filters[] = {"ALL", "ESP", "LVGL", "USER"};
+    static minigui_log_entry_t entry;
+
+    uint32_t rng = cfg->seed ? cfg->seed : 0x9E3779B9u;
+    uint32_t frame_ms = cfg->frame_period_ms ? cfg->frame_period_ms : 33;
+    uint32_t per_frame = 64;
+    if (cfg->lines_per_sec) {
+        per_frame = (uint32_t)(((uint64_t)cfg->lines_per_sec * frame_ms) / 1000u);
+        if (per_frame == 0) per_frame = 1;
+    }
+
+    minigui_log_store_clear();
+    minigui_switch_screen(MINIGUI_SCREEN_LOGS);
+
+    uint64_t frame_total = 0;
+    uint64_t bind_total = 0;
+    uint32_t seq = 0;
+    uint32_t start_us = minigui_perf_now_us();
+
+    while (seq < cfg->total_lines) {
+        uint32_t frame_tick = lv_tick_get();
+
+        // 1. Ingestion
+        for (uint32_t k = 0; k < per_frame && seq < cfg->total_lines; k++, seq++) {
+            make_entry(&entry, seq, cfg, &rng);
+
+            uint32_t t0 = minigui_perf_now_us();
+            minigui_log_store_push(&entry);
+            uint32_t lat = minigui_perf_now_us() - t0;
+
+            if (lat > result->ingest_max_us) result->ingest_max_us = lat;
+            if (seq < BENCH_LATENCY_SAMPLES) {
+                latency_samples[seq] = lat;
+            } else {
+                uint32_t j = bench_rand(&rng) % (seq + 1);
+                if (j < BENCH_LATENCY_SAMPLES) latency_samples[j] = lat;
+            }
+        }
+
+        // 2. Filter + index + view bind, then render
+        MINIGUI_LOCK();
+        uint32_t t0 = minigui_perf_now_us();
+        refresh_log_table(filters[result->frames % 4]);
+        uint32_t t1 = minigui_perf_now_us();
+        lv_refr_now(NULL);
+        uint32_t t2 = minigui_perf_now_us();
+        MINIGUI_UNLOCK();
+
+        uint32_t frame_us = t2 - t0;
+        bind_total += t1 - t0;
+        frame_total += frame_us;
+        if (frame_us > result->frame_max_us) result->frame_max_us = frame_us;
+        result->frames++;
+
+        // 3. Keep other timers alive and pace to the target rate
+        lv_timer_handler();
+        if (cfg->lines_per_sec) {
+            uint32_t spent = lv_tick_elaps(frame_tick);
+            if (spent < frame_ms) lv_delay_ms(frame_ms - spent);
+        }
+    }
+
+    result->elapsed_us = minigui_perf_now_us() - start_us;
+    result->lines_pushed = seq;
+    if (result->elapsed_us) {
+        result->lines_per_sec = (uint32_t)(((uint64_t)seq * 1000000u) / result->elapsed_us);
+    }
+
+    uint32_t n = seq < BENCH_LATENCY_SAMPLES ? seq : BENCH_LATENCY_SAMPLES;
+    qsort(latency_samples, n, sizeof(latency_samples[0]), cmp_u32);
+    result->ingest_p50_us = latency_samples[(n * 50) / 100];
+    result->ingest_p99_us = latency_samples[(n * 99) / 100];
+
+    minigui_log_store_stats_t stats;
+    minigui_log_store_get_stats(&stats);
+    result->bytes_per_entry = stats.bytes_per_entry;
+    result->retained = stats.retained;
+    result->dropped = stats.dropped;
+
+    if (result->frames) {
+        result->bind_avg_us = (uint32_t)(bind_total / result->frames);
+        result->frame_avg_us = (uint32_t)(frame_total / result->frames);
+    }
+
+    LV_LOG_USER("Log bench: %lu lines/s, p99 %lu us, %lu B/entry, frame avg %lu us",
+                (unsigned long)result->lines_per_sec, (unsigned long)result->ingest_p99_us,
+                (unsigned long)result->bytes_per_entry, (unsigned long)result->frame_avg_us);
+    return true;
+}
+#endif // MINIGUI_ENABLE_LOGS
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Build and render every view once per layout profile.
+ **
+ ** @section call_site Called from:
+ ** - Host simulator after minigui_init().
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_layout.h (profiles, cache)
+ ** - minigui_perf.h (measurement)
+ **
+ ** @param disp (lv_display_t*): Display to resize, NULL for the default.
+ ** @param results (minigui_bench_layout_result_t*): Output array.
+ ** @param max_results (uint32_t): Capacity of results.
+ **
+ ** @section pointers
+ ** - results: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c orig_w/@c orig_h (int32_t): Resolution restored at the end.
+ **
+ ** @return uint32_t: Profiles measured.
+ **
+ ** Implementation Steps:
+ ** 1. Remember the current resolution.
+ ** 2. Per profile: resize, invalidate the cache, time a resolving and a
+ **    cached minigui_layout_get().
+ ** 3. Measure every screen, and every Settings category.
+ ** 4. Restore the resolution and show the default screen.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_bench_layout_profiles(lv_display_t *disp, minigui_bench_layout_result_t *results,
+                                       uint32_t max_results) {
+    if (!results) return 0;
+    if (!disp) disp = lv_display_get_default();
+    if (!disp) return 0;
+
+    int32_t orig_w = lv_display_get_horizontal_resolution(disp);
+    int32_t orig_h = lv_display_get_vertical_resolution(disp);
+
+    uint32_t count = minigui_layout_get_profile_count();
+    if (count > max_results) count = max_results;
+
+    for (uint32_t i = 0; i < count; i++) {
+        minigui_bench_layout_result_t *r = &results[i];
+        memset(r, 0, sizeof(*r));
+        minigui_layout_get_profile_resolution(i, &r->hor_res, &r->ver_res);
+
+        MINIGUI_LOCK();
+        lv_display_set_resolution(disp, r->hor_res, r->ver_res);
+        minigui_layout_invalidate();
+        uint32_t t0 = minigui_perf_now_us();
+        const minigui_layout_t *layout = minigui_layout_get();
+        uint32_t t1 = minigui_perf_now_us();
+        minigui_layout_get();
+        uint32_t t2 = minigui_perf_now_us();
+        r->profile = layout->profile;
+        MINIGUI_UNLOCK();
+
+        r->resolve_us = t1 - t0;
+        r->cached_us = t2 - t1;
+
+        for (int s = 0; s < MINIGUI_SCREEN_COUNT; s++) {
+#if MINIGUI_ENABLE_SETTINGS
+            if (s == MINIGUI_SCREEN_SETTINGS) {
+                uint32_t cats = screen_settings_get_category_count();
+                for (uint32_t c = 0; c < cats; c++) measure_view((minigui_screen_t)s, (int32_t)c, r);
+                continue;
+            }
+#endif
+            measure_view((minigui_screen_t)s, MINIGUI_PERF_CATEGORY_DEFAULT, r);
+        }
+
+        LV_LOG_USER("Layout bench %ldx%ld: profile %u, resolve %lu us, build %lu us (max %lu), render %lu us (max %lu)",
+                    (long)r->hor_res, (long)r->ver_res, r->profile, (unsigned long)r->resolve_us,
+                    (unsigned long)r->build_us_total, (unsigned long)r->build_us_max,
+                    (unsigned long)r->render_us_total, (unsigned long)r->render_us_max);
+    }
+
+    MINIGUI_LOCK();
+    lv_display_set_resolution(disp, orig_w, orig_h);
+    minigui_layout_invalidate();
+    MINIGUI_UNLOCK();
+    minigui_switch_screen(MINIGUI_SCREEN_DEFAULT);
+
+    return count;
+}
+
+/**
+ * @brief Strings produced per sample set by the formatting benchmark
+ */
+#define BENCH_FMT_STRINGS 6
+#define BENCH_FMT_LEN     48
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Builds one deterministic sample set for the formatting benchmark.
+ **
+ ** @section call_site Called from:
+ ** - minigui_bench_format().
+ **
+ ** @section dependencies Required Headers:
+ ** - time.h (struct tm)
+ **
+ ** @param i (uint32_t): Sample index.
+ ** @param stats (minigui_system_stats_t*): Output Monitor values.
+ ** @param bytes (uint64_t*): Output byte count.
+ ** @param tm (struct tm*): Output clock time.
+ **
+ ** @section pointers
+ ** - stats/bytes/tm: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Sweep the voltage in 1 mV steps offset by 0.2 mV, so no sample sits
+ **    on a rounding tie where printf and the formatter may legitimately
+ **    disagree.
+ ** 2. Derive the other fields from the index.
+ ******************************************************************************
+ ******************************************************************************/
+static void bench_fmt_sample(uint32_t i, minigui_system_stats_t *stats, uint64_t *bytes, struct tm *tm) {
+    stats->voltage = 3.0f + (float)(i % 1000u) * 0.001f + 0.0002f;
+    stats->cpu_usage = (uint8_t)(i % 101u);
+    stats->flash_total_kb = 4096u;
+    stats->flash_used_kb = (i * 37u) % 4097u;
+    stats->ram_total_kb = 520u;
+    stats->ram_used_kb = (i * 13u) % 521u;
+    *bytes = (uint64_t)i * 7919u * (1u + i % 4096u);
+
+    memset(tm, 0, sizeof(*tm));
+    tm->tm_wday = (int)(i % 7u);
+    tm->tm_mon = (int)(i % 12u);
+    tm->tm_mday = (int)(1u + i % 28u);
+    tm->tm_hour = (int)(i % 24u);
+    tm->tm_min = (int)(i % 60u);
+    tm->tm_sec = (int)((i * 7u) % 60u);
+}
+
+static void bench_fmt_printf(uint32_t i, char out[BENCH_FMT_STRINGS][BENCH_FMT_LEN]) {
+    static const char *const units[] = { "B", "KB", "MB", "GB", "TB" };
+    minigui_system_stats_t s;
+    uint64_t bytes;
+    struct tm tm;
+    bench_fmt_sample(i, &s, &bytes, &tm);
+
+    snprintf(out[0], BENCH_FMT_LEN, "Voltage: %.2fV", s.voltage);
+    snprintf(out[1], BENCH_FMT_LEN, "CPU Usage: %d%%", s.cpu_usage);
+    snprintf(out[2], BENCH_FMT_LEN, "Flash: %lu / %lu KB (%d%%)", (unsigned long)s.flash_used_kb,
+             (unsigned long)s.flash_total_kb, (int)((s.flash_used_kb * 100) / s.flash_total_kb));
+    snprintf(out[3], BENCH_FMT_LEN, "RAM: %lu / %lu KB (%d%%)", (unsigned long)s.ram_used_kb,
+             (unsigned long)s.ram_total_kb, (int)((s.ram_used_kb * 100) / s.ram_total_kb));
+
+    double v = (double)bytes;
+    uint32_t u = 0;
+    while (u < 4 && v >= 1024.0) {
+        v /= 1024.0;
+        u++;
+    }
+    if (u == 0) {
+        snprintf(out[4], BENCH_FMT_LEN, "%lu B", (unsigned long)bytes);
+    } else if (v < 99.95) {
+        snprintf(out[4], BENCH_FMT_LEN, "%.1f %s", v, units[u]);
+    } else {
+        snprintf(out[4], BENCH_FMT_LEN, "%.0f %s", v, units[u]);
+    }
+
+    strftime(out[5], BENCH_FMT_LEN, "%a %m/%d %H:%M:%S", &tm);
+}
+
+static void bench_fmt_fixed(uint32_t i, char out[BENCH_FMT_STRINGS][BENCH_FMT_LEN]) {
+    minigui_system_stats_t s;
+    uint64_t bytes;
+    struct tm tm;
+    bench_fmt_sample(i, &s, &bytes, &tm);
+
+    size_t n = minigui_fmt_str(out[0], BENCH_FMT_LEN, "Voltage: ");
+    n += minigui_fmt_float(out[0] + n, BENCH_FMT_LEN - n, s.voltage, 2);
+    minigui_fmt_str(out[0] + n, BENCH_FMT_LEN - n, "V");
+
+    n = minigui_fmt_str(out[1], BENCH_FMT_LEN, "CPU Usage: ");
+    minigui_fmt_percent(out[1] + n, BENCH_FMT_LEN - n, s.cpu_usage, 100);
+
+    const char *prefix[2] = { "Flash: ", "RAM: " };
+    uint32_t used[2] = { s.flash_used_kb, s.ram_used_kb };
+    uint32_t total[2] = { s.flash_total_kb, s.ram_total_kb };
+    for (uint32_t k = 0; k < 2; k++) {
+        char *p = out[2 + k];
+        n = minigui_fmt_str(p, BENCH_FMT_LEN, prefix[k]);
+        n += minigui_fmt_u32(p + n, BENCH_FMT_LEN - n, used[k]);
+        n += minigui_fmt_str(p + n, BENCH_FMT_LEN - n, " / ");
+        n += minigui_fmt_u32(p + n, BENCH_FMT_LEN - n, total[k]);
+        n += minigui_fmt_str(p + n, BENCH_FMT_LEN - n, " KB (");
+        n += minigui_fmt_percent(p + n, BENCH_FMT_LEN - n, used[k], total[k]);
+        minigui_fmt_str(p + n, BENCH_FMT_LEN - n, ")");
+    }
+
+    minigui_fmt_bytes(out[4], BENCH_FMT_LEN, bytes);
+    minigui_fmt_clock(out[5], BENCH_FMT_LEN, &tm);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Compare snprintf against the minigui_fmt formatters.
+ **
+ ** @section call_site Called from:
+ ** - Host simulator / firmware console.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdio.h, time.h (reference implementation)
+ ** - minigui_fmt.h (formatters under test)
+ ** - minigui_perf.h (clock)
+ **
+ ** @param iterations (uint32_t): Sample sets, 0 for 10000.
+ ** @param result (minigui_bench_fmt_result_t*): Output.
+ **
+ ** @section pointers
+ ** - result: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c a/@c b (char[][]): Outputs of both sides for one sample set.
+ ** - @c sink (volatile uint32_t): Keeps the timed loops from being elided.
+ **
+ ** @return bool: true if the run completed.
+ **
+ ** Implementation Steps:
+ ** 1. Time all sample sets with snprintf/strftime.
+ ** 2. Time the same sample sets with minigui_fmt.
+ ** 3. Untimed pass: compare both outputs and count differences.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_bench_format(uint32_t iterations, minigui_bench_fmt_result_t *result) {
+    if (!result) return false;
+    if (iterations == 0) iterations = 10000;
+
+    char a[BENCH_FMT_STRINGS][BENCH_FMT_LEN];
+    char b[BENCH_FMT_STRINGS][BENCH_FMT_LEN];
+    volatile uint32_t sink = 0;
+
+    memset(result, 0, sizeof(*result));
+    result->iterations = iterations;
+    result->strings = BENCH_FMT_STRINGS;
+
+    uint32_t t0 = minigui_perf_now_us();
+    for (uint32_t i = 0; i < iterations; i++) {
+        bench_fmt_printf(i, a);
+        sink += (uint8_t)a[i % BENCH_FMT_STRINGS][0];
+    }
+    result->snprintf_us = minigui_perf_now_us() - t0;
+
+    t0 = minigui_perf_now_us();
+    for (uint32_t i = 0; i < iterations; i++) {
+        bench_fmt_fixed(i, b);
+        sink += (uint8_t)b[i % BENCH_FMT_STRINGS][0];
+    }
+    result->fmt_us = minigui_perf_now_us() - t0;
+    (void)sink;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        bench_fmt_printf(i, a);
+        bench_fmt_fixed(i, b);
+        for (uint32_t k = 0; k < BENCH_FMT_STRINGS; k++) {
+            if (strcmp(a[k], b[k]) != 0) {
+                if (result->mismatches == 0) LV_LOG_WARN("Format bench: \"%s\" vs \"%s\"", a[k], b[k]);
+                result->mismatches++;
+            }
+        }
+    }
+
+    LV_LOG_USER("Format bench: %lu sets x %u strings, snprintf %lu us, minigui_fmt %lu us, %lu mismatches",
+                (unsigned long)iterations, (unsigned)BENCH_FMT_STRINGS, (unsigned long)result->snprintf_us,
+                (unsigned long)result->fmt_us, (unsigned long)result->mismatches);
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Measure every view with object-backed and drawn primitives.
+ **
+ ** @section call_site Called from:
+ ** - Simulator or firmware console after minigui_init().
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_draw.h (object mode switch)
+ ** - minigui_perf.h (measurement)
+ **
+ ** @param results (minigui_bench_draw_result_t*): Output array.
+ ** @param max_results (uint32_t): Capacity of results.
+ **
+ ** @section pointers
+ ** - results: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c views (int32_t[][2]): Screen/category pairs to measure.
+ ** - @c prev_mode (bool): Object mode to restore.
+ **
+ ** @return uint32_t: Views measured.
+ **
+ ** Implementation Steps:
+ ** 1. Enumerate screens, expanding Settings into its categories.
+ ** 2. Per view, measure in object mode, then in draw mode (each rebuilds
+ **    the view), and log the object, RAM and time deltas.
+ ** 3. Restore the object mode and the default screen.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_bench_draw_primitives(minigui_bench_draw_result_t *results, uint32_t max_results) {
+    if (!results) return 0;
+
+    bool prev_mode = minigui_draw_get_object_mode();
+    uint32_t count = 0;
+
+    for (int s = 0; s < MINIGUI_SCREEN_COUNT && count < max_results; s++) {
+        uint32_t cats = 0;  // Screens without categories are measured once
+#if MINIGUI_ENABLE_SETTINGS
+        if (s == MINIGUI_SCREEN_SETTINGS) cats = screen_settings_get_category_count();
+#endif
+        for (uint32_t c = 0; c < (cats ? cats : 1) && count < max_results; c++) {
+            minigui_bench_draw_result_t *r = &results[count];
+            memset(r, 0, sizeof(*r));
+            r->screen = s;
+            r->category = cats ? (int32_t)c : MINIGUI_PERF_CATEGORY_DEFAULT;
+
+            minigui_draw_set_object_mode(true);
+            bool ok = measure_draw_side((minigui_screen_t)s, r->category, &r->objects);
+            minigui_draw_set_object_mode(false);
+            ok = ok && measure_draw_side((minigui_screen_t)s, r->category, &r->drawn);
+            if (!ok) continue;
+
+            LV_LOG_USER("Draw bench %ld/%ld: objects %lu -> %lu, RAM %lu -> %lu B, build %lu -> %lu us, "
+                        "layout %lu -> %lu us, render %lu -> %lu us",
+                        (long)r->screen, (long)r->category,
+                        (unsigned long)r->objects.obj_count, (unsigned long)r->drawn.obj_count,
+                        (unsigned long)r->objects.ram_bytes, (unsigned long)r->drawn.ram_bytes,
+                        (unsigned long)r->objects.build_us, (unsigned long)r->drawn.build_us,
+                        (unsigned long)r->objects.layout_us, (unsigned long)r->drawn.layout_us,
+                        (unsigned long)r->objects.render_us, (unsigned long)r->drawn.render_us);
+            count++;
+        }
+    }
+
+    minigui_draw_set_object_mode(prev_mode);
+    minigui_switch_screen(MINIGUI_SCREEN_DEFAULT);
+    return count;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Alternate the built-in themes on the current screen.
+ **
+ ** @section call_site Called from:
+ ** - Simulator or firmware console after minigui_init().
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_theme.h (palettes, apply)
+ ** - minigui_perf.h (timing)
+ **
+ ** @param switches (uint32_t): Switches to perform (0 = 20).
+ ** @param result (minigui_bench_theme_result_t*): Output.
+ **
+ ** @section pointers
+ ** - result: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c original (const minigui_theme_t*): Theme restored at the end.
+ ** - @c content (lv_obj_t*): Content area, must survive every switch.
+ **
+ ** @return bool: true if completed without recreating objects.
+ **
+ ** Implementation Steps:
+ ** 1. Snapshot object count and content area under the lock.
+ ** 2. Alternate light/dark (starting with the other one), timing the apply
+ **    and one forced refresh (the style change already invalidated all).
+ ** 3. Restore the original theme, compare and log.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_bench_theme_switch(uint32_t switches, minigui_bench_theme_result_t *result) {
+    if (!result) return false;
+    if (switches == 0) switches = 20;
+    memset(result, 0, sizeof(*result));
+
+    const minigui_theme_t *original = minigui_theme_get();
+    lv_obj_t *content = minigui_get_content_area();
+    if (!content) return false;
+
+    MINIGUI_LOCK();
+    result->objects_before = count_tree(lv_screen_active());
+    lv_refr_now(NULL);
+    MINIGUI_UNLOCK();
+
+    uint64_t apply_total = 0;
+    uint64_t frame_total = 0;
+    for (uint32_t i = 0; i < switches; i++) {
+        bool to_light = ((i & 1u) == 0) == (original != &minigui_theme_light);
+        const minigui_theme_t *next = to_light ? &minigui_theme_light : &minigui_theme_dark;
+
+        MINIGUI_LOCK();
+        uint32_t t0 = minigui_perf_now_us();
+        minigui_theme_apply(next);
+        uint32_t t1 = minigui_perf_now_us();
+        lv_refr_now(NULL);
+        uint32_t t2 = minigui_perf_now_us();
+        MINIGUI_UNLOCK();
+
+        apply_total += t1 - t0;
+        frame_total += t2 - t1;
+        if (t1 - t0 > result->apply_max_us) result->apply_max_us = t1 - t0;
+        if (t2 - t1 > result->frame_max_us) result->frame_max_us = t2 - t1;
+        result->switches++;
+    }
+    minigui_theme_apply(original);
+
+    MINIGUI_LOCK();
+    result->objects_after = count_tree(lv_screen_active());
+    MINIGUI_UNLOCK();
+    result->rebuilt = (minigui_get_content_area() != content) || result->objects_after != result->objects_before;
+    result->apply_avg_us = (uint32_t)(apply_total / result->switches);
+    result->frame_avg_us = (uint32_t)(frame_total / result->switches);
+
+    LV_LOG_USER("Theme bench: %lu switches, apply avg %lu us (max %lu), frame avg %lu us (max %lu), "
+                "objects %lu -> %lu%s",
+                (unsigned long)result->switches, (unsigned long)result->apply_avg_us,
+                (unsigned long)result->apply_max_us, (unsigned long)result->frame_avg_us,
+                (unsigned long)result->frame_max_us, (unsigned long)result->objects_before,
+                (unsigned long)result->objects_after, result->rebuilt ? " (REBUILT)" : "");
+    return !result->rebuilt;
+}
+
+#if MINIGUI_ENABLE_SETTINGS
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Open a large generated settings group next to the Screen panel.
+ **
+ ** @section call_site Called from:
+ ** - Simulator or firmware console after minigui_init().
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_settings.h (schema, search)
+ ** - minigui_perf.h (minigui_perf_measure, timing)
+ ** - minigui_alloc.h (generated items and labels)
+ **
+ ** @param items (uint16_t): Group size (0 = 150).
+ ** @param result (minigui_bench_schema_result_t*): Output.
+ **
+ ** @section pointers
+ ** - result: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c table (minigui_setting_item_t*): Generated items.
+ ** - @c names (char*): Keys and labels, BENCH_SCHEMA_NAME_LEN each.
+ ** - @c previous (const minigui_settings_schema_t*): Restored at the end.
+ **
+ ** @return bool: true if the run completed.
+ **
+ ** Implementation Steps:
+ ** 1. Generate items cycling through INT, BOOL, ENUM and STRING, labelled
+ **    "Parameter NNN <Level|Enable|Mode|Name>", and register them as one group.
+ ** 2. Measure category 0 (Screen) and the group (last category).
+ ** 3. Run each query 10 times and average.
+ ** 4. Register the previous schema, rebuild Settings (rows reference the
+ **    generated labels), then free them.
+ ******************************************************************************
+ ******************************************************************************/
+#define BENCH_SCHEMA_NAME_LEN 32
+
+bool minigui_bench_settings_schema(uint16_t items, minigui_bench_schema_result_t *result) {
+    static const char *const suffix[4] = { "Level", "Enable", "Mode", "Name" };
+    static const char *const queries[] = { "zzz", "mode", "name", "lev", "par", "parameter 1" };
+
+    if (!result) return false;
+    if (items == 0) items = 150;
+    memset(result, 0, sizeof(*result));
+
+    minigui_setting_item_t *table = (minigui_setting_item_t *)minigui_malloc(MINIGUI_POOL_INTERNAL,
+                                                                             items * sizeof(*table));
+    char *names = (char *)minigui_malloc(MINIGUI_POOL_INTERNAL, (size_t)items * 2 * BENCH_SCHEMA_NAME_LEN);
+    if (!table || !names) {
+        minigui_free(MINIGUI_POOL_INTERNAL, table);
+        minigui_free(MINIGUI_POOL_INTERNAL, names);
+        return false;
+    }
+
+    for (uint16_t i = 0; i < items; i++) {
+        char *key = names + (size_t)i * 2 * BENCH_SCHEMA_NAME_LEN;
+        char *label = key + BENCH_SCHEMA_NAME_LEN;
+        snprintf(key, BENCH_SCHEMA_NAME_LEN, "bench.p%03u", (unsigned)i);
+        snprintf(label, BENCH_SCHEMA_NAME_LEN, "Parameter %03u %s", (unsigned)i, suffix[i % 4]);
+
+        static const minigui_setting_item_t templates[4] = {
+            MINIGUI_SETTING_INT(NULL, NULL, 0, 100, 5, 50, "%"),
+            MINIGUI_SETTING_BOOL(NULL, NULL, 0),
+            MINIGUI_SETTING_ENUM(NULL, NULL, "Off\nLow\nHigh", 1),
+            MINIGUI_SETTING_STRING(NULL, NULL, 16, "default"),
+        };
+        table[i] = templates[i % 4];
+        table[i].key = key;
+        table[i].label = label;
+    }
+
+    const minigui_setting_group_t group = { "Bench", table, items };
+    const minigui_settings_schema_t schema = { &group, 1 };
+    const minigui_settings_schema_t *previous = minigui_settings_get_schema();
+
+    bool ok = minigui_settings_register(&schema);
+    minigui_perf_sample_t sample;
+    if (ok && minigui_perf_measure(MINIGUI_SCREEN_SETTINGS, 0, 200, &sample, NULL)) {
+        result->screen_build_us = sample.build_us;
+        result->screen_render_us = sample.render_us;
+        result->screen_objects = sample.obj_count;
+    } else {
+        ok = false;
+    }
+    if (ok && minigui_perf_measure(MINIGUI_SCREEN_SETTINGS, (int32_t)screen_settings_get_category_count() - 1,
+                                   200, &sample, NULL)) {
+        result->group_build_us = sample.build_us;
+        result->group_render_us = sample.render_us;
+        result->group_objects = sample.obj_count;
+    } else {
+        ok = false;
+    }
+
+    if (ok) {
+        uint16_t *hits = (uint16_t *)minigui_malloc(MINIGUI_POOL_INTERNAL, items * sizeof(uint16_t));
+        uint32_t runs = 0;
+        uint64_t total = 0;
+        for (uint32_t q = 0; hits && q < sizeof(queries) / sizeof(queries[0]); q++) {
+            for (int r = 0; r < 10; r++) {
+                uint32_t t0 = minigui_perf_now_us();
+                result->search_hits = minigui_settings_search(queries[q], hits, items);
+                total += minigui_perf_now_us() - t0;
+                runs++;
+            }
+        }
+        minigui_free(MINIGUI_POOL_INTERNAL, hits);
+        result->search_avg_us = runs ? (uint32_t)(total / runs) : 0;
+    }
+    result->items = items;
+
+    minigui_settings_register(previous);
+    minigui_switch_screen(MINIGUI_SCREEN_SETTINGS);
+    minigui_free(MINIGUI_POOL_INTERNAL, names);
+    minigui_free(MINIGUI_POOL_INTERNAL, table);
+
+    LV_LOG_USER("Schema bench: %u items, Screen panel %lu us / %lu objs, group %lu us / %lu objs, "
+                "search avg %lu us",
+                (unsigned)result->items, (unsigned long)(result->screen_build_us + result->screen_render_us),
+                (unsigned long)result->screen_objects,
+                (unsigned long)(result->group_build_us + result->group_render_us),
+                (unsigned long)result->group_objects, (unsigned long)result->search_avg_us);
+    return ok;
+}
+#endif // MINIGUI_ENABLE_SETTINGS
+
+/******************************************************************************
+ ******************************************************************************
+ * METRICS HISTORY BENCHMARK
+ ******************************************************************************
+ ******************************************************************************/
+
+#define BENCH_HISTORY_POINTS 240
+
+/**
+ * @brief Synthetic device metrics, one row per call of bench_metrics_next()
+ */
+typedef struct {
+    uint32_t rng;
+    int32_t v[MINIGUI_HISTORY_SERIES];
+    uint32_t rows;                        // Rows checked (verification)
+    uint32_t mismatches;
+} bench_metrics_t;
+
+static void bench_metrics_init(bench_metrics_t *m) {
+    memset(m, 0, sizeof(*m));
+    m->rng = 0x5EED1234u;
+    m->v[0] = 5000;                       // Voltage, mV
+    m->v[1] = 30;                         // CPU, %
+    m->v[2] = 128;                        // RAM, KB
+    m->v[3] = 512;                        // Flash, KB
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Advances the synthetic metrics by one second.
+ **
+ ** @section call_site Called from:
+ ** - minigui_bench_history() while appending and while verifying.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param m (bench_metrics_t*): Generator state.
+ **
+ ** @section pointers
+ ** - m: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Voltage steps between 4.99/5.00/5.01 V about every 20 s, CPU walks
+ **    every 10 s, RAM every 30 s, flash stays constant.
+ ** 2. ERROR/WARN counts are rare 0/1 events; further series (temperature,
+ **    RSSI) drift slowly.
+ ******************************************************************************
+ ******************************************************************************/
+static void bench_metrics_next(bench_metrics_t *m) {
+    int32_t *v = m->v;
+    if (bench_rand(&m->rng) % 20 == 0) v[0] = 4990 + 10 * (int32_t)(bench_rand(&m->rng) % 3);
+    if (bench_rand(&m->rng) % 10 == 0) {
+        v[1] += (int32_t)(bench_rand(&m->rng) % 5) - 2;
+        if (v[1] < 5) v[1] = 5;
+        if (v[1] > 95) v[1] = 95;
+    }
+    if (bench_rand(&m->rng) % 30 == 0) v[2] += (int32_t)(bench_rand(&m->rng) % 9) - 4;
+#if MINIGUI_HISTORY_SERIES > 5
+    v[4] = bench_rand(&m->rng) % 600 == 0;
+    v[5] = bench_rand(&m->rng) % 120 == 0;
+#endif
+#if MINIGUI_HISTORY_SERIES > 7
+    if (bench_rand(&m->rng) % 60 == 0) v[6] = 250 + (int32_t)(bench_rand(&m->rng) % 3) - 1;
+    if (bench_rand(&m->rng) % 30 == 0) v[7] = -60 + (int32_t)(bench_rand(&m->rng) % 7) - 3;
+#endif
+}
+
+static void bench_history_count_cb(void *ctx, uint32_t time_s, const int32_t *values) {
+    (void)time_s;
+    (void)values;
+    (*(uint32_t *)ctx)++;
+}
+
+static void bench_history_verify_cb(void *ctx, uint32_t time_s, const int32_t *values) {
+    bench_metrics_t *m = (bench_metrics_t *)ctx;
+    bench_metrics_next(m);
+    m->rows++;
+    if (time_s != m->rows || memcmp(values, m->v, sizeof(m->v)) != 0) m->mismatches++;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Fill a metrics history with synthetic rows and measure it.
+ **
+ ** @section call_site Called from:
+ ** - Host simulator, firmware console command.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_history.h (store under test)
+ ** - minigui_perf.h (microsecond clock)
+ **
+ ** @param hours (uint32_t): Hours of 1 Hz rows (0 = 24).
+ ** @param result (minigui_bench_history_result_t*): Output measurements.
+ **
+ ** @section pointers
+ ** - result: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c history (minigui_history_t*): Private store, destroyed at the end.
+ ** - @c m (bench_metrics_t): Generator, replayed for verification.
+ ** - @c points (minigui_history_point_t*): Chart read buffer.
+ **
+ ** @return bool: true if the run completed without mismatches.
+ **
+ ** Implementation Steps:
+ ** 1. Append hours x 3600 rows timestamped 1, 2, 3, ... and time them.
+ ** 2. Replay the generator up to the oldest kept row and compare every
+ **    decoded row; then time a plain decode of all blocks.
+ ** 3. Time a whole-range read and a last-hour read into 240 points.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_bench_history(uint32_t hours, minigui_bench_history_result_t *result) {
+    if (!result) return false;
+    if (hours == 0) hours = 24;
+    memset(result, 0, sizeof(*result));
+
+    minigui_history_t *history = minigui_history_create(MINIGUI_HISTORY_BLOCKS);
+    minigui_history_point_t *points = (minigui_history_point_t *)minigui_malloc(
+        MINIGUI_POOL_INTERNAL, BENCH_HISTORY_POINTS * sizeof(*points));
+    if (!history || !points) {
+        minigui_history_destroy(history);
+        minigui_free(MINIGUI_POOL_INTERNAL, points);
+        return false;
+    }
+
+    bench_metrics_t m;
+    bench_metrics_init(&m);
+    uint32_t rows = hours * 3600u;
+    uint32_t t0 = minigui_perf_now_us();
+    for (uint32_t i = 1; i <= rows; i++) {
+        bench_metrics_next(&m);
+        minigui_history_append(history, i, m.v);
+    }
+    uint32_t append_us = minigui_perf_now_us() - t0;
+
+    minigui_history_stats_t stats;
+    minigui_history_get_stats(history, &stats);
+    uint16_t blocks = minigui_history_block_count(history);
+
+    bench_metrics_init(&m);
+    for (uint32_t i = 0; i < rows - stats.rows; i++) bench_metrics_next(&m);
+    m.rows = rows - stats.rows;
+    for (uint16_t b = 0; b < blocks; b++) minigui_history_decode_block(history, b, bench_history_verify_cb, &m);
+
+    uint32_t decoded = 0;
+    t0 = minigui_perf_now_us();
+    for (uint16_t b = 0; b < blocks; b++) minigui_history_decode_block(history, b, bench_history_count_cb, &decoded);
+    result->decode_us = minigui_perf_now_us() - t0;
+
+    uint32_t span = stats.last_s - stats.first_s + 1u;
+    t0 = minigui_perf_now_us();
+    minigui_history_read(history, 1, stats.first_s, stats.last_s,
+                         (span + BENCH_HISTORY_POINTS - 1u) / BENCH_HISTORY_POINTS, points, BENCH_HISTORY_POINTS);
+    result->chart_day_us = minigui_perf_now_us() - t0;
+
+    uint32_t hour_from = stats.last_s > 3600u ? stats.last_s - 3599u : stats.first_s;
+    t0 = minigui_perf_now_us();
+    minigui_history_read(history, 1, hour_from, stats.last_s, 15, points, BENCH_HISTORY_POINTS);
+    result->chart_hour_us = minigui_perf_now_us() - t0;
+
+    result->rows = rows;
+    result->rows_kept = stats.rows;
+    result->blocks = blocks;
+    result->raw_bytes = stats.raw_bytes;
+    result->stored_bytes = stats.used_bytes;
+    result->ratio_x100 = stats.used_bytes ? (uint32_t)((uint64_t)stats.raw_bytes * 100u / stats.used_bytes) : 0;
+    result->bytes_per_row_x100 = stats.rows ? (uint32_t)((uint64_t)stats.used_bytes * 100u / stats.rows) : 0;
+    result->append_avg_ns = (uint32_t)((uint64_t)append_us * 1000u / rows);
+    result->decode_rows_per_s = result->decode_us ? (uint32_t)((uint64_t)decoded * 1000000u / result->decode_us) : 0;
+    result->mismatches = m.mismatches + (decoded != stats.rows);
+
+    minigui_free(MINIGUI_POOL_INTERNAL, points);
+    minigui_history_destroy(history);
+
+    LV_LOG_USER("History bench: %lu/%lu rows in %u blocks, %lu -> %lu bytes (x%lu.%02lu, %lu.%02lu B/row), "
+                "append %lu ns, decode %lu rows/s, charts %lu/%lu us, %lu mismatches",
+                (unsigned long)result->rows_kept, (unsigned long)result->rows, (unsigned)result->blocks,
+                (unsigned long)result->raw_bytes, (unsigned long)result->stored_bytes,
+                (unsigned long)(result->ratio_x100 / 100u), (unsigned long)(result->ratio_x100 % 100u),
+                (unsigned long)(result->bytes_per_row_x100 / 100u), (unsigned long)(result->bytes_per_row_x100 % 100u),
+                (unsigned long)result->append_avg_ns, (unsigned long)result->decode_rows_per_s,
+                (unsigned long)result->chart_day_us, (unsigned long)result->chart_hour_us,
+                (unsigned long)result->mismatches);
+    return result->mismatches == 0;
+}
@@ -0,0 +1,516 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Draw-Only Primitives Implementation.
+ **
+ **            Items are measured once when added; the host's draw event only
+ **            resolves their areas against the current content coordinates
+ **            and issues label/rect draw tasks. In object mode the same calls
+ **            create the labels and separator objects the panels used to
+ **            build, so both variants can be measured in one binary.
+ **
+ **            @section minigui_draw.c - Draw-only primitives.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None (lvgl included via header)
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_draw.h"
+#include "minigui_alloc.h"
+#include "minigui_fmt.h"
+#include "minigui_theme.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+typedef enum {
+    ITEM_TEXT = 0,
+    ITEM_KV,
+    ITEM_SEPARATOR,
+} item_kind_t;
+
+/**
+ * @brief One drawn item (or its fallback object)
+ */
+typedef struct {
+    uint8_t kind;                         // item_kind_t
+    lv_align_t align;                     // LV_ALIGN_DEFAULT = flowing
+    const char *text;                     // Text block or key (static)
+    const lv_font_t *font;                // Resolved at add time
+    int32_t y;                            // Flowing: offset from the content top
+    int32_t w;                            // Measured width (text, or key + initial value)
+    int32_t h;                            // Measured height
+    int32_t key_w;                        // KV: width of the key
+    lv_obj_t *obj;                        // Object mode: fallback widget
+    char value[MINIGUI_DRAW_VALUE_LEN];   // KV: current value
+} draw_item_t;
+
+struct minigui_draw_list {
+    lv_obj_t *host;
+    bool objects;                         // Created in object mode
+    uint8_t count;
+    uint8_t capacity;
+    uint8_t flowing;                      // Flowing items added so far
+    int32_t flow_w;                       // Widest flowing item
+    int32_t flow_h;                       // Bottom of the last flowing item incl. margin
+    draw_item_t items[];
+};
+
+static bool object_mode;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static int32_t text_width(const char *text, const lv_font_t *font, lv_obj_t *host) {
+    lv_point_t size;
+    lv_text_get_size(&size, text, font, lv_obj_get_style_text_letter_space(host, LV_PART_MAIN),
+                     lv_obj_get_style_text_line_space(host, LV_PART_MAIN), LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    return size.x;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Reserves the next item slot.
+ **
+ ** @section call_site Called from:
+ ** - minigui_draw_add_text(), minigui_draw_add_kv(),
+ **   minigui_draw_add_separator().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param list (minigui_draw_list_t*): List to extend.
+ ** @param kind (item_kind_t): Item type.
+ ** @param align (lv_align_t): LV_ALIGN_DEFAULT for flowing items.
+ **
+ ** @section pointers
+ ** - list: Owned by the host object.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return draw_item_t*: Zeroed slot, or NULL if the list is full.
+ **
+ ** Implementation Steps:
+ ** 1. Reject a full list.
+ ** 2. Clear and tag the slot.
+ ******************************************************************************
+ ******************************************************************************/
+static draw_item_t *item_new(minigui_draw_list_t *list, item_kind_t kind, lv_align_t align) {
+    if (!list || list->count >= list->capacity) return NULL;
+
+    draw_item_t *item = &list->items[list->count];
+    memset(item, 0, sizeof(*item));
+    item->kind = (uint8_t)kind;
+    item->align = align;
+    return item;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Places a flowing item below the previous one.
+ **
+ ** @section call_site Called from:
+ ** - The add functions, after the item has been measured.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (row gap style, self-size refresh)
+ **
+ ** @param list (minigui_draw_list_t*): Owning list.
+ ** @param item (draw_item_t*): Measured item.
+ ** @param margin_top (int32_t): Space above the item.
+ ** @param margin_bottom (int32_t): Space below the item.
+ **
+ ** @section pointers
+ ** - list/item: Owned by the host object.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return int32_t: Index of the item.
+ **
+ ** Implementation Steps:
+ ** 1. Add the host's row gap if another flowing item precedes this one
+ **    (same spacing as a flex column), then the top margin.
+ ** 2. Advance the flow cursor and width, commit the slot.
+ ** 3. Tell LVGL the host's content size changed.
+ ******************************************************************************
+ ******************************************************************************/
+static int32_t item_commit_flow(minigui_draw_list_t *list, draw_item_t *item, int32_t margin_top,
+                                int32_t margin_bottom) {
+    int32_t y = list->flow_h;
+    if (list->flowing) y += lv_obj_get_style_pad_row(list->host, LV_PART_MAIN);
+    item->y = y + margin_top;
+
+    list->flow_h = item->y + item->h + margin_bottom;
+    if (item->w > list->flow_w) list->flow_w = item->w;
+    list->flowing++;
+
+    if (!list->objects) lv_obj_refresh_self_size(list->host);
+    return list->count++;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Resolves an item's screen area.
+ **
+ ** @section call_site Called from:
+ ** - draw_event_cb() and minigui_draw_set_value().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param item (const draw_item_t*): Item.
+ ** @param content (const lv_area_t*): Host content coordinates.
+ ** @param area (lv_area_t*): Output area.
+ **
+ ** @section pointers
+ ** - All owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Flowing items span the content width at their flow offset.
+ ** 2. Aligned items are placed by the horizontal and vertical part of the
+ **    alignment inside the content area (outside alignments fall back to
+ **    top left).
+ ******************************************************************************
+ ******************************************************************************/
+static void item_area(const draw_item_t *item, const lv_area_t *content, lv_area_t *area) {
+    if (item->align == LV_ALIGN_DEFAULT) {
+        area->x1 = content->x1;
+        area->x2 = content->x2;
+        area->y1 = content->y1 + item->y;
+        area->y2 = area->y1 + item->h - 1;
+        return;
+    }
+
+    int32_t free_w = lv_area_get_width(content) - item->w;
+    int32_t free_h = lv_area_get_height(content) - item->h;
+    int32_t x = 0;
+    int32_t y = 0;
+
+    switch (item->align) {
+        case LV_ALIGN_TOP_MID:      x = free_w / 2;                   break;
+        case LV_ALIGN_TOP_RIGHT:    x = free_w;                       break;
+        case LV_ALIGN_LEFT_MID:                     y = free_h / 2;   break;
+        case LV_ALIGN_CENTER:       x = free_w / 2; y = free_h / 2;   break;
+        case LV_ALIGN_RIGHT_MID:    x = free_w;     y = free_h / 2;   break;
+        case LV_ALIGN_BOTTOM_LEFT:                  y = free_h;       break;
+        case LV_ALIGN_BOTTOM_MID:   x = free_w / 2; y = free_h;       break;
+        case LV_ALIGN_BOTTOM_RIGHT: x = free_w;     y = free_h;       break;
+        default:                                                      break;
+    }
+
+    area->x1 = content->x1 + x;
+    area->y1 = content->y1 + y;
+    area->x2 = area->x1 + item->w - 1;
+    area->y2 = area->y1 + item->h - 1;
+}
+
+/**
+ * @brief Host content area as the items see it: moved by the scroll position,
+ *        like LVGL moves the children of a scrolled object
+ */
+static void scrolled_content(lv_obj_t *host, lv_area_t *content) {
+    lv_obj_get_content_coords(host, content);
+    lv_area_move(content, -lv_obj_get_scroll_x(host), -lv_obj_get_scroll_y(host));
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Paints every item of a list.
+ **
+ ** @section call_site Called from:
+ ** - Host LV_EVENT_DRAW_MAIN (after the host's own background).
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (label and rect draw tasks)
+ **
+ ** @param e (lv_event_t*): Event; user data is the list.
+ **
+ ** @section pointers
+ ** - Text pointers handed to the draw tasks stay valid until the host is
+ **   deleted, which cannot happen during a refresh.
+ **
+ ** @section variables Internal Variables:
+ ** - @c label (lv_draw_label_dsc_t): Host text style, font set per item.
+ ** - @c rect (lv_draw_rect_dsc_t): Separator fill.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Resolve the scrolled content area and the host's label style once.
+ ** 2. Per item, compute the area (LVGL drops tasks outside the clip area).
+ ** 3. Draw text blocks and keys as labels, values after the key width,
+ **    separators as 1px rectangles.
+ ******************************************************************************
+ ******************************************************************************/
+static void draw_event_cb(lv_event_t *e) {
+    minigui_draw_list_t *list = (minigui_draw_list_t *)lv_event_get_user_data(e);
+    lv_layer_t *layer = lv_event_get_layer(e);
+
+    lv_area_t content;
+    scrolled_content(list->host, &content);
+
+    lv_draw_label_dsc_t label;
+    lv_draw_label_dsc_init(&label);
+    lv_obj_init_draw_label_dsc(list->host, LV_PART_MAIN, &label);
+
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.bg_color = lv_color_hex(minigui_theme_get()->separator);  // Follows theme switches
+    rect.bg_opa = LV_OPA_COVER;
+
+    for (uint8_t i = 0; i < list->count; i++) {
+        const draw_item_t *item = &list->items[i];
+        lv_area_t area;
+        item_area(item, &content, &area);
+
+        switch (item->kind) {
+            case ITEM_TEXT:
+                label.font = item->font;
+                label.text = item->text;
+                lv_draw_label(layer, &label, &area);
+                break;
+            case ITEM_KV:
+                label.font = item->font;
+                label.text = item->text;
+                lv_draw_label(layer, &label, &area);
+                area.x1 += item->key_w;
+                label.text = item->value;
+                lv_draw_label(layer, &label, &area);
+                break;
+            case ITEM_SEPARATOR:
+                lv_draw_rect(layer, &rect, &area);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static void self_size_event_cb(lv_event_t *e) {
+    minigui_draw_list_t *list = (minigui_draw_list_t *)lv_event_get_user_data(e);
+    lv_point_t *p = (lv_point_t *)lv_event_get_param(e);
+    p->x = LV_MAX(p->x, list->flow_w);
+    p->y = LV_MAX(p->y, list->flow_h);
+}
+
+static void delete_event_cb(lv_event_t *e) {
+    minigui_free(MINIGUI_POOL_INTERNAL, lv_event_get_user_data(e));
+}
+
+static void kv_compose(const draw_item_t *item, char *buf, size_t size) {
+    size_t n = minigui_fmt_str(buf, size, item->text);
+    minigui_fmt_str(buf + n, size - n, item->value);
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+minigui_draw_list_t *minigui_draw_attach(lv_obj_t *host, uint8_t capacity) {
+    if (!host || capacity == 0) return NULL;
+
+    minigui_draw_list_t *list = (minigui_draw_list_t *)minigui_malloc(
+        MINIGUI_POOL_INTERNAL, sizeof(*list) + (size_t)capacity * sizeof(draw_item_t));
+    if (!list) return NULL;
+
+    memset(list, 0, sizeof(*list));
+    list->host = host;
+    list->capacity = capacity;
+    list->objects = object_mode;
+
+    if (list->objects) {
+        lv_obj_set_flex_flow(host, LV_FLEX_FLOW_COLUMN);
+    } else {
+        lv_obj_add_event_cb(host, draw_event_cb, LV_EVENT_DRAW_MAIN, list);
+        lv_obj_add_event_cb(host, self_size_event_cb, LV_EVENT_GET_SELF_SIZE, list);
+    }
+    lv_obj_add_event_cb(host, delete_event_cb, LV_EVENT_DELETE, list);
+    return list;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Adds a static text block.
+ **
+ ** @section call_site Called from:
+ ** - Panel builders (titles, headers, card texts).
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (text measurement, labels in object mode)
+ **
+ ** @param list (minigui_draw_list_t*): Target list.
+ ** @param text (const char*): Static text.
+ ** @param font (const lv_font_t*): Font, NULL for the host's.
+ ** @param align (lv_align_t): LV_ALIGN_DEFAULT to flow.
+ ** @param margin_bottom (int32_t): Space below a flowing item.
+ **
+ ** @section pointers
+ ** - text: Must outlive the host (string literals in practice).
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return int32_t: Item index or -1.
+ **
+ ** Implementation Steps:
+ ** 1. Reserve a slot and resolve the font.
+ ** 2. Object mode: create a static label with the same font, margin or
+ **    alignment (aligned labels ignore the host's flex layout).
+ ** 3. Measure the text; aligned items are committed as-is, flowing items
+ **    go through the flow cursor.
+ ******************************************************************************
+ ******************************************************************************/
+int32_t minigui_draw_add_text(minigui_draw_list_t *list, const char *text, const lv_font_t *font,
+                              lv_align_t align, int32_t margin_bottom) {
+    draw_item_t *item = item_new(list, ITEM_TEXT, align);
+    if (!item) return -1;
+
+    item->text = text ? text : "";
+    item->font = font ? font : lv_obj_get_style_text_font(list->host, LV_PART_MAIN);
+
+    if (list->objects) {
+        item->obj = lv_label_create(list->host);
+        lv_label_set_text_static(item->obj, item->text);
+        if (font) lv_obj_set_style_text_font(item->obj, font, 0);
+        if (align == LV_ALIGN_DEFAULT) {
+            lv_obj_set_style_margin_bottom(item->obj, margin_bottom, 0);
+        } else {
+            lv_obj_add_flag(item->obj, LV_OBJ_FLAG_IGNORE_LAYOUT);
+            lv_obj_align(item->obj, align, 0, 0);
+        }
+    }
+
+    lv_point_t size;
+    lv_text_get_size(&size, item->text, item->font, lv_obj_get_style_text_letter_space(list->host, LV_PART_MAIN),
+                     lv_obj_get_style_text_line_space(list->host, LV_PART_MAIN), LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    item->w = size.x;
+    item->h = size.y;
+
+    if (align != LV_ALIGN_DEFAULT) {
+        if (!list->objects) lv_obj_invalidate(list->host);
+        return list->count++;
+    }
+    return item_commit_flow(list, item, 0, margin_bottom);
+}
+
+int32_t minigui_draw_add_kv(minigui_draw_list_t *list, const char *key, const char *value,
+                            int32_t margin_bottom) {
+    draw_item_t *item = item_new(list, ITEM_KV, LV_ALIGN_DEFAULT);
+    if (!item) return -1;
+
+    item->text = key ? key : "";
+    item->font = lv_obj_get_style_text_font(list->host, LV_PART_MAIN);
+    minigui_fmt_str(item->value, sizeof(item->value), value);
+
+    if (list->objects) {
+        char buf[96];
+        kv_compose(item, buf, sizeof(buf));
+        item->obj = lv_label_create(list->host);
+        lv_label_set_text(item->obj, buf);
+        lv_obj_set_style_margin_bottom(item->obj, margin_bottom, 0);
+    }
+
+    item->key_w = text_width(item->text, item->font, list->host);
+    item->w = item->key_w + text_width(item->value, item->font, list->host);
+    item->h = lv_font_get_line_height(item->font);
+    return item_commit_flow(list, item, 0, margin_bottom);
+}
+
+int32_t minigui_draw_add_separator(minigui_draw_list_t *list, int32_t margin_top, int32_t margin_bottom) {
+    draw_item_t *item = item_new(list, ITEM_SEPARATOR, LV_ALIGN_DEFAULT);
+    if (!item) return -1;
+
+    if (list->objects) {
+        item->obj = lv_obj_create(list->host);
+        lv_obj_set_size(item->obj, lv_pct(100), 1);
+        lv_obj_add_style(item->obj, minigui_theme_style(MINIGUI_THEME_SEPARATOR), 0);
+        lv_obj_set_style_border_width(item->obj, 0, 0);
+        lv_obj_set_style_margin_top(item->obj, margin_top, 0);
+        lv_obj_set_style_margin_bottom(item->obj, margin_bottom, 0);
+    }
+
+    item->h = 1;
+    return item_commit_flow(list, item, margin_top, margin_bottom);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Replaces a key/value row's value.
+ **
+ ** @section call_site Called from:
+ ** - Panel refresh timers (e.g. the Monitor panel every second).
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_fmt.h (bounded copy)
+ **
+ ** @param list (minigui_draw_list_t*): Owning list.
+ ** @param item (int32_t): Index returned by minigui_draw_add_kv().
+ ** @param value (const char*): New value (copied, truncated to fit).
+ **
+ ** @section pointers
+ ** - value: Read during the call only.
+ **
+ ** @section variables Internal Variables:
+ ** - @c area (lv_area_t): The row, the only region invalidated.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Ignore bad indices, non-KV items and unchanged values.
+ ** 2. Copy the value; in object mode set the composed label text.
+ ** 3. Otherwise invalidate the row's area of the host.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_draw_set_value(minigui_draw_list_t *list, int32_t item, const char *value) {
+    if (!list || item < 0 || item >= list->count) return;
+    draw_item_t *it = &list->items[item];
+    if (it->kind != ITEM_KV || !value || strncmp(it->value, value, sizeof(it->value) - 1) == 0) return;
+
+    minigui_fmt_str(it->value, sizeof(it->value), value);
+
+    if (list->objects) {
+        char buf[96];
+        kv_compose(it, buf, sizeof(buf));
+        lv_label_set_text(it->obj, buf);
+        return;
+    }
+
+    lv_area_t content;
+    lv_area_t area;
+    scrolled_content(list->host, &content);
+    item_area(it, &content, &area);
+    lv_obj_invalidate_area(list->host, &area);
+}
+
+void minigui_draw_set_object_mode(bool enable) {
+    object_mode = enable;
+}
+
+bool minigui_draw_get_object_mode(void) {
+    return object_mode;
+}
@@ -0,0 +1,374 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Number Formatting Implementation.
+ **
+ **            Digit conversion with integer division only. All formatters go
+ **            through one bounded writer, which enforces truncation and
+ **            termination in a single place.
+ **
+ **            @section minigui_fmt.c - Fixed-point formatting.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_fmt.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+/**
+ * @brief Bounded output cursor
+ */
+typedef struct {
+    char *buf;
+    size_t size;
+    size_t len;
+} fmt_out_t;
+
+static const uint32_t pow10_u32[10] = {
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u,
+};
+
+static const float pow10_f[7] = { 1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f, 100000.0f, 1000000.0f };
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static void out_init(fmt_out_t *o, char *buf, size_t size) {
+    o->buf = buf;
+    o->size = buf ? size : 0;
+    o->len = 0;
+}
+
+static void out_char(fmt_out_t *o, char c) {
+    if (o->len + 1 < o->size) o->buf[o->len++] = c;
+}
+
+static void out_str(fmt_out_t *o, const char *str) {
+    while (str && *str) out_char(o, *str++);
+}
+
+static size_t out_end(fmt_out_t *o) {
+    if (o->size) o->buf[o->len] = '\0';
+    return o->len;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Writes an unsigned value in decimal.
+ **
+ ** @section call_site Called from:
+ ** - Every numeric formatter.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param o (fmt_out_t*): Output cursor.
+ ** @param value (uint32_t): Value.
+ ** @param width (uint8_t): Minimum digits, zero-padded.
+ **
+ ** @section pointers
+ ** - o: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c digits (char[10]): Digits in reverse order.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Peel digits off with division by 10 (a multiply on every compiler).
+ ** 2. Pad with zeros, then copy the digits most significant first.
+ ******************************************************************************
+ ******************************************************************************/
+static void out_u32(fmt_out_t *o, uint32_t value, uint8_t width) {
+    char digits[10];
+    uint8_t n = 0;
+    do {
+        digits[n++] = (char)('0' + value % 10u);
+        value /= 10u;
+    } while (value);
+
+    for (uint8_t i = n; i < width; i++) out_char(o, '0');
+    while (n) out_char(o, digits[--n]);
+}
+
+static void out_fixed(fmt_out_t *o, int32_t value, uint8_t decimals) {
+    if (decimals > 9) decimals = 9;
+
+    uint32_t mag = (uint32_t)value;
+    if (value < 0) {
+        out_char(o, '-');
+        mag = 0u - mag;
+    }
+
+    out_u32(o, mag / pow10_u32[decimals], 1);
+    if (decimals == 0) return;
+    out_char(o, '.');
+    out_u32(o, mag % pow10_u32[decimals], decimals);
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+size_t minigui_fmt_str(char *buf, size_t size, const char *str) {
+    fmt_out_t o;
+    out_init(&o, buf, size);
+    out_str(&o, str);
+    return out_end(&o);
+}
+
+size_t minigui_fmt_u32(char *buf, size_t size, uint32_t value) {
+    return minigui_fmt_u32_pad(buf, size, value, 1);
+}
+
+size_t minigui_fmt_i32(char *buf, size_t size, int32_t value) {
+    return minigui_fmt_fixed(buf, size, value, 0);
+}
+
+size_t minigui_fmt_u32_pad(char *buf, size_t size, uint32_t value, uint8_t width) {
+    fmt_out_t o;
+    out_init(&o, buf, size);
+    out_u32(&o, value, width);
+    return out_end(&o);
+}
+
+size_t minigui_fmt_fixed(char *buf, size_t size, int32_t value, uint8_t decimals) {
+    fmt_out_t o;
+    out_init(&o, buf, size);
+    out_fixed(&o, value, decimals);
+    return out_end(&o);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Float rounded to a fixed number of decimals.
+ **
+ ** @section call_site Called from:
+ ** - Monitor panel (voltage) and any provider value delivered as float.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param buf (char*): Output buffer.
+ ** @param size (size_t): Capacity of buf.
+ ** @param value (float): Value.
+ ** @param decimals (uint8_t): Digits after the point (clamped to 6).
+ **
+ ** @section pointers
+ ** - buf: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c scaled (float): value * 10^decimals, rounded half away from zero.
+ ** - @c fixed (int32_t): Clamped integer handed to the fixed formatter.
+ **
+ ** @return size_t: Characters written.
+ **
+ ** Implementation Steps:
+ ** 1. Print "nan" for NaN.
+ ** 2. Scale and round once in float, clamp to the int32 range.
+ ** 3. Format as fixed point.
+ ******************************************************************************
+ ******************************************************************************/
+size_t minigui_fmt_float(char *buf, size_t size, float value, uint8_t decimals) {
+    if (value != value) return minigui_fmt_str(buf, size, "nan");
+    if (decimals > 6) decimals = 6;
+
+    float scaled = value * pow10_f[decimals];
+    scaled += (scaled < 0.0f) ? -0.5f : 0.5f;
+
+    int32_t fixed;
+    if (scaled >= 2147483647.0f) {
+        fixed = INT32_MAX;
+    } else if (scaled <= -2147483648.0f) {
+        fixed = INT32_MIN;
+    } else {
+        fixed = (int32_t)scaled;
+    }
+    return minigui_fmt_fixed(buf, size, fixed, decimals);
+}
+
+size_t minigui_fmt_percent(char *buf, size_t size, uint32_t part, uint32_t total) {
+    fmt_out_t o;
+    out_init(&o, buf, size);
+    out_u32(&o, total ? (uint32_t)(((uint64_t)part * 100u) / total) : 0u, 1);
+    out_char(&o, '%');
+    return out_end(&o);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Byte size with a binary unit.
+ **
+ ** @section call_site Called from:
+ ** - Monitor and diagnostics panels, transfer progress.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param buf (char*): Output buffer.
+ ** @param size (size_t): Capacity of buf.
+ ** @param bytes (uint64_t): Size in bytes.
+ **
+ ** @section pointers
+ ** - buf: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c unit (uint64_t): Bytes per unit (1024^u).
+ ** - @c tenths (uint64_t): Size in tenths of a unit, rounded.
+ **
+ ** @return size_t: Characters written.
+ **
+ ** Implementation Steps:
+ ** 1. Plain bytes below 1 KB.
+ ** 2. Pick the largest unit not above the value.
+ ** 3. Round to tenths without overflowing (whole and remainder separately).
+ ** 4. One decimal below 100 units, whole units above (rounded from the
+ **    byte count, not from the tenths, to avoid double rounding).
+ ******************************************************************************
+ ******************************************************************************/
+size_t minigui_fmt_bytes(char *buf, size_t size, uint64_t bytes) {
+    static const char *const units[] = { " B", " KB", " MB", " GB", " TB" };
+
+    fmt_out_t o;
+    out_init(&o, buf, size);
+
+    if (bytes < 1024u) {
+        out_u32(&o, (uint32_t)bytes, 1);
+        out_str(&o, units[0]);
+        return out_end(&o);
+    }
+
+    uint32_t u = 1;
+    uint64_t unit = 1024u;
+    while (u < 4 && bytes >= unit * 1024u) {
+        unit *= 1024u;
+        u++;
+    }
+
+    uint64_t tenths = (bytes / unit) * 10u + ((bytes % unit) * 10u + unit / 2u) / unit;
+    if (tenths < 1000u) {
+        out_fixed(&o, (int32_t)tenths, 1);
+    } else {
+        uint64_t whole = bytes / unit + ((bytes % unit) * 2u >= unit ? 1u : 0u);  // Round once
+        out_u32(&o, whole > UINT32_MAX ? UINT32_MAX : (uint32_t)whole, 1);
+    }
+    out_str(&o, units[u]);
+    return out_end(&o);
+}
+
+size_t minigui_fmt_hms(char *buf, size_t size, uint32_t seconds) {
+    fmt_out_t o;
+    out_init(&o, buf, size);
+    out_u32(&o, seconds / 3600u, 2);
+    out_char(&o, ':');
+    out_u32(&o, (seconds / 60u) % 60u, 2);
+    out_char(&o, ':');
+    out_u32(&o, seconds % 60u, 2);
+    return out_end(&o);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Short human-readable duration.
+ **
+ ** @section call_site Called from:
+ ** - Progress and ETA labels.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param buf (char*): Output buffer.
+ ** @param size (size_t): Capacity of buf.
+ ** @param seconds (uint32_t): Duration.
+ **
+ ** @section pointers
+ ** - buf: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c hi/@c lo (uint32_t): The two most significant units shown.
+ **
+ ** @return size_t: Characters written.
+ **
+ ** Implementation Steps:
+ ** 1. Pick the two largest units (s; m s; h m; d h).
+ ** 2. Print the first plainly and the second zero-padded to two digits.
+ ******************************************************************************
+ ******************************************************************************/
+size_t minigui_fmt_duration(char *buf, size_t size, uint32_t seconds) {
+    fmt_out_t o;
+    out_init(&o, buf, size);
+
+    if (seconds < 60u) {
+        out_u32(&o, seconds, 1);
+        out_char(&o, 's');
+        return out_end(&o);
+    }
+
+    uint32_t hi, lo;
+    char hi_unit, lo_unit;
+    if (seconds < 3600u) {
+        hi = seconds / 60u;
+        lo = seconds % 60u;
+        hi_unit = 'm';
+        lo_unit = 's';
+    } else if (seconds < 86400u) {
+        hi = seconds / 3600u;
+        lo = (seconds / 60u) % 60u;
+        hi_unit = 'h';
+        lo_unit = 'm';
+    } else {
+        hi = seconds / 86400u;
+        lo = (seconds / 3600u) % 24u;
+        hi_unit = 'd';
+        lo_unit = 'h';
+    }
+
+    out_u32(&o, hi, 1);
+    out_char(&o, hi_unit);
+    out_char(&o, ' ');
+    out_u32(&o, lo, 2);
+    out_char(&o, lo_unit);
+    return out_end(&o);
+}
+
+size_t minigui_fmt_clock(char *buf, size_t size, const struct tm *tm) {
+    static const char days[7][4] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+
+    fmt_out_t o;
+    out_init(&o, buf, size);
+    if (!tm) return out_end(&o);
+
+    out_str(&o, (tm->tm_wday >= 0 && tm->tm_wday < 7) ? days[tm->tm_wday] : "???");
+    out_char(&o, ' ');
+    out_u32(&o, (uint32_t)(tm->tm_mon + 1), 2);
+    out_char(&o, '/');
+    out_u32(&o, (uint32_t)tm->tm_mday, 2);
+    out_char(&o, ' ');
+    out_u32(&o, (uint32_t)tm->tm_hour, 2);
+    out_char(&o, ':');
+    out_u32(&o, (uint32_t)tm->tm_min, 2);
+    out_char(&o, ':');
+    out_u32(&o, (uint32_t)tm->tm_sec, 2);
+    return out_end(&o);
+}
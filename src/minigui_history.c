@@ -0,0 +1,566 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Metrics History Implementation.
+ **
+ **            Blocks live in one ring allocation. Each block starts with a
+ **            header (time span, row count, bit length, raw first row) and
+ **            continues with an MSB-first bit stream, one record per row:
+ **
+ **            - timestamp: delta-of-delta, '0' | '10'+7 | '110'+9 |
+ **              '1110'+12 | '1111'+32 bits
+ **            - '0' if no value changed, else '1' and per value: XOR with
+ **              the previous value, '0' if equal, '10' + meaningful bits
+ **              inside the previous window, or '11' + leading zeros (5) +
+ **              length - 1 (5) + meaningful bits
+ **
+ **            At a steady 1 Hz a row without changes costs 2 bits.
+ **
+ **            @section minigui_history.c - Compressed metrics history.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_history.h"
+#include "minigui.h"
+#include "minigui_alert.h"
+#include "minigui_alloc.h"
+#include "minigui_lock.h"
+
+#if MINIGUI_HISTORY_BLOCK_BYTES % 4 || MINIGUI_HISTORY_BLOCK_BYTES > 8192
+#error "MINIGUI_HISTORY_BLOCK_BYTES must be a multiple of 4 and at most 8192"
+#endif
+
+#if MINIGUI_HISTORY_SERIES < 4
+#error "MINIGUI_HISTORY_SERIES must hold the four sampled system metrics"
+#endif
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+#define NO_WINDOW 0xFF                    // Forces a new XOR window
+
+/**
+ * @brief Start of every block
+ */
+typedef struct {
+    uint32_t first_s;
+    uint32_t last_s;
+    uint16_t rows;
+    uint16_t bits;                        // Payload bits used
+    int32_t first[MINIGUI_HISTORY_SERIES];  // Raw first row
+} block_head_t;
+
+#define PAYLOAD_BYTES (MINIGUI_HISTORY_BLOCK_BYTES - sizeof(block_head_t))
+
+/**
+ * @brief Previous row, shared by encoder and decoder
+ */
+typedef struct {
+    uint32_t t;
+    int32_t delta;
+    uint32_t v[MINIGUI_HISTORY_SERIES];
+    uint8_t lead[MINIGUI_HISTORY_SERIES];
+    uint8_t trail[MINIGUI_HISTORY_SERIES];
+} codec_t;
+
+struct minigui_history {
+    uint8_t *mem;
+    uint16_t capacity;                    // Blocks
+    uint16_t oldest;                      // Ring index of block 0
+    uint16_t used;
+    uint16_t dropped;
+    uint32_t rows;
+    uint32_t rows_total;
+    codec_t enc;                          // State after the newest row
+};
+
+static minigui_history_t *sampler_store;
+static lv_timer_t *sampler_timer;
+static int32_t app_values[MINIGUI_HISTORY_SERIES];
+
+// Monotonic seconds: lv_tick is folded in by difference, so its wrap is carried
+static bool clock_ready;
+static uint32_t clock_tick_ms;
+static uint32_t clock_s;
+static uint32_t clock_ms;                 // Milliseconds not yet counted in clock_s
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static block_head_t *block_at(const minigui_history_t *h, uint16_t index) {
+    return (block_head_t *)(h->mem + (size_t)((h->oldest + index) % h->capacity) * MINIGUI_HISTORY_BLOCK_BYTES);
+}
+
+static uint8_t *payload(block_head_t *b) {
+    return (uint8_t *)(b + 1);
+}
+
+static void codec_reset(codec_t *c, uint32_t t, const int32_t *values) {
+    c->t = t;
+    c->delta = 0;
+    for (uint8_t s = 0; s < MINIGUI_HISTORY_SERIES; s++) {
+        c->v[s] = (uint32_t)values[s];
+        c->lead[s] = NO_WINDOW;
+        c->trail[s] = 0;
+    }
+}
+
+/**
+ * @brief Append the low @p n bits of @p value (payload bytes start zeroed)
+ */
+static bool put_bits(uint8_t *buf, uint32_t *pos, uint32_t value, uint8_t n) {
+    if (*pos + n > PAYLOAD_BYTES * 8u) return false;
+    while (n) {
+        uint8_t room = (uint8_t)(8u - (*pos & 7u));
+        uint8_t take = n < room ? n : room;
+        uint32_t bits = (value >> (n - take)) & ((1u << take) - 1u);
+        buf[*pos >> 3] |= (uint8_t)(bits << (room - take));
+        *pos += take;
+        n -= take;
+    }
+    return true;
+}
+
+static uint32_t get_bits(const uint8_t *buf, uint32_t *pos, uint8_t n) {
+    uint32_t value = 0;
+    while (n) {
+        uint8_t room = (uint8_t)(8u - (*pos & 7u));
+        uint8_t take = n < room ? n : room;
+        uint32_t bits = ((uint32_t)buf[*pos >> 3] >> (room - take)) & ((1u << take) - 1u);
+        value = (value << take) | bits;
+        *pos += take;
+        n -= take;
+    }
+    return value;
+}
+
+static uint8_t clz32(uint32_t x) {
+    uint8_t n = 0;
+    while (!(x & 0x80000000u)) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+}
+
+static uint8_t ctz32(uint32_t x) {
+    uint8_t n = 0;
+    while (!(x & 1u)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Encodes one row after the previous one.
+ **
+ ** @section call_site Called from:
+ ** - minigui_history_append().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param buf (uint8_t*): Block payload.
+ ** @param pos (uint32_t*): Bit position, advanced.
+ ** @param c (codec_t*): Previous row, updated.
+ ** @param t (uint32_t): Row time.
+ ** @param values (const int32_t*): Row values.
+ **
+ ** @section pointers
+ ** - buf, pos, c: Left partly written on failure; the caller rolls back.
+ **
+ ** @section variables Internal Variables:
+ ** - @c dod (int32_t): Change of the timestamp delta.
+ ** - @c x (uint32_t): XOR of a value with its predecessor.
+ **
+ ** @return bool: false if the payload is full.
+ **
+ ** Implementation Steps:
+ ** 1. Timestamp: delta-of-delta in the smallest of five classes.
+ ** 2. One bit: whether any value changed (most rows of slow metrics don't).
+ ** 3. Each value: XOR with the previous one. Equal: one bit. Otherwise the
+ **    meaningful bits, inside the previous window when they fit (saves the
+ **    11-bit window description), else with a new window.
+ ******************************************************************************
+ ******************************************************************************/
+static bool encode_row(uint8_t *buf, uint32_t *pos, codec_t *c, uint32_t t, const int32_t *values) {
+    int32_t delta = (int32_t)(t - c->t);
+    int32_t dod = delta - c->delta;
+    bool ok;
+
+    if (dod == 0) {
+        ok = put_bits(buf, pos, 0, 1);
+    } else if (dod >= -63 && dod <= 64) {
+        ok = put_bits(buf, pos, 2, 2) && put_bits(buf, pos, (uint32_t)(dod + 63), 7);
+    } else if (dod >= -255 && dod <= 256) {
+        ok = put_bits(buf, pos, 6, 3) && put_bits(buf, pos, (uint32_t)(dod + 255), 9);
+    } else if (dod >= -2047 && dod <= 2048) {
+        ok = put_bits(buf, pos, 14, 4) && put_bits(buf, pos, (uint32_t)(dod + 2047), 12);
+    } else {
+        ok = put_bits(buf, pos, 15, 4) && put_bits(buf, pos, (uint32_t)dod, 32);
+    }
+    c->t = t;
+    c->delta = delta;
+
+    bool changed = memcmp(c->v, values, sizeof(c->v)) != 0;
+    ok = ok && put_bits(buf, pos, changed, 1);
+    for (uint8_t s = 0; ok && changed && s < MINIGUI_HISTORY_SERIES; s++) {
+        uint32_t x = (uint32_t)values[s] ^ c->v[s];
+        c->v[s] = (uint32_t)values[s];
+        if (x == 0) {
+            ok = put_bits(buf, pos, 0, 1);
+            continue;
+        }
+        uint8_t lead = clz32(x);
+        uint8_t trail = ctz32(x);
+        if (c->lead[s] != NO_WINDOW && lead >= c->lead[s] && trail >= c->trail[s]) {
+            uint8_t len = (uint8_t)(32u - c->lead[s] - c->trail[s]);
+            ok = put_bits(buf, pos, 2, 2) && put_bits(buf, pos, x >> c->trail[s], len);
+        } else {
+            uint8_t len = (uint8_t)(32u - lead - trail);
+            ok = put_bits(buf, pos, 3, 2) && put_bits(buf, pos, lead, 5) &&
+                 put_bits(buf, pos, len - 1u, 5) && put_bits(buf, pos, x >> trail, len);
+            c->lead[s] = lead;
+            c->trail[s] = trail;
+        }
+    }
+    return ok;
+}
+
+static void decode_row(const uint8_t *buf, uint32_t *pos, codec_t *c) {
+    int32_t dod;
+    if (!get_bits(buf, pos, 1)) {
+        dod = 0;
+    } else if (!get_bits(buf, pos, 1)) {
+        dod = (int32_t)get_bits(buf, pos, 7) - 63;
+    } else if (!get_bits(buf, pos, 1)) {
+        dod = (int32_t)get_bits(buf, pos, 9) - 255;
+    } else if (!get_bits(buf, pos, 1)) {
+        dod = (int32_t)get_bits(buf, pos, 12) - 2047;
+    } else {
+        dod = (int32_t)get_bits(buf, pos, 32);
+    }
+    c->delta += dod;
+    c->t += (uint32_t)c->delta;
+
+    if (!get_bits(buf, pos, 1)) return;
+    for (uint8_t s = 0; s < MINIGUI_HISTORY_SERIES; s++) {
+        if (!get_bits(buf, pos, 1)) continue;
+        if (get_bits(buf, pos, 1)) {
+            c->lead[s] = (uint8_t)get_bits(buf, pos, 5);
+            uint8_t len = (uint8_t)(get_bits(buf, pos, 5) + 1u);
+            c->trail[s] = (uint8_t)(32u - c->lead[s] - len);
+        }
+        uint8_t len = (uint8_t)(32u - c->lead[s] - c->trail[s]);
+        c->v[s] ^= get_bits(buf, pos, len) << c->trail[s];
+    }
+}
+
+/**
+ * @brief Opens the next block with @p values as its raw first row
+ */
+static void open_block(minigui_history_t *h, uint32_t t, const int32_t *values) {
+    if (h->used == h->capacity) {
+        h->rows -= block_at(h, 0)->rows;
+        h->oldest = (uint16_t)((h->oldest + 1) % h->capacity);
+        h->used--;
+        h->dropped++;
+    }
+    block_head_t *b = block_at(h, h->used++);
+    b->first_s = b->last_s = t;
+    b->rows = 1;
+    b->bits = 0;
+    memcpy(b->first, values, sizeof(b->first));
+    memset(payload(b), 0, PAYLOAD_BYTES);
+    codec_reset(&h->enc, t, values);
+}
+
+static uint16_t block_bytes(const block_head_t *b) {
+    return (uint16_t)(sizeof(block_head_t) + (b->bits + 7u) / 8u);
+}
+
+/**
+ * @brief Folds decoded rows into the points of minigui_history_read()
+ */
+typedef struct {
+    uint8_t series;
+    uint32_t from_s;
+    uint32_t to_s;
+    uint32_t step_s;
+    minigui_history_point_t *points;
+    size_t max;
+    size_t count;
+    int64_t sum;
+} read_ctx_t;
+
+static void read_row_cb(void *ctx, uint32_t time_s, const int32_t *values) {
+    read_ctx_t *r = (read_ctx_t *)ctx;
+    if (time_s < r->from_s || time_s > r->to_s) return;
+
+    int32_t v = values[r->series];
+    uint32_t start = r->from_s + (time_s - r->from_s) / r->step_s * r->step_s;
+    minigui_history_point_t *p = r->count ? &r->points[r->count - 1] : NULL;
+    if (!p || p->time_s != start) {
+        if (p) p->avg = (int32_t)(r->sum / p->rows);
+        if (r->count == r->max) return;
+        p = &r->points[r->count++];
+        p->time_s = start;
+        p->min = p->max = v;
+        p->rows = 0;
+        r->sum = 0;
+    }
+    if (v < p->min) p->min = v;
+    if (v > p->max) p->max = v;
+    if (p->rows < UINT16_MAX) p->rows++;
+    r->sum += v;
+}
+
+static void sampler_cb(lv_timer_t *timer) {
+    (void)timer;
+    minigui_system_stats_t stats;
+    int32_t values[MINIGUI_HISTORY_SERIES];
+
+    minigui_get_system_stats(&stats);
+    MINIGUI_LOCK();
+    memcpy(values, app_values, sizeof(values));
+    MINIGUI_UNLOCK();
+    values[MINIGUI_METRIC_VOLTAGE_MV] = (int32_t)(stats.voltage * 1000.0f + 0.5f);
+    values[MINIGUI_METRIC_CPU_PCT] = (int32_t)stats.cpu_usage;
+    values[MINIGUI_METRIC_RAM_USED_KB] = (int32_t)stats.ram_used_kb;
+    values[MINIGUI_METRIC_FLASH_USED_KB] = (int32_t)stats.flash_used_kb;
+    minigui_history_append(sampler_store, minigui_history_now_s(), values);
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+minigui_history_t *minigui_history_create(uint16_t blocks) {
+    if (blocks == 0) return NULL;
+    minigui_history_t *h = (minigui_history_t *)minigui_malloc(MINIGUI_POOL_INTERNAL, sizeof(*h));
+    if (!h) return NULL;
+    memset(h, 0, sizeof(*h));
+    h->mem = (uint8_t *)minigui_malloc(MINIGUI_POOL_PSRAM, (size_t)blocks * MINIGUI_HISTORY_BLOCK_BYTES);
+    if (!h->mem) {
+        LV_LOG_ERROR("History: %u blocks do not fit", (unsigned)blocks);
+        minigui_free(MINIGUI_POOL_INTERNAL, h);
+        return NULL;
+    }
+    h->capacity = blocks;
+    return h;
+}
+
+void minigui_history_destroy(minigui_history_t *history) {
+    if (!history) return;
+    minigui_free(MINIGUI_POOL_PSRAM, history->mem);
+    minigui_free(MINIGUI_POOL_INTERNAL, history);
+}
+
+bool minigui_history_append(minigui_history_t *history, uint32_t time_s, const int32_t *values) {
+    minigui_history_t *h = history;
+    if (!h || !values) return false;
+
+    if (h->used) {
+        block_head_t *b = block_at(h, h->used - 1);
+        if (time_s < b->last_s) return false;
+
+        codec_t saved = h->enc;
+        uint32_t pos = b->bits;
+        if (b->rows < UINT16_MAX && encode_row(payload(b), &pos, &h->enc, time_s, values)) {
+            b->bits = (uint16_t)pos;
+            b->last_s = time_s;
+            b->rows++;
+            h->rows++;
+            h->rows_total++;
+            return true;
+        }
+        // Roll back the partial row: clear the bits written after b->bits
+        uint8_t *p = payload(b);
+        uint32_t keep = b->bits;
+        if (keep & 7u) p[keep >> 3] &= (uint8_t)(0xFFu << (8u - (keep & 7u)));
+        uint32_t from = (keep + 7u) >> 3;
+        memset(p + from, 0, PAYLOAD_BYTES - from);
+        h->enc = saved;
+    }
+    open_block(h, time_s, values);
+    h->rows++;
+    h->rows_total++;
+    return true;
+}
+
+uint16_t minigui_history_block_count(const minigui_history_t *history) {
+    return history ? history->used : 0;
+}
+
+bool minigui_history_block_info(const minigui_history_t *history, uint16_t index, minigui_history_block_t *info) {
+    if (!history || !info || index >= history->used) return false;
+    const block_head_t *b = block_at(history, index);
+    info->first_s = b->first_s;
+    info->last_s = b->last_s;
+    info->rows = b->rows;
+    info->bytes = block_bytes(b);
+    return true;
+}
+
+uint16_t minigui_history_find_block(const minigui_history_t *history, uint32_t time_s) {
+    if (!history) return 0;
+    uint16_t lo = 0;
+    uint16_t hi = history->used;
+    while (lo < hi) {
+        uint16_t mid = (uint16_t)((lo + hi) / 2u);
+        if (block_at(history, mid)->last_s < time_s) lo = (uint16_t)(mid + 1u);
+        else hi = mid;
+    }
+    return lo;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Decode one block.
+ **
+ ** @section call_site Called from:
+ ** - minigui_history_read(), chart code, the benchmark.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param history (const minigui_history_t*): Store.
+ ** @param index (uint16_t): Block, 0 = oldest.
+ ** @param cb (minigui_history_row_cb_t): Called per row.
+ ** @param ctx (void*): Passed to @p cb.
+ **
+ ** @section pointers
+ ** - values passed to cb: Valid during the call only.
+ **
+ ** @section variables Internal Variables:
+ ** - @c c (codec_t): Previous row, seeded from the block header.
+ **
+ ** @return uint32_t: Rows decoded.
+ **
+ ** Implementation Steps:
+ ** 1. Emit the raw first row from the header.
+ ** 2. Decode the remaining rows from the bit stream.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_history_decode_block(const minigui_history_t *history, uint16_t index,
+                                      minigui_history_row_cb_t cb, void *ctx) {
+    if (!history || !cb || index >= history->used) return 0;
+
+    block_head_t *b = block_at(history, index);
+    const uint8_t *buf = payload(b);
+    codec_t c;
+    uint32_t pos = 0;
+
+    codec_reset(&c, b->first_s, b->first);
+    cb(ctx, c.t, b->first);
+    for (uint16_t row = 1; row < b->rows; row++) {
+        decode_row(buf, &pos, &c);
+        cb(ctx, c.t, (const int32_t *)c.v);
+    }
+    return b->rows;
+}
+
+size_t minigui_history_read(const minigui_history_t *history, uint8_t series, uint32_t from_s, uint32_t to_s,
+                            uint32_t step_s, minigui_history_point_t *points, size_t max) {
+    if (!history || !points || !max || series >= MINIGUI_HISTORY_SERIES || to_s < from_s) return 0;
+
+    read_ctx_t r = {
+        .series = series, .from_s = from_s, .to_s = to_s, .step_s = step_s ? step_s : 1,
+        .points = points, .max = max,
+    };
+    for (uint16_t i = minigui_history_find_block(history, from_s); i < history->used; i++) {
+        if (block_at(history, i)->first_s > to_s) break;
+        minigui_history_decode_block(history, i, read_row_cb, &r);
+    }
+    if (r.count && points[r.count - 1].rows) {
+        points[r.count - 1].avg = (int32_t)(r.sum / points[r.count - 1].rows);
+    }
+    return r.count;
+}
+
+void minigui_history_get_stats(const minigui_history_t *history, minigui_history_stats_t *stats) {
+    if (!stats) return;
+    memset(stats, 0, sizeof(*stats));
+    if (!history) return;
+
+    stats->rows = history->rows;
+    stats->rows_total = history->rows_total;
+    stats->raw_bytes = history->rows * (uint32_t)(sizeof(uint32_t) + MINIGUI_HISTORY_SERIES * sizeof(int32_t));
+    stats->capacity_bytes = (uint32_t)history->capacity * MINIGUI_HISTORY_BLOCK_BYTES;
+    stats->blocks = history->used;
+    stats->dropped_blocks = history->dropped;
+    for (uint16_t i = 0; i < history->used; i++) stats->used_bytes += block_bytes(block_at(history, i));
+    if (history->used) {
+        stats->first_s = block_at(history, 0)->first_s;
+        stats->last_s = block_at(history, history->used - 1)->last_s;
+    }
+}
+
+bool minigui_history_start(void) {
+    MINIGUI_LOCK();
+    if (!sampler_store) sampler_store = minigui_history_create(MINIGUI_HISTORY_BLOCKS);
+    if (sampler_store && !sampler_timer) {
+        sampler_timer = lv_timer_create(sampler_cb, MINIGUI_HISTORY_PERIOD_MS, NULL);
+    }
+    bool ok = sampler_store != NULL;
+    MINIGUI_UNLOCK();
+    return ok;
+}
+
+uint32_t minigui_history_now_s(void) {
+    MINIGUI_LOCK();
+    uint32_t now = lv_tick_get();
+    if (!clock_ready) {
+        clock_ready = true;
+        clock_s = now / 1000u;
+        clock_ms = now % 1000u;
+    } else {
+        clock_ms += now - clock_tick_ms;  // Unsigned difference survives the wrap
+        clock_s += clock_ms / 1000u;
+        clock_ms %= 1000u;
+    }
+    clock_tick_ms = now;
+    uint32_t s = clock_s;
+    MINIGUI_UNLOCK();
+    return s;
+}
+
+void minigui_history_stop(void) {
+    MINIGUI_LOCK();
+    if (sampler_timer) lv_timer_delete(sampler_timer);
+    sampler_timer = NULL;
+    MINIGUI_UNLOCK();
+}
+
+minigui_history_t *minigui_history_get(void) {
+    return sampler_store;
+}
+
+void minigui_history_set(uint8_t series, int32_t value) {
+    if (series >= MINIGUI_HISTORY_SERIES) return;
+    MINIGUI_LOCK();
+    app_values[series] = value;
+    MINIGUI_UNLOCK();
+}
@@ -0,0 +1,209 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI On-Screen Keyboard Service Implementation.
+ **
+ **            One slot per display holds the cached keyboard and the text
+ **            area it currently types into. The keyboard lives on the top
+ **            layer, so it survives screen switches, and is opaque: LVGL
+ **            starts redrawing at the topmost object that fully covers an
+ **            invalidated area, and the button matrix invalidates only the
+ **            pressed key, so a key press repaints that key and nothing
+ **            underneath it.
+ **
+ **            @section minigui_keyboard.c - Shared keyboard service.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None (lvgl included via header)
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_keyboard.h"
+#include "minigui_ctx.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+/**
+ * @brief Keyboard of one display
+ */
+typedef struct {
+    lv_display_t *disp;
+    lv_obj_t *kb;           // Created on first use, NULL before
+    lv_obj_t *ta;           // Text area the keyboard is attached to, or NULL
+} kb_slot_t;
+
+static kb_slot_t kb_slots[MINIGUI_MAX_CONTEXTS];
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static kb_slot_t *find_slot(lv_display_t *disp) {
+    if (!disp) disp = lv_display_get_default();
+    for (int i = 0; i < MINIGUI_MAX_CONTEXTS; i++) {
+        if (kb_slots[i].kb && kb_slots[i].disp == disp) return &kb_slots[i];
+    }
+    return NULL;
+}
+
+static void ta_delete_cb(lv_event_t *e);
+
+static void detach(kb_slot_t *slot) {
+    if (slot->ta) {
+        lv_obj_remove_event_cb_with_user_data(slot->ta, ta_delete_cb, slot);
+        slot->ta = NULL;
+    }
+    lv_keyboard_set_textarea(slot->kb, NULL);
+    lv_obj_add_flag(slot->kb, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void ta_delete_cb(lv_event_t *e) {
+    kb_slot_t *slot = (kb_slot_t *)lv_event_get_user_data(e);
+    slot->ta = NULL;  // The text area drops its own event list
+    detach(slot);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Handle keyboard events (close on OK/Cancel, forget on delete).
+ **
+ ** @section call_site Called from:
+ ** - Cached keyboard (LV_EVENT_READY, LV_EVENT_CANCEL, LV_EVENT_DELETE).
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (keyboard API)
+ **
+ ** @param e (lv_event_t*): LVGL event object.
+ **
+ ** @section pointers
+ ** - e: Owned by LVGL.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. On Ready/Cancel, detach and hide, then remove the focus state from
+ **    the text area and pass the event on to it (LVGL would not, since the
+ **    keyboard no longer has a text area).
+ ** 2. On delete (display torn down), unhook the text area and free the slot.
+ ******************************************************************************
+ ******************************************************************************/
+static void kb_event_cb(lv_event_t *e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    kb_slot_t *slot = (kb_slot_t *)lv_event_get_user_data(e);
+
+    if (code == LV_EVENT_READY || code == LV_EVENT_CANCEL) {
+        lv_obj_t *ta = slot->ta;
+        detach(slot);
+        if (ta) {
+            // The keyboard forwards the event only to an attached text area
+            lv_obj_remove_state(ta, LV_STATE_FOCUSED);
+            lv_obj_send_event(ta, code, NULL);
+        }
+    } else if (code == LV_EVENT_DELETE) {
+        if (slot->ta) lv_obj_remove_event_cb_with_user_data(slot->ta, ta_delete_cb, slot);
+        slot->ta = NULL;
+        slot->kb = NULL;
+        slot->disp = NULL;
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Creates the keyboard of a display.
+ **
+ ** @section call_site Called from:
+ ** - minigui_keyboard_show() on the first focus on that display.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (keyboard widget, top layer)
+ **
+ ** @param disp (lv_display_t*): Display.
+ **
+ ** @section pointers
+ ** - disp: Owned by the application.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return kb_slot_t*: The slot, or NULL if every slot is taken.
+ **
+ ** Implementation Steps:
+ ** 1. Take a free slot.
+ ** 2. Create the keyboard hidden on the top layer and move it to the back,
+ **    so the menu drawer and its blocker still cover it.
+ ** 3. Make its background opaque, which lets LVGL skip everything below it
+ **    when a key is redrawn.
+ ******************************************************************************
+ ******************************************************************************/
+static kb_slot_t *create_slot(lv_display_t *disp) {
+    kb_slot_t *slot = NULL;
+    for (int i = 0; i < MINIGUI_MAX_CONTEXTS && !slot; i++) {
+        if (!kb_slots[i].kb) slot = &kb_slots[i];
+    }
+    if (!slot) {
+        LV_LOG_WARN("Keyboard: no free slot");
+        return NULL;
+    }
+
+    slot->disp = disp;
+    slot->ta = NULL;
+    slot->kb = lv_keyboard_create(lv_display_get_layer_top(disp));
+    lv_obj_add_flag(slot->kb, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_move_to_index(slot->kb, 0);
+    lv_obj_set_style_bg_opa(slot->kb, LV_OPA_COVER, 0);
+    lv_obj_add_event_cb(slot->kb, kb_event_cb, LV_EVENT_ALL, slot);
+    return slot;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+void minigui_keyboard_show(lv_obj_t *ta) {
+    if (!ta) return;
+    lv_display_t *disp = lv_obj_get_display(ta);
+    kb_slot_t *slot = find_slot(disp);
+    if (!slot) slot = create_slot(disp);
+    if (!slot) return;
+
+    if (slot->ta != ta) {
+        if (slot->ta) lv_obj_remove_event_cb_with_user_data(slot->ta, ta_delete_cb, slot);
+        slot->ta = ta;
+        lv_obj_add_event_cb(ta, ta_delete_cb, LV_EVENT_DELETE, slot);
+        lv_keyboard_set_textarea(slot->kb, ta);
+    }
+    lv_obj_remove_flag(slot->kb, LV_OBJ_FLAG_HIDDEN);
+}
+
+void minigui_keyboard_hide(lv_display_t *disp) {
+    kb_slot_t *slot = find_slot(disp);
+    if (slot) detach(slot);
+}
+
+void minigui_keyboard_focus_cb(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_FOCUSED) minigui_keyboard_show(lv_event_get_target(e));
+}
+
+bool minigui_keyboard_is_created(lv_display_t *disp) {
+    return find_slot(disp) != NULL;
+}
@@ -0,0 +1,312 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Layout Profiles Implementation.
+ **
+ **            Holds the profile table and resolves it into cached metrics for
+ **            the current display resolution.
+ **
+ **            @section minigui_layout.c - Profile table and metric cache.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_layout.h"
+#include "minigui_metrics.h"
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+/**
+ * @brief Fixed metrics of one design resolution
+ */
+typedef struct {
+    int16_t hor_res, ver_res;
+    uint8_t status_bar_pct;
+    int16_t clock_w;
+    int16_t drawer_w, menu_btn_h, menu_btn_top, menu_btn_pitch;
+    int16_t card_w, card_h;
+    int16_t logs_header_h, logs_header_label_w, logs_ctrl_y, logs_ctrl_h;
+    int16_t logs_filter_w, logs_refresh_w;
+    int16_t logs_ctrl_right;      /**< Gap between refresh button and header edge */
+    int16_t logs_col_time, logs_col_source, logs_col_level;
+    int16_t nav_pane_w;
+} layout_profile_t;
+
+/**
+ * @brief Gap between the filter dropdown and the refresh button (px)
+ */
+#define LOGS_CTRL_GAP 5
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Profile table, ordered by ascending resolution.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_layout.c.
+ **
+ ** @section rationale Rationale:
+ ** - The 800x480 row reproduces the original hard-coded metrics exactly,
+ **   so existing baselines stay valid on the reference board.
+ ******************************************************************************
+ ******************************************************************************/
+static const layout_profile_t profiles[] = {
+    // res        bar clock drawer btn_h top pitch card     hdr  lbl  y  h  filt ref right time src lvl nav
+    {  480,  272, 16, 110,  180,   36,  24,  44,  140,  96, 36, 220, 0, 26,  80, 26, 10,  70, 56, 44, 140 },
+    {  800,  480, 12, 180,  250,   50,  40,  60,  220, 150, 40, 400, 5, 30, 100, 30, 55, 100, 80, 60, 200 },
+    { 1024,  600, 12, 200,  280,   56,  44,  66,  280, 180, 44, 480, 2, 32, 120, 32, 20, 110, 90, 70, 240 },
+    { 1280,  800, 10, 220,  320,   60,  48,  72,  340, 220, 48, 560, 2, 36, 140, 36, 24, 120, 100, 80, 280 },
+};
+
+#define PROFILE_COUNT (sizeof(profiles) / sizeof(profiles[0]))
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Metrics resolved for the resolutions in use.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_layout.c.
+ **
+ ** @section rationale Rationale:
+ ** - Builders call minigui_layout_get_for() on every screen build; the cache
+ **   turns that into a resolution compare. hor_res == 0 marks a free slot.
+ ** - One slot per display, so two panels with different resolutions do not
+ **   evict each other on every build.
+ ******************************************************************************
+ ******************************************************************************/
+static minigui_layout_t cache[MINIGUI_LAYOUT_CACHE_SLOTS];
+static uint8_t cache_victim = 0;  // Next slot to replace when all are in use
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Picks the profile for a resolution.
+ **
+ ** @section call_site Called from:
+ ** - minigui_layout_compute().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param hor_res (int32_t): Horizontal resolution.
+ ** @param ver_res (int32_t): Vertical resolution.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c best (uint32_t): Largest fitting profile so far.
+ **
+ ** @return uint32_t: Profile index.
+ **
+ ** Implementation Steps:
+ ** 1. Walk the ascending table and keep the last profile that fits.
+ ** 2. Fall back to profile 0 for displays smaller than every profile.
+ ******************************************************************************
+ ******************************************************************************/
+static uint32_t select_profile(int32_t hor_res, int32_t ver_res) {
+    uint32_t best = 0;
+    for (uint32_t i = 0; i < PROFILE_COUNT; i++) {
+        if (profiles[i].hor_res <= hor_res && profiles[i].ver_res <= ver_res) best = i;
+    }
+    return best;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Resolve metrics for a resolution.
+ **
+ ** @section call_site Called from:
+ ** - minigui_layout_get() on a resolution change.
+ ** - Benchmarks.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param hor_res (int32_t): Horizontal resolution.
+ ** @param ver_res (int32_t): Vertical resolution.
+ ** @param out (minigui_layout_t*): Output metrics.
+ **
+ ** @section pointers
+ ** - out: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c p (const layout_profile_t*): Selected profile.
+ ** - @c header_w (int32_t): Usable width inside the Logs header.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Select the profile and copy its fixed metrics.
+ ** 2. Right-align the Logs refresh button and the filter next to it.
+ ** 3. Keep the controls right of the caption on narrow displays.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_layout_compute(int32_t hor_res, int32_t ver_res, minigui_layout_t *out) {
+    if (!out) return;
+
+    uint32_t idx = select_profile(hor_res, ver_res);
+    const layout_profile_t *p = &profiles[idx];
+
+    out->hor_res = (int16_t)hor_res;
+    out->ver_res = (int16_t)ver_res;
+    out->profile = (uint8_t)idx;
+    out->status_bar_pct = p->status_bar_pct;
+    out->clock_w = p->clock_w;
+    out->drawer_w = p->drawer_w;
+    out->menu_btn_h = p->menu_btn_h;
+    out->menu_btn_top = p->menu_btn_top;
+    out->menu_btn_pitch = p->menu_btn_pitch;
+    out->card_w = p->card_w;
+    out->card_h = p->card_h;
+    out->logs_header_h = p->logs_header_h;
+    out->logs_header_label_w = p->logs_header_label_w;
+    out->logs_ctrl_y = p->logs_ctrl_y;
+    out->logs_ctrl_h = p->logs_ctrl_h;
+    out->logs_filter_w = p->logs_filter_w;
+    out->logs_refresh_w = p->logs_refresh_w;
+    out->logs_col_time = p->logs_col_time;
+    out->logs_col_source = p->logs_col_source;
+    out->logs_col_level = p->logs_col_level;
+    out->nav_pane_w = p->nav_pane_w;
+
+    int32_t header_w = hor_res - 2 * MINIGUI_LAYOUT_LOGS_HEADER_PAD;
+    int32_t refresh_x = header_w - p->logs_ctrl_right - p->logs_refresh_w;
+    int32_t filter_x = refresh_x - LOGS_CTRL_GAP - p->logs_filter_w;
+    int32_t min_filter_x = MINIGUI_LAYOUT_LOGS_HEADER_PAD + p->logs_header_label_w;
+    if (filter_x < min_filter_x) {
+        filter_x = min_filter_x;
+        refresh_x = filter_x + p->logs_filter_w + LOGS_CTRL_GAP;
+    }
+    out->logs_filter_x = (int16_t)filter_x;
+    out->logs_refresh_x = (int16_t)refresh_x;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Layout metrics for a display.
+ **
+ ** @section call_site Called from:
+ ** - Screen builders, menu and status bar setup.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (display resolution)
+ **
+ ** @param disp (lv_display_t*): Display, NULL for the default one.
+ **
+ ** @section pointers
+ ** - disp: Owned by LVGL.
+ ** - Returns a cache slot.
+ **
+ ** @section variables Internal Variables:
+ ** - @c hor/@c ver (int32_t): Display resolution.
+ ** - @c slot (minigui_layout_t*): Matching or replaced cache slot.
+ **
+ ** @return const minigui_layout_t*: Cached metrics.
+ **
+ ** Implementation Steps:
+ ** 1. Read the resolution (800x480 without a display).
+ ** 2. Return the slot resolved for that resolution if there is one.
+ ** 3. Otherwise resolve into a free slot, or replace slots round-robin.
+ ******************************************************************************
+ ******************************************************************************/
+const minigui_layout_t *minigui_layout_get_for(lv_display_t *disp) {
+    int32_t hor = 800;
+    int32_t ver = 480;
+
+    if (!disp) disp = lv_display_get_default();
+    if (disp) {
+        hor = lv_display_get_horizontal_resolution(disp);
+        ver = lv_display_get_vertical_resolution(disp);
+    }
+
+    minigui_layout_t *slot = NULL;
+    for (uint32_t i = 0; i < MINIGUI_LAYOUT_CACHE_SLOTS; i++) {
+        if (cache[i].hor_res == hor && cache[i].ver_res == ver) {
+            MINIGUI_METRICS_COUNT(MINIGUI_METRICS_LAYOUT_CACHE_HIT);
+            return &cache[i];
+        }
+        if (!slot && cache[i].hor_res == 0) slot = &cache[i];
+    }
+
+    if (!slot) {
+        slot = &cache[cache_victim];
+        cache_victim = (uint8_t)((cache_victim + 1) % MINIGUI_LAYOUT_CACHE_SLOTS);
+    }
+
+    MINIGUI_METRICS_COUNT(MINIGUI_METRICS_LAYOUT_CACHE_MISS);
+    minigui_layout_compute(hor, ver, slot);
+    LV_LOG_INFO("MiniGUI: layout profile %u for %ldx%ld", slot->profile, (long)hor, (long)ver);
+    return slot;
+}
+
+const minigui_layout_t *minigui_layout_get(void) {
+    return minigui_layout_get_for(NULL);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Drop the cached metrics.
+ **
+ ** @section call_site Called from:
+ ** - Benchmarks and tests that edit the display between builds.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Zero every slot so the next lookup recomputes.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_layout_invalidate(void) {
+    memset(cache, 0, sizeof(cache));
+    cache_victim = 0;
+}
+
+uint32_t minigui_layout_get_profile_count(void) {
+    return (uint32_t)PROFILE_COUNT;
+}
+
+bool minigui_layout_get_profile_resolution(uint32_t index, int32_t *hor_res, int32_t *ver_res) {
+    if (index >= PROFILE_COUNT || !hor_res || !ver_res) return false;
+    *hor_res = profiles[index].hor_res;
+    *ver_res = profiles[index].ver_res;
+    return true;
+}
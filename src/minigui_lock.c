@@ -0,0 +1,566 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Lock Contention Profiler.
+ **
+ **            Instrumented wrapper around the recursive LVGL lock. All
+ **            bookkeeping is updated while the lock is held, so the profiler
+ **            needs no synchronisation of its own.
+ **
+ **            @section minigui_lock.c - Lock profiler implementation.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None directly here, lvgl is included via minigui_lock.h
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_lock.h"
+
+/**
+ * @brief Deepest recursion tracked individually (deeper levels are counted only)
+ */
+#define LOCK_PROF_MAX_DEPTH 8
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Statistics table, one entry per call site.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_lock.c.
+ **
+ ** @section rationale Rationale:
+ ** - Fixed size so profiling never allocates while holding the lock.
+ ******************************************************************************
+ ******************************************************************************/
+static minigui_lock_site_stats_t sites[MINIGUI_LOCK_PROF_MAX_SITES];
+static size_t site_count = 0;
+
+// Recursion stack of the current holder (only touched while the lock is held)
+static uint8_t lock_depth = 0;
+static int16_t depth_site[LOCK_PROF_MAX_DEPTH];
+static uint32_t depth_start_us[LOCK_PROF_MAX_DEPTH];
+
+// Microsecond clock (NULL: lv_tick), kept here so profiling does not need the dev tools
+static minigui_lock_clock_t prof_clock = NULL;
+
+// Holder identity hooks
+static minigui_lock_thread_id_cb_t thread_id_cb = NULL;
+static void *ui_thread_id = NULL;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Reads the profiler clock.
+ **
+ ** @section call_site Called from:
+ ** - minigui_lock_prof_acquire() and minigui_lock_prof_release().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_tick_get fallback)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return uint32_t: Time in microseconds.
+ **
+ ** Implementation Steps:
+ ** 1. Use the registered clock if present.
+ ** 2. Otherwise scale lv_tick milliseconds to microseconds.
+ ******************************************************************************
+ ******************************************************************************/
+static uint32_t prof_now_us(void) {
+    if (prof_clock) return prof_clock();
+    return lv_tick_get() * 1000u;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Finds or creates the statistics slot for a call site.
+ **
+ ** @section call_site Called from:
+ ** - minigui_lock_prof_acquire() while holding the lock.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param site (const char*): Static function name.
+ **
+ ** @section pointers
+ ** - site: Compared by address, then by content.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return int: Slot index, or -1 if the table is full.
+ **
+ ** Implementation Steps:
+ ** 1. Linear search by pointer (each __func__ has a unique address).
+ ** 2. Append a new slot if not found and space remains.
+ ******************************************************************************
+ ******************************************************************************/
+static int find_site(const char *site) {
+    for (size_t i = 0; i < site_count; i++) {
+        if (sites[i].site == site) return (int)i;
+    }
+    if (site_count >= MINIGUI_LOCK_PROF_MAX_SITES) return -1;
+
+    memset(&sites[site_count], 0, sizeof(sites[0]));
+    sites[site_count].site = site;
+    return (int)site_count++;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Ranking key used to order the report.
+ **
+ ** @section call_site Called from:
+ ** - minigui_lock_prof_report().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param s (const minigui_lock_site_stats_t*): Site statistics.
+ **
+ ** @section pointers
+ ** - s: Read-only.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return uint64_t: Worst hold + worst wait.
+ **
+ ** Implementation Steps:
+ ** 1. Sum the two maxima (the UI-visible stall of a single call).
+ ******************************************************************************
+ ******************************************************************************/
+static uint64_t site_badness(const minigui_lock_site_stats_t *s) {
+    return (uint64_t)s->hold_max_us + s->wait_max_us;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Take the LVGL lock and record statistics for a call site.
+ **
+ ** @section call_site Called from:
+ ** - MINIGUI_LOCK() in profiling builds.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_lock)
+ **
+ ** @param site (const char*): Static function name.
+ **
+ ** @section pointers
+ ** - site: Stored by reference.
+ **
+ ** @section variables Internal Variables:
+ ** - @c t0 (uint32_t): Time before blocking on the lock.
+ ** - @c wait (uint32_t): Time spent blocked.
+ ** - @c self (void*): Identity of the caller.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Resolve the caller identity (before blocking).
+ ** 2. Time lv_lock().
+ ** 3. Push the site on the recursion stack with its hold start time.
+ ** 4. Update the site counters.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_lock_prof_acquire(const char *site) {
+    void *self = thread_id_cb ? thread_id_cb() : NULL;
+
+    uint32_t t0 = prof_now_us();
+    lv_lock();
+    uint32_t now = prof_now_us();
+    uint32_t wait = now - t0;
+
+    // From here on we own the lock: bookkeeping is race free
+    uint8_t depth = ++lock_depth;
+    int idx = find_site(site);
+
+    if (depth <= LOCK_PROF_MAX_DEPTH) {
+        depth_site[depth - 1] = (int16_t)idx;
+        depth_start_us[depth - 1] = now;
+    }
+    if (idx < 0) return;
+
+    minigui_lock_site_stats_t *s = &sites[idx];
+    s->acquisitions++;
+    if (depth > 1) s->nested++;
+    if (depth > s->max_depth) s->max_depth = depth;
+    if (wait >= MINIGUI_LOCK_PROF_CONTENDED_US) s->contended++;
+    if (ui_thread_id && self == ui_thread_id) s->ui_thread++;
+    s->wait_total_us += wait;
+    if (wait > s->wait_max_us) s->wait_max_us = wait;
+    s->last_holder = self;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Release the LVGL lock and record the hold time.
+ **
+ ** @section call_site Called from:
+ ** - MINIGUI_UNLOCK() in profiling builds.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_unlock)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c hold (uint32_t): Time since the matching acquire.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Pop the recursion stack and compute the hold time.
+ ** 2. Attribute it to the site that acquired this level.
+ ** 3. Call lv_unlock() last, so bookkeeping stays under the lock.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_lock_prof_release(void) {
+    if (lock_depth > 0) {
+        uint8_t depth = lock_depth--;
+        if (depth <= LOCK_PROF_MAX_DEPTH && depth_site[depth - 1] >= 0) {
+            minigui_lock_site_stats_t *s = &sites[depth_site[depth - 1]];
+            uint32_t hold = prof_now_us() - depth_start_us[depth - 1];
+            s->hold_total_us += hold;
+            if (hold > s->hold_max_us) s->hold_max_us = hold;
+        }
+    }
+    lv_unlock();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Run lv_timer_handler() as a profiled lock site.
+ **
+ ** @section call_site Called from:
+ ** - The LVGL task loop in profiling builds.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_timer_handler)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c next (uint32_t): Delay until the next timer is due.
+ **
+ ** @return uint32_t: Result of lv_timer_handler().
+ **
+ ** Implementation Steps:
+ ** 1. Acquire via the profiler so callbacks nest under this site.
+ ** 2. Run the timer handler (its own internal lock is recursive).
+ ** 3. Release via the profiler.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_lock_prof_timer_handler(void) {
+    minigui_lock_prof_acquire("lv_timer_handler");
+    uint32_t next = lv_timer_handler();
+    minigui_lock_prof_release();
+    return next;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Register the profiler clock.
+ **
+ ** @section call_site Called from:
+ ** - Firmware/simulator initialization.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param clock (minigui_lock_clock_t): Microsecond clock or NULL.
+ **
+ ** @section pointers
+ ** - clock: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Store the clock in @c prof_clock.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_lock_prof_set_clock(minigui_lock_clock_t clock) {
+    prof_clock = clock;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Register the caller identity callback.
+ **
+ ** @section call_site Called from:
+ ** - Firmware/simulator initialization.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param cb (minigui_lock_thread_id_cb_t): Identity callback.
+ **
+ ** @section pointers
+ ** - cb: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Store the callback.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_lock_prof_set_thread_id_cb(minigui_lock_thread_id_cb_t cb) {
+    thread_id_cb = cb;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Register the identity of the UI task.
+ **
+ ** @section call_site Called from:
+ ** - The LVGL task at startup.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param ui_thread (void*): Identity of the UI task.
+ **
+ ** @section pointers
+ ** - ui_thread: Opaque, never dereferenced.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Store the identity.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_lock_prof_set_ui_thread(void *ui_thread) {
+    ui_thread_id = ui_thread;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Copy the statistics of one call site.
+ **
+ ** @section call_site Called from:
+ ** - Diagnostics and metrics exporters.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_lock)
+ **
+ ** @param index (size_t): Site index.
+ ** @param out (minigui_lock_site_stats_t*): Output.
+ **
+ ** @section pointers
+ ** - out: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return bool: true if the index was valid.
+ **
+ ** Implementation Steps:
+ ** 1. Copy the slot under the raw LVGL lock (not profiled).
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_lock_prof_get(size_t index, minigui_lock_site_stats_t *out) {
+    if (!out) return false;
+
+    lv_lock();
+    bool ok = index < site_count;
+    if (ok) *out = sites[index];
+    lv_unlock();
+    return ok;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Number of call sites seen so far.
+ **
+ ** @section call_site Called from:
+ ** - Diagnostics and metrics exporters.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return size_t: Site count.
+ **
+ ** Implementation Steps:
+ ** 1. Return @c site_count.
+ ******************************************************************************
+ ******************************************************************************/
+size_t minigui_lock_prof_site_count(void) {
+    return site_count;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Clear all statistics.
+ **
+ ** @section call_site Called from:
+ ** - Benchmarks before a measured phase.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_lock)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Under the raw lock, zero every counter but keep site names.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_lock_prof_reset(void) {
+    lv_lock();
+    for (size_t i = 0; i < site_count; i++) {
+        const char *name = sites[i].site;
+        memset(&sites[i], 0, sizeof(sites[i]));
+        sites[i].site = name;
+    }
+    lv_unlock();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Write a report of the worst lock call sites.
+ **
+ ** @section call_site Called from:
+ ** - Debug console / simulator exit.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdio.h (snprintf)
+ **
+ ** @param cb (minigui_lock_report_cb_t): Line sink.
+ ** @param user (void*): Passed to @c cb.
+ **
+ ** @section pointers
+ ** - user: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c snap (minigui_lock_site_stats_t[]): Copy taken under the lock.
+ ** - @c order (uint8_t[]): Site indices sorted by badness.
+ ** - @c line (char[192]): Formatting buffer.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Snapshot the table under the raw lock (the sink may block).
+ ** 2. Insertion-sort indices by worst hold + worst wait.
+ ** 3. Emit a header and one line per site.
+ ** 4. Append advice for nested and contended sites.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_lock_prof_report(minigui_lock_report_cb_t cb, void *user) {
+    if (!cb) return;
+
+    static minigui_lock_site_stats_t snap[MINIGUI_LOCK_PROF_MAX_SITES];
+    uint8_t order[MINIGUI_LOCK_PROF_MAX_SITES];
+    char line[192];
+
+    lv_lock();
+    size_t count = site_count;
+    memcpy(snap, sites, count * sizeof(sites[0]));
+    lv_unlock();
+
+    for (size_t i = 0; i < count; i++) {
+        size_t j = i;
+        while (j > 0 && site_badness(&snap[order[j - 1]]) < site_badness(&snap[i])) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = (uint8_t)i;
+    }
+
+    cb("site                           acq  nest  cont  ui  wait_avg/max(us)  hold_avg/max(us)  depth", user);
+    for (size_t k = 0; k < count; k++) {
+        const minigui_lock_site_stats_t *s = &snap[order[k]];
+        uint32_t n = s->acquisitions ? s->acquisitions : 1;
+        snprintf(line, sizeof(line), "%-28.28s %6lu %5lu %5lu %4lu %8lu/%-8lu %8lu/%-8lu %5u",
+                 s->site,
+                 (unsigned long)s->acquisitions, (unsigned long)s->nested,
+                 (unsigned long)s->contended, (unsigned long)s->ui_thread,
+                 (unsigned long)(s->wait_total_us / n), (unsigned long)s->wait_max_us,
+                 (unsigned long)(s->hold_total_us / n), (unsigned long)s->hold_max_us,
+                 (unsigned)s->max_depth);
+        cb(line, user);
+    }
+
+    for (size_t k = 0; k < count; k++) {
+        const minigui_lock_site_stats_t *s = &snap[order[k]];
+        if (s->nested) {
+            snprintf(line, sizeof(line),
+                     "! %s: %lu nested acquisitions - called from inside LVGL callbacks; "
+                     "use an internal unlocked path", s->site, (unsigned long)s->nested);
+            cb(line, user);
+        }
+        if (s->contended && s->ui_thread < s->acquisitions) {
+            snprintf(line, sizeof(line),
+                     "! %s: %lu contended waits (max %lu us) from producer tasks; "
+                     "post asynchronously instead of blocking", s->site,
+                     (unsigned long)s->contended, (unsigned long)s->wait_max_us);
+            cb(line, user);
+        }
+    }
+}
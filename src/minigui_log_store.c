@@ -0,0 +1,336 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Log Store Implementation.
+ **
+ **            A fixed-capacity ring of log entries. Each slot carries a hash of
+ **            its source tag computed at ingestion time, so source filtering
+ **            compares integers instead of strings for non-matching entries.
+ **
+ **            @section minigui_log_store.c - Log ingestion implementation.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>  // For memcpy, strcmp
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_log_store.h"
+#include "minigui_alert.h"
+#include "minigui_alloc.h"
+#include "minigui_lock.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+/**
+ * @brief One ring slot: the entry plus its source index key
+ */
+typedef struct {
+    uint32_t source_hash;        /**< FNV-1a of entry.source */
+    minigui_log_entry_t entry;   /**< Stored copy of the log line */
+} log_slot_t;
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Ring storage, allocated from the PSRAM pool on first push.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_log_store.c.
+ **
+ ** @section rationale Rationale:
+ ** - Products that never push logs pay no RAM for the ring.
+ ******************************************************************************
+ ******************************************************************************/
+static log_slot_t *ring = NULL;
+
+// Ring cursor and counters (protected by lv_lock)
+static uint32_t ring_head = 0;     // Next slot to write
+static uint32_t ring_count = 0;    // Valid slots
+static uint32_t total_pushed = 0;
+static uint32_t total_dropped = 0;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Hashes a source tag for the filter index.
+ **
+ ** @section call_site Called from:
+ ** - minigui_log_store_push() and minigui_log_store_query().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param str (const char*): Null-terminated tag.
+ **
+ ** @section pointers
+ ** - str: Read-only.
+ **
+ ** @section variables Internal Variables:
+ ** - @c hash (uint32_t): FNV-1a accumulator.
+ **
+ ** @return uint32_t: Hash value.
+ **
+ ** Implementation Steps:
+ ** 1. Fold each byte of the string into an FNV-1a hash.
+ ******************************************************************************
+ ******************************************************************************/
+static uint32_t source_hash(const char *str) {
+    uint32_t hash = 2166136261u;
+    while (*str) {
+        hash ^= (uint8_t)*str++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Copies a string field, always terminating the destination.
+ **
+ ** @section call_site Called from:
+ ** - minigui_log_store_push().
+ **
+ ** @section dependencies Required Headers:
+ ** - string.h (strncpy)
+ **
+ ** @param dst (char*): Destination field.
+ ** @param src (const char*): Source string.
+ ** @param size (size_t): Destination capacity.
+ **
+ ** @section pointers
+ ** - dst: Slot field owned by the ring.
+ ** - src: Read-only.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Copy at most size-1 characters and terminate.
+ ******************************************************************************
+ ******************************************************************************/
+static void copy_field(char *dst, const char *src, size_t size) {
+    strncpy(dst, src, size - 1);
+    dst[size - 1] = '\0';
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Append one log entry to the ring.
+ **
+ ** @section call_site Called from:
+ ** - Any producer task.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_lock)
+ ** - minigui_alloc.h (PSRAM pool)
+ **
+ ** @param entry (const minigui_log_entry_t*): Entry to copy.
+ **
+ ** @section pointers
+ ** - entry: Read-only, copied.
+ **
+ ** @section variables Internal Variables:
+ ** - @c slot (log_slot_t*): Slot being overwritten.
+ **
+ ** @return bool: true if stored.
+ **
+ ** Implementation Steps:
+ ** 1. Acquire LVGL lock (MINIGUI_LOCK).
+ ** 2. Allocate the ring on first use; count a drop on failure.
+ ** 3. Copy fields into the head slot and compute the source hash.
+ ** 4. Advance the head; count an overwrite as a drop when full.
+ ** 5. Release LVGL lock (MINIGUI_UNLOCK).
+ ** 6. Count ERROR/WARN lines for the alert rate rules.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_log_store_push(const minigui_log_entry_t *entry) {
+    if (!entry) return false;
+
+    MINIGUI_LOCK();
+
+    if (!ring) {
+        ring = (log_slot_t *)minigui_malloc(MINIGUI_POOL_PSRAM,
+                                           MINIGUI_LOG_STORE_CAPACITY * sizeof(log_slot_t));
+        if (!ring) {
+            total_dropped++;
+            MINIGUI_UNLOCK();
+            return false;
+        }
+    }
+
+    log_slot_t *slot = &ring[ring_head];
+    copy_field(slot->entry.timestamp, entry->timestamp, sizeof(slot->entry.timestamp));
+    copy_field(slot->entry.source, entry->source, sizeof(slot->entry.source));
+    copy_field(slot->entry.level, entry->level, sizeof(slot->entry.level));
+    copy_field(slot->entry.message, entry->message, sizeof(slot->entry.message));
+    slot->source_hash = source_hash(slot->entry.source);
+
+    ring_head = (ring_head + 1) % MINIGUI_LOG_STORE_CAPACITY;
+    if (ring_count < MINIGUI_LOG_STORE_CAPACITY) {
+        ring_count++;
+    } else {
+        total_dropped++; // Oldest entry overwritten
+    }
+    total_pushed++;
+
+    MINIGUI_UNLOCK();
+
+    if (entry->level[0] == 'E') minigui_alert_count(MINIGUI_METRIC_LOG_ERRORS, 1);
+    else if (entry->level[0] == 'W') minigui_alert_count(MINIGUI_METRIC_LOG_WARNINGS, 1);
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Read the newest entries matching a source filter.
+ **
+ ** @section call_site Called from:
+ ** - Logs screen when no external provider is registered.
+ **
+ ** @section dependencies Required Headers:
+ ** - string.h (memcpy, strcmp)
+ **
+ ** @param logs (minigui_log_entry_t*): Output buffer.
+ ** @param max_count (size_t): Buffer capacity.
+ ** @param filter (const char*): Source filter or NULL/"ALL".
+ **
+ ** @section pointers
+ ** - logs: Owned by caller.
+ ** - filter: Read-only.
+ **
+ ** @section variables Internal Variables:
+ ** - @c want (uint32_t): Hash of the filter tag.
+ ** - @c added (size_t): Entries written so far.
+ **
+ ** @return size_t: Number of entries written.
+ **
+ ** Implementation Steps:
+ ** 1. Acquire LVGL lock (MINIGUI_LOCK).
+ ** 2. Hash the filter once.
+ ** 3. Walk the ring newest to oldest, comparing hashes then strings.
+ ** 4. Copy matches until the buffer is full.
+ ** 5. Release LVGL lock (MINIGUI_UNLOCK).
+ ******************************************************************************
+ ******************************************************************************/
+size_t minigui_log_store_query(minigui_log_entry_t *logs, size_t max_count, const char *filter) {
+    if (!logs || max_count == 0) return 0;
+
+    bool match_all = (!filter || strcmp(filter, "ALL") == 0);
+    uint32_t want = match_all ? 0 : source_hash(filter);
+    size_t added = 0;
+
+    MINIGUI_LOCK();
+    for (uint32_t i = 0; i < ring_count && added < max_count; i++) {
+        uint32_t idx = (ring_head + MINIGUI_LOG_STORE_CAPACITY - 1 - i) % MINIGUI_LOG_STORE_CAPACITY;
+        const log_slot_t *slot = &ring[idx];
+
+        if (!match_all && (slot->source_hash != want || strcmp(slot->entry.source, filter) != 0)) continue;
+
+        memcpy(&logs[added], &slot->entry, sizeof(minigui_log_entry_t));
+        added++;
+    }
+    MINIGUI_UNLOCK();
+
+    return added;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Drop all retained entries and reset the counters.
+ **
+ ** @section call_site Called from:
+ ** - Benchmarks, user "clear logs" actions.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_lock)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Reset cursor and counters under the LVGL lock; keep the allocation.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_log_store_clear(void) {
+    MINIGUI_LOCK();
+    ring_head = 0;
+    ring_count = 0;
+    total_pushed = 0;
+    total_dropped = 0;
+    MINIGUI_UNLOCK();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Snapshot the store counters.
+ **
+ ** @section call_site Called from:
+ ** - Benchmarks and diagnostics.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_lock)
+ **
+ ** @param stats (minigui_log_store_stats_t*): Output.
+ **
+ ** @section pointers
+ ** - stats: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Copy counters under the LVGL lock.
+ ** 2. Report the slot size as the per-entry memory cost.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_log_store_get_stats(minigui_log_store_stats_t *stats) {
+    if (!stats) return;
+
+    MINIGUI_LOCK();
+    stats->pushed = total_pushed;
+    stats->dropped = total_dropped;
+    stats->retained = ring_count;
+    stats->capacity = MINIGUI_LOG_STORE_CAPACITY;
+    stats->bytes_per_entry = sizeof(log_slot_t);
+    MINIGUI_UNLOCK();
+}
@@ -31,38 +31,9 @@
  ******************************************************************************/
 #include "minigui_menu.h"
 #include "minigui.h"
-
-/******************************************************************************
- ******************************************************************************
- * FILE GLOBALS
- ******************************************************************************
- ******************************************************************************/
-
-/******************************************************************************
- ******************************************************************************
- ** @brief Reference to the sliding drawer object.
- **
- ** @section scope Internal Scope:
- ** - Internal to minigui_menu.c.
- **
- ** @section rationale Rationale:
- ** - Holds the navigation buttons and slides in from the left.
- ******************************************************************************
- ******************************************************************************/
-static lv_obj_t *menu_drawer = NULL;
-
-/******************************************************************************
- ******************************************************************************
- ** @brief Reference to the full-screen background blocker.
- **
- ** @section scope Internal Scope:
- ** - Internal to minigui_menu.c.
- **
- ** @section rationale Rationale:
- ** - Dims the main content when menu is open and captures clicks to close it.
- ******************************************************************************
- ******************************************************************************/
-static lv_obj_t *menu_blocker = NULL;
+#include "minigui_ctx.h"
+#include "minigui_layout.h"
+#include "minigui_theme.h"
 
 // ============================================================================
 // PRIVATE HELPER FUNCTIONS
@@ -73,7 +44,7 @@ static lv_obj_t *menu_blocker = NULL;
  ** @brief Callback when the background "dimmer" is clicked.
  **
  ** @section call_site Called from:
- ** - menu_blocker's LV_EVENT_CLICKED.
+ ** - The blocker's LV_EVENT_CLICKED.
  **
  ** @section dependencies Required Headers:
  ** - lvgl.h (event handling)
@@ -82,6 +53,7 @@ static lv_obj_t *menu_blocker = NULL;
  **
  ** @section pointers 
  ** - e: Owned by LVGL.
+ ** - User data: The owning minigui_menu_t.
  **
  ** @section variables 
  ** - None
@@ -95,7 +67,7 @@ static lv_obj_t *menu_blocker = NULL;
  ******************************************************************************/
 static void blocker_cb(lv_event_t *e) {
     LV_LOG_USER("Menu closed via background dimmer");
-    minigui_menu_toggle();
+    minigui_menu_toggle((minigui_menu_t *)lv_event_get_user_data(e));
 }
 
 /******************************************************************************
@@ -106,38 +78,44 @@ static void blocker_cb(lv_event_t *e) {
  ** - Individual navigation buttons in the drawer (LV_EVENT_CLICKED).
  **
  ** @section dependencies Required Headers:
- ** - minigui.h (for minigui_switch_screen)
+ ** - minigui_ctx.h (for minigui_ctx_switch_screen)
  **
  ** @param e (lv_event_t*): LVGL event object.
  **
  ** @section pointers 
  ** - e: Owned by LVGL.
+ ** - Drawer user data: The owning minigui_menu_t.
  **
  ** @section variables Internal Variables:
  ** - @c target (minigui_screen_t): ID of the destination screen.
- ** - @c screen_names (const char*[]): Human-readable names for logging.
+ ** - @c btn (lv_obj_t*): Clicked button (its display selects the context).
+ ** - @c screen_names (const char*[]): Menu labels from MINIGUI_SCREEN_LIST, for logging.
  **
  ** @return void
  **
  ** Implementation Steps:
  ** 1. Retrieve the target screen ID from the event's user data.
  ** 2. Log the navigation action.
- ** 3. Call minigui_switch_screen to change the main view.
+ ** 3. Switch the screen of the context that owns the button.
  ** 4. Call minigui_menu_toggle() to close the drawer.
  ******************************************************************************
  ******************************************************************************/
 static void nav_btn_cb(lv_event_t *e) {
     minigui_screen_t target = (minigui_screen_t)(uintptr_t)lv_event_get_user_data(e);
+    lv_obj_t *btn = lv_event_get_target(e);
 
     // Use LV_LOG_USER for user actions - perfect separation!
-    const char* screen_names[] = {"Home", "Logs", "Settings"};
-    LV_LOG_USER("User navigating to %s screen", screen_names[target]);
+#define MENU_NAME_ENTRY(id, title, label, creator) label,
+    static const char *const screen_names[] = { MINIGUI_SCREEN_LIST(MENU_NAME_ENTRY) };
+#undef MENU_NAME_ENTRY
+    LV_UNUSED(screen_names);   // Only read by LV_LOG_USER, which may be compiled out
+    LV_LOG_USER("User navigating to %s screen", target < MINIGUI_SCREEN_COUNT ? screen_names[target] : "?");
 
-    // Switch the content area screen
-    minigui_switch_screen(target);
+    // Switch the content area screen of this display's UI
+    minigui_ctx_switch_screen(minigui_ctx_from_obj(btn), target);
 
     // Close the drawer
-    minigui_menu_toggle();
+    minigui_menu_toggle((minigui_menu_t *)lv_obj_get_user_data(lv_obj_get_parent(btn)));
 }
 
 // ============================================================================
@@ -146,65 +124,77 @@ static void nav_btn_cb(lv_event_t *e) {
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Initializes the global navigation menu.
+ ** @brief Creates a navigation menu on a display's top layer.
  **
  ** @section call_site Called from:
- ** - minigui_init() during system startup.
+ ** - minigui_ctx_create() for every UI instance.
  **
  ** @section dependencies Required Headers:
  ** - lvgl.h (for widget creation)
  **
- ** @param None
+ ** @param menu (minigui_menu_t*): Handles to fill.
+ ** @param disp (lv_display_t*): Display whose top layer hosts the menu.
  **
  ** @section pointers 
- ** - None (Static handles stored in file scope)
+ ** - menu: Owned by the context; stored as drawer and blocker user data.
+ ** - disp: Owned by LVGL.
  **
  ** @section variables Internal Variables:
  ** - @c top (lv_obj_t*): Handle to the top screen layer.
  ** - @c btn_texts (const char*[]): Labels for the menu buttons.
  ** - @c screen_ids (minigui_screen_t[]): Target IDs for the buttons.
+ **   Both are generated from MINIGUI_SCREEN_LIST (enabled screens only).
  **
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Get the top layer of the screen for floating menu support.
- ** 2. Create and configure the @c menu_blocker dimmer object.
- ** 3. Create and configure the @c menu_drawer sidebar.
+ ** 1. Get the display's top layer for floating menu support.
+ ** 2. Create and configure the blocker dimmer object.
+ ** 3. Create and configure the drawer sidebar (profile width of @p disp).
  ** 4. Loop through navigation definitions to populate buttons in the drawer.
  ** 5. Attach nav_btn_cb to each button with the corresponding screen ID.
  ******************************************************************************
  ******************************************************************************/
-void minigui_menu_init(void) {
+void minigui_menu_init(minigui_menu_t *menu, lv_display_t *disp) {
     // We use the top layer so the menu slides OVER the status bar
-    lv_obj_t *top = lv_layer_top();
+    lv_obj_t *top = lv_display_get_layer_top(disp);
+    const minigui_layout_t *layout = minigui_layout_get_for(disp);
 
     // 1. BLOCKER (Background Dimming)
-    menu_blocker = lv_obj_create(top);
+    lv_obj_t *menu_blocker = lv_obj_create(top);
     lv_obj_set_size(menu_blocker, lv_pct(100), lv_pct(100));
     lv_obj_set_style_bg_color(menu_blocker, lv_color_black(), 0);
     lv_obj_set_style_bg_opa(menu_blocker, LV_OPA_50, 0);
     lv_obj_set_style_radius(menu_blocker, 0, 0); // Square
     lv_obj_set_style_border_width(menu_blocker, 0, 0);
     lv_obj_add_flag(menu_blocker, LV_OBJ_FLAG_HIDDEN); // Hidden by default
-    lv_obj_add_event_cb(menu_blocker, blocker_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(menu_blocker, blocker_cb, LV_EVENT_CLICKED, menu);
 
     // 2. DRAWER (The sliding panel)
-    menu_drawer = lv_obj_create(top);
-    lv_obj_set_size(menu_drawer, 250, lv_pct(100));
-    lv_obj_set_x(menu_drawer, -250); // Start off-screen to the left
-    lv_obj_set_style_bg_color(menu_drawer, lv_color_hex(0x222222), 0);
+    lv_obj_t *menu_drawer = lv_obj_create(top);
+    lv_obj_set_size(menu_drawer, layout->drawer_w, lv_pct(100));
+    lv_obj_set_x(menu_drawer, -layout->drawer_w); // Start off-screen to the left
+    lv_obj_add_style(menu_drawer, minigui_theme_style(MINIGUI_THEME_DRAWER), 0);
     lv_obj_set_style_border_width(menu_drawer, 0, 0);
     lv_obj_set_style_radius(menu_drawer, 0, 0); // Square corners
     lv_obj_set_scrollbar_mode(menu_drawer, LV_SCROLLBAR_MODE_OFF);
+    lv_obj_set_user_data(menu_drawer, menu); // Lets nav buttons find their menu
+
+    menu->blocker = menu_blocker;
+    menu->drawer = menu_drawer;
 
     // 3. NAVIGATION BUTTONS
-    const char *btn_texts[] = {"Home", "Logs", "Settings"};
-    minigui_screen_t screen_ids[] = {MINIGUI_SCREEN_HOME, MINIGUI_SCREEN_LOGS, MINIGUI_SCREEN_SETTINGS};
+#define MENU_LABEL_ENTRY(id, title, label, creator) label,
+#define MENU_ID_ENTRY(id, title, label, creator) MINIGUI_SCREEN_##id,
+    const char *btn_texts[] = { MINIGUI_SCREEN_LIST(MENU_LABEL_ENTRY) };
+    minigui_screen_t screen_ids[] = { MINIGUI_SCREEN_LIST(MENU_ID_ENTRY) };
+#undef MENU_LABEL_ENTRY
+#undef MENU_ID_ENTRY
 
-    for (int i = 0; i < 3; i++) {
+    for (int i = 0; i < MINIGUI_SCREEN_COUNT; i++) {
         lv_obj_t *btn = lv_button_create(menu_drawer);
-        lv_obj_set_size(btn, lv_pct(90), 50);
-        lv_obj_align(btn, LV_ALIGN_TOP_MID, 0, 40 + (i * 60));
+        lv_obj_set_size(btn, lv_pct(90), layout->menu_btn_h);
+        lv_obj_align(btn, LV_ALIGN_TOP_MID, 0, layout->menu_btn_top + (i * layout->menu_btn_pitch));
         lv_obj_set_style_radius(btn, 4, 0); // Slight rounding on buttons only for aesthetics
 
         lv_obj_t *lbl = lv_label_create(btn);
@@ -217,6 +207,39 @@ void minigui_menu_init(void) {
     }
 }
 
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Deletes the drawer and blocker of a menu.
+ **
+ ** @section call_site Called from:
+ ** - minigui_ctx_destroy().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (object deletion)
+ **
+ ** @param menu (minigui_menu_t*): Menu to delete.
+ **
+ ** @section pointers 
+ ** - menu: Handles are cleared.
+ **
+ ** @section variables 
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Delete both objects (LVGL also drops a running drawer animation).
+ ** 2. Clear the handles so a late toggle is a no-op.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_menu_deinit(minigui_menu_t *menu) {
+    if (!menu) return;
+    if (menu->drawer) lv_obj_delete(menu->drawer);
+    if (menu->blocker) lv_obj_delete(menu->blocker);
+    menu->drawer = NULL;
+    menu->blocker = NULL;
+}
+
 /******************************************************************************
  ******************************************************************************
  ** @brief Toggles the visibility of the navigation menu.
@@ -228,10 +251,10 @@ void minigui_menu_init(void) {
  ** @section dependencies Required Headers:
  ** - lvgl.h (for animations)
  **
- ** @param None
+ ** @param menu (minigui_menu_t*): Menu to open or close.
  **
  ** @section pointers 
- ** - None
+ ** - menu: Owned by the context.
  **
  ** @section variables Internal Variables:
  ** - @c is_hidden (bool): Current visibility state of the menu.
@@ -244,14 +267,18 @@ void minigui_menu_init(void) {
  ** 2. Determine visibility state via hidden flag on blocker.
  ** 3. Configure a 300ms ease-out animation for the drawer's X position.
  ** 4. If opening: reveal blocker and animate drawer to 0.
- ** 5. If closing: hide blocker and animate drawer to -250.
+ ** 5. If closing: hide blocker and animate drawer to minus its width.
  ** 6. Start the animation.
  ******************************************************************************
  ******************************************************************************/
-void minigui_menu_toggle(void) {
-    if (!menu_drawer || !menu_blocker) return;
+void minigui_menu_toggle(minigui_menu_t *menu) {
+    if (!menu || !menu->drawer || !menu->blocker) return;
+
+    lv_obj_t *menu_drawer = menu->drawer;
+    lv_obj_t *menu_blocker = menu->blocker;
 
     bool is_hidden = lv_obj_has_flag(menu_blocker, LV_OBJ_FLAG_HIDDEN);
+    int32_t drawer_w = lv_obj_get_width(menu_drawer);
 
     // Create the animation for the drawer
     lv_anim_t a;
@@ -264,11 +291,11 @@ void minigui_menu_toggle(void) {
     if (is_hidden) {
         // OPENING
         lv_obj_remove_flag(menu_blocker, LV_OBJ_FLAG_HIDDEN);
-        lv_anim_set_values(&a, -250, 0);
+        lv_anim_set_values(&a, -drawer_w, 0);
     } else {
         // CLOSING
         lv_obj_add_flag(menu_blocker, LV_OBJ_FLAG_HIDDEN);
-        lv_anim_set_values(&a, 0, -250);
+        lv_anim_set_values(&a, 0, -drawer_w);
     }
 
     lv_anim_start(&a);
@@ -0,0 +1,539 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Metrics Exposition Implementation.
+ **
+ **            Timings are fixed-bucket histograms updated in place, so an
+ **            observation costs a few compares and adds. The dump walks the
+ **            timings and the stats getters of the other modules and writes
+ **            the text exposition format through a MINIGUI_METRICS_CHUNK
+ **            buffer on the stack; values are formatted with minigui_fmt,
+ **            without printf or floats.
+ **
+ **            @section minigui_metrics.c - Timings and Prometheus dump.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None (lvgl included via header)
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_metrics.h"
+#include "minigui_alert.h"
+#include "minigui_alloc.h"
+#include "minigui_fmt.h"
+#include "minigui_history.h"
+#include "minigui_lock.h"
+#include "minigui_store.h"
+#if MINIGUI_ENABLE_LOGS
+#include "minigui_log_store.h"
+#endif
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+/**
+ * @brief Bucket upper edges in us, and the same edges as exposed (seconds)
+ */
+static const uint32_t bucket_us[MINIGUI_METRICS_BUCKETS - 1] = {
+    100, 500, 1000, 5000, 10000, 20000, 50000, 100000, 500000,
+};
+static const char *const bucket_le[MINIGUI_METRICS_BUCKETS] = {
+    "0.0001", "0.0005", "0.001", "0.005", "0.01", "0.02", "0.05", "0.1", "0.5", "+Inf",
+};
+
+#define PROVIDER_FAMILY "minigui_provider_duration_seconds"
+
+/**
+ * @brief Exposed family and label of each timing
+ */
+static const struct {
+    const char *family;
+    const char *name;                         // Short name, the provider label in PROVIDER_FAMILY
+} timing_names[MINIGUI_METRICS_TIMING_COUNT] = {
+    [MINIGUI_METRICS_FRAME]                   = { "minigui_frame_duration_seconds", "frame" },
+    [MINIGUI_METRICS_SCREEN_BUILD]            = { "minigui_screen_build_duration_seconds", "screen_build" },
+    [MINIGUI_METRICS_PROVIDER_SYSTEM_STATS]   = { PROVIDER_FAMILY, "system_stats" },
+    [MINIGUI_METRICS_PROVIDER_NETWORK_STATUS] = { PROVIDER_FAMILY, "network_status" },
+    [MINIGUI_METRICS_PROVIDER_WIFI_SCAN]      = { PROVIDER_FAMILY, "wifi_scan" },
+    [MINIGUI_METRICS_PROVIDER_LOGS]           = { PROVIDER_FAMILY, "logs" },
+    [MINIGUI_METRICS_PROVIDER_TIME]           = { PROVIDER_FAMILY, "time" },
+};
+
+static const char *const pool_names[MINIGUI_POOL_COUNT] = { "internal", "psram", "dma" };
+
+static minigui_metrics_clock_t clock_cb;
+static minigui_metrics_timing_stats_t timings[MINIGUI_METRICS_TIMING_COUNT];
+static uint32_t counters[MINIGUI_METRICS_COUNTER_COUNT];
+
+static uint32_t frame_start_us;
+static bool frame_rendered;
+
+/**
+ * @brief Dump state: pending chunk and running total
+ */
+typedef struct {
+    minigui_metrics_write_cb_t cb;
+    void *user;
+    size_t len;
+    size_t total;
+    char buf[MINIGUI_METRICS_CHUNK];
+} writer_t;
+
+/**
+ * @brief Room for the longest formatted number (u32 + "." + 6 digits)
+ */
+#define NUM_BUF 24
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static void flush(writer_t *w) {
+    if (w->len == 0) return;
+    w->cb(w->buf, w->len, w->user);
+    w->total += w->len;
+    w->len = 0;
+}
+
+static void put(writer_t *w, const char *text) {
+    while (*text) {
+        if (w->len == sizeof(w->buf)) flush(w);
+        w->buf[w->len++] = *text++;
+    }
+}
+
+static void put_u32(writer_t *w, uint32_t value) {
+    char num[NUM_BUF];
+    minigui_fmt_u32(num, sizeof(num), value);
+    put(w, num);
+}
+
+/**
+ * @brief Microseconds as decimal seconds ("1.250000")
+ */
+static void put_seconds(writer_t *w, uint64_t us) {
+    char num[NUM_BUF];
+    size_t n = minigui_fmt_u32(num, sizeof(num), (uint32_t)(us / 1000000u));
+    n += minigui_fmt_str(num + n, sizeof(num) - n, ".");
+    minigui_fmt_u32_pad(num + n, sizeof(num) - n, (uint32_t)(us % 1000000u), 6);
+    put(w, num);
+}
+
+static void put_family(writer_t *w, const char *name, const char *type, const char *help) {
+    put(w, "# HELP ");
+    put(w, name);
+    put(w, " ");
+    put(w, help);
+    put(w, "\n# TYPE ");
+    put(w, name);
+    put(w, " ");
+    put(w, type);
+    put(w, "\n");
+}
+
+/**
+ * @brief One sample line: name{key="value"} number
+ */
+static void put_sample(writer_t *w, const char *name, const char *key, const char *label, uint32_t value) {
+    put(w, name);
+    if (key) {
+        put(w, "{");
+        put(w, key);
+        put(w, "=\"");
+        put(w, label);
+        put(w, "\"}");
+    }
+    put(w, " ");
+    put_u32(w, value);
+    put(w, "\n");
+}
+
+/**
+ * @brief Opens the label set of a histogram line; returns true if a label was written
+ */
+static bool put_series(writer_t *w, const char *family, const char *suffix, const char *provider) {
+    put(w, family);
+    put(w, suffix);
+    if (!provider) return false;
+    put(w, "{provider=\"");
+    put(w, provider);
+    put(w, "\"");
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Writes one timing as histogram samples.
+ **
+ ** @section call_site Called from:
+ ** - minigui_metrics_dump().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param w (writer_t*): Dump state.
+ ** @param id (minigui_metrics_timing_t): Timing to write.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c t (minigui_metrics_timing_stats_t): Snapshot taken under the lock.
+ ** - @c cumulative (uint32_t): Running bucket count (buckets are stored
+ **   per range, exposed cumulative).
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Snapshot the timing, so the lock is not held while writing.
+ ** 2. One _bucket line per edge, then _sum and _count.
+ ******************************************************************************
+ ******************************************************************************/
+static void put_histogram(writer_t *w, minigui_metrics_timing_t id) {
+    minigui_metrics_timing_stats_t t;
+    minigui_metrics_get_timing(id, &t);
+
+    const char *family = timing_names[id].family;
+    const char *provider = id >= MINIGUI_METRICS_PROVIDER_SYSTEM_STATS ? timing_names[id].name : NULL;
+    uint32_t cumulative = 0;
+
+    for (uint8_t b = 0; b < MINIGUI_METRICS_BUCKETS; b++) {
+        cumulative += t.buckets[b];
+        put(w, put_series(w, family, "_bucket", provider) ? "," : "{");
+        put(w, "le=\"");
+        put(w, bucket_le[b]);
+        put(w, "\"} ");
+        put_u32(w, cumulative);
+        put(w, "\n");
+    }
+
+    if (put_series(w, family, "_sum", provider)) put(w, "}");
+    put(w, " ");
+    put_seconds(w, t.sum_us);
+    put(w, "\n");
+
+    if (put_series(w, family, "_count", provider)) put(w, "}");
+    put(w, " ");
+    put_u32(w, t.count);
+    put(w, "\n");
+}
+
+static void frame_event_cb(lv_event_t *e) {
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_REFR_START:
+            frame_start_us = minigui_metrics_now_us();
+            frame_rendered = false;
+            break;
+        case LV_EVENT_RENDER_START:
+            frame_rendered = true;
+            break;
+        case LV_EVENT_REFR_READY:
+            // Refresh periods with nothing invalidated are not frames
+            if (frame_rendered) {
+                minigui_metrics_observe(MINIGUI_METRICS_FRAME, minigui_metrics_now_us() - frame_start_us);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+void minigui_metrics_set_clock(minigui_metrics_clock_t clock) {
+    clock_cb = clock;
+}
+
+uint32_t minigui_metrics_now_us(void) {
+    return clock_cb ? clock_cb() : lv_tick_get() * 1000u;
+}
+
+void minigui_metrics_observe(minigui_metrics_timing_t id, uint32_t us) {
+    if ((unsigned)id >= MINIGUI_METRICS_TIMING_COUNT) return;
+
+    uint8_t b = 0;
+    while (b < MINIGUI_METRICS_BUCKETS - 1 && us > bucket_us[b]) b++;
+
+    MINIGUI_LOCK();
+    minigui_metrics_timing_stats_t *t = &timings[id];
+    t->buckets[b]++;
+    t->count++;
+    t->sum_us += us;
+    if (us > t->max_us) t->max_us = us;
+    MINIGUI_UNLOCK();
+}
+
+void minigui_metrics_inc(minigui_metrics_counter_t id) {
+    if ((unsigned)id >= MINIGUI_METRICS_COUNTER_COUNT) return;
+    MINIGUI_LOCK();
+    counters[id]++;
+    MINIGUI_UNLOCK();
+}
+
+void minigui_metrics_attach_display(lv_display_t *disp) {
+    if (!disp) return;
+    lv_display_add_event_cb(disp, frame_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, frame_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, frame_event_cb, LV_EVENT_REFR_READY, NULL);
+}
+
+void minigui_metrics_detach_display(lv_display_t *disp) {
+    if (!disp) return;
+    lv_display_remove_event_cb_with_user_data(disp, frame_event_cb, NULL);
+}
+
+bool minigui_metrics_get_timing(minigui_metrics_timing_t id, minigui_metrics_timing_stats_t *stats) {
+    if (!stats || (unsigned)id >= MINIGUI_METRICS_TIMING_COUNT) return false;
+    MINIGUI_LOCK();
+    *stats = timings[id];
+    MINIGUI_UNLOCK();
+    return true;
+}
+
+void minigui_metrics_reset(void) {
+    MINIGUI_LOCK();
+    memset(timings, 0, sizeof(timings));
+    memset(counters, 0, sizeof(counters));
+    MINIGUI_UNLOCK();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Write every counter and gauge in the Prometheus text format.
+ **
+ ** @section call_site Called from:
+ ** - Shell commands, HTTP handlers, scraper tasks.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_alloc.h, minigui_log_store.h, minigui_store.h,
+ **   minigui_alert.h, minigui_history.h, minigui_lock.h (sources)
+ ** - minigui_fmt.h (number formatting)
+ **
+ ** @param cb (minigui_metrics_write_cb_t): Receives the text in chunks.
+ ** @param user (void*): Passed to @p cb.
+ **
+ ** @section pointers
+ ** - w.buf: Chunk handed to @p cb, reused after it returns.
+ **
+ ** @section variables Internal Variables:
+ ** - @c w (writer_t): Chunk buffer and byte count.
+ **
+ ** @return size_t: Bytes written.
+ **
+ ** Implementation Steps:
+ ** 1. Uptime, then the timings: histograms grouped by family (each
+ **    family's HELP/TYPE once), and the worst case of each as a gauge.
+ ** 2. Layout cache lookups, log ingestion (MINIGUI_ENABLE_LOGS).
+ ** 3. Memory pools and, with the builtin allocator, the LVGL heap.
+ ** 4. Settings store, alerts, metrics history (once started).
+ ** 5. Lock sites (MINIGUI_LOCK_PROFILING).
+ ** 6. Flush the last chunk.
+ **
+ ** Every source is read through its own getter under its own lock; the
+ ** lock is never held while @p cb runs.
+ ******************************************************************************
+ ******************************************************************************/
+size_t minigui_metrics_dump(minigui_metrics_write_cb_t cb, void *user) {
+    if (!cb) return 0;
+
+    writer_t w;
+    w.cb = cb;
+    w.user = user;
+    w.len = 0;
+    w.total = 0;
+
+    // 1. Uptime and timings
+    put_family(&w, "minigui_uptime_seconds", "gauge", "Time since boot.");
+    put_sample(&w, "minigui_uptime_seconds", NULL, NULL, lv_tick_get() / 1000u);
+
+    put_family(&w, timing_names[MINIGUI_METRICS_FRAME].family, "histogram",
+               "Display refreshes that rendered, layout to flush.");
+    put_histogram(&w, MINIGUI_METRICS_FRAME);
+
+    put_family(&w, timing_names[MINIGUI_METRICS_SCREEN_BUILD].family, "histogram",
+               "Screen switches: clear, create and layout freeze.");
+    put_histogram(&w, MINIGUI_METRICS_SCREEN_BUILD);
+
+    put_family(&w, PROVIDER_FAMILY, "histogram", "Application data provider calls.");
+    for (int id = MINIGUI_METRICS_PROVIDER_SYSTEM_STATS; id < MINIGUI_METRICS_TIMING_COUNT; id++) {
+        put_histogram(&w, (minigui_metrics_timing_t)id);
+    }
+
+    put_family(&w, "minigui_duration_max_seconds", "gauge", "Worst observed duration per timing.");
+    for (int id = 0; id < MINIGUI_METRICS_TIMING_COUNT; id++) {
+        minigui_metrics_timing_stats_t t;
+        minigui_metrics_get_timing((minigui_metrics_timing_t)id, &t);
+        put(&w, "minigui_duration_max_seconds{timing=\"");
+        put(&w, timing_names[id].name);
+        put(&w, "\"} ");
+        put_seconds(&w, t.max_us);
+        put(&w, "\n");
+    }
+
+    // 2. Caches and log ingestion
+    MINIGUI_LOCK();
+    uint32_t hits = counters[MINIGUI_METRICS_LAYOUT_CACHE_HIT];
+    uint32_t misses = counters[MINIGUI_METRICS_LAYOUT_CACHE_MISS];
+    MINIGUI_UNLOCK();
+    put_family(&w, "minigui_layout_cache_lookups_total", "counter", "Layout profile lookups by result.");
+    put_sample(&w, "minigui_layout_cache_lookups_total", "result", "hit", hits);
+    put_sample(&w, "minigui_layout_cache_lookups_total", "result", "miss", misses);
+
+#if MINIGUI_ENABLE_LOGS
+    minigui_log_store_stats_t logs;
+    minigui_log_store_get_stats(&logs);
+    put_family(&w, "minigui_log_entries_total", "counter", "Log entries ingested.");
+    put_sample(&w, "minigui_log_entries_total", NULL, NULL, logs.pushed);
+    put_family(&w, "minigui_log_dropped_total", "counter", "Log entries overwritten or not stored.");
+    put_sample(&w, "minigui_log_dropped_total", NULL, NULL, logs.dropped);
+    put_family(&w, "minigui_log_retained_entries", "gauge", "Log entries held.");
+    put_sample(&w, "minigui_log_retained_entries", NULL, NULL, logs.retained);
+    put_family(&w, "minigui_log_capacity_entries", "gauge", "Log ring capacity.");
+    put_sample(&w, "minigui_log_capacity_entries", NULL, NULL, logs.capacity);
+#endif
+
+    // 3. Memory
+    minigui_pool_stats_t pools[MINIGUI_POOL_COUNT];
+    for (int p = 0; p < MINIGUI_POOL_COUNT; p++) minigui_get_pool_stats((minigui_pool_t)p, &pools[p]);
+
+    put_family(&w, "minigui_pool_used_bytes", "gauge", "Bytes allocated per pool.");
+    for (int p = 0; p < MINIGUI_POOL_COUNT; p++) {
+        put_sample(&w, "minigui_pool_used_bytes", "pool", pool_names[p], (uint32_t)pools[p].in_use);
+    }
+    put_family(&w, "minigui_pool_peak_bytes", "gauge", "Highest allocation per pool.");
+    for (int p = 0; p < MINIGUI_POOL_COUNT; p++) {
+        put_sample(&w, "minigui_pool_peak_bytes", "pool", pool_names[p], (uint32_t)pools[p].peak);
+    }
+    put_family(&w, "minigui_pool_capacity_bytes", "gauge", "Arena size per pool (0 = heap backed).");
+    for (int p = 0; p < MINIGUI_POOL_COUNT; p++) {
+        put_sample(&w, "minigui_pool_capacity_bytes", "pool", pool_names[p], (uint32_t)pools[p].capacity);
+    }
+    put_family(&w, "minigui_pool_allocations_total", "counter", "Successful allocations per pool.");
+    for (int p = 0; p < MINIGUI_POOL_COUNT; p++) {
+        put_sample(&w, "minigui_pool_allocations_total", "pool", pool_names[p], pools[p].allocs);
+    }
+    put_family(&w, "minigui_pool_failures_total", "counter", "Failed allocations per pool.");
+    for (int p = 0; p < MINIGUI_POOL_COUNT; p++) {
+        put_sample(&w, "minigui_pool_failures_total", "pool", pool_names[p], pools[p].failures);
+    }
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    lv_mem_monitor_t mon;
+    MINIGUI_LOCK();
+    lv_mem_monitor(&mon);
+    MINIGUI_UNLOCK();
+    put_family(&w, "minigui_lvgl_heap_used_bytes", "gauge", "LVGL heap in use.");
+    put_sample(&w, "minigui_lvgl_heap_used_bytes", NULL, NULL, (uint32_t)(mon.total_size - mon.free_size));
+    put_family(&w, "minigui_lvgl_heap_peak_bytes", "gauge", "LVGL heap high-water mark.");
+    put_sample(&w, "minigui_lvgl_heap_peak_bytes", NULL, NULL, (uint32_t)mon.max_used);
+    put_family(&w, "minigui_lvgl_heap_size_bytes", "gauge", "LVGL heap size.");
+    put_sample(&w, "minigui_lvgl_heap_size_bytes", NULL, NULL, (uint32_t)mon.total_size);
+    put_family(&w, "minigui_lvgl_heap_fragmentation_percent", "gauge", "LVGL heap fragmentation.");
+    put_sample(&w, "minigui_lvgl_heap_fragmentation_percent", NULL, NULL, mon.frag_pct);
+#endif
+
+    // 4. Settings store, alerts, history
+    minigui_store_stats_t store;
+    minigui_store_get_stats(&store);
+    put_family(&w, "minigui_store_entries", "gauge", "Settings held in RAM.");
+    put_sample(&w, "minigui_store_entries", NULL, NULL, store.entries);
+    put_family(&w, "minigui_store_dirty_entries", "gauge", "Settings changed since the last commit.");
+    put_sample(&w, "minigui_store_dirty_entries", NULL, NULL, store.dirty);
+    put_family(&w, "minigui_store_bytes", "gauge", "RAM used by settings.");
+    put_sample(&w, "minigui_store_bytes", NULL, NULL, store.bytes);
+    put_family(&w, "minigui_store_operations_total", "counter", "Settings store operations.");
+    put_sample(&w, "minigui_store_operations_total", "op", "set", store.sets);
+    put_sample(&w, "minigui_store_operations_total", "op", "write", store.writes);
+    put_sample(&w, "minigui_store_operations_total", "op", "commit", store.commits);
+    put_sample(&w, "minigui_store_operations_total", "op", "failure", store.failures);
+
+    minigui_alert_stats_t alerts;
+    minigui_alert_get_stats(&alerts);
+    put_family(&w, "minigui_alerts_total", "counter", "Alert transitions.");
+    put_sample(&w, "minigui_alerts_total", "event", "raised", alerts.raised);
+    put_sample(&w, "minigui_alerts_total", "event", "cleared", alerts.cleared);
+    put_family(&w, "minigui_alerts_active", "gauge", "Alerts currently raised.");
+    put_sample(&w, "minigui_alerts_active", NULL, NULL, alerts.active);
+    put_family(&w, "minigui_alert_samples_total", "counter", "Samples ingested by the alert engine.");
+    put_sample(&w, "minigui_alert_samples_total", NULL, NULL, alerts.samples);
+    put_family(&w, "minigui_alert_polls_total", "counter", "System stats samples taken by the alert engine.");
+    put_sample(&w, "minigui_alert_polls_total", NULL, NULL, alerts.polls);
+    put_family(&w, "minigui_alert_poll_max_ms", "gauge", "Longest alert engine sample (LVGL task blocked).");
+    put_sample(&w, "minigui_alert_poll_max_ms", NULL, NULL, alerts.poll_max_ms);
+
+    minigui_history_t *history = minigui_history_get();
+    if (history) {
+        minigui_history_stats_t hs;
+        MINIGUI_LOCK();
+        minigui_history_get_stats(history, &hs);
+        MINIGUI_UNLOCK();
+        put_family(&w, "minigui_history_rows", "gauge", "Metric history rows held.");
+        put_sample(&w, "minigui_history_rows", NULL, NULL, hs.rows);
+        put_family(&w, "minigui_history_used_bytes", "gauge", "Compressed metric history size.");
+        put_sample(&w, "minigui_history_used_bytes", NULL, NULL, hs.used_bytes);
+        put_family(&w, "minigui_history_capacity_bytes", "gauge", "Metric history store size.");
+        put_sample(&w, "minigui_history_capacity_bytes", NULL, NULL, hs.capacity_bytes);
+        put_family(&w, "minigui_history_dropped_blocks_total", "counter", "Oldest history blocks overwritten.");
+        put_sample(&w, "minigui_history_dropped_blocks_total", NULL, NULL, hs.dropped_blocks);
+    }
+
+    // 5. Lock sites
+#ifdef MINIGUI_LOCK_PROFILING
+    size_t sites = minigui_lock_prof_site_count();
+    minigui_lock_site_stats_t site;
+    put_family(&w, "minigui_lock_acquisitions_total", "counter", "UI lock acquisitions per call site.");
+    for (size_t i = 0; i < sites; i++) {
+        if (minigui_lock_prof_get(i, &site)) {
+            put_sample(&w, "minigui_lock_acquisitions_total", "site", site.site, site.acquisitions);
+        }
+    }
+    put_family(&w, "minigui_lock_contended_total", "counter", "Acquisitions that waited per call site.");
+    for (size_t i = 0; i < sites; i++) {
+        if (minigui_lock_prof_get(i, &site)) {
+            put_sample(&w, "minigui_lock_contended_total", "site", site.site, site.contended);
+        }
+    }
+    put_family(&w, "minigui_lock_wait_seconds_total", "counter", "Time spent waiting per call site.");
+    for (size_t i = 0; i < sites; i++) {
+        if (minigui_lock_prof_get(i, &site)) {
+            put(&w, "minigui_lock_wait_seconds_total{site=\"");
+            put(&w, site.site);
+            put(&w, "\"} ");
+            put_seconds(&w, site.wait_total_us);
+            put(&w, "\n");
+        }
+    }
+    put_family(&w, "minigui_lock_hold_seconds_total", "counter", "Time the lock was held per call site.");
+    for (size_t i = 0; i < sites; i++) {
+        if (minigui_lock_prof_get(i, &site)) {
+            put(&w, "minigui_lock_hold_seconds_total{site=\"");
+            put(&w, site.site);
+            put(&w, "\"} ");
+            put_seconds(&w, site.hold_total_us);
+            put(&w, "\n");
+        }
+    }
+#endif
+
+    // 6. Last chunk
+    flush(&w);
+    return w.total;
+}
@@ -0,0 +1,856 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Screen Mirror Implementation.
+ **
+ **            Captures flushed areas from the active draw buffer, encodes them
+ **            into a staging frame and writes the frame to a non-blocking
+ **            socket from an LVGL timer. Only one frame is ever in flight;
+ **            areas flushed meanwhile are kept as damage and redrawn once the
+ **            viewer has caught up.
+ **
+ **            @section minigui_mirror.c - Remote framebuffer mirror.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>        // For memcpy, memset, strncpy
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>    // lwIP BSD sockets on ESP-IDF
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#ifndef ESP_PLATFORM
+#include <sys/un.h>
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_mirror.h"
+#include "minigui_alloc.h"
+#include "minigui_lock.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+#ifdef MSG_NOSIGNAL
+#define MIRROR_SEND_FLAGS MSG_NOSIGNAL  // A closed viewer must not raise SIGPIPE
+#else
+#define MIRROR_SEND_FLAGS 0
+#endif
+
+#define MIRROR_INDEX_SIZE 64
+#define MIRROR_MAX_CHUNK  64            // Pixels per RAW or RUN op
+
+/**
+ * @brief Incremental encoder state for one rectangle
+ */
+typedef struct {
+    uint8_t index[MIRROR_INDEX_SIZE][4];  /**< Recently seen pixels by hash */
+    uint8_t prev[4];                      /**< Last emitted pixel */
+    uint32_t run;                         /**< Pending repeats of prev */
+    uint8_t *raw_tag;                     /**< Tag of the open RAW op, or NULL */
+    uint8_t *out;
+    uint8_t *end;
+    uint8_t bpp;
+    bool overflow;
+} mirror_enc_t;
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Mirror session: sockets, staging frame and pending damage.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_mirror.c. Touched only with the LVGL lock held
+ **   (display events and the poll timer run inside lv_timer_handler()).
+ **
+ ** @section rationale Rationale:
+ ** - One staging buffer is both the frame being built and the frame being
+ **   sent. While it is being sent, new refreshes only record their areas,
+ **   which costs neither encoding time nor memory for a slow viewer.
+ ******************************************************************************
+ ******************************************************************************/
+static struct {
+    lv_display_t *disp;
+    lv_timer_t *poll_timer;
+    int listen_fd;
+    int client_fd;
+    bool is_unix;
+    char path[108];
+
+    uint8_t *tx;               // Staging frame (PSRAM pool)
+    size_t tx_len;             // Bytes of the finished frame
+    size_t tx_off;             // Bytes already written
+    bool building;             // A frame is open for the current refresh
+    bool skipped;              // The current refresh only recorded damage
+    uint16_t rect_count;
+    uint32_t seq;
+
+    lv_area_t damage[MINIGUI_MIRROR_MAX_DAMAGE];
+    uint8_t damage_count;
+
+    minigui_mirror_stats_t stats;
+} mirror = { .listen_fd = -1, .client_fd = -1 };
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static void put_u16(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t pixel_hash(const uint8_t *px, uint8_t bpp) {
+    uint32_t h = 0;
+    for (uint8_t i = 0; i < bpp; i++) h += (uint32_t)px[i] * (2u * i + 1u);
+    return h % MIRROR_INDEX_SIZE;
+}
+
+// lv_area_join()/lv_area_is_on() live in LVGL's private headers
+static bool area_overlaps(const lv_area_t *a, const lv_area_t *b) {
+    return a->x1 <= b->x2 && b->x1 <= a->x2 && a->y1 <= b->y2 && b->y1 <= a->y2;
+}
+
+static void area_join(lv_area_t *dst, const lv_area_t *src) {
+    dst->x1 = LV_MIN(dst->x1, src->x1);
+    dst->y1 = LV_MIN(dst->y1, src->y1);
+    dst->x2 = LV_MAX(dst->x2, src->x2);
+    dst->y2 = LV_MAX(dst->y2, src->y2);
+}
+
+static void enc_init(mirror_enc_t *enc, uint8_t bpp, uint8_t *out, uint8_t *end) {
+    memset(enc, 0, sizeof(*enc));
+    enc->bpp = bpp;
+    enc->out = out;
+    enc->end = end;
+}
+
+static void enc_emit(mirror_enc_t *enc, uint8_t tag) {
+    if (enc->out >= enc->end) {
+        enc->overflow = true;
+        return;
+    }
+    *enc->out++ = tag;
+}
+
+static void enc_flush_run(mirror_enc_t *enc) {
+    if (enc->run == 0) return;
+    enc_emit(enc, (uint8_t)(MINIGUI_MIRROR_OP_RUN | (enc->run - 1)));
+    enc->run = 0;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Feeds one pixel to the encoder.
+ **
+ ** @section call_site Called from:
+ ** - enc_row().
+ **
+ ** @section dependencies Required Headers:
+ ** - string.h (memcmp, memcpy)
+ **
+ ** @param enc (mirror_enc_t*): Encoder state.
+ ** @param px (const uint8_t*): Pixel bytes.
+ **
+ ** @section pointers
+ ** - enc->out: Advances inside the staging buffer.
+ **
+ ** @section variables Internal Variables:
+ ** - @c h (uint32_t): Index slot of the pixel.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Same as the previous pixel: extend the run (max 64 per op).
+ ** 2. Otherwise close the run; emit INDEX on an index hit.
+ ** 3. Otherwise append the pixel to the open RAW op (or open one) and
+ **    remember it in the index.
+ ******************************************************************************
+ ******************************************************************************/
+static void enc_pixel(mirror_enc_t *enc, const uint8_t *px) {
+    uint8_t bpp = enc->bpp;
+
+    if (memcmp(px, enc->prev, bpp) == 0) {
+        enc->raw_tag = NULL;
+        if (++enc->run == MIRROR_MAX_CHUNK) enc_flush_run(enc);
+        return;
+    }
+    enc_flush_run(enc);
+
+    uint32_t h = pixel_hash(px, bpp);
+    memcpy(enc->prev, px, bpp);
+
+    if (memcmp(enc->index[h], px, bpp) == 0) {
+        enc->raw_tag = NULL;
+        enc_emit(enc, (uint8_t)(MINIGUI_MIRROR_OP_INDEX | h));
+        return;
+    }
+    memcpy(enc->index[h], px, bpp);
+
+    if (enc->raw_tag && (*enc->raw_tag & 0x3Fu) == MIRROR_MAX_CHUNK - 1) enc->raw_tag = NULL;
+    if (!enc->raw_tag) {
+        if (enc->out >= enc->end) {
+            enc->overflow = true;
+            return;
+        }
+        enc->raw_tag = enc->out;
+        *enc->out++ = MINIGUI_MIRROR_OP_RAW;
+    } else {
+        (*enc->raw_tag)++;
+    }
+
+    if ((size_t)(enc->end - enc->out) < bpp) {
+        enc->overflow = true;
+        return;
+    }
+    memcpy(enc->out, px, bpp);
+    enc->out += bpp;
+}
+
+static void enc_row(mirror_enc_t *enc, const uint8_t *row, uint32_t w) {
+    for (uint32_t x = 0; x < w && !enc->overflow; x++) enc_pixel(enc, row + x * enc->bpp);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Records an area that still has to reach the viewer.
+ **
+ ** @section call_site Called from:
+ ** - flush_start_cb() for skipped or deferred areas.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (area helpers)
+ **
+ ** @param area (const lv_area_t*): Display area.
+ **
+ ** @section pointers
+ ** - area: Read-only.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Merge into an overlapping pending area.
+ ** 2. Otherwise append; when the list is full, collapse everything into the
+ **    bounding box (the redraw then covers more, but nothing is lost).
+ ******************************************************************************
+ ******************************************************************************/
+static void damage_add(const lv_area_t *area) {
+    for (uint8_t i = 0; i < mirror.damage_count; i++) {
+        if (area_overlaps(&mirror.damage[i], area)) {
+            area_join(&mirror.damage[i], area);
+            return;
+        }
+    }
+
+    if (mirror.damage_count < MINIGUI_MIRROR_MAX_DAMAGE) {
+        mirror.damage[mirror.damage_count++] = *area;
+        return;
+    }
+
+    for (uint8_t i = 1; i < mirror.damage_count; i++) {
+        area_join(&mirror.damage[0], &mirror.damage[i]);
+    }
+    area_join(&mirror.damage[0], area);
+    mirror.damage_count = 1;
+}
+
+static void damage_full_screen(void) {
+    lv_area_t all = {
+        0, 0,
+        lv_display_get_horizontal_resolution(mirror.disp) - 1,
+        lv_display_get_vertical_resolution(mirror.disp) - 1,
+    };
+    mirror.damage_count = 0;
+    damage_add(&all);
+}
+
+static void close_client(void) {
+    if (mirror.client_fd < 0) return;
+    close(mirror.client_fd);
+    mirror.client_fd = -1;
+    mirror.stats.connected = false;
+    mirror.tx_len = 0;
+    mirror.tx_off = 0;
+    mirror.building = false;
+    mirror.damage_count = 0;
+}
+
+static bool set_nonblocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Writes as much of the staged frame as the socket accepts.
+ **
+ ** @section call_site Called from:
+ ** - refr_ready_cb() right after a frame is finished.
+ ** - poll_timer_cb().
+ **
+ ** @section dependencies Required Headers:
+ ** - sys/socket.h (send)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c n (ssize_t): Bytes accepted by the socket.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Send until the frame is out or the socket reports EAGAIN
+ **    (backpressure: the rest goes out on a later poll).
+ ** 2. Drop the viewer on any other error.
+ ** 3. Count the frame once its last byte has been accepted.
+ ******************************************************************************
+ ******************************************************************************/
+static void try_send(void) {
+    while (mirror.client_fd >= 0 && mirror.tx_off < mirror.tx_len) {
+        ssize_t n = send(mirror.client_fd, mirror.tx + mirror.tx_off,
+                         mirror.tx_len - mirror.tx_off, MIRROR_SEND_FLAGS);
+        if (n > 0) {
+            mirror.tx_off += (size_t)n;
+            mirror.stats.bytes_sent += (uint64_t)n;
+            if (mirror.tx_off == mirror.tx_len) mirror.stats.frames_sent++;
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return;
+
+        LV_LOG_WARN("MiniGUI: mirror viewer disconnected (%d)", errno);
+        close_client();
+        return;
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Opens a frame at the start of a refresh if the link is idle.
+ **
+ ** @section call_site Called from:
+ ** - LVGL, LV_EVENT_REFR_START of the mirrored display.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param e (lv_event_t*): Unused.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Without a viewer, do nothing.
+ ** 2. While a frame is still being sent, mark this refresh as skipped.
+ ** 3. Otherwise reserve the frame header in the staging buffer.
+ ******************************************************************************
+ ******************************************************************************/
+static void refr_start_cb(lv_event_t *e) {
+    (void)e;
+    mirror.building = false;
+    mirror.skipped = false;
+    if (mirror.client_fd < 0) return;
+
+    if (mirror.tx_off < mirror.tx_len) return;
+
+    mirror.building = true;
+    mirror.rect_count = 0;
+    mirror.tx_len = MINIGUI_MIRROR_FRAME_HDR_SIZE;
+    mirror.tx_off = 0;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Encodes one flushed area into the open frame.
+ **
+ ** @section call_site Called from:
+ ** - LVGL, LV_EVENT_FLUSH_START, right before the driver's flush_cb.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (active draw buffer, color format)
+ **
+ ** @param e (lv_event_t*): Parameter is the flushed area.
+ **
+ ** @section pointers
+ ** - buf: The display's active draw buffer; read before the driver swaps
+ **   or transfers it.
+ **
+ ** @section variables Internal Variables:
+ ** - @c full (bool): Buffer holds the whole screen (direct/full mode), so
+ **   the area is addressed inside it; otherwise it starts at the area.
+ ** - @c enc (mirror_enc_t): Encoder state for this rectangle.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Skipped refresh: only record the area.
+ ** 2. Locate the area's first pixel and row stride in the draw buffer.
+ ** 3. Encode row by row after a rectangle header.
+ ** 4. If the staging buffer overflows, roll the rectangle back and record
+ **    it as damage for the next frame.
+ ******************************************************************************
+ ******************************************************************************/
+static void flush_start_cb(lv_event_t *e) {
+    const lv_area_t *area = lv_event_get_param(e);
+    if (mirror.client_fd < 0 || !area) return;
+
+    if (!mirror.building) {
+        mirror.skipped = true;
+        damage_add(area);
+        return;
+    }
+
+    lv_draw_buf_t *buf = lv_display_get_buf_active(mirror.disp);
+    if (!buf || !buf->data) return;
+
+    uint8_t bpp = lv_color_format_get_size(lv_display_get_color_format(mirror.disp));
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+    uint32_t stride = buf->header.stride;
+    bool full = buf->header.w == lv_display_get_horizontal_resolution(mirror.disp) &&
+                buf->header.h == lv_display_get_vertical_resolution(mirror.disp);
+    const uint8_t *src = buf->data;
+    if (full) src += (size_t)area->y1 * stride + (size_t)area->x1 * bpp;
+
+    uint8_t *rect = mirror.tx + mirror.tx_len;
+    uint8_t *end = mirror.tx + MINIGUI_MIRROR_BUF_SIZE;
+    if (bpp == 0 || bpp > 4 || end - rect <= MINIGUI_MIRROR_RECT_HDR_SIZE) {
+        mirror.stats.rects_deferred++;
+        damage_add(area);
+        return;
+    }
+
+    mirror_enc_t enc;
+    enc_init(&enc, bpp, rect + MINIGUI_MIRROR_RECT_HDR_SIZE, end);
+    for (int32_t y = 0; y < h && !enc.overflow; y++) enc_row(&enc, src + (size_t)y * stride, (uint32_t)w);
+    if (!enc.overflow) enc_flush_run(&enc);
+
+    if (enc.overflow) {
+        mirror.stats.rects_deferred++;
+        damage_add(area);
+        return;
+    }
+
+    size_t payload = (size_t)(enc.out - rect) - MINIGUI_MIRROR_RECT_HDR_SIZE;
+    put_u16(rect + 0, (uint32_t)area->x1);
+    put_u16(rect + 2, (uint32_t)area->y1);
+    put_u16(rect + 4, (uint32_t)w);
+    put_u16(rect + 6, (uint32_t)h);
+    put_u32(rect + 8, (uint32_t)payload);
+
+    mirror.tx_len = (size_t)(enc.out - mirror.tx);
+    mirror.rect_count++;
+    mirror.stats.rects_sent++;
+    mirror.stats.bytes_raw += (uint64_t)w * (uint64_t)h * bpp;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Closes the frame of a refresh and starts sending it.
+ **
+ ** @section call_site Called from:
+ ** - LVGL, LV_EVENT_REFR_READY of the mirrored display.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (resolution, color format)
+ **
+ ** @param e (lv_event_t*): Unused.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Count skipped refreshes.
+ ** 2. Drop empty frames; otherwise write the frame header and send.
+ ******************************************************************************
+ ******************************************************************************/
+static void refr_ready_cb(lv_event_t *e) {
+    (void)e;
+    if (mirror.skipped) mirror.stats.frames_skipped++;
+    if (!mirror.building) return;
+    mirror.building = false;
+
+    if (mirror.rect_count == 0) {
+        mirror.tx_len = 0;
+        return;
+    }
+
+    lv_color_format_t cf = lv_display_get_color_format(mirror.disp);
+    uint8_t *hdr = mirror.tx;
+    memset(hdr, 0, MINIGUI_MIRROR_FRAME_HDR_SIZE);
+    put_u32(hdr + 0, MINIGUI_MIRROR_MAGIC);
+    hdr[4] = MINIGUI_MIRROR_VERSION;
+    hdr[5] = lv_color_format_get_size(cf);
+    put_u16(hdr + 6, mirror.rect_count);
+    put_u32(hdr + 8, mirror.seq++);
+    put_u16(hdr + 12, (uint32_t)lv_display_get_horizontal_resolution(mirror.disp));
+    put_u16(hdr + 14, (uint32_t)lv_display_get_vertical_resolution(mirror.disp));
+    hdr[16] = (uint8_t)cf;
+
+    try_send();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Services the sockets.
+ **
+ ** @section call_site Called from:
+ ** - LVGL timer, every MINIGUI_MIRROR_POLL_MS.
+ **
+ ** @section dependencies Required Headers:
+ ** - sys/socket.h (accept)
+ ** - lvgl.h (invalidation)
+ **
+ ** @param t (lv_timer_t*): Unused.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c fd (int): Newly accepted viewer.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Accept a viewer if none is attached and schedule a full-screen
+ **    keyframe.
+ ** 2. Continue sending the staged frame.
+ ** 3. Once the link is idle, invalidate the pending damage so the next
+ **    refresh captures the current content of every skipped area.
+ ******************************************************************************
+ ******************************************************************************/
+static void poll_timer_cb(lv_timer_t *t) {
+    (void)t;
+
+    if (mirror.client_fd < 0) {
+        int fd = accept(mirror.listen_fd, NULL, NULL);
+        if (fd < 0) return;
+        if (!set_nonblocking(fd)) {
+            close(fd);
+            return;
+        }
+        if (!mirror.is_unix) {
+            int one = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+        mirror.client_fd = fd;
+        mirror.stats.connected = true;
+        mirror.stats.clients++;
+        mirror.tx_len = 0;
+        mirror.tx_off = 0;
+        damage_full_screen();
+        LV_LOG_USER("MiniGUI: mirror viewer connected");
+    }
+
+    try_send();
+
+    if (mirror.client_fd < 0 || mirror.tx_off < mirror.tx_len) return;
+    if (mirror.damage_count == 0) return;
+
+    lv_obj_t *scr = lv_display_get_screen_active(mirror.disp);
+    for (uint8_t i = 0; i < mirror.damage_count; i++) lv_obj_invalidate_area(scr, &mirror.damage[i]);
+    mirror.damage_count = 0;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Creates the non-blocking listening socket.
+ **
+ ** @section call_site Called from:
+ ** - minigui_mirror_start().
+ **
+ ** @section dependencies Required Headers:
+ ** - sys/socket.h, netinet/in.h, sys/un.h
+ **
+ ** @param cfg (const minigui_mirror_config_t*): Transport settings.
+ **
+ ** @section pointers
+ ** - cfg: Read-only.
+ **
+ ** @section variables Internal Variables:
+ ** - @c fd (int): Socket being set up.
+ **
+ ** @return int: Listening socket, or -1.
+ **
+ ** Implementation Steps:
+ ** 1. Create and bind a TCP (SO_REUSEADDR) or UNIX socket.
+ ** 2. Listen with a backlog of one and switch to non-blocking mode.
+ ******************************************************************************
+ ******************************************************************************/
+static int open_listener(const minigui_mirror_config_t *cfg) {
+    int fd = -1;
+
+    if (cfg->transport == MINIGUI_MIRROR_TCP) {
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(cfg->port);
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) goto fail;
+    } else {
+#ifndef ESP_PLATFORM
+        if (!cfg->path || strlen(cfg->path) >= sizeof(mirror.path)) return -1;
+        struct sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, cfg->path, sizeof(addr.sun_path) - 1);
+
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        unlink(cfg->path);
+        if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) goto fail;
+#else
+        return -1;
+#endif
+    }
+
+    if (listen(fd, 1) != 0 || !set_nonblocking(fd)) goto fail;
+    return fd;
+
+fail:
+    LV_LOG_ERROR("MiniGUI: mirror listener failed (%d)", errno);
+    close(fd);
+    return -1;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Start mirroring a display.
+ **
+ ** @section call_site Called from:
+ ** - Application, when remote support is enabled.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (display events, timers)
+ ** - minigui_alloc.h (staging buffer)
+ **
+ ** @param cfg (const minigui_mirror_config_t*): Transport and display.
+ **
+ ** @section pointers
+ ** - cfg: Read-only, copied.
+ **
+ ** @section variables Internal Variables:
+ ** - @c disp (lv_display_t*): Resolved display.
+ ** - @c fd (int): Listening socket.
+ **
+ ** @return bool: true if listening.
+ **
+ ** Implementation Steps:
+ ** 1. Reject a second session or a missing display.
+ ** 2. Open the listener and allocate the staging buffer.
+ ** 3. Hook the display refresh/flush events and start the poll timer.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_mirror_start(const minigui_mirror_config_t *cfg) {
+    if (!cfg) return false;
+
+    MINIGUI_LOCK();
+    lv_display_t *disp = cfg->disp ? cfg->disp : lv_display_get_default();
+    if (mirror.disp || !disp) {
+        MINIGUI_UNLOCK();
+        return false;
+    }
+
+    int fd = open_listener(cfg);
+    if (fd < 0) {
+        MINIGUI_UNLOCK();
+        return false;
+    }
+
+    uint8_t *tx = minigui_malloc(MINIGUI_POOL_PSRAM, MINIGUI_MIRROR_BUF_SIZE);
+    if (!tx) {
+        close(fd);
+        MINIGUI_UNLOCK();
+        return false;
+    }
+
+    memset(&mirror.stats, 0, sizeof(mirror.stats));
+    mirror.disp = disp;
+    mirror.listen_fd = fd;
+    mirror.client_fd = -1;
+    mirror.is_unix = cfg->transport == MINIGUI_MIRROR_UNIX;
+    mirror.path[0] = '\0';
+    if (mirror.is_unix) strncpy(mirror.path, cfg->path, sizeof(mirror.path) - 1);
+    mirror.tx = tx;
+    mirror.tx_len = 0;
+    mirror.tx_off = 0;
+    mirror.building = false;
+    mirror.damage_count = 0;
+    mirror.seq = 0;
+
+    lv_display_add_event_cb(disp, refr_start_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, flush_start_cb, LV_EVENT_FLUSH_START, NULL);
+    lv_display_add_event_cb(disp, refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+    mirror.poll_timer = lv_timer_create(poll_timer_cb, MINIGUI_MIRROR_POLL_MS, NULL);
+    MINIGUI_UNLOCK();
+    return true;
+}
+
+void minigui_mirror_stop(void) {
+    MINIGUI_LOCK();
+    if (!mirror.disp) {
+        MINIGUI_UNLOCK();
+        return;
+    }
+
+    lv_display_remove_event_cb_with_user_data(mirror.disp, refr_start_cb, NULL);
+    lv_display_remove_event_cb_with_user_data(mirror.disp, flush_start_cb, NULL);
+    lv_display_remove_event_cb_with_user_data(mirror.disp, refr_ready_cb, NULL);
+    lv_timer_delete(mirror.poll_timer);
+    mirror.poll_timer = NULL;
+
+    close_client();
+    close(mirror.listen_fd);
+    mirror.listen_fd = -1;
+#ifndef ESP_PLATFORM
+    if (mirror.is_unix) unlink(mirror.path);
+#endif
+
+    minigui_free(MINIGUI_POOL_PSRAM, mirror.tx);
+    mirror.tx = NULL;
+    mirror.disp = NULL;
+    MINIGUI_UNLOCK();
+}
+
+void minigui_mirror_get_stats(minigui_mirror_stats_t *stats) {
+    if (!stats) return;
+    MINIGUI_LOCK();
+    *stats = mirror.stats;
+    MINIGUI_UNLOCK();
+}
+
+size_t minigui_mirror_encode(const uint8_t *src, uint32_t count, uint8_t bpp,
+                             uint8_t *dst, size_t dst_size) {
+    if (!src || !dst || bpp == 0 || bpp > 4) return 0;
+
+    mirror_enc_t enc;
+    enc_init(&enc, bpp, dst, dst + dst_size);
+    enc_row(&enc, src, count);
+    if (!enc.overflow) enc_flush_run(&enc);
+    return enc.overflow ? 0 : (size_t)(enc.out - dst);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Decode a mirror payload.
+ **
+ ** @section call_site Called from:
+ ** - Viewers linking the library (reference implementation of the codec).
+ **
+ ** @section dependencies Required Headers:
+ ** - string.h (memcpy)
+ **
+ ** @param src (const uint8_t*): Encoded payload.
+ ** @param src_len (size_t): Payload length.
+ ** @param bpp (uint8_t): Bytes per pixel.
+ ** @param dst (uint8_t*): Output pixels.
+ ** @param count (uint32_t): Expected pixel count.
+ **
+ ** @section pointers
+ ** - src: Read-only.
+ ** - dst: Owned by caller, count * bpp bytes.
+ **
+ ** @section variables Internal Variables:
+ ** - @c index/@c prev: Mirror of the encoder state.
+ ** - @c n (uint32_t): Pixels produced so far.
+ **
+ ** @return bool: true if the payload decodes to exactly @p count pixels.
+ **
+ ** Implementation Steps:
+ ** 1. RUN: repeat the previous pixel.
+ ** 2. INDEX: emit the indexed pixel and make it the previous one.
+ ** 3. RAW: copy literal pixels, updating index and previous pixel.
+ ** 4. Reject truncated payloads and pixel count overruns.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_mirror_decode(const uint8_t *src, size_t src_len, uint8_t bpp,
+                           uint8_t *dst, uint32_t count) {
+    if (!src || !dst || bpp == 0 || bpp > 4) return false;
+
+    uint8_t index[MIRROR_INDEX_SIZE][4];
+    uint8_t prev[4] = { 0 };
+    memset(index, 0, sizeof(index));
+
+    uint32_t n = 0;
+    size_t i = 0;
+    while (i < src_len) {
+        uint8_t tag = src[i++];
+        uint32_t arg = tag & 0x3Fu;
+
+        switch (tag & MINIGUI_MIRROR_OP_MASK) {
+        case MINIGUI_MIRROR_OP_RUN:
+            if (n + arg + 1 > count) return false;
+            for (uint32_t k = 0; k <= arg; k++, n++) memcpy(dst + (size_t)n * bpp, prev, bpp);
+            break;
+        case MINIGUI_MIRROR_OP_INDEX:
+            if (n + 1 > count) return false;
+            memcpy(prev, index[arg], bpp);
+            memcpy(dst + (size_t)n++ * bpp, prev, bpp);
+            break;
+        case MINIGUI_MIRROR_OP_RAW:
+            if (n + arg + 1 > count || src_len - i < (size_t)(arg + 1) * bpp) return false;
+            for (uint32_t k = 0; k <= arg; k++, n++, i += bpp) {
+                memcpy(prev, src + i, bpp);
+                memcpy(index[pixel_hash(prev, bpp)], prev, bpp);
+                memcpy(dst + (size_t)n * bpp, prev, bpp);
+            }
+            break;
+        default:
+            return false;  // 0x40 tags are reserved
+        }
+    }
+    return n == count;
+}
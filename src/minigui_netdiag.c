@@ -0,0 +1,598 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Network Diagnostics Implementation.
+ **
+ **            One run at a time, identified by a run id so that reports from
+ **            a cancelled or timed-out run are dropped. Latency samples are
+ **            kept sorted per phase (exact percentiles, at most
+ **            MINIGUI_NETDIAG_MAX_PROBES each); throughput samples only
+ **            update their histogram and totals.
+ **
+ **            @section minigui_netdiag.c - Latency/throughput diagnostics.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None (lvgl included via header)
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_netdiag.h"
+#include "minigui_lock.h"
+#include "minigui_store.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+#define LATENCY_PHASES 2                  // LOOPBACK and LATENCY keep samples
+
+/**
+ * @brief Upper bucket edges: RTT in microseconds
+ */
+static const uint32_t latency_edges[MINIGUI_NETDIAG_BUCKETS - 1] = {
+    1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000,
+};
+static const char *const latency_labels[MINIGUI_NETDIAG_BUCKETS] = {
+    "<1", "2", "5", "10", "20", "50", "100", "200", "500", ">500",
+};
+
+/**
+ * @brief Lower bucket edges: bytes per second (bucket 0 starts at 0)
+ */
+static const uint32_t rate_edges[MINIGUI_NETDIAG_BUCKETS - 1] = {
+    16u << 10, 32u << 10, 64u << 10, 128u << 10, 256u << 10, 512u << 10, 1u << 20, 2u << 20, 4u << 20,
+};
+static const char *const rate_labels[MINIGUI_NETDIAG_BUCKETS] = {
+    "<16K", "16K", "32K", "64K", "128K", "256K", "512K", "1M", "2M", "4M+",
+};
+
+static const char *const verdict_text[] = {
+    [MINIGUI_NETDIAG_VERDICT_NONE]    = "",
+    [MINIGUI_NETDIAG_VERDICT_OK]      = "Device and network OK",
+    [MINIGUI_NETDIAG_VERDICT_DEVICE]  = "Device slow (loopback delayed)",
+    [MINIGUI_NETDIAG_VERDICT_NETWORK] = "Network slow or lossy (device OK)",
+};
+
+static const minigui_netdiag_transport_t *transport;
+static uint32_t current_run;              // Running run, 0 when idle
+static uint32_t last_run;
+static lv_timer_t *timeout_timer;
+static lv_subject_t diag_subject;
+static bool subject_ready;
+static int32_t notify_seq;
+static uint32_t last_notify_ms;
+
+static minigui_netdiag_status_t status;
+static uint32_t samples[LATENCY_PHASES][MINIGUI_NETDIAG_MAX_PROBES];  // Sorted RTTs per phase
+static uint64_t rtt_sum[LATENCY_PHASES];
+static uint64_t transfer_us;
+
+static char endpoint[MINIGUI_NETDIAG_ENDPOINT_MAX];
+static bool endpoint_loaded;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static lv_subject_t *subject(void) {
+    if (!subject_ready) {
+        lv_subject_init_int(&diag_subject, 0);
+        subject_ready = true;
+    }
+    return &diag_subject;
+}
+
+static void publish(void) {
+    last_notify_ms = lv_tick_get();
+    lv_subject_set_int(subject(), ++notify_seq);
+}
+
+static uint8_t latency_bucket(uint32_t rtt_us) {
+    uint8_t b = 0;
+    while (b < MINIGUI_NETDIAG_BUCKETS - 1 && rtt_us >= latency_edges[b]) b++;
+    return b;
+}
+
+static uint8_t rate_bucket(uint32_t bps) {
+    uint8_t b = 0;
+    while (b < MINIGUI_NETDIAG_BUCKETS - 1 && bps >= rate_edges[b]) b++;
+    return b;
+}
+
+/**
+ * @brief Lower edge of the bucket holding the @p pct percentile sample
+ */
+static uint32_t rate_percentile(const minigui_netdiag_hist_t *h, uint32_t pct) {
+    uint32_t rank = (h->count * pct + 99u) / 100u;
+    uint32_t seen = 0;
+    for (uint8_t b = 0; b < MINIGUI_NETDIAG_BUCKETS; b++) {
+        seen += h->buckets[b];
+        if (seen >= rank) return b ? rate_edges[b - 1] : 0;
+    }
+    return 0;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Derives the verdict from the current results.
+ **
+ ** @section call_site Called from:
+ ** - minigui_netdiag_report_rtt(), finish().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c probes (uint32_t): Endpoint probes sent (replies + lost).
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Loopback median above MINIGUI_NETDIAG_DEVICE_SLOW_US: DEVICE. The
+ **    device's own path is slow, so endpoint numbers say little.
+ ** 2. Endpoint without replies, loss at MINIGUI_NETDIAG_LOSS_PCT or p95
+ **    above MINIGUI_NETDIAG_NET_SLOW_US: NETWORK.
+ ** 3. Otherwise OK, or NONE before the first endpoint probe.
+ ******************************************************************************
+ ******************************************************************************/
+static void update_verdict(void) {
+    const minigui_netdiag_hist_t *loop = &status.hist[MINIGUI_NETDIAG_LOOPBACK];
+    const minigui_netdiag_hist_t *lat = &status.hist[MINIGUI_NETDIAG_LATENCY];
+    uint32_t probes = lat->count + lat->lost;
+
+    if (loop->count && loop->p50 > MINIGUI_NETDIAG_DEVICE_SLOW_US) {
+        status.verdict = MINIGUI_NETDIAG_VERDICT_DEVICE;
+    } else if (probes == 0) {
+        status.verdict = MINIGUI_NETDIAG_VERDICT_NONE;
+    } else if (lat->count == 0 || lat->lost * 100u >= probes * MINIGUI_NETDIAG_LOSS_PCT ||
+               lat->p95 > MINIGUI_NETDIAG_NET_SLOW_US) {
+        status.verdict = MINIGUI_NETDIAG_VERDICT_NETWORK;
+    } else {
+        status.verdict = MINIGUI_NETDIAG_VERDICT_OK;
+    }
+}
+
+/**
+ * @brief Ends the running run with @p state (caller holds the lock)
+ */
+static void finish(minigui_netdiag_state_t state, const char *error) {
+    if (timeout_timer) {
+        lv_timer_delete(timeout_timer);
+        timeout_timer = NULL;
+    }
+    current_run = 0;
+    status.state = state;
+    status.error = error;
+    update_verdict();
+    LV_LOG_USER("Netdiag #%lu: state %d, verdict %d", (unsigned long)last_run, (int)state, (int)status.verdict);
+    publish();
+}
+
+static void timeout_cb(lv_timer_t *timer) {
+    (void)timer;
+    uint32_t run = current_run;
+    finish(MINIGUI_NETDIAG_TIMEOUT, NULL);
+    if (run && transport && transport->stop) transport->stop(transport->ctx, run);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ * IN-PROCESS STAND-IN TRANSPORT
+ ******************************************************************************
+ ******************************************************************************/
+
+#define LOOPBACK_TICK_MS 20
+
+static struct {
+    minigui_netdiag_loopback_t behaviour;
+    minigui_netdiag_config_t cfg;
+    uint32_t run;
+    lv_timer_t *timer;
+    minigui_netdiag_phase_t phase;
+    uint16_t sent;                        // Probes done in the current phase
+    uint32_t next_ms;                     // Next probe
+    uint32_t last_ms;                     // Previous transfer tick
+    uint32_t transferred;
+    uint32_t rng;
+} loopback;
+
+static uint32_t loopback_rand(void) {
+    loopback.rng ^= loopback.rng << 13;
+    loopback.rng ^= loopback.rng >> 17;
+    loopback.rng ^= loopback.rng << 5;
+    return loopback.rng;
+}
+
+static void loopback_halt(void) {
+    if (loopback.timer) lv_timer_delete(loopback.timer);
+    loopback.timer = NULL;
+    loopback.run = 0;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Produces the stand-in samples of one tick.
+ **
+ ** @section call_site Called from:
+ ** - Stand-in timer every LOOPBACK_TICK_MS.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (tick)
+ **
+ ** @param timer (lv_timer_t*): The stand-in timer.
+ **
+ ** @section pointers
+ ** - timer: Deleted by loopback_halt().
+ **
+ ** @section variables Internal Variables:
+ ** - @c b (minigui_netdiag_loopback_t*): Configured behaviour.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Probe phases: one sample per interval (loopback: device_us plus up
+ **    to 25 %, endpoint: latency plus jitter or lost), then the next phase.
+ ** 2. Transfer: the bytes rate_bps allows since the last tick, with up to
+ **    20 % ripple; report done once transfer_bytes are through.
+ ******************************************************************************
+ ******************************************************************************/
+static void loopback_tick_cb(lv_timer_t *timer) {
+    (void)timer;
+    const minigui_netdiag_loopback_t *b = &loopback.behaviour;
+    uint32_t run = loopback.run;
+    uint32_t now = lv_tick_get();
+
+    if (loopback.phase != MINIGUI_NETDIAG_THROUGHPUT) {
+        if ((int32_t)(now - loopback.next_ms) < 0) return;
+        minigui_netdiag_phase_t phase = loopback.phase;
+        uint32_t rtt;
+        if (phase == MINIGUI_NETDIAG_LOOPBACK) {
+            rtt = b->device_us + loopback_rand() % (b->device_us / 4u + 1u);
+        } else if (b->loss_pct && loopback_rand() % 100u < b->loss_pct) {
+            rtt = MINIGUI_NETDIAG_LOST;
+        } else {
+            rtt = (b->latency_ms + loopback_rand() % (b->jitter_ms + 1u)) * 1000u + loopback_rand() % 1000u;
+        }
+        loopback.next_ms = now + loopback.cfg.interval_ms;
+        if (++loopback.sent >= loopback.cfg.probes) {
+            loopback.phase++;
+            loopback.sent = 0;
+            loopback.last_ms = now;
+        }
+        minigui_netdiag_report_rtt(run, phase, rtt);
+        return;
+    }
+
+    uint32_t dt = now - loopback.last_ms;
+    if (dt == 0) return;
+    loopback.last_ms = now;
+    uint64_t bytes = ((uint64_t)b->rate_bps * dt) / 1000u;
+    bytes = bytes * (90u + loopback_rand() % 21u) / 100u;
+    uint32_t left = loopback.cfg.transfer_bytes - loopback.transferred;
+    if (bytes > left) bytes = left;
+    loopback.transferred += (uint32_t)bytes;
+    minigui_netdiag_report_bytes(run, (uint32_t)bytes, dt * 1000u);
+
+    if (loopback.transferred >= loopback.cfg.transfer_bytes) {
+        loopback_halt();
+        minigui_netdiag_report_done(run, NULL);
+    }
+}
+
+static bool loopback_start(void *ctx, const minigui_netdiag_config_t *cfg, uint32_t run) {
+    (void)ctx;
+    loopback_halt();
+    loopback.cfg = *cfg;
+    loopback.run = run;
+    loopback.phase = MINIGUI_NETDIAG_LOOPBACK;
+    loopback.sent = 0;
+    loopback.transferred = 0;
+    loopback.next_ms = lv_tick_get();
+    if (loopback.rng == 0) loopback.rng = 0x2545F491u;
+    loopback.timer = lv_timer_create(loopback_tick_cb, LOOPBACK_TICK_MS, NULL);
+    return loopback.timer != NULL;
+}
+
+static void loopback_stop(void *ctx, uint32_t run) {
+    (void)ctx;
+    if (run == loopback.run) loopback_halt();
+}
+
+static const minigui_netdiag_transport_t loopback_transport = { loopback_start, loopback_stop, NULL };
+
+#if MINIGUI_ENABLE_MOCKS
+static const minigui_netdiag_loopback_t mock_behaviour = {
+    .latency_ms = 35, .jitter_ms = 40, .loss_pct = 0, .device_us = 400, .rate_bps = 600u * 1024u,
+};
+#endif
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+void minigui_register_netdiag_transport(const minigui_netdiag_transport_t *t) {
+    MINIGUI_LOCK();
+    transport = t;
+    MINIGUI_UNLOCK();
+}
+
+void minigui_netdiag_set_endpoint(const char *ep) {
+    if (!ep) return;
+    MINIGUI_LOCK();
+    strncpy(endpoint, ep, sizeof(endpoint) - 1);
+    endpoint[sizeof(endpoint) - 1] = '\0';
+    endpoint_loaded = true;
+    minigui_store_set_str(MINIGUI_NETDIAG_STORE_KEY, endpoint);
+    MINIGUI_UNLOCK();
+}
+
+const char *minigui_netdiag_get_endpoint(void) {
+    MINIGUI_LOCK();
+    if (!endpoint_loaded) {
+        if (minigui_store_get_str(MINIGUI_NETDIAG_STORE_KEY, endpoint, sizeof(endpoint)) == 0) {
+            strncpy(endpoint, MINIGUI_NETDIAG_ENDPOINT, sizeof(endpoint) - 1);
+        }
+        endpoint_loaded = true;
+    }
+    MINIGUI_UNLOCK();
+    return endpoint;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Start a diagnostics run.
+ **
+ ** @section call_site Called from:
+ ** - Settings network panel, application code.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (timer, subject)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c t (const minigui_netdiag_transport_t*): Registered or stand-in.
+ ** - @c cfg (minigui_netdiag_config_t): Run parameters handed over.
+ **
+ ** @return uint32_t: Run id, or 0 if no transport took the run.
+ **
+ ** Implementation Steps:
+ ** 1. Resolve the transport (stand-in with mocks); cancel a running run.
+ ** 2. Clear the results, take the next non-zero id, publish RUNNING.
+ ** 3. Arm the run timeout and start the transport; FAILED if it refuses.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_netdiag_start(void) {
+    MINIGUI_LOCK();
+    const minigui_netdiag_transport_t *t = transport;
+#if MINIGUI_ENABLE_MOCKS
+    if (!t) t = minigui_netdiag_loopback_transport(&mock_behaviour);
+#endif
+    if (current_run) minigui_netdiag_cancel();
+
+    memset(&status, 0, sizeof(status));
+    memset(rtt_sum, 0, sizeof(rtt_sum));
+    transfer_us = 0;
+    if (!t) {
+        status.state = MINIGUI_NETDIAG_FAILED;
+        status.error = "No transport";
+        publish();
+        MINIGUI_UNLOCK();
+        return 0;
+    }
+    transport = t;
+
+    minigui_netdiag_config_t cfg = {
+        .probes = MINIGUI_NETDIAG_PROBES,
+        .interval_ms = MINIGUI_NETDIAG_INTERVAL_MS,
+        .timeout_ms = MINIGUI_NETDIAG_PROBE_TIMEOUT_MS,
+        .transfer_bytes = MINIGUI_NETDIAG_TRANSFER_BYTES,
+    };
+    if (cfg.probes > MINIGUI_NETDIAG_MAX_PROBES) cfg.probes = MINIGUI_NETDIAG_MAX_PROBES;
+    strncpy(cfg.endpoint, minigui_netdiag_get_endpoint(), sizeof(cfg.endpoint) - 1);
+
+    uint32_t run = ++last_run;
+    if (run == 0) run = last_run = 1;
+    current_run = run;
+    status.state = MINIGUI_NETDIAG_RUNNING;
+    LV_LOG_USER("Netdiag #%lu: %s", (unsigned long)run, cfg.endpoint);
+    publish();
+
+    timeout_timer = lv_timer_create(timeout_cb, MINIGUI_NETDIAG_RUN_TIMEOUT_MS, NULL);
+    if (!t->start(t->ctx, &cfg, run)) {
+        if (current_run == run) finish(MINIGUI_NETDIAG_FAILED, "Transport refused the run");
+        run = 0;
+    }
+    MINIGUI_UNLOCK();
+    return run;
+}
+
+void minigui_netdiag_cancel(void) {
+    MINIGUI_LOCK();
+    uint32_t run = current_run;
+    if (run) {
+        finish(MINIGUI_NETDIAG_CANCELLED, NULL);
+        if (transport && transport->stop) transport->stop(transport->ctx, run);
+    }
+    MINIGUI_UNLOCK();
+}
+
+bool minigui_netdiag_is_running(void) {
+    return current_run != 0;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Record one latency probe.
+ **
+ ** @section call_site Called from:
+ ** - The transport's task (any task).
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_lock.h (serialize with the UI)
+ **
+ ** @param run (uint32_t): Run the sample belongs to.
+ ** @param phase (minigui_netdiag_phase_t): LOOPBACK or LATENCY.
+ ** @param rtt_us (uint32_t): Round trip, or MINIGUI_NETDIAG_LOST.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c s (uint32_t*): Sorted samples of the phase.
+ ** - @c n (uint32_t): Samples before this one.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Drop reports of other runs, non-latency phases and extra samples.
+ ** 2. Count a loss, or bin the RTT and insert it into the sorted samples.
+ ** 3. Refresh min/max/avg/p50/p95 and the verdict, publish.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_netdiag_report_rtt(uint32_t run, minigui_netdiag_phase_t phase, uint32_t rtt_us) {
+    if (phase >= LATENCY_PHASES) return;
+
+    MINIGUI_LOCK();
+    minigui_netdiag_hist_t *h = &status.hist[phase];
+    if (!run || run != current_run || h->count + h->lost >= MINIGUI_NETDIAG_MAX_PROBES) {
+        MINIGUI_UNLOCK();
+        return;
+    }
+    status.phase = phase;
+
+    if (rtt_us == MINIGUI_NETDIAG_LOST) {
+        h->lost++;
+    } else {
+        uint32_t *s = samples[phase];
+        uint32_t n = h->count;
+        while (n > 0 && s[n - 1] > rtt_us) {
+            s[n] = s[n - 1];
+            n--;
+        }
+        s[n] = rtt_us;
+        h->count++;
+        h->buckets[latency_bucket(rtt_us)]++;
+        rtt_sum[phase] += rtt_us;
+
+        h->min = s[0];
+        h->max = s[h->count - 1];
+        h->avg = (uint32_t)(rtt_sum[phase] / h->count);
+        h->p50 = s[(h->count - 1) * 50u / 100u];
+        h->p95 = s[(h->count - 1) * 95u / 100u];
+    }
+    update_verdict();
+    publish();
+    MINIGUI_UNLOCK();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Record transfer progress.
+ **
+ ** @section call_site Called from:
+ ** - The transport's task (any task).
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_lock.h (serialize with the UI)
+ **
+ ** @param run (uint32_t): Run the sample belongs to.
+ ** @param bytes (uint32_t): Bytes since the previous report.
+ ** @param elapsed_us (uint32_t): Time they took.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c bps (uint32_t): Rate of this sample.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Drop reports of other runs and empty intervals.
+ ** 2. Bin the sample rate, update min/max and the overall average.
+ ** 3. Publish at most every MINIGUI_NETDIAG_UI_MS.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_netdiag_report_bytes(uint32_t run, uint32_t bytes, uint32_t elapsed_us) {
+    if (elapsed_us == 0) return;
+
+    MINIGUI_LOCK();
+    if (!run || run != current_run) {
+        MINIGUI_UNLOCK();
+        return;
+    }
+    minigui_netdiag_hist_t *h = &status.hist[MINIGUI_NETDIAG_THROUGHPUT];
+    uint32_t bps = (uint32_t)(((uint64_t)bytes * 1000000u) / elapsed_us);
+
+    status.phase = MINIGUI_NETDIAG_THROUGHPUT;
+    status.transferred += bytes;
+    transfer_us += elapsed_us;
+    h->buckets[rate_bucket(bps)]++;
+    h->min = h->count ? LV_MIN(h->min, bps) : bps;
+    h->max = LV_MAX(h->max, bps);
+    h->count++;
+    h->avg = (uint32_t)(((uint64_t)status.transferred * 1000000u) / transfer_us);
+    h->p50 = rate_percentile(h, 50);
+    h->p95 = rate_percentile(h, 95);
+
+    if (lv_tick_elaps(last_notify_ms) >= MINIGUI_NETDIAG_UI_MS) publish();
+    MINIGUI_UNLOCK();
+}
+
+void minigui_netdiag_report_done(uint32_t run, const char *error) {
+    MINIGUI_LOCK();
+    if (run && run == current_run) finish(error ? MINIGUI_NETDIAG_FAILED : MINIGUI_NETDIAG_DONE, error);
+    MINIGUI_UNLOCK();
+}
+
+void minigui_netdiag_get_status(minigui_netdiag_status_t *out) {
+    if (!out) return;
+    MINIGUI_LOCK();
+    *out = status;
+    MINIGUI_UNLOCK();
+}
+
+lv_subject_t *minigui_netdiag_subject(void) {
+    MINIGUI_LOCK();
+    lv_subject_t *s = subject();
+    MINIGUI_UNLOCK();
+    return s;
+}
+
+const char *minigui_netdiag_bucket_label(minigui_netdiag_phase_t phase, uint8_t bucket) {
+    if (bucket >= MINIGUI_NETDIAG_BUCKETS) return "";
+    return phase == MINIGUI_NETDIAG_THROUGHPUT ? rate_labels[bucket] : latency_labels[bucket];
+}
+
+const char *minigui_netdiag_verdict_text(minigui_netdiag_verdict_t verdict) {
+    return verdict <= MINIGUI_NETDIAG_VERDICT_NETWORK ? verdict_text[verdict] : "";
+}
+
+const minigui_netdiag_transport_t *minigui_netdiag_loopback_transport(const minigui_netdiag_loopback_t *behaviour) {
+    if (behaviour) loopback.behaviour = *behaviour;
+    return &loopback_transport;
+}
@@ -0,0 +1,536 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Performance & Visual Regression Instrumentation.
+ **
+ **            This module measures how long each screen takes to build and
+ **            render, how many objects and how much heap it costs, and hashes
+ **            the rendered pixels so a headless runner can compare them with
+ **            golden images and stored budgets.
+ **
+ **            @section minigui_perf.c - Performance instrumentation.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None directly here, lvgl is included via minigui_perf.h
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_perf.h"
+#include "minigui.h"
+#include "minigui_lock.h"
+#if MINIGUI_ENABLE_SETTINGS
+#include "screens/screen_settings.h"
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Registered microsecond clock.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_perf.c.
+ **
+ ** @section rationale Rationale:
+ ** - lv_tick only has millisecond resolution, which is too coarse for
+ **   per-screen build times; the integrator supplies a finer clock.
+ ******************************************************************************
+ ******************************************************************************/
+static minigui_perf_clock_t perf_clock = NULL;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief True when @c value exceeds a non-zero @c budget by more than @c tol percent
+ */
+#define PERF_OVER_BUDGET(value, budget, tol) \
+    ((budget) != 0 && (uint64_t)(value) * 100u > (uint64_t)(budget) * (100u + (tol)))
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Recursively counts an object and all of its descendants.
+ **
+ ** @section call_site Called from:
+ ** - minigui_perf_measure() on the content area.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (object tree traversal)
+ **
+ ** @param obj (lv_obj_t*): Root of the subtree.
+ **
+ ** @section pointers
+ ** - obj: Owned by LVGL.
+ **
+ ** @section variables Internal Variables:
+ ** - @c count (uint32_t): Running total including @c obj itself.
+ **
+ ** @return uint32_t: Number of objects in the subtree.
+ **
+ ** Implementation Steps:
+ ** 1. Count the object itself.
+ ** 2. Recurse into each child and accumulate.
+ ******************************************************************************
+ ******************************************************************************/
+static uint32_t count_objects(lv_obj_t *obj) {
+    if (!obj) return 0;
+
+    uint32_t count = 1;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < child_cnt; i++) {
+        count += count_objects(lv_obj_get_child(obj, (int32_t)i));
+    }
+    return count;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Runs LVGL timers for a fixed time so deferred work completes.
+ **
+ ** @section call_site Called from:
+ ** - minigui_perf_measure() after the screen is built.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (timer handler and delay)
+ **
+ ** @param settle_ms (uint32_t): Time to keep the timer loop running.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c start (uint32_t): Tick at which settling began.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Loop lv_timer_handler() with short delays until @c settle_ms elapsed.
+ ******************************************************************************
+ ******************************************************************************/
+static void settle_timers(uint32_t settle_ms) {
+    uint32_t start = lv_tick_get();
+    while (lv_tick_elaps(start) < settle_ms) {
+        lv_timer_handler();
+        lv_delay_ms(5);
+    }
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Register a high resolution clock for measurements.
+ **
+ ** @section call_site Called from:
+ ** - Host harness or firmware initialization.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param clock (minigui_perf_clock_t): Microsecond clock or NULL.
+ **
+ ** @section pointers
+ ** - clock: Function pointer owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Store the clock in @c perf_clock.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_perf_set_clock(minigui_perf_clock_t clock) {
+    perf_clock = clock;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Read the measurement clock.
+ **
+ ** @section call_site Called from:
+ ** - Any instrumented minigui module.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_tick_get fallback)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return uint32_t: Time in microseconds.
+ **
+ ** Implementation Steps:
+ ** 1. Use the registered clock if present.
+ ** 2. Otherwise scale lv_tick milliseconds to microseconds.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_perf_now_us(void) {
+    if (perf_clock) return perf_clock();
+    return lv_tick_get() * 1000u;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Build, render and measure one screen (and settings category).
+ **
+ ** @section call_site Called from:
+ ** - Headless regression runner.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (snapshot, refresh, memory monitor)
+ ** - screen_settings.h (category selection)
+ **
+ ** @param screen (minigui_screen_t): Screen to build.
+ ** @param category (int32_t): Settings category or MINIGUI_PERF_CATEGORY_DEFAULT.
+ ** @param settle_ms (uint32_t): Timer settling time after build.
+ ** @param out (minigui_perf_sample_t*): Output measurements.
+ ** @param frame_out (lv_draw_buf_t**): Optional rendered frame for diffing.
+ **
+ ** @section pointers
+ ** - out: Owned by caller.
+ ** - frame_out: Caller takes ownership of the returned draw buffer.
+ **
+ ** @section variables Internal Variables:
+ ** - @c area (lv_obj_t*): The content area holding the screen.
+ ** - @c t0 (uint32_t): Timestamp at the start of each measured phase.
+ ** - @c frame (lv_draw_buf_t*): Snapshot of the content area.
+ **
+ ** @return bool: true if the screen was built and rendered.
+ **
+ ** Implementation Steps:
+ ** 1. Validate arguments and the content area.
+ ** 2. Time minigui_switch_screen() (plus category switch for Settings).
+ ** 3. Let deferred timers run for @c settle_ms.
+ ** 4. Under the LVGL lock, invalidate and time a full refresh.
+ ** 5. Count objects and read the LVGL heap monitor.
+ ** 6. Snapshot the content area and hash its pixels.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_perf_measure(minigui_screen_t screen, int32_t category, uint32_t settle_ms,
+                          minigui_perf_sample_t *out, lv_draw_buf_t **frame_out) {
+    if (!out || screen >= MINIGUI_SCREEN_COUNT) return false;
+    memset(out, 0, sizeof(*out));
+    if (frame_out) *frame_out = NULL;
+
+    lv_obj_t *area = minigui_get_content_area();
+    if (!area) return false;
+
+    // 1. Build
+    uint32_t t0 = minigui_perf_now_us();
+    minigui_switch_screen(screen);
+#if MINIGUI_ENABLE_SETTINGS
+    if (screen == MINIGUI_SCREEN_SETTINGS && category >= 0) {
+        screen_settings_show_category((uint32_t)category);
+    }
+#endif
+    out->build_us = minigui_perf_now_us() - t0;
+
+    // 2. Let deferred loaders (e.g. the Logs table) finish
+    settle_timers(settle_ms);
+
+    MINIGUI_LOCK();
+
+    // 3. Render one full frame
+    lv_obj_invalidate(lv_screen_active());
+    t0 = minigui_perf_now_us();
+    lv_refr_now(NULL);
+    out->render_us = minigui_perf_now_us() - t0;
+
+    // 4. Object and heap cost
+    out->obj_count = count_objects(area);
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    out->heap_used = (uint32_t)(mon.total_size - mon.free_size);
+#endif
+
+    // 5. Frame hash (content area only, so the status bar clock is excluded)
+#if LV_USE_SNAPSHOT
+    lv_draw_buf_t *frame = lv_snapshot_take(area, LV_COLOR_FORMAT_NATIVE);
+    if (frame) {
+        out->frame_hash = minigui_perf_hash_frame(frame);
+        if (frame_out) {
+            *frame_out = frame;
+        } else {
+            lv_draw_buf_destroy(frame);
+        }
+    }
+#endif
+
+    MINIGUI_UNLOCK();
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Hash the visible pixels of a draw buffer.
+ **
+ ** @section call_site Called from:
+ ** - minigui_perf_measure().
+ ** - Regression runner when loading golden images.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (color format helpers)
+ **
+ ** @param buf (const lv_draw_buf_t*): Frame to hash.
+ **
+ ** @section pointers
+ ** - buf: Read-only, owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c hash (uint32_t): FNV-1a accumulator.
+ ** - @c row_bytes (uint32_t): Visible bytes per row.
+ **
+ ** @return uint32_t: FNV-1a hash, 0 for an empty buffer.
+ **
+ ** Implementation Steps:
+ ** 1. Compute the visible byte width of a row from the color format.
+ ** 2. Fold each row into the hash, skipping stride padding.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_perf_hash_frame(const lv_draw_buf_t *buf) {
+    if (!buf || !buf->data) return 0;
+
+    uint32_t row_bytes = buf->header.w * lv_color_format_get_size(buf->header.cf);
+    uint32_t hash = 2166136261u;
+
+    for (uint32_t y = 0; y < buf->header.h; y++) {
+        const uint8_t *row = buf->data + (size_t)y * buf->header.stride;
+        for (uint32_t x = 0; x < row_bytes; x++) {
+            hash ^= row[x];
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Compare two frames pixel by pixel.
+ **
+ ** @section call_site Called from:
+ ** - Regression runner on hash mismatch.
+ **
+ ** @section dependencies Required Headers:
+ ** - string.h (memcmp/memset)
+ **
+ ** @param golden (const lv_draw_buf_t*): Reference frame.
+ ** @param actual (const lv_draw_buf_t*): Fresh frame.
+ ** @param diff (lv_draw_buf_t*): Optional diff output.
+ **
+ ** @section pointers
+ ** - golden/actual: Read-only, owned by caller.
+ ** - diff: Owned by caller, must match the geometry of @c golden.
+ **
+ ** @section variables Internal Variables:
+ ** - @c px_size (uint32_t): Bytes per pixel.
+ ** - @c changed (uint32_t): Differing pixel counter.
+ **
+ ** @return uint32_t: Differing pixels, UINT32_MAX on geometry mismatch.
+ **
+ ** Implementation Steps:
+ ** 1. Reject frames whose size or color format differ.
+ ** 2. Compare each pixel; count and mark differences in @c diff.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_perf_frame_diff(const lv_draw_buf_t *golden, const lv_draw_buf_t *actual,
+                                 lv_draw_buf_t *diff) {
+    if (!golden || !actual || !golden->data || !actual->data) return UINT32_MAX;
+    if (golden->header.w != actual->header.w || golden->header.h != actual->header.h ||
+        golden->header.cf != actual->header.cf) {
+        return UINT32_MAX;
+    }
+    if (diff && (diff->header.w != golden->header.w || diff->header.h != golden->header.h ||
+                 diff->header.cf != golden->header.cf)) {
+        diff = NULL;
+    }
+
+    uint32_t px_size = lv_color_format_get_size(golden->header.cf);
+    uint32_t changed = 0;
+
+    for (uint32_t y = 0; y < golden->header.h; y++) {
+        const uint8_t *a = golden->data + (size_t)y * golden->header.stride;
+        const uint8_t *b = actual->data + (size_t)y * actual->header.stride;
+        uint8_t *d = diff ? diff->data + (size_t)y * diff->header.stride : NULL;
+
+        for (uint32_t x = 0; x < golden->header.w; x++) {
+            bool differs = memcmp(a + x * px_size, b + x * px_size, px_size) != 0;
+            if (differs) changed++;
+            if (d) memset(d + x * px_size, differs ? 0xFF : 0x00, px_size);
+        }
+    }
+    return changed;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Check a sample against its baseline.
+ **
+ ** @section call_site Called from:
+ ** - Regression runner after each measurement.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param baseline (const minigui_perf_baseline_t*): Stored budgets.
+ ** @param sample (const minigui_perf_sample_t*): Fresh measurement.
+ ** @param tolerance_pct (uint8_t): Allowed overshoot in percent.
+ **
+ ** @section pointers
+ ** - baseline/sample: Read-only, owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return uint32_t: MINIGUI_PERF_FAIL_* bitmask.
+ **
+ ** Implementation Steps:
+ ** 1. Compare the frame hash exactly (pixel-exact requirement).
+ ** 2. Compare each numeric budget scaled by the tolerance; a zero budget
+ **    means "not tracked".
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_perf_check(const minigui_perf_baseline_t *baseline,
+                            const minigui_perf_sample_t *sample, uint8_t tolerance_pct) {
+    if (!baseline || !sample) return 0;
+
+    uint32_t flags = 0;
+    if (baseline->frame_hash != 0 && baseline->frame_hash != sample->frame_hash) {
+        flags |= MINIGUI_PERF_FAIL_HASH;
+    }
+    if (PERF_OVER_BUDGET(sample->build_us, baseline->max_build_us, tolerance_pct)) {
+        flags |= MINIGUI_PERF_FAIL_BUILD;
+    }
+    if (PERF_OVER_BUDGET(sample->render_us, baseline->max_render_us, tolerance_pct)) {
+        flags |= MINIGUI_PERF_FAIL_RENDER;
+    }
+    if (PERF_OVER_BUDGET(sample->obj_count, baseline->max_obj_count, tolerance_pct)) {
+        flags |= MINIGUI_PERF_FAIL_OBJECTS;
+    }
+    if (PERF_OVER_BUDGET(sample->heap_used, baseline->max_heap_used, tolerance_pct)) {
+        flags |= MINIGUI_PERF_FAIL_HEAP;
+    }
+    return flags;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Parse one baseline file line.
+ **
+ ** @section call_site Called from:
+ ** - Regression runner while loading the baseline file.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdio.h (sscanf)
+ **
+ ** @param line (const char*): Text line.
+ ** @param out (minigui_perf_baseline_t*): Parsed entry.
+ **
+ ** @section pointers
+ ** - line: Read-only.
+ ** - out: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c screen/category/build/render/objs/heap/hash: sscanf targets.
+ **
+ ** @return bool: true if all seven fields were parsed.
+ **
+ ** Implementation Steps:
+ ** 1. Skip leading whitespace; reject empty and comment lines.
+ ** 2. Scan the seven whitespace-separated fields.
+ ** 3. Copy them into @c out.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_perf_parse_baseline(const char *line, minigui_perf_baseline_t *out) {
+    if (!line || !out) return false;
+
+    while (*line == ' ' || *line == '\t') line++;
+    if (*line == '#' || *line == '\0' || *line == '\n' || *line == '\r') return false;
+
+    long screen, category;
+    unsigned long build, render, objs, heap, hash;
+    if (sscanf(line, "%ld %ld %lu %lu %lu %lu %lx",
+               &screen, &category, &build, &render, &objs, &heap, &hash) != 7) {
+        return false;
+    }
+
+    out->screen = (int32_t)screen;
+    out->category = (int32_t)category;
+    out->max_build_us = (uint32_t)build;
+    out->max_render_us = (uint32_t)render;
+    out->max_obj_count = (uint32_t)objs;
+    out->max_heap_used = (uint32_t)heap;
+    out->frame_hash = (uint32_t)hash;
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Format a sample as a baseline file line.
+ **
+ ** @section call_site Called from:
+ ** - Regression runner in "update goldens" mode.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdio.h (snprintf)
+ **
+ ** @param buf (char*): Output buffer.
+ ** @param len (size_t): Buffer capacity.
+ ** @param screen (minigui_screen_t): Screen of the sample.
+ ** @param category (int32_t): Category of the sample.
+ ** @param sample (const minigui_perf_sample_t*): Measurement.
+ **
+ ** @section pointers
+ ** - buf: Owned by caller.
+ ** - sample: Read-only.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return int: Characters written, or negative on error.
+ **
+ ** Implementation Steps:
+ ** 1. Print the fields in the order expected by minigui_perf_parse_baseline().
+ ******************************************************************************
+ ******************************************************************************/
+int minigui_perf_format_baseline(char *buf, size_t len, minigui_screen_t screen,
+                                 int32_t category, const minigui_perf_sample_t *sample) {
+    if (!buf || !sample) return -1;
+
+    return snprintf(buf, len, "%d %ld %lu %lu %lu %lu %08lx\n",
+                    (int)screen, (long)category,
+                    (unsigned long)sample->build_us,
+                    (unsigned long)sample->render_us,
+                    (unsigned long)sample->obj_count,
+                    (unsigned long)sample->heap_used,
+                    (unsigned long)sample->frame_hash);
+}
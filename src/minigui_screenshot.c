@@ -0,0 +1,667 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Screenshot Capture Implementation.
+ **
+ **            Forces a full refresh of the display and encodes every flushed
+ **            strip, row by row, from the draw buffer. Two encoders are
+ **            provided: QOI, and PNG with the Sub filter and a deflate
+ **            stream of fixed-Huffman literals plus distance-1 matches (the
+ **            zlib Z_RLE strategy), which needs no window or hash table.
+ **
+ **            @section minigui_screenshot.c - Streaming screenshot encoder.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>  // For memset, memcmp, memcpy
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_screenshot.h"
+#include "minigui_alloc.h"
+#include "minigui_lock.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+#define QOI_OP_INDEX 0x00u
+#define QOI_OP_DIFF  0x40u
+#define QOI_OP_LUMA  0x80u
+#define QOI_OP_RUN   0xC0u
+#define QOI_OP_RGB   0xFEu
+#define QOI_MAX_RUN  62
+
+#define DEFLATE_MAX_MATCH 258
+#define ADLER_MOD  65521u
+#define ADLER_NMAX 5552u      // Bytes before the Adler sums must be reduced
+
+/**
+ * @brief Capture and encoder state for one screenshot
+ */
+typedef struct {
+    minigui_screenshot_format_t format;
+    minigui_screenshot_write_cb_t write_cb;
+    void *user;
+    lv_display_t *disp;
+    lv_color_format_t cf;
+    uint8_t bpp;
+    int32_t hor_res;
+    int32_t ver_res;
+    int32_t next_row;          /**< First row not encoded yet */
+    bool failed;
+
+    uint8_t out[MINIGUI_SCREENSHOT_CHUNK];
+    size_t out_len;
+
+    // PNG / deflate
+    uint32_t bit_buf;
+    uint8_t bit_cnt;
+    uint32_t adler_a, adler_b, adler_n;
+    uint8_t last;              /**< Previous stream byte (distance-1 match source) */
+    bool have_last;
+    uint16_t run;              /**< Pending repeats of last */
+
+    // QOI
+    uint8_t qoi_index[64][4];  /**< RGBA; unused slots have alpha 0 and never match */
+    uint8_t qoi_prev[3];
+    uint8_t qoi_run;
+} shot_t;
+
+/**
+ * @brief Deflate length codes 257..285: base length and extra bits
+ */
+static const uint16_t len_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+static const uint8_t len_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Updates a PNG CRC-32 (nibble table, 64 bytes of flash).
+ **
+ ** @section call_site Called from:
+ ** - png_chunk().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param crc (uint32_t): Running CRC (start with 0).
+ ** @param data (const uint8_t*): Bytes to add.
+ ** @param len (size_t): Byte count.
+ **
+ ** @section pointers
+ ** - data: Read-only.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return uint32_t: Updated CRC.
+ **
+ ** Implementation Steps:
+ ** 1. Process each byte as two nibbles of the reflected 0xEDB88320 CRC.
+ ******************************************************************************
+ ******************************************************************************/
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+    static const uint32_t table[16] = {
+        0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu, 0x76DC4190u, 0x6B6B51F4u,
+        0x4DB26158u, 0x5005713Cu, 0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+        0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu,
+    };
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 0x0Fu];
+        crc = (crc >> 4) ^ table[crc & 0x0Fu];
+    }
+    return ~crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static void emit(shot_t *st, const void *data, size_t len) {
+    if (st->failed) return;
+    if (!st->write_cb(data, len, st->user)) st->failed = true;
+}
+
+static void png_chunk(shot_t *st, const char *type, const uint8_t *data, uint32_t len) {
+    uint8_t hdr[8];
+    uint8_t tail[4];
+    put_be32(hdr, len);
+    memcpy(hdr + 4, type, 4);
+    put_be32(tail, crc32_update(crc32_update(0, hdr + 4, 4), data, len));
+
+    emit(st, hdr, sizeof(hdr));
+    if (len) emit(st, data, len);
+    emit(st, tail, sizeof(tail));
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Hands the output chunk to the sink.
+ **
+ ** @section call_site Called from:
+ ** - out_byte() when the chunk is full, and at the end of the image.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param st (shot_t*): Capture state.
+ **
+ ** @section pointers
+ ** - st->out: Reused after the call.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. PNG: wrap the bytes in an IDAT chunk (the zlib stream spans chunks).
+ ** 2. QOI: pass the bytes through.
+ ******************************************************************************
+ ******************************************************************************/
+static void out_flush(shot_t *st) {
+    if (st->out_len == 0) return;
+    if (st->format == MINIGUI_SCREENSHOT_PNG) {
+        png_chunk(st, "IDAT", st->out, (uint32_t)st->out_len);
+    } else {
+        emit(st, st->out, st->out_len);
+    }
+    st->out_len = 0;
+}
+
+static void out_byte(shot_t *st, uint8_t b) {
+    st->out[st->out_len++] = b;
+    if (st->out_len == sizeof(st->out)) out_flush(st);
+}
+
+// ---------------------------------------------------------------- deflate
+
+static void bits_put(shot_t *st, uint32_t value, uint8_t n) {
+    st->bit_buf |= value << st->bit_cnt;
+    st->bit_cnt += n;
+    while (st->bit_cnt >= 8) {
+        out_byte(st, (uint8_t)st->bit_buf);
+        st->bit_buf >>= 8;
+        st->bit_cnt -= 8;
+    }
+}
+
+static void huff_put(shot_t *st, uint32_t code, uint8_t len) {
+    uint32_t rev = 0;
+    for (uint8_t i = 0; i < len; i++) rev |= ((code >> i) & 1u) << (len - 1 - i);
+    bits_put(st, rev, len);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Writes a literal/length symbol with the fixed Huffman code.
+ **
+ ** @section call_site Called from:
+ ** - z_flush_run(), z_byte(), png_end().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param st (shot_t*): Capture state.
+ ** @param sym (uint32_t): Symbol 0..287.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Map the symbol to its RFC 1951 fixed code (7, 8 or 9 bits).
+ ******************************************************************************
+ ******************************************************************************/
+static void z_symbol(shot_t *st, uint32_t sym) {
+    if (sym < 144) {
+        huff_put(st, 0x30u + sym, 8);
+    } else if (sym < 256) {
+        huff_put(st, 0x190u + (sym - 144), 9);
+    } else if (sym < 280) {
+        huff_put(st, sym - 256, 7);
+    } else {
+        huff_put(st, 0xC0u + (sym - 280), 8);
+    }
+}
+
+static void z_flush_run(shot_t *st) {
+    if (st->run == 0) return;
+
+    if (st->run < 3) {
+        for (uint16_t i = 0; i < st->run; i++) z_symbol(st, st->last);
+    } else {
+        uint32_t i = 28;
+        while (len_base[i] > st->run) i--;
+        z_symbol(st, 257 + i);
+        bits_put(st, st->run - len_base[i], len_extra[i]);
+        huff_put(st, 0, 5);  // Distance code 0 = distance 1
+    }
+    st->run = 0;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Adds one byte to the zlib stream.
+ **
+ ** @section call_site Called from:
+ ** - encode_rows().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param st (shot_t*): Capture state.
+ ** @param b (uint8_t): Uncompressed byte.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Update the Adler-32 sums, reducing them every ADLER_NMAX bytes.
+ ** 2. A repeat of the previous byte extends the pending match.
+ ** 3. Otherwise close the match and emit the byte as a literal.
+ ******************************************************************************
+ ******************************************************************************/
+static void z_byte(shot_t *st, uint8_t b) {
+    st->adler_a += b;
+    st->adler_b += st->adler_a;
+    if (++st->adler_n == ADLER_NMAX) {
+        st->adler_a %= ADLER_MOD;
+        st->adler_b %= ADLER_MOD;
+        st->adler_n = 0;
+    }
+
+    if (st->have_last && b == st->last) {
+        if (++st->run == DEFLATE_MAX_MATCH) z_flush_run(st);
+        return;
+    }
+    z_flush_run(st);
+    z_symbol(st, b);
+    st->last = b;
+    st->have_last = true;
+}
+
+// ---------------------------------------------------------------- formats
+
+static void png_begin(shot_t *st) {
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    uint8_t ihdr[13];
+    put_be32(ihdr, (uint32_t)st->hor_res);
+    put_be32(ihdr + 4, (uint32_t)st->ver_res);
+    ihdr[8] = 8;    // Bit depth
+    ihdr[9] = 2;    // Truecolor
+    ihdr[10] = 0;   // Deflate
+    ihdr[11] = 0;   // Adaptive filtering
+    ihdr[12] = 0;   // No interlace
+
+    emit(st, signature, sizeof(signature));
+    png_chunk(st, "IHDR", ihdr, sizeof(ihdr));
+
+    out_byte(st, 0x78);        // zlib: deflate, 32K window
+    out_byte(st, 0x01);        // No preset dictionary, fastest level
+    bits_put(st, 1, 1);        // BFINAL: the whole image is one block
+    bits_put(st, 1, 2);        // BTYPE 01: fixed Huffman codes
+    st->adler_a = 1;
+}
+
+static void png_end(shot_t *st) {
+    z_flush_run(st);
+    z_symbol(st, 256);         // End of block
+    bits_put(st, 0, (uint8_t)((8 - st->bit_cnt) & 7u));
+
+    uint8_t adler[4];
+    put_be32(adler, ((st->adler_b % ADLER_MOD) << 16) | (st->adler_a % ADLER_MOD));
+    for (uint8_t i = 0; i < 4; i++) out_byte(st, adler[i]);
+    out_flush(st);
+    png_chunk(st, "IEND", NULL, 0);
+}
+
+static void qoi_begin(shot_t *st) {
+    uint8_t hdr[14] = { 'q', 'o', 'i', 'f' };
+    put_be32(hdr + 4, (uint32_t)st->hor_res);
+    put_be32(hdr + 8, (uint32_t)st->ver_res);
+    hdr[12] = 3;               // RGB
+    hdr[13] = 0;               // sRGB
+    for (uint8_t i = 0; i < sizeof(hdr); i++) out_byte(st, hdr[i]);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Encodes one RGB row as QOI ops.
+ **
+ ** @section call_site Called from:
+ ** - encode_rows().
+ **
+ ** @section dependencies Required Headers:
+ ** - string.h (memcmp, memcpy)
+ **
+ ** @param st (shot_t*): Capture state.
+ ** @param rgb (const uint8_t*): Row, 3 bytes per pixel.
+ ** @param w (int32_t): Pixels in the row.
+ **
+ ** @section pointers
+ ** - rgb: Read-only.
+ **
+ ** @section variables Internal Variables:
+ ** - @c h (uint32_t): Index position (alpha is always 255).
+ ** - @c slot (uint8_t*): Index entry, compared with its alpha so the
+ **   zero-initialised entries (alpha 0 for the decoder) never match.
+ ** - @c dr/@c dg/@c db (int8_t): Wrapped channel differences.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Extend a run while pixels repeat (runs continue across rows).
+ ** 2. Otherwise emit INDEX, DIFF, LUMA or RGB, in that order of preference.
+ ******************************************************************************
+ ******************************************************************************/
+static void qoi_row(shot_t *st, const uint8_t *rgb, int32_t w) {
+    for (int32_t x = 0; x < w; x++, rgb += 3) {
+        if (memcmp(rgb, st->qoi_prev, 3) == 0) {
+            if (++st->qoi_run == QOI_MAX_RUN) {
+                out_byte(st, (uint8_t)(QOI_OP_RUN | (st->qoi_run - 1)));
+                st->qoi_run = 0;
+            }
+            continue;
+        }
+        if (st->qoi_run) {
+            out_byte(st, (uint8_t)(QOI_OP_RUN | (st->qoi_run - 1)));
+            st->qoi_run = 0;
+        }
+
+        uint32_t h = (rgb[0] * 3u + rgb[1] * 5u + rgb[2] * 7u + 255u * 11u) % 64u;
+        uint8_t *slot = st->qoi_index[h];
+        if (slot[3] == 255 && memcmp(slot, rgb, 3) == 0) {
+            out_byte(st, (uint8_t)(QOI_OP_INDEX | h));
+        } else {
+            memcpy(slot, rgb, 3);
+            slot[3] = 255;
+            int8_t dr = (int8_t)(rgb[0] - st->qoi_prev[0]);
+            int8_t dg = (int8_t)(rgb[1] - st->qoi_prev[1]);
+            int8_t db = (int8_t)(rgb[2] - st->qoi_prev[2]);
+            int8_t dr_dg = (int8_t)(dr - dg);
+            int8_t db_dg = (int8_t)(db - dg);
+
+            if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                out_byte(st, (uint8_t)(QOI_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)));
+            } else if (dg >= -32 && dg <= 31 && dr_dg >= -8 && dr_dg <= 7 && db_dg >= -8 && db_dg <= 7) {
+                out_byte(st, (uint8_t)(QOI_OP_LUMA | (dg + 32)));
+                out_byte(st, (uint8_t)(((dr_dg + 8) << 4) | (db_dg + 8)));
+            } else {
+                out_byte(st, QOI_OP_RGB);
+                out_byte(st, rgb[0]);
+                out_byte(st, rgb[1]);
+                out_byte(st, rgb[2]);
+            }
+        }
+        memcpy(st->qoi_prev, rgb, 3);
+    }
+}
+
+static void qoi_end(shot_t *st) {
+    static const uint8_t padding[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+    if (st->qoi_run) out_byte(st, (uint8_t)(QOI_OP_RUN | (st->qoi_run - 1)));
+    for (uint8_t i = 0; i < sizeof(padding); i++) out_byte(st, padding[i]);
+    out_flush(st);
+}
+
+// ---------------------------------------------------------------- capture
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Converts one native pixel to 8-bit RGB.
+ **
+ ** @section call_site Called from:
+ ** - encode_rows().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (color format IDs)
+ **
+ ** @param cf (lv_color_format_t): Native format (checked at start).
+ ** @param px (const uint8_t*): Native pixel.
+ ** @param rgb (uint8_t*): Output, 3 bytes.
+ **
+ ** @section pointers
+ ** - rgb: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. RGB565: expand 5/6-bit channels by bit replication.
+ ** 2. 24/32-bit formats: reorder LVGL's B, G, R byte order.
+ ** 3. L8: replicate the luminance.
+ ******************************************************************************
+ ******************************************************************************/
+static void to_rgb(lv_color_format_t cf, const uint8_t *px, uint8_t *rgb) {
+    if (cf == LV_COLOR_FORMAT_RGB565) {
+        uint16_t v = (uint16_t)(px[0] | (px[1] << 8));
+        uint8_t r = (uint8_t)(v >> 11), g = (uint8_t)((v >> 5) & 0x3Fu), b = (uint8_t)(v & 0x1Fu);
+        rgb[0] = (uint8_t)((r << 3) | (r >> 2));
+        rgb[1] = (uint8_t)((g << 2) | (g >> 4));
+        rgb[2] = (uint8_t)((b << 3) | (b >> 2));
+    } else if (cf == LV_COLOR_FORMAT_L8) {
+        rgb[0] = rgb[1] = rgb[2] = px[0];
+    } else {
+        rgb[0] = px[2];
+        rgb[1] = px[1];
+        rgb[2] = px[0];
+    }
+}
+
+static bool format_supported(lv_color_format_t cf) {
+    return cf == LV_COLOR_FORMAT_RGB565 || cf == LV_COLOR_FORMAT_RGB888 ||
+           cf == LV_COLOR_FORMAT_XRGB8888 || cf == LV_COLOR_FORMAT_ARGB8888 ||
+           cf == LV_COLOR_FORMAT_L8;
+}
+
+static void encode_rows(shot_t *st, const uint8_t *src, uint32_t stride, int32_t rows) {
+    uint8_t rgb[3 * 32];  // Converted in groups of 32 pixels
+
+    for (int32_t y = 0; y < rows && !st->failed; y++, src += stride) {
+        if (st->format == MINIGUI_SCREENSHOT_PNG) z_byte(st, 1);
+        uint8_t left[3] = { 0, 0, 0 };
+
+        for (int32_t x = 0; x < st->hor_res; x += 32) {
+            int32_t n = LV_MIN(32, st->hor_res - x);
+            for (int32_t i = 0; i < n; i++) to_rgb(st->cf, src + (size_t)(x + i) * st->bpp, rgb + i * 3);
+
+            if (st->format == MINIGUI_SCREENSHOT_QOI) {
+                qoi_row(st, rgb, n);
+                continue;
+            }
+            for (int32_t i = 0; i < n * 3; i++) {
+                uint8_t v = rgb[i];
+                z_byte(st, (uint8_t)(v - left[i % 3]));
+                left[i % 3] = v;
+            }
+        }
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Encodes the rows of one flushed strip.
+ **
+ ** @section call_site Called from:
+ ** - LVGL, LV_EVENT_FLUSH_START during the forced refresh.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (active draw buffer)
+ **
+ ** @param e (lv_event_t*): Parameter is the flushed area; user data is the
+ **          capture state.
+ **
+ ** @section pointers
+ ** - buf: The display's active draw buffer, read before the driver sends it.
+ **
+ ** @section variables Internal Variables:
+ ** - @c full (bool): Buffer holds the whole screen (direct/full mode).
+ ** - @c first (int32_t): First row of the area not encoded yet.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Require full-width areas arriving top to bottom without gaps (what a
+ **    full-screen invalidation produces in every render mode).
+ ** 2. Locate the first new row in the draw buffer and encode the rows.
+ ******************************************************************************
+ ******************************************************************************/
+static void flush_start_cb(lv_event_t *e) {
+    shot_t *st = lv_event_get_user_data(e);
+    const lv_area_t *area = lv_event_get_param(e);
+    if (st->failed || !area || area->y2 < st->next_row) return;
+
+    if (area->x1 != 0 || area->x2 != st->hor_res - 1 || area->y1 > st->next_row) {
+        LV_LOG_WARN("MiniGUI: screenshot got an unexpected flush area");
+        st->failed = true;
+        return;
+    }
+
+    lv_draw_buf_t *buf = lv_display_get_buf_active(st->disp);
+    if (!buf || !buf->data) {
+        st->failed = true;
+        return;
+    }
+
+    bool full = buf->header.w == st->hor_res && buf->header.h == st->ver_res;
+    int32_t first = st->next_row;
+    const uint8_t *src = buf->data + (size_t)(full ? first : first - area->y1) * buf->header.stride;
+
+    encode_rows(st, src, buf->header.stride, area->y2 - first + 1);
+    st->next_row = area->y2 + 1;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Capture a display into an image stream.
+ **
+ ** @section call_site Called from:
+ ** - Application (support console, ticket upload).
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (invalidation, refresh, display events)
+ ** - minigui_alloc.h (encoder state)
+ **
+ ** @param disp (lv_display_t*): Display, NULL for the default.
+ ** @param format (minigui_screenshot_format_t): QOI or PNG.
+ ** @param write_cb (minigui_screenshot_write_cb_t): Byte sink.
+ ** @param user (void*): Passed to write_cb.
+ **
+ ** @section pointers
+ ** - st: Encoder state, internal pool, freed before return.
+ **
+ ** @section variables Internal Variables:
+ ** - @c ok (bool): Every row was encoded and written.
+ **
+ ** @return bool: true on success.
+ **
+ ** Implementation Steps:
+ ** 1. Resolve the display; reject rotation and unsupported formats.
+ ** 2. Allocate the state and write the file header.
+ ** 3. Hook FLUSH_START, invalidate the active screen, refresh now, unhook.
+ ** 4. Write the trailer if every row arrived.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_screenshot(lv_display_t *disp, minigui_screenshot_format_t format,
+                        minigui_screenshot_write_cb_t write_cb, void *user) {
+    if (!write_cb) return false;
+
+    MINIGUI_LOCK();
+    if (!disp) disp = lv_display_get_default();
+    if (!disp) {
+        MINIGUI_UNLOCK();
+        return false;
+    }
+
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    if (!format_supported(cf) || lv_display_get_rotation(disp) != LV_DISPLAY_ROTATION_0) {
+        LV_LOG_WARN("MiniGUI: screenshot needs an unrotated RGB565/RGB888/XRGB8888/L8 display");
+        MINIGUI_UNLOCK();
+        return false;
+    }
+
+    shot_t *st = minigui_malloc(MINIGUI_POOL_INTERNAL, sizeof(shot_t));
+    if (!st) {
+        MINIGUI_UNLOCK();
+        return false;
+    }
+    memset(st, 0, sizeof(*st));
+    st->format = format;
+    st->write_cb = write_cb;
+    st->user = user;
+    st->disp = disp;
+    st->cf = cf;
+    st->bpp = lv_color_format_get_size(cf);
+    st->hor_res = lv_display_get_horizontal_resolution(disp);
+    st->ver_res = lv_display_get_vertical_resolution(disp);
+
+    if (format == MINIGUI_SCREENSHOT_PNG) {
+        png_begin(st);
+    } else {
+        qoi_begin(st);
+    }
+
+    lv_display_add_event_cb(disp, flush_start_cb, LV_EVENT_FLUSH_START, st);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+    lv_display_remove_event_cb_with_user_data(disp, flush_start_cb, st);
+
+    bool ok = !st->failed && st->next_row == st->ver_res;
+    if (ok) {
+        if (format == MINIGUI_SCREENSHOT_PNG) {
+            png_end(st);
+        } else {
+            qoi_end(st);
+        }
+        ok = !st->failed;
+    }
+
+    minigui_free(MINIGUI_POOL_INTERNAL, st);
+    MINIGUI_UNLOCK();
+    return ok;
+}
@@ -0,0 +1,593 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Settings Schema Implementation.
+ **
+ **            All runtime state of a schema lives in one block from the
+ **            internal pool: the item table flattened to ids, one int32 per
+ **            item (the value, or the text offset for STRING items), the text
+ **            storage, the key index and the word index. Both indexes are
+ **            sorted once at registration; lookups and search are binary
+ **            searches.
+ **
+ **            @section minigui_settings.c - Settings values and indexes.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_settings.h"
+#include "minigui_alloc.h"
+#include "minigui_fmt.h"
+#include "minigui_lock.h"
+#include "minigui_store.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+/**
+ * @brief Runtime state of the registered schema (one allocation)
+ *
+ * Word index entries pack the item id (high 16 bits) and the offset of the
+ * word in the label (low 8 bits), so labels are indexed up to 255 chars.
+ */
+typedef struct {
+    const minigui_settings_schema_t *schema;
+    uint16_t count;
+    uint16_t word_count;
+    const minigui_setting_item_t **items;   // id -> item
+    int32_t *values;                        // id -> value (STRING: offset into text)
+    uint32_t *words;                        // Word index, sorted by folded label suffix
+    uint16_t *keys;                         // Ids sorted by key
+    uint16_t *group_first;                  // Group -> first id
+    char *text;                             // STRING storage (max + 1 per item)
+} settings_state_t;
+
+static settings_state_t *state;
+static minigui_settings_change_cb_t change_cb;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static char fold(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+static bool is_word_char(char c) {
+    c = fold(c);
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+}
+
+static const char *word_at(uint32_t entry) {
+    return state->items[entry >> 16]->label + (entry & 0xFFu);
+}
+
+static int fold_cmp(const char *a, const char *b) {
+    while (*a && fold(*a) == fold(*b)) {
+        a++;
+        b++;
+    }
+    return (int)(unsigned char)fold(*a) - (int)(unsigned char)fold(*b);
+}
+
+static bool fold_prefix(const char *str, const char *prefix) {
+    while (*prefix) {
+        if (fold(*str++) != fold(*prefix++)) return false;
+    }
+    return true;
+}
+
+static int word_sort_cmp(const void *a, const void *b) {
+    return fold_cmp(word_at(*(const uint32_t *)a), word_at(*(const uint32_t *)b));
+}
+
+static int key_sort_cmp(const void *a, const void *b) {
+    return strcmp(state->items[*(const uint16_t *)a]->key, state->items[*(const uint16_t *)b]->key);
+}
+
+static int id_sort_cmp(const void *a, const void *b) {
+    return (int)*(const uint16_t *)a - (int)*(const uint16_t *)b;
+}
+
+static uint16_t count_words(const char *label) {
+    uint16_t n = 0;
+    for (size_t i = 0; label[i] && i < 256; i++) {
+        if (is_word_char(label[i]) && (i == 0 || !is_word_char(label[i - 1]))) n++;
+    }
+    return n;
+}
+
+static char *text_of(uint16_t id) {
+    return state->text + state->values[id];
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Checks one item and returns the text storage it needs.
+ **
+ ** @section call_site Called from:
+ ** - minigui_settings_register() for every item.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param item (const minigui_setting_item_t*): Item to check.
+ ** @param text_len (size_t*): Incremented by the item's text storage.
+ **
+ ** @section pointers
+ ** - item: Schema data.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return bool: false if the item is malformed.
+ **
+ ** Implementation Steps:
+ ** 1. Require key and label.
+ ** 2. Check the default against the type's range.
+ ******************************************************************************
+ ******************************************************************************/
+static bool check_item(const minigui_setting_item_t *item, size_t *text_len) {
+    if (!item->key || !item->label) return false;
+
+    switch (item->type) {
+        case MINIGUI_SETTING_TYPE_BOOL:
+            return item->def == 0 || item->def == 1;
+        case MINIGUI_SETTING_TYPE_INT:
+            return item->step > 0 && item->min <= item->def && item->def <= item->max &&
+                   (item->def - item->min) % item->step == 0;
+        case MINIGUI_SETTING_TYPE_ENUM:
+            return item->def >= 0 && item->def < (int32_t)minigui_settings_option_count(item);
+        case MINIGUI_SETTING_TYPE_STRING:
+            if (item->max <= 0 || item->max > MINIGUI_SETTING_TEXT_MAX || (item->text && strlen(item->text) > (size_t)item->max)) return false;
+            *text_len += (size_t)item->max + 1;
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool accepts_int(const minigui_setting_item_t *item, int32_t value) {
+    switch (item->type) {
+        case MINIGUI_SETTING_TYPE_BOOL:
+            if (value != 0 && value != 1) return false;
+            break;
+        case MINIGUI_SETTING_TYPE_INT:
+            if (value < item->min || value > item->max || (value - item->min) % item->step) return false;
+            break;
+        case MINIGUI_SETTING_TYPE_ENUM:
+            if (value < 0 || value >= (int32_t)minigui_settings_option_count(item)) return false;
+            break;
+        default:
+            return false;
+    }
+    return !item->validate || item->validate(item, value, NULL);
+}
+
+/**
+ * @brief Persist a changed value (write-behind) and report it
+ */
+static void notify(uint16_t id) {
+    const minigui_setting_item_t *item = state->items[id];
+    if (item->type == MINIGUI_SETTING_TYPE_STRING) {
+        minigui_store_set_str(item->key, text_of(id));
+    } else {
+        minigui_store_set_i32(item->key, state->values[id]);
+    }
+    if (change_cb) change_cb(id, item);
+}
+
+/**
+ * @brief Replace a default with the stored value, if present and valid
+ */
+static void load_stored(uint16_t id) {
+    const minigui_setting_item_t *item = state->items[id];
+    if (item->type == MINIGUI_SETTING_TYPE_STRING) {
+        char buf[MINIGUI_SETTING_TEXT_MAX + 1];
+        int32_t len = minigui_store_get(item->key, buf, sizeof(buf) - 1);
+        if (len < 0 || len > item->max) return;
+        buf[len] = '\0';
+        if (strlen(buf) != (size_t)len || (item->validate && !item->validate(item, 0, buf))) return;
+        minigui_fmt_str(text_of(id), (size_t)item->max + 1, buf);
+    } else {
+        int32_t value;
+        if (minigui_store_get(item->key, &value, sizeof(value)) == (int32_t)sizeof(value) && accepts_int(item, value)) {
+            state->values[id] = value;
+        }
+    }
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Register the schema and load every value (stored or default).
+ **
+ ** @section call_site Called from:
+ ** - Application startup, benchmarks.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_alloc.h (internal pool)
+ ** - stdlib.h (qsort)
+ **
+ ** @param schema (const minigui_settings_schema_t*): Schema, or NULL.
+ **
+ ** @section pointers
+ ** - schema: Referenced until the next registration.
+ **
+ ** @section variables Internal Variables:
+ ** - @c count / @c word_count / @c text_len: Sizes of the storage areas.
+ ** - @c s (settings_state_t*): New state; storage areas follow the header,
+ **   ordered by alignment (pointers, 32-bit, 16-bit, text).
+ **
+ ** @return bool: true if registered.
+ **
+ ** Implementation Steps:
+ ** 1. Drop the previous state under the lock.
+ ** 2. Check every item and size the storage.
+ ** 3. Allocate one block and carve the areas.
+ ** 4. Flatten items to ids, fill defaults, build word and key entries.
+ ** 5. Sort both indexes; reject duplicate keys.
+ ** 6. Replace defaults with valid values from the settings store.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_settings_register(const minigui_settings_schema_t *schema) {
+    MINIGUI_LOCK();
+    if (state) {
+        minigui_free(MINIGUI_POOL_INTERNAL, state);
+        state = NULL;
+    }
+    if (!schema) {
+        MINIGUI_UNLOCK();
+        return true;
+    }
+
+    uint32_t count = 0;
+    uint32_t word_count = 0;
+    size_t text_len = 0;
+    for (uint8_t g = 0; g < schema->group_count; g++) {
+        const minigui_setting_group_t *group = &schema->groups[g];
+        for (uint16_t i = 0; i < group->count; i++) {
+            const minigui_setting_item_t *item = &group->items[i];
+            if (!check_item(item, &text_len)) {
+                LV_LOG_ERROR("Settings: invalid item '%s'", item->key ? item->key : "?");
+                MINIGUI_UNLOCK();
+                return false;
+            }
+            word_count += count_words(item->label);
+        }
+        count += group->count;
+    }
+    if (count >= MINIGUI_SETTING_NONE) {
+        LV_LOG_ERROR("Settings: too many items (%lu)", (unsigned long)count);
+        MINIGUI_UNLOCK();
+        return false;
+    }
+
+    size_t size = sizeof(settings_state_t) +
+                  count * sizeof(const minigui_setting_item_t *) +
+                  count * sizeof(int32_t) + word_count * sizeof(uint32_t) +
+                  (count + schema->group_count) * sizeof(uint16_t) + text_len;
+    settings_state_t *s = (settings_state_t *)minigui_malloc(MINIGUI_POOL_INTERNAL, size);
+    if (!s) {
+        LV_LOG_ERROR("Settings: out of memory (%lu bytes)", (unsigned long)size);
+        MINIGUI_UNLOCK();
+        return false;
+    }
+
+    s->schema = schema;
+    s->count = (uint16_t)count;
+    s->word_count = (uint16_t)word_count;
+    s->items = (const minigui_setting_item_t **)(s + 1);
+    s->values = (int32_t *)(s->items + count);
+    s->words = (uint32_t *)(s->values + count);
+    s->keys = (uint16_t *)(s->words + word_count);
+    s->group_first = s->keys + count;
+    s->text = (char *)(s->group_first + schema->group_count);
+    state = s;
+
+    uint16_t id = 0;
+    uint32_t w = 0;
+    int32_t text_off = 0;
+    for (uint8_t g = 0; g < schema->group_count; g++) {
+        const minigui_setting_group_t *group = &schema->groups[g];
+        s->group_first[g] = id;
+        for (uint16_t i = 0; i < group->count; i++, id++) {
+            const minigui_setting_item_t *item = &group->items[i];
+            s->items[id] = item;
+            s->keys[id] = id;
+            if (item->type == MINIGUI_SETTING_TYPE_STRING) {
+                s->values[id] = text_off;
+                minigui_fmt_str(s->text + text_off, (size_t)item->max + 1, item->text);
+                text_off += item->max + 1;
+            } else {
+                s->values[id] = item->def;
+            }
+
+            const char *label = item->label;
+            for (size_t c = 0; label[c] && c < 256; c++) {
+                if (is_word_char(label[c]) && (c == 0 || !is_word_char(label[c - 1]))) {
+                    s->words[w++] = ((uint32_t)id << 16) | (uint32_t)c;
+                }
+            }
+        }
+    }
+
+    qsort(s->words, s->word_count, sizeof(uint32_t), word_sort_cmp);
+    qsort(s->keys, s->count, sizeof(uint16_t), key_sort_cmp);
+    for (uint16_t i = 1; i < s->count; i++) {
+        if (strcmp(s->items[s->keys[i - 1]]->key, s->items[s->keys[i]]->key) == 0) {
+            LV_LOG_ERROR("Settings: duplicate key '%s'", s->items[s->keys[i]]->key);
+            minigui_free(MINIGUI_POOL_INTERNAL, s);
+            state = NULL;
+            MINIGUI_UNLOCK();
+            return false;
+        }
+    }
+
+    for (uint16_t i = 0; i < s->count; i++) load_stored(i);
+
+    LV_LOG_INFO("Settings: %u items in %u groups, %u indexed words, %lu bytes",
+                (unsigned)s->count, (unsigned)schema->group_count, (unsigned)s->word_count, (unsigned long)size);
+    MINIGUI_UNLOCK();
+    return true;
+}
+
+const minigui_settings_schema_t *minigui_settings_get_schema(void) {
+    return state ? state->schema : NULL;
+}
+
+uint16_t minigui_settings_get_count(void) {
+    return state ? state->count : 0;
+}
+
+const minigui_setting_item_t *minigui_settings_get_item(uint16_t id) {
+    return (state && id < state->count) ? state->items[id] : NULL;
+}
+
+uint16_t minigui_settings_group_first(uint8_t group) {
+    return (state && group < state->schema->group_count) ? state->group_first[group] : MINIGUI_SETTING_NONE;
+}
+
+uint16_t minigui_settings_find(const char *key) {
+    if (!state || !key) return MINIGUI_SETTING_NONE;
+
+    uint16_t lo = 0;
+    uint16_t hi = state->count;
+    while (lo < hi) {
+        uint16_t mid = (uint16_t)((lo + hi) / 2u);
+        int cmp = strcmp(state->items[state->keys[mid]]->key, key);
+        if (cmp == 0) return state->keys[mid];
+        if (cmp < 0) {
+            lo = (uint16_t)(mid + 1u);
+        } else {
+            hi = mid;
+        }
+    }
+    return MINIGUI_SETTING_NONE;
+}
+
+int32_t minigui_settings_get_int(uint16_t id) {
+    MINIGUI_LOCK();
+    int32_t value = 0;
+    if (state && id < state->count && state->items[id]->type != MINIGUI_SETTING_TYPE_STRING) {
+        value = state->values[id];
+    }
+    MINIGUI_UNLOCK();
+    return value;
+}
+
+size_t minigui_settings_get_str(uint16_t id, char *buf, size_t size) {
+    MINIGUI_LOCK();
+    size_t n = 0;
+    if (state && id < state->count && state->items[id]->type == MINIGUI_SETTING_TYPE_STRING) {
+        n = minigui_fmt_str(buf, size, text_of(id));
+    } else if (buf && size) {
+        buf[0] = '\0';
+    }
+    MINIGUI_UNLOCK();
+    return n;
+}
+
+bool minigui_settings_set_int(uint16_t id, int32_t value) {
+    MINIGUI_LOCK();
+    if (!state || id >= state->count || !accepts_int(state->items[id], value)) {
+        MINIGUI_UNLOCK();
+        return false;
+    }
+    if (state->values[id] != value) {
+        state->values[id] = value;
+        notify(id);
+    }
+    MINIGUI_UNLOCK();
+    return true;
+}
+
+bool minigui_settings_set_str(uint16_t id, const char *text) {
+    if (!text) text = "";
+
+    MINIGUI_LOCK();
+    const minigui_setting_item_t *item = (state && id < state->count) ? state->items[id] : NULL;
+    if (!item || item->type != MINIGUI_SETTING_TYPE_STRING || strlen(text) > (size_t)item->max ||
+        (item->validate && !item->validate(item, 0, text))) {
+        MINIGUI_UNLOCK();
+        return false;
+    }
+    if (strcmp(text_of(id), text) != 0) {
+        minigui_fmt_str(text_of(id), (size_t)item->max + 1, text);
+        notify(id);
+    }
+    MINIGUI_UNLOCK();
+    return true;
+}
+
+void minigui_settings_reset(void) {
+    MINIGUI_LOCK();
+    for (uint16_t id = 0; state && id < state->count; id++) {
+        const minigui_setting_item_t *item = state->items[id];
+        if (item->type == MINIGUI_SETTING_TYPE_STRING) {
+            minigui_settings_set_str(id, item->text);
+        } else {
+            minigui_settings_set_int(id, item->def);
+        }
+    }
+    MINIGUI_UNLOCK();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Format a value as shown in the panel.
+ **
+ ** @section call_site Called from:
+ ** - Settings schema rows when they are bound or changed.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_fmt.h (integer formatting)
+ **
+ ** @param id (uint16_t): Item id.
+ ** @param buf (char*): Output buffer.
+ ** @param size (size_t): Capacity of buf.
+ **
+ ** @section pointers
+ ** - buf: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c opt (const char*): Start of the selected ENUM option.
+ **
+ ** @return size_t: Characters written.
+ **
+ ** Implementation Steps:
+ ** 1. BOOL: "On"/"Off"; INT: value and unit; STRING: the text.
+ ** 2. ENUM: skip to the selected option and copy it up to its '\n'.
+ ******************************************************************************
+ ******************************************************************************/
+size_t minigui_settings_format(uint16_t id, char *buf, size_t size) {
+    MINIGUI_LOCK();
+    const minigui_setting_item_t *item = (state && id < state->count) ? state->items[id] : NULL;
+    size_t n = 0;
+
+    if (!item) {
+        n = minigui_fmt_str(buf, size, "");
+    } else if (item->type == MINIGUI_SETTING_TYPE_BOOL) {
+        n = minigui_fmt_str(buf, size, state->values[id] ? "On" : "Off");
+    } else if (item->type == MINIGUI_SETTING_TYPE_INT) {
+        n = minigui_fmt_i32(buf, size, state->values[id]);
+        if (item->unit) {
+            n += minigui_fmt_str(buf + n, size - n, " ");
+            n += minigui_fmt_str(buf + n, size - n, item->unit);
+        }
+    } else if (item->type == MINIGUI_SETTING_TYPE_ENUM) {
+        const char *opt = item->text;
+        for (int32_t i = 0; i < state->values[id] && opt; i++) {
+            opt = strchr(opt, '\n');
+            if (opt) opt++;
+        }
+        const char *end = opt ? strchr(opt, '\n') : NULL;
+        size_t len = opt ? (end ? (size_t)(end - opt) : strlen(opt)) : 0;
+        if (size) {
+            n = len < size - 1 ? len : size - 1;
+            memcpy(buf, opt ? opt : "", n);
+            buf[n] = '\0';
+        }
+    } else {
+        n = minigui_fmt_str(buf, size, text_of(id));
+    }
+
+    MINIGUI_UNLOCK();
+    return n;
+}
+
+uint16_t minigui_settings_option_count(const minigui_setting_item_t *item) {
+    if (!item || item->type != MINIGUI_SETTING_TYPE_ENUM || !item->text) return 0;
+    uint16_t n = 1;
+    for (const char *p = item->text; *p; p++) {
+        if (*p == '\n') n++;
+    }
+    return n;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Find items whose name contains a word starting with a query.
+ **
+ ** @section call_site Called from:
+ ** - Settings search field.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdlib.h (qsort)
+ **
+ ** @param query (const char*): Case-insensitive prefix.
+ ** @param ids (uint16_t*): Output ids.
+ ** @param max (uint16_t): Capacity of ids.
+ **
+ ** @section pointers
+ ** - ids: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c lo / @c hi (uint16_t): Binary search bounds over the word index.
+ **
+ ** @return uint16_t: Ids written.
+ **
+ ** Implementation Steps:
+ ** 1. Lower-bound the query in the word index (sorted by folded suffix).
+ ** 2. Walk forward while the suffix starts with the query.
+ ** 3. Sort the ids and remove duplicates.
+ ******************************************************************************
+ ******************************************************************************/
+uint16_t minigui_settings_search(const char *query, uint16_t *ids, uint16_t max) {
+    if (!query || !*query || !ids || !max) return 0;
+
+    MINIGUI_LOCK();
+    uint16_t n = 0;
+    if (state) {
+        uint16_t lo = 0;
+        uint16_t hi = state->word_count;
+        while (lo < hi) {
+            uint16_t mid = (uint16_t)((lo + hi) / 2u);
+            if (fold_cmp(word_at(state->words[mid]), query) < 0) {
+                lo = (uint16_t)(mid + 1u);
+            } else {
+                hi = mid;
+            }
+        }
+        for (uint16_t i = lo; i < state->word_count && n < max; i++) {
+            if (!fold_prefix(word_at(state->words[i]), query)) break;
+            ids[n++] = (uint16_t)(state->words[i] >> 16);
+        }
+    }
+    MINIGUI_UNLOCK();
+
+    qsort(ids, n, sizeof(uint16_t), id_sort_cmp);
+    uint16_t unique = 0;
+    for (uint16_t i = 0; i < n; i++) {
+        if (unique == 0 || ids[unique - 1] != ids[i]) ids[unique++] = ids[i];
+    }
+    return unique;
+}
+
+void minigui_settings_register_change_cb(minigui_settings_change_cb_t cb) {
+    MINIGUI_LOCK();
+    change_cb = cb;
+    MINIGUI_UNLOCK();
+}
@@ -0,0 +1,213 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI SHA-256 Implementation.
+ **
+ **            Portable FIPS 180-4 compression with a 16-word rolling message
+ **            schedule (64 bytes of stack instead of 256).
+ **
+ **            @section minigui_sha256.c - Incremental SHA-256.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_sha256.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+static const uint32_t round_k[64] = {
+    0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u, 0x3956c25bu, 0x59f111f1u, 0x923f82a4u, 0xab1c5ed5u,
+    0xd807aa98u, 0x12835b01u, 0x243185beu, 0x550c7dc3u, 0x72be5d74u, 0x80deb1feu, 0x9bdc06a7u, 0xc19bf174u,
+    0xe49b69c1u, 0xefbe4786u, 0x0fc19dc6u, 0x240ca1ccu, 0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau,
+    0x983e5152u, 0xa831c66du, 0xb00327c8u, 0xbf597fc7u, 0xc6e00bf3u, 0xd5a79147u, 0x06ca6351u, 0x14292967u,
+    0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu, 0x53380d13u, 0x650a7354u, 0x766a0abbu, 0x81c2c92eu, 0x92722c85u,
+    0xa2bfe8a1u, 0xa81a664bu, 0xc24b8b70u, 0xc76c51a3u, 0xd192e819u, 0xd6990624u, 0xf40e3585u, 0x106aa070u,
+    0x19a4c116u, 0x1e376c08u, 0x2748774cu, 0x34b0bcb5u, 0x391c0cb3u, 0x4ed8aa4au, 0x5b9cca4fu, 0x682e6ff3u,
+    0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u, 0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u,
+};
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static uint32_t rotr(uint32_t x, unsigned n) {
+    return (x >> n) | (x << (32u - n));
+}
+
+static uint32_t load_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static void store_be32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Compresses one 64-byte block into the state.
+ **
+ ** @section call_site Called from:
+ ** - minigui_sha256_update(), minigui_sha256_final().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param state (uint32_t[8]): Hash state.
+ ** @param block (const uint8_t*): 64 input bytes.
+ **
+ ** @section pointers
+ ** - block: Read-only.
+ **
+ ** @section variables Internal Variables:
+ ** - @c w (uint32_t[16]): Message schedule, extended in place (w[i & 15]).
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Load the block big-endian.
+ ** 2. Run 64 rounds, computing schedule words 16..63 on the fly.
+ ** 3. Add the working variables to the state.
+ ******************************************************************************
+ ******************************************************************************/
+static void compress(uint32_t state[8], const uint8_t *block) {
+    uint32_t w[16];
+    for (int i = 0; i < 16; i++) w[i] = load_be32(block + 4 * i);
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (int i = 0; i < 64; i++) {
+        if (i >= 16) {
+            uint32_t w15 = w[(i + 1) & 15];
+            uint32_t w2 = w[(i + 14) & 15];
+            uint32_t s0 = rotr(w15, 7) ^ rotr(w15, 18) ^ (w15 >> 3);
+            uint32_t s1 = rotr(w2, 17) ^ rotr(w2, 19) ^ (w2 >> 10);
+            w[i & 15] += s0 + w[(i + 9) & 15] + s1;
+        }
+        uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + round_k[i] + w[i & 15];
+        uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+void minigui_sha256_init(minigui_sha256_t *ctx) {
+    static const uint32_t iv[8] = {
+        0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au, 0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u,
+    };
+    memcpy(ctx->state, iv, sizeof(iv));
+    ctx->bytes = 0;
+}
+
+void minigui_sha256_update(minigui_sha256_t *ctx, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    size_t used = (size_t)(ctx->bytes & 63u);
+    ctx->bytes += len;
+
+    if (used) {
+        size_t take = 64u - used < len ? 64u - used : len;
+        memcpy(ctx->block + used, p, take);
+        p += take;
+        len -= take;
+        if (used + take < 64u) return;
+        compress(ctx->state, ctx->block);
+    }
+    for (; len >= 64u; p += 64, len -= 64u) compress(ctx->state, p);
+    if (len) memcpy(ctx->block, p, len);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Finish and write the digest.
+ **
+ ** @section call_site Called from:
+ ** - Firmware update verification, tools.
+ **
+ ** @section dependencies Required Headers:
+ ** - string.h (memset)
+ **
+ ** @param ctx (minigui_sha256_t*): Hash state.
+ ** @param digest (uint8_t[32]): Output.
+ **
+ ** @section pointers
+ ** - ctx, digest: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c used (size_t): Bytes in the partial block.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Append 0x80 and zero-pad; use an extra block if the length field
+ **    does not fit.
+ ** 2. Append the bit length big-endian and compress.
+ ** 3. Store the state big-endian.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_sha256_final(minigui_sha256_t *ctx, uint8_t digest[MINIGUI_SHA256_SIZE]) {
+    size_t used = (size_t)(ctx->bytes & 63u);
+    uint64_t bits = ctx->bytes * 8u;
+
+    ctx->block[used++] = 0x80;
+    if (used > 56u) {
+        memset(ctx->block + used, 0, 64u - used);
+        compress(ctx->state, ctx->block);
+        used = 0;
+    }
+    memset(ctx->block + used, 0, 56u - used);
+    store_be32(ctx->block + 56, (uint32_t)(bits >> 32));
+    store_be32(ctx->block + 60, (uint32_t)bits);
+    compress(ctx->state, ctx->block);
+
+    for (int i = 0; i < 8; i++) store_be32(digest + 4 * i, ctx->state[i]);
+}
+
+void minigui_sha256_hex(const uint8_t digest[MINIGUI_SHA256_SIZE], char *out) {
+    static const char hex[] = "0123456789abcdef";
+    for (int i = 0; i < MINIGUI_SHA256_SIZE; i++) {
+        out[2 * i] = hex[digest[i] >> 4];
+        out[2 * i + 1] = hex[digest[i] & 0x0F];
+    }
+    out[2 * MINIGUI_SHA256_SIZE] = '\0';
+}
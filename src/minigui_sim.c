@@ -0,0 +1,670 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Synthetic Load Providers Implementation.
+ **
+ **            Provider callbacks that inject latency, jitter and failures,
+ **            return large Wi-Fi lists, flap the network link, random-walk the
+ **            system statistics and push log bursts into the log store.
+ **
+ **            @section minigui_sim.c - Synthetic provider implementation.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>    // For burst timestamps
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_sim.h"
+#include "minigui.h"
+#include "minigui_fmt.h"
+#include "minigui_lock.h"
+#include "minigui_wifi.h"
+#if MINIGUI_ENABLE_NETDIAG
+#include "minigui_netdiag.h"
+#endif
+#if MINIGUI_ENABLE_LOGS
+#include "minigui_log_store.h"
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Active simulation configuration.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_sim.c.
+ **
+ ** @section rationale Rationale:
+ ** - Copied at install time so callers may pass a stack structure.
+ ******************************************************************************
+ ******************************************************************************/
+static minigui_sim_cfg_t sim_cfg;
+
+// Generator and random-walk state
+static uint32_t sim_rng = 1;
+static bool sim_connected = true;
+static int32_t sim_cpu = 30;            // %
+static int32_t sim_ram_used_kb = 160;   // KB
+static int32_t sim_voltage_mv = 5000;   // mV
+
+// Log burst timer and counters
+static lv_timer_t *burst_timer = NULL;
+static lv_timer_t *apply_timer = NULL;        // Steps the simulated Wi-Fi apply
+static uint32_t apply_request;
+static minigui_wifi_apply_stage_t apply_stage;
+static minigui_sim_stats_t sim_stats;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief xorshift32 pseudo random generator.
+ **
+ ** @section call_site Called from:
+ ** - All synthetic providers.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return uint32_t: Next pseudo random value.
+ **
+ ** Implementation Steps:
+ ** 1. Advance @c sim_rng with the 13/17/5 xorshift sequence.
+ ******************************************************************************
+ ******************************************************************************/
+static uint32_t sim_rand(void) {
+    sim_rng ^= sim_rng << 13;
+    sim_rng ^= sim_rng >> 17;
+    sim_rng ^= sim_rng << 5;
+    return sim_rng;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Random walk step clamped to a range.
+ **
+ ** @section call_site Called from:
+ ** - sim_get_system_stats().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param value (int32_t): Current value.
+ ** @param step (int32_t): Maximum step magnitude.
+ ** @param lo (int32_t): Lower bound.
+ ** @param hi (int32_t): Upper bound.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return int32_t: New value within [lo, hi].
+ **
+ ** Implementation Steps:
+ ** 1. Add a uniform step in [-step, +step].
+ ** 2. Clamp to the bounds.
+ ******************************************************************************
+ ******************************************************************************/
+static int32_t walk(int32_t value, int32_t step, int32_t lo, int32_t hi) {
+    if (step > 0) {
+        value += (int32_t)(sim_rand() % (uint32_t)(2 * step + 1)) - step;
+    }
+    if (value < lo) value = lo;
+    if (value > hi) value = hi;
+    return value;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Injects latency and decides whether the call fails.
+ **
+ ** @section call_site Called from:
+ ** - The start of every synthetic provider.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (lv_delay_ms)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c stall (uint32_t): Latency for this call.
+ **
+ ** @return bool: true if the call should fail.
+ **
+ ** Implementation Steps:
+ ** 1. Count the call.
+ ** 2. Block for latency plus random jitter (this runs on the caller's
+ **    task, exactly like a slow hardware provider would).
+ ** 3. Roll the failure probability.
+ ******************************************************************************
+ ******************************************************************************/
+static bool sim_begin_call(void) {
+    sim_stats.calls++;
+
+    uint32_t stall = sim_cfg.latency_ms;
+    if (sim_cfg.jitter_ms) stall += sim_rand() % (sim_cfg.jitter_ms + 1u);
+    if (stall) {
+        lv_delay_ms(stall);
+        sim_stats.stall_ms += stall;
+    }
+
+    if (sim_cfg.failure_pct && (sim_rand() % 100) < sim_cfg.failure_pct) {
+        sim_stats.failures++;
+        return true;
+    }
+    return false;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Synthetic Wi-Fi scan provider.
+ **
+ ** @section call_site Called from:
+ ** - minigui_scan_wifi() once installed.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdio.h (snprintf)
+ **
+ ** @param networks (minigui_wifi_network_t*): Output buffer.
+ ** @param max_count (size_t): Buffer capacity.
+ **
+ ** @section pointers
+ ** - networks: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return size_t: Networks written (0 on injected failure).
+ **
+ ** Implementation Steps:
+ ** 1. Stall / fail as configured.
+ ** 2. Emit up to @c wifi_count networks with random RSSI.
+ ******************************************************************************
+ ******************************************************************************/
+static size_t sim_scan_wifi(minigui_wifi_network_t *networks, size_t max_count) {
+    if (sim_begin_call()) return 0;
+
+    size_t count = sim_cfg.wifi_count < max_count ? sim_cfg.wifi_count : max_count;
+    for (size_t i = 0; i < count; i++) {
+        snprintf(networks[i].ssid, sizeof(networks[i].ssid), "SIM_AP_%03u", (unsigned)i);
+        networks[i].rssi = (int8_t)(-30 - (int32_t)(sim_rand() % 66)); // -30..-95 dBm
+    }
+    return count;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Synthetic system statistics provider.
+ **
+ ** @section call_site Called from:
+ ** - minigui_get_system_stats() once installed.
+ **
+ ** @section dependencies Required Headers:
+ ** - string.h (memset)
+ **
+ ** @param stats (minigui_system_stats_t*): Output.
+ **
+ ** @section pointers
+ ** - stats: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Stall / fail as configured; a failure reports all-zero statistics.
+ ** 2. Random-walk CPU, RAM and voltage and fill the structure.
+ ******************************************************************************
+ ******************************************************************************/
+static void sim_get_system_stats(minigui_system_stats_t *stats) {
+    if (sim_begin_call()) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+
+    sim_cpu = walk(sim_cpu, sim_cfg.cpu_step_pct, 0, 100);
+    sim_ram_used_kb = walk(sim_ram_used_kb, sim_cfg.ram_step_kb, 52, 494);
+    sim_voltage_mv = walk(sim_voltage_mv, sim_cfg.voltage_step_mv, 4500, 5300);
+
+    stats->voltage = (float)sim_voltage_mv / 1000.0f;
+    stats->cpu_usage = (uint8_t)sim_cpu;
+    stats->flash_used_kb = 1536;
+    stats->flash_total_kb = 4096;
+    stats->ram_used_kb = (uint32_t)sim_ram_used_kb;
+    stats->ram_total_kb = 520;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Synthetic network status provider.
+ **
+ ** @section call_site Called from:
+ ** - minigui_get_network_status() once installed.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_fmt.h (bounded string copies)
+ **
+ ** @param status (minigui_network_status_t*): Output.
+ **
+ ** @section pointers
+ ** - status: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Stall / fail as configured; a failure reports "not connected".
+ ** 2. Flip the link state with @c disconnect_pct probability.
+ ** 3. Fill SSID/IP/MAC for the current state.
+ ******************************************************************************
+ ******************************************************************************/
+static void sim_get_network_status(minigui_network_status_t *status) {
+    memset(status, 0, sizeof(*status));
+    if (sim_begin_call()) return;
+
+    if (sim_cfg.disconnect_pct && (sim_rand() % 100) < sim_cfg.disconnect_pct) {
+        sim_connected = !sim_connected;
+        sim_stats.disconnects++;
+    }
+
+    status->connected = sim_connected;
+    minigui_fmt_str(status->mac_address, sizeof(status->mac_address), "02:00:00:5E:10:01");
+    if (sim_connected) {
+        minigui_fmt_str(status->ssid, sizeof(status->ssid), "SIM_AP_000");
+        minigui_fmt_str(status->ip_address, sizeof(status->ip_address), "10.0.0.42");
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Advances the simulated Wi-Fi apply by one stage.
+ **
+ ** @section call_site Called from:
+ ** - @c apply_timer every 600 ms plus the configured latency.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_wifi.h (stage reports)
+ **
+ ** @param timer (lv_timer_t*): Triggering timer.
+ **
+ ** @section pointers
+ ** - timer: Owned by this module, deleted at the final stage.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Walk SAVED, ASSOCIATING, DHCP, CONNECTED; association fails with the
+ **    configured failure probability.
+ ** 2. Report the stage and stop at a final one (a successful connect also
+ **    flips the simulated link up).
+ ******************************************************************************
+ ******************************************************************************/
+static void apply_timer_cb(lv_timer_t *timer) {
+    if (apply_stage == MINIGUI_WIFI_APPLY_ASSOCIATING && sim_cfg.failure_pct &&
+        (sim_rand() % 100) < sim_cfg.failure_pct) {
+        sim_stats.failures++;
+        apply_stage = MINIGUI_WIFI_APPLY_FAILED;
+    } else {
+        apply_stage = (minigui_wifi_apply_stage_t)(apply_stage + 1);
+    }
+
+    if (apply_stage >= MINIGUI_WIFI_APPLY_CONNECTED) {
+        if (apply_stage == MINIGUI_WIFI_APPLY_CONNECTED) sim_connected = true;
+        lv_timer_delete(timer);
+        apply_timer = NULL;
+    }
+    minigui_wifi_apply_report(apply_request, apply_stage);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Abandons the simulated Wi-Fi apply.
+ **
+ ** @section call_site Called from:
+ ** - minigui_wifi.c on cancel or timeout (registered cancel callback).
+ ** - sim_wifi_apply() before a new request, minigui_sim_uninstall().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (timer)
+ **
+ ** @param request (uint32_t): Request to abandon; only one runs at a time,
+ **        so it is not checked.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Delete the stage timer if it runs; no further stage is reported.
+ ******************************************************************************
+ ******************************************************************************/
+static void sim_wifi_cancel(uint32_t request) {
+    (void)request;
+    if (apply_timer) {
+        lv_timer_delete(apply_timer);
+        apply_timer = NULL;
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Synthetic asynchronous apply: stages arrive from a timer.
+ **
+ ** @section call_site Called from:
+ ** - minigui_wifi_apply() (registered apply callback), LVGL lock held.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_wifi.h (stages)
+ ** - lvgl.h (timer)
+ **
+ ** @param creds (const minigui_wifi_credentials_t*): Ignored; nothing is
+ **        stored.
+ ** @param request (uint32_t): Id echoed in every stage report.
+ **
+ ** @section pointers
+ ** - creds: Not referenced.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return bool: false if the stage timer could not be created.
+ **
+ ** Implementation Steps:
+ ** 1. Count the call and abandon a previous request.
+ ** 2. Start at SAVING and create the stage timer (600 ms plus the
+ **    configured latency); apply_timer_cb() reports the following stages.
+ ******************************************************************************
+ ******************************************************************************/
+static bool sim_wifi_apply(const minigui_wifi_credentials_t *creds, uint32_t request) {
+    (void)creds;
+    sim_stats.calls++;
+    sim_wifi_cancel(0);
+    apply_request = request;
+    apply_stage = MINIGUI_WIFI_APPLY_SAVING;
+    apply_timer = lv_timer_create(apply_timer_cb, 600u + sim_cfg.latency_ms, NULL);
+    return apply_timer != NULL;
+}
+
+#if MINIGUI_ENABLE_LOGS
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Pushes one burst of synthetic log lines into the log store.
+ **
+ ** @section call_site Called from:
+ ** - @c burst_timer every @c log_burst_period_ms.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_log_store.h (ingestion)
+ ** - time.h (timestamps)
+ **
+ ** @param timer (lv_timer_t*): Triggering timer.
+ **
+ ** @section pointers
+ ** - timer: Owned by LVGL.
+ **
+ ** @section variables Internal Variables:
+ ** - @c entry (minigui_log_entry_t): Line being generated.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Format the current wall-clock time once for the burst.
+ ** 2. Push @c log_burst_size lines with random source, level and message.
+ ******************************************************************************
+ ******************************************************************************/
+static void burst_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    static const char *sources[] = {"ESP", "LVGL", "USER", "WIFI"};
+    static const char *levels[] = {"DEBUG", "INFO", "INFO", "WARN", "ERROR"};
+    static const char *messages[] = {
+        "Heap watermark updated",
+        "Sensor poll completed",
+        "Retrying connection to broker",
+        "Frame took longer than budget",
+        "Configuration value changed",
+        "Queue depth above threshold"
+    };
+
+    minigui_log_entry_t entry;
+    time_t now = time(NULL);
+    struct tm *tm_info = localtime(&now);
+    strftime(entry.timestamp, sizeof(entry.timestamp), "%H:%M:%S", tm_info);
+
+    for (uint16_t i = 0; i < sim_cfg.log_burst_size; i++) {
+        strncpy(entry.source, sources[sim_rand() % 4], sizeof(entry.source) - 1);
+        entry.source[sizeof(entry.source) - 1] = '\0';
+        strncpy(entry.level, levels[sim_rand() % 5], sizeof(entry.level) - 1);
+        entry.level[sizeof(entry.level) - 1] = '\0';
+        snprintf(entry.message, sizeof(entry.message), "%s (#%lu)",
+                 messages[sim_rand() % 6], (unsigned long)sim_stats.log_lines);
+        minigui_log_store_push(&entry);
+        sim_stats.log_lines++;
+    }
+}
+#endif // MINIGUI_ENABLE_LOGS
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Fill a configuration with production-like defaults.
+ **
+ ** @section call_site Called from:
+ ** - Simulator setup before minigui_sim_install().
+ **
+ ** @section dependencies Required Headers:
+ ** - string.h (memset)
+ **
+ ** @param cfg (minigui_sim_cfg_t*): Output.
+ **
+ ** @section pointers
+ ** - cfg: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Zero the structure and set moderate stall, failure and burst values.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_sim_default_cfg(minigui_sim_cfg_t *cfg) {
+    if (!cfg) return;
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->latency_ms = 20;
+    cfg->jitter_ms = 30;
+    cfg->failure_pct = 2;
+    cfg->wifi_count = 40;
+    cfg->disconnect_pct = 5;
+    cfg->log_burst_size = 20;
+    cfg->log_burst_period_ms = 2000;
+    cfg->cpu_step_pct = 8;
+    cfg->ram_step_kb = 12;
+    cfg->voltage_step_mv = 40;
+    cfg->seed = 0x5EED1234u;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Register the synthetic providers and start log bursts.
+ **
+ ** @section call_site Called from:
+ ** - Simulator / benchmark setup.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui.h (provider registration)
+ ** - lvgl.h (timer, lock)
+ **
+ ** @param cfg (const minigui_sim_cfg_t*): Behaviour to simulate.
+ **
+ ** @section pointers
+ ** - cfg: Read-only, copied.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Copy configuration, reset counters and seed the generator.
+ ** 2. Register the three providers, the asynchronous Wi-Fi apply and a
+ **    diagnostics stand-in with the same latency, jitter and failure rate.
+ ** 3. (Re)create the burst timer under the LVGL lock.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_sim_install(const minigui_sim_cfg_t *cfg) {
+    if (!cfg) return;
+
+    sim_cfg = *cfg;
+    sim_rng = cfg->seed ? cfg->seed : 0x5EED1234u;
+    memset(&sim_stats, 0, sizeof(sim_stats));
+
+    minigui_register_wifi_scan_provider(sim_scan_wifi);
+    minigui_register_system_stats_provider(sim_get_system_stats);
+    minigui_register_network_status_provider(sim_get_network_status);
+    minigui_register_wifi_apply_cb(sim_wifi_apply, sim_wifi_cancel);
+#if MINIGUI_ENABLE_NETDIAG
+    const minigui_netdiag_loopback_t probes = {
+        .latency_ms = sim_cfg.latency_ms, .jitter_ms = sim_cfg.jitter_ms, .loss_pct = sim_cfg.failure_pct,
+        .device_us = 500, .rate_bps = 256u * 1024u,
+    };
+    minigui_register_netdiag_transport(minigui_netdiag_loopback_transport(&probes));
+#endif
+
+    MINIGUI_LOCK();
+    if (burst_timer) {
+        lv_timer_delete(burst_timer);
+        burst_timer = NULL;
+    }
+#if MINIGUI_ENABLE_LOGS
+    if (sim_cfg.log_burst_period_ms && sim_cfg.log_burst_size) {
+        burst_timer = lv_timer_create(burst_timer_cb, sim_cfg.log_burst_period_ms, NULL);
+    }
+#endif
+    MINIGUI_UNLOCK();
+
+    LV_LOG_INFO("MiniGUI: Synthetic providers installed (latency %u+%u ms, fail %u%%)",
+                sim_cfg.latency_ms, sim_cfg.jitter_ms, sim_cfg.failure_pct);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Unregister the providers and stop log bursts.
+ **
+ ** @section call_site Called from:
+ ** - Simulator / benchmark teardown.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui.h (provider registration)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Restore the built-in providers by registering NULL.
+ ** 2. Delete the burst and apply timers under the LVGL lock.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_sim_uninstall(void) {
+    minigui_register_wifi_scan_provider(NULL);
+    minigui_register_system_stats_provider(NULL);
+    minigui_register_network_status_provider(NULL);
+    minigui_register_wifi_apply_cb(NULL, NULL);
+#if MINIGUI_ENABLE_NETDIAG
+    minigui_netdiag_cancel();
+    minigui_register_netdiag_transport(NULL);
+#endif
+
+    MINIGUI_LOCK();
+    if (burst_timer) {
+        lv_timer_delete(burst_timer);
+        burst_timer = NULL;
+    }
+    sim_wifi_cancel(0);
+    MINIGUI_UNLOCK();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Read the generated-load counters.
+ **
+ ** @section call_site Called from:
+ ** - Benchmarks and simulator diagnostics.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param stats (minigui_sim_stats_t*): Output.
+ **
+ ** @section pointers
+ ** - stats: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Copy @c sim_stats.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_sim_get_stats(minigui_sim_stats_t *stats) {
+    if (stats) *stats = sim_stats;
+}
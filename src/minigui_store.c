@@ -0,0 +1,580 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Settings Store Implementation.
+ **
+ **            Entries are kept in a key-sorted pointer table (binary search),
+ **            each one a single pooled block holding header, key and value.
+ **            One paused LVGL timer implements the write-behind policy: it is
+ **            restarted by every change and fires once the changes settle.
+ **
+ **            @section minigui_store.c - Write-behind key/value store.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_store.h"
+#include "minigui_alloc.h"
+#include "minigui_lock.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+#define STORE_HOUR_SLOTS 60                 // One-minute commit buckets
+#define STORE_FILE_PATH_MAX 128
+#define STORE_FILE_LINE_MAX (MINIGUI_STORE_KEY_MAX + 2 * MINIGUI_STORE_VALUE_MAX + 4)
+
+/**
+ * @brief One entry; key (terminated) and value bytes follow the header
+ */
+typedef struct {
+    uint8_t key_len;
+    uint8_t len;
+    uint8_t cap;
+    bool dirty;
+    char key[];
+} store_entry_t;
+
+/**
+ * @brief Store state
+ */
+typedef struct {
+    const minigui_store_backend_t *backend;
+    store_entry_t **entries;                // Sorted by key
+    uint16_t count;
+    uint16_t dirty;
+    lv_timer_t *timer;
+    uint32_t first_dirty_ms;                // Tick of the oldest uncommitted change
+    uint32_t bytes;
+    uint32_t sets;
+    uint32_t writes;
+    uint32_t commits;
+    uint32_t failures;
+    uint32_t hour_minute[STORE_HOUR_SLOTS]; // Minute a bucket counts for
+    uint16_t hour_commits[STORE_HOUR_SLOTS];
+} store_t;
+
+static store_t store;
+
+static const char *file_path;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static uint8_t *entry_data(store_entry_t *e) {
+    return (uint8_t *)e->key + e->key_len + 1;
+}
+
+static size_t entry_size(size_t key_len, size_t cap) {
+    return sizeof(store_entry_t) + key_len + 1 + cap;
+}
+
+/**
+ * @brief Index of @p key, or the insertion point with @p found false
+ */
+static uint16_t find_entry(const char *key, bool *found) {
+    uint16_t lo = 0, hi = store.count;
+    while (lo < hi) {
+        uint16_t mid = (uint16_t)((lo + hi) / 2);
+        int cmp = strcmp(store.entries[mid]->key, key);
+        if (cmp == 0) {
+            *found = true;
+            return mid;
+        }
+        if (cmp < 0) {
+            lo = (uint16_t)(mid + 1);
+        } else {
+            hi = mid;
+        }
+    }
+    *found = false;
+    return lo;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Inserts or updates an entry.
+ **
+ ** @section call_site Called from:
+ ** - minigui_store_set() (dirty) and load_entry() (clean).
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_alloc.h (internal pool)
+ **
+ ** @param key (const char*): Key.
+ ** @param data (const void*): Value bytes.
+ ** @param len (size_t): Value length.
+ ** @param dirty (bool): Mark the entry for the next commit.
+ **
+ ** @section pointers
+ ** - key, data: Copied.
+ **
+ ** @section variables Internal Variables:
+ ** - @c e (store_entry_t*): Existing entry, replaced by a larger block when
+ **   the value outgrows its capacity.
+ **
+ ** @return bool: false if the key/value is too long, the table is full or
+ **         the pool is exhausted.
+ **
+ ** Implementation Steps:
+ ** 1. Check sizes and locate the key.
+ ** 2. Allocate a new block if the entry is new or too small (capacity is
+ **    rounded up to 8 so small growth does not reallocate).
+ ** 3. Copy the value and update the dirty count.
+ ******************************************************************************
+ ******************************************************************************/
+static bool put_entry(const char *key, const void *data, size_t len, bool dirty) {
+    size_t key_len = strlen(key);
+    if (key_len == 0 || key_len > MINIGUI_STORE_KEY_MAX || len > MINIGUI_STORE_VALUE_MAX) {
+        LV_LOG_WARN("Store: rejected '%s' (%lu bytes)", key, (unsigned long)len);
+        return false;
+    }
+
+    bool found;
+    uint16_t idx = find_entry(key, &found);
+    store_entry_t *e = found ? store.entries[idx] : NULL;
+
+    if (!e || len > e->cap) {
+        if (!found && store.count >= MINIGUI_STORE_MAX_ENTRIES) {
+            LV_LOG_WARN("Store: full, '%s' not stored", key);
+            return false;
+        }
+        size_t cap = (len + 7u) & ~(size_t)7u;
+        if (cap > MINIGUI_STORE_VALUE_MAX) cap = MINIGUI_STORE_VALUE_MAX;
+        store_entry_t *n = (store_entry_t *)minigui_malloc(MINIGUI_POOL_INTERNAL, entry_size(key_len, cap));
+        if (!n) {
+            LV_LOG_WARN("Store: out of memory for '%s'", key);
+            return false;
+        }
+        n->key_len = (uint8_t)key_len;
+        n->cap = (uint8_t)cap;
+        n->dirty = false;
+        memcpy(n->key, key, key_len + 1);
+        store.bytes += (uint32_t)entry_size(key_len, cap);
+
+        if (e) {
+            n->dirty = e->dirty;
+            store.bytes -= (uint32_t)entry_size(e->key_len, e->cap);
+            minigui_free(MINIGUI_POOL_INTERNAL, e);
+        } else {
+            memmove(&store.entries[idx + 1], &store.entries[idx], (store.count - idx) * sizeof(store_entry_t *));
+            store.count++;
+        }
+        store.entries[idx] = n;
+        e = n;
+    }
+
+    if (len) memcpy(entry_data(e), data, len);
+    e->len = (uint8_t)len;
+    if (dirty && !e->dirty) {
+        e->dirty = true;
+        store.dirty++;
+    }
+    return true;
+}
+
+static void load_entry(const char *key, const void *data, size_t len, void *user) {
+    (void)user;
+    put_entry(key, data, len, false);
+}
+
+static void record_commit(void) {
+    uint32_t minute = lv_tick_get() / 60000u;
+    uint32_t slot = minute % STORE_HOUR_SLOTS;
+    if (store.hour_minute[slot] != minute) {
+        store.hour_minute[slot] = minute;
+        store.hour_commits[slot] = 0;
+    }
+    store.hour_commits[slot]++;
+}
+
+static uint32_t commits_last_hour(void) {
+    uint32_t minute = lv_tick_get() / 60000u;
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < STORE_HOUR_SLOTS; i++) {
+        if (minute - store.hour_minute[i] < STORE_HOUR_SLOTS) total += store.hour_commits[i];
+    }
+    return total;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Writes all dirty entries and commits them as one batch.
+ **
+ ** @section call_site Called from:
+ ** - flush_timer_cb(), minigui_store_flush(), minigui_store_deinit().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c b (const minigui_store_backend_t*): Active backend.
+ **
+ ** @return bool: true if nothing was pending or the commit succeeded.
+ **
+ ** Implementation Steps:
+ ** 1. RAM-only stores just clear the dirty flags.
+ ** 2. Hand every dirty entry to @c write (if the backend has one), then
+ **    call @c commit once.
+ ** 3. On failure keep the entries dirty so the next flush retries them.
+ ** 4. On success clear the flags and count the commit.
+ ******************************************************************************
+ ******************************************************************************/
+static bool flush_locked(void) {
+    if (!store.dirty) return true;
+
+    const minigui_store_backend_t *b = store.backend;
+    bool ok = true;
+    for (uint16_t i = 0; b && b->write && ok && i < store.count; i++) {
+        store_entry_t *e = store.entries[i];
+        if (e->dirty) ok = b->write(b->ctx, e->key, entry_data(e), e->len);
+    }
+    if (b && ok && b->commit) ok = b->commit(b->ctx);
+
+    if (!ok) {
+        store.failures++;
+        LV_LOG_WARN("Store: commit of %u entries failed, retrying later", (unsigned)store.dirty);
+        return false;
+    }
+
+    for (uint16_t i = 0; i < store.count; i++) store.entries[i]->dirty = false;
+    if (b) {
+        store.writes += store.dirty;
+        store.commits++;
+        record_commit();
+        LV_LOG_INFO("Store: committed %u entries (%lu commits in the last hour)",
+                    (unsigned)store.dirty, (unsigned long)commits_last_hour());
+    }
+    store.dirty = 0;
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Flush timer: commits once changes have settled.
+ **
+ ** @section call_site Called from:
+ ** - LVGL timer, MINIGUI_STORE_FLUSH_DELAY_MS after the last restart.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (timer)
+ **
+ ** @param timer (lv_timer_t*): The flush timer.
+ **
+ ** @section pointers
+ ** - timer: Owned by the store.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Flush; on success pause until the next change.
+ ** 2. On failure stay armed, so the batch is retried every period.
+ ******************************************************************************
+ ******************************************************************************/
+static void flush_timer_cb(lv_timer_t *timer) {
+    if (flush_locked()) lv_timer_pause(timer);
+}
+
+static const char hex_digits[] = "0123456789abcdef";
+
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief File backend: parses "key hex" lines.
+ **
+ ** @section call_site Called from:
+ ** - minigui_store_init() through the backend.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdio.h (file I/O)
+ **
+ ** @param ctx (void*): Unused.
+ ** @param emit (minigui_store_entry_cb_t): Receives each entry.
+ ** @param user (void*): Passed to emit.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c line (char[]): One line; longer lines are malformed anyway.
+ ** - @c data (uint8_t[]): Decoded value.
+ **
+ ** @return bool: true, also when the file does not exist yet.
+ **
+ ** Implementation Steps:
+ ** 1. Split each line at the first space.
+ ** 2. Decode hex pairs up to the line end; skip lines with bad digits.
+ ******************************************************************************
+ ******************************************************************************/
+static bool file_load(void *ctx, minigui_store_entry_cb_t emit, void *user) {
+    (void)ctx;
+    FILE *f = fopen(file_path, "r");
+    if (!f) return true;
+
+    char line[STORE_FILE_LINE_MAX];
+    uint8_t data[MINIGUI_STORE_VALUE_MAX];
+    while (fgets(line, sizeof(line), f)) {
+        char *sep = strchr(line, ' ');
+        if (!sep) continue;
+        *sep = '\0';
+
+        const char *hex = sep + 1;
+        size_t len = 0;
+        bool ok = true;
+        while (ok && hex[0] && hex[0] != '\n' && hex[0] != '\r') {
+            int hi = hex_value(hex[0]);
+            int lo = hex_value(hex[1]);
+            if (hi < 0 || lo < 0 || len >= sizeof(data)) {
+                ok = false;
+            } else {
+                data[len++] = (uint8_t)(hi << 4 | lo);
+                hex += 2;
+            }
+        }
+        if (ok) emit(line, data, len, user);
+    }
+    fclose(f);
+    return true;
+}
+
+static void file_write_entry(const char *key, const void *data, size_t len, void *user) {
+    FILE *f = (FILE *)user;
+    const uint8_t *bytes = (const uint8_t *)data;
+    fputs(key, f);
+    fputc(' ', f);
+    for (size_t i = 0; i < len; i++) {
+        fputc(hex_digits[bytes[i] >> 4], f);
+        fputc(hex_digits[bytes[i] & 0x0F], f);
+    }
+    fputc('\n', f);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief File backend: rewrites the file atomically.
+ **
+ ** @section call_site Called from:
+ ** - flush_locked() through the backend.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdio.h (file I/O, rename)
+ **
+ ** @param ctx (void*): Unused.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c tmp (char[]): "<path>.tmp".
+ **
+ ** @return bool: false on any I/O error (the old file is left untouched).
+ **
+ ** Implementation Steps:
+ ** 1. Write every entry to the temporary file.
+ ** 2. Close it, checking for write errors, and rename it over the file.
+ ******************************************************************************
+ ******************************************************************************/
+static bool file_commit(void *ctx) {
+    (void)ctx;
+    char tmp[STORE_FILE_PATH_MAX];
+    if ((size_t)snprintf(tmp, sizeof(tmp), "%s.tmp", file_path) >= sizeof(tmp)) return false;
+
+    FILE *f = fopen(tmp, "w");
+    if (!f) return false;
+    minigui_store_foreach(file_write_entry, f);
+    bool ok = !ferror(f);
+    if (fclose(f) != 0) ok = false;
+    if (ok && rename(tmp, file_path) != 0) ok = false;
+    if (!ok) remove(tmp);
+    return ok;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+bool minigui_store_init(const minigui_store_backend_t *backend) {
+    minigui_store_deinit();
+
+    MINIGUI_LOCK();
+    size_t size = MINIGUI_STORE_MAX_ENTRIES * sizeof(store_entry_t *);
+    store.entries = (store_entry_t **)minigui_malloc(MINIGUI_POOL_INTERNAL, size);
+    store.timer = store.entries ? lv_timer_create(flush_timer_cb, MINIGUI_STORE_FLUSH_DELAY_MS, NULL) : NULL;
+    if (!store.timer) {
+        LV_LOG_ERROR("Store: out of memory");
+        minigui_free(MINIGUI_POOL_INTERNAL, store.entries);
+        store.entries = NULL;
+        MINIGUI_UNLOCK();
+        return false;
+    }
+    lv_timer_pause(store.timer);
+    store.bytes = (uint32_t)size;
+    store.backend = backend;
+
+    if (backend && backend->load && !backend->load(backend->ctx, load_entry, NULL)) {
+        LV_LOG_WARN("Store: load failed, starting with %u entries", (unsigned)store.count);
+    }
+    LV_LOG_INFO("Store: %u entries loaded", (unsigned)store.count);
+    MINIGUI_UNLOCK();
+    return true;
+}
+
+void minigui_store_deinit(void) {
+    MINIGUI_LOCK();
+    if (store.entries) {
+        flush_locked();
+        for (uint16_t i = 0; i < store.count; i++) minigui_free(MINIGUI_POOL_INTERNAL, store.entries[i]);
+        minigui_free(MINIGUI_POOL_INTERNAL, store.entries);
+        lv_timer_delete(store.timer);
+    }
+    memset(&store, 0, sizeof(store));
+    MINIGUI_UNLOCK();
+}
+
+bool minigui_store_set(const char *key, const void *data, size_t len) {
+    if (!key || (!data && len)) return false;
+
+    MINIGUI_LOCK();
+    if (!store.entries) {
+        MINIGUI_UNLOCK();
+        return false;
+    }
+
+    bool found;
+    uint16_t idx = find_entry(key, &found);
+    if (found && store.entries[idx]->len == len && (len == 0 || memcmp(entry_data(store.entries[idx]), data, len) == 0)) {
+        MINIGUI_UNLOCK();
+        return true;
+    }
+
+    bool was_clean = store.dirty == 0;
+    bool ok = put_entry(key, data, len, true);
+    if (ok) {
+        store.sets++;
+        if (was_clean) {
+            store.first_dirty_ms = lv_tick_get();
+            lv_timer_reset(store.timer);
+            lv_timer_resume(store.timer);
+        } else if (lv_tick_elaps(store.first_dirty_ms) < MINIGUI_STORE_FLUSH_MAX_MS - MINIGUI_STORE_FLUSH_DELAY_MS) {
+            lv_timer_reset(store.timer);
+        }
+    }
+    MINIGUI_UNLOCK();
+    return ok;
+}
+
+int32_t minigui_store_get(const char *key, void *data, size_t size) {
+    if (!key) return -1;
+
+    MINIGUI_LOCK();
+    bool found = false;
+    uint16_t idx = store.entries ? find_entry(key, &found) : 0;
+    int32_t len = -1;
+    if (found) {
+        store_entry_t *e = store.entries[idx];
+        len = e->len;
+        if (data) memcpy(data, entry_data(e), e->len < size ? e->len : size);
+    }
+    MINIGUI_UNLOCK();
+    return len;
+}
+
+bool minigui_store_set_i32(const char *key, int32_t value) {
+    return minigui_store_set(key, &value, sizeof(value));
+}
+
+int32_t minigui_store_get_i32(const char *key, int32_t def) {
+    int32_t value;
+    return minigui_store_get(key, &value, sizeof(value)) == (int32_t)sizeof(value) ? value : def;
+}
+
+bool minigui_store_set_str(const char *key, const char *str) {
+    return minigui_store_set(key, str ? str : "", str ? strlen(str) : 0);
+}
+
+size_t minigui_store_get_str(const char *key, char *buf, size_t size) {
+    if (!buf || size == 0) return 0;
+    int32_t len = minigui_store_get(key, buf, size - 1);
+    size_t n = len < 0 ? 0 : ((size_t)len < size - 1 ? (size_t)len : size - 1);
+    buf[n] = '\0';
+    return n;
+}
+
+bool minigui_store_flush(void) {
+    MINIGUI_LOCK();
+    bool ok = flush_locked();
+    if (ok && store.timer) lv_timer_pause(store.timer);
+    MINIGUI_UNLOCK();
+    return ok;
+}
+
+void minigui_store_foreach(minigui_store_entry_cb_t cb, void *user) {
+    if (!cb) return;
+
+    MINIGUI_LOCK();
+    for (uint16_t i = 0; i < store.count; i++) {
+        store_entry_t *e = store.entries[i];
+        cb(e->key, entry_data(e), e->len, user);
+    }
+    MINIGUI_UNLOCK();
+}
+
+void minigui_store_get_stats(minigui_store_stats_t *stats) {
+    if (!stats) return;
+
+    MINIGUI_LOCK();
+    stats->entries = store.count;
+    stats->dirty = store.dirty;
+    stats->bytes = store.bytes;
+    stats->sets = store.sets;
+    stats->writes = store.writes;
+    stats->commits = store.commits;
+    stats->commits_last_hour = commits_last_hour();
+    stats->failures = store.failures;
+    MINIGUI_UNLOCK();
+}
+
+const minigui_store_backend_t *minigui_store_file_backend(const char *path) {
+    static const minigui_store_backend_t backend = {
+        .load = file_load,
+        .write = NULL,
+        .commit = file_commit,
+        .ctx = NULL,
+    };
+    file_path = path;
+    return &backend;
+}
@@ -0,0 +1,231 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Themes Implementation.
+ **
+ **            One lv_style_t per role, filled from the active palette. A
+ **            theme switch only rewrites color values of these styles (the
+ **            property slots already exist, so nothing is allocated) and
+ **            reports one global style change.
+ **
+ **            @section minigui_theme.c - Shared role styles.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None (lvgl included via header)
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_theme.h"
+#include "minigui_lock.h"
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+const minigui_theme_t minigui_theme_dark = {
+    .name = "Dark",
+    .dark = true,
+    .bg = 0x000000,
+    .bar = 0x202020,
+    .drawer = 0x222222,
+    .panel = 0x1A1A1A,
+    .nav = 0x2A2A2A,
+    .header = 0x333333,
+    .border = 0x444444,
+    .control = 0x444444,
+    .control_pressed = 0x555555,
+    .separator = 0x555555,
+    .text = 0xFFFFFF,
+    .text_muted = 0xAAAAAA,
+    .on_accent = 0xFFFFFF,
+};
+
+const minigui_theme_t minigui_theme_light = {
+    .name = "Light",
+    .dark = false,
+    .bg = 0xF2F2F2,
+    .bar = 0xDCDCDC,
+    .drawer = 0xE6E6E6,
+    .panel = 0xEBEBEB,
+    .nav = 0xDDDDDD,
+    .header = 0xD2D2D2,
+    .border = 0xB4B4B4,
+    .control = 0xC8C8C8,
+    .control_pressed = 0xB4B4B4,
+    .separator = 0xBEBEBE,
+    .text = 0x141414,
+    .text_muted = 0x555555,
+    .on_accent = 0xFFFFFF,
+};
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+static lv_style_t role_styles[MINIGUI_THEME_ROLE_COUNT];
+static const minigui_theme_t *active_theme = &minigui_theme_dark;
+static bool styles_ready;
+#if LV_USE_THEME_DEFAULT
+static bool lvgl_dark = LV_THEME_DEFAULT_DARK;  // Mode the LVGL default theme was built with
+#endif
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static void set_bg(minigui_theme_role_t role, uint32_t hex) {
+    lv_style_set_bg_color(&role_styles[role], lv_color_hex(hex));
+    lv_style_set_bg_opa(&role_styles[role], LV_OPA_COVER);
+}
+
+static void set_text(minigui_theme_role_t role, uint32_t hex) {
+    lv_style_set_text_color(&role_styles[role], lv_color_hex(hex));
+}
+
+static void set_border(minigui_theme_role_t role, uint32_t hex) {
+    lv_style_set_border_color(&role_styles[role], lv_color_hex(hex));
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Writes a palette into the role styles.
+ **
+ ** @section call_site Called from:
+ ** - minigui_theme_style() on first use.
+ ** - minigui_theme_apply().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (style setters)
+ **
+ ** @param t (const minigui_theme_t*): Palette.
+ **
+ ** @section pointers
+ ** - t: Read-only.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Initialize the styles once.
+ ** 2. Set only color properties; geometry stays in the constant styles of
+ **    each module, so roles can be combined with them.
+ ******************************************************************************
+ ******************************************************************************/
+static void fill_styles(const minigui_theme_t *t) {
+    if (!styles_ready) {
+        for (int i = 0; i < MINIGUI_THEME_ROLE_COUNT; i++) lv_style_init(&role_styles[i]);
+        styles_ready = true;
+    }
+
+    set_bg(MINIGUI_THEME_SCREEN, t->bg);
+    set_bg(MINIGUI_THEME_STATUS_BAR, t->bar);
+    set_bg(MINIGUI_THEME_MENU_BUTTON, t->drawer);
+    set_border(MINIGUI_THEME_MENU_BUTTON, t->border);
+    set_text(MINIGUI_THEME_MENU_BUTTON, t->text);
+    set_text(MINIGUI_THEME_TITLE, t->text);
+    set_text(MINIGUI_THEME_CLOCK, t->text_muted);
+    set_bg(MINIGUI_THEME_DRAWER, t->drawer);
+    set_bg(MINIGUI_THEME_PANEL, t->panel);
+    set_bg(MINIGUI_THEME_NAV, t->nav);
+    set_border(MINIGUI_THEME_NAV, t->border);
+    set_bg(MINIGUI_THEME_HEADER, t->header);
+    set_text(MINIGUI_THEME_HEADER, t->text);
+    set_bg(MINIGUI_THEME_CONTROL, t->control);
+    set_text(MINIGUI_THEME_CONTROL, t->text);
+    set_bg(MINIGUI_THEME_CONTROL_PRESSED, t->control_pressed);
+    set_bg(MINIGUI_THEME_TABLE, t->bg);
+    set_text(MINIGUI_THEME_TABLE, t->text);
+    set_border(MINIGUI_THEME_TABLE_ITEMS, t->border);
+    set_bg(MINIGUI_THEME_SEPARATOR, t->separator);
+    set_text(MINIGUI_THEME_CARD, t->on_accent);
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+lv_style_t *minigui_theme_style(minigui_theme_role_t role) {
+    if (role >= MINIGUI_THEME_ROLE_COUNT) role = MINIGUI_THEME_SCREEN;
+    if (!styles_ready) fill_styles(active_theme);
+    return &role_styles[role];
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Switch every display to another theme.
+ **
+ ** @section call_site Called from:
+ ** - Settings theme selector, application code.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (style change report, default theme)
+ ** - minigui_lock.h (LVGL lock)
+ **
+ ** @param theme (const minigui_theme_t*): Palette to activate.
+ **
+ ** @section pointers
+ ** - theme: Referenced until the next switch.
+ **
+ ** @section variables Internal Variables:
+ ** - @c reported (bool): Whether the default theme already refreshed all
+ **   objects, so the refresh is not done twice.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Ignore NULL and the active theme.
+ ** 2. Rewrite the role styles.
+ ** 3. If the dark/light mode of stock widgets changes, re-init the LVGL
+ **    default theme for all displays (disp = NULL), which reports the style
+ **    change itself; otherwise report it once here.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_theme_apply(const minigui_theme_t *theme) {
+    if (!theme) return;
+
+    MINIGUI_LOCK();
+    if (theme == active_theme && styles_ready) {
+        MINIGUI_UNLOCK();
+        return;
+    }
+
+    active_theme = theme;
+    fill_styles(theme);
+
+    bool reported = false;
+#if LV_USE_THEME_DEFAULT
+    if (theme->dark != lvgl_dark && lv_theme_default_is_inited()) {
+        lv_theme_default_init(NULL, lv_theme_get_color_primary(NULL), lv_theme_get_color_secondary(NULL),
+                              theme->dark, lv_theme_get_font_normal(NULL));
+        lvgl_dark = theme->dark;
+        reported = true;
+    }
+#endif
+    if (!reported) lv_obj_report_style_change(NULL);
+
+    LV_LOG_USER("Theme: %s", theme->name);
+    MINIGUI_UNLOCK();
+}
+
+const minigui_theme_t *minigui_theme_get(void) {
+    return active_theme;
+}
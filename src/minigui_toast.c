@@ -0,0 +1,1116 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Toast Notifications Implementation.
+ **
+ **            Producers claim a slot of a fixed inbox with a compare-and-
+ **            swap, copy the message and mark it ready; they never block and
+ **            never touch LVGL. A MINIGUI_TOAST_POLL_MS timer in the UI task
+ **            moves ready slots, in post order, into the priority queue:
+ **            repeats of a queued or visible message only raise its count.
+ **            Free places on screen take the highest level, oldest first.
+ **            A dismiss that finds the inbox full is not lost: it stamps its
+ **            sequence number into an atomic bucket picked by the text hash.
+ **            The places on screen are shared by every display with a
+ **            context; each display gets its own toast objects on its top
+ **            layer, created once per place at fixed positions and sizes
+ **            and hidden between uses, so a toast only redraws its own area
+ **            and never lays out a screen.
+ **
+ **            @section minigui_toast.c - Toast queue and pool.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdatomic.h>
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_toast.h"
+#include "minigui_ctx.h"
+#include "minigui_fmt.h"
+#include "minigui_lock.h"
+#include "minigui_theme.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+#define TOAST_MAX_W   360             // Width cap on large displays
+#define TOAST_MARGIN  12              // Gap to the display edges and between toasts
+#define TOAST_PAD_HOR 14
+#define TOAST_PAD_VER 8
+#define TOAST_FONT    (&lv_font_montserrat_16)
+#define DISMISS_BUCKETS 32            // Overflow dismisses, by text hash
+
+/**
+ * @brief Inbox slot states (producer: FREE -> WRITING -> READY, UI: READY -> FREE)
+ */
+enum { SLOT_FREE = 0, SLOT_WRITING, SLOT_READY };
+
+typedef struct {
+    atomic_uchar state;
+    uint8_t level;
+    bool dismiss;                     // Remove instead of show
+    uint32_t duration_ms;
+    uint32_t seq;                     // Post order
+    char text[MINIGUI_TOAST_TEXT_LEN];
+} inbox_slot_t;
+
+/**
+ * @brief A queued or visible toast
+ */
+typedef struct {
+    char text[MINIGUI_TOAST_TEXT_LEN];
+    uint32_t duration_ms;
+    uint32_t seq;                     // First post, breaks ties between equal levels
+    uint32_t last_seq;                // Latest post merged into it
+    uint16_t count;                   // Posts merged into it
+    uint8_t level;
+    bool used;
+} toast_item_t;
+
+/**
+ * @brief A place on screen (shared by all displays)
+ */
+typedef struct {
+    toast_item_t item;                // item.used: showing
+    uint32_t shown_ms;                // Start of the display time (restarted by repeats)
+} toast_view_t;
+
+/**
+ * @brief Pooled objects of one place on one display
+ */
+typedef struct {
+    lv_obj_t *obj;                    // NULL until first used
+    lv_obj_t *label;
+} toast_obj_t;
+
+/**
+ * @brief Toast objects of one display
+ */
+typedef struct {
+    lv_display_t *disp;               // NULL: free slot
+    toast_obj_t places[MINIGUI_TOAST_VISIBLE];
+} toast_display_t;
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Lock-free inbox shared by the producers and the UI task.
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_toast.c.
+ **
+ ** @section rationale Rationale:
+ ** - Posting never blocks and never touches LVGL, so any task (and ISR-like
+ **   callbacks) can post; the sequence counter keeps posts and dismisses in
+ **   order.
+ ** - @c posted and @c dropped are updated by producers, hence atomic.
+ ******************************************************************************
+ ******************************************************************************/
+static inbox_slot_t inbox[MINIGUI_TOAST_INBOX];
+static atomic_uint inbox_hint;
+static atomic_uint post_seq;
+static atomic_uint posted;
+static atomic_uint dropped;
+static atomic_uint dismiss_pending[DISMISS_BUCKETS];   // Newest overflowed dismiss seq + 1, 0 = none
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Queue, places on screen and per-display objects (UI task only).
+ **
+ ** @section scope Internal Scope:
+ ** - Internal to minigui_toast.c.
+ **
+ ** @section rationale Rationale:
+ ** - Bounded arrays: the toast service never allocates, whatever the post rate.
+ ** - Places are shared so every display shows the same toasts; only the
+ **   objects are per display.
+ ******************************************************************************
+ ******************************************************************************/
+static toast_item_t queue[MINIGUI_TOAST_QUEUE];
+static toast_view_t views[MINIGUI_TOAST_VISIBLE];
+static toast_display_t displays[MINIGUI_MAX_CONTEXTS];
+static lv_timer_t *poll_timer;
+static minigui_toast_stats_t stats;   // UI-side counters (coalesced, evicted, shown)
+
+static lv_style_t toast_style;
+static bool style_ready;
+
+static const lv_palette_t level_palette[MINIGUI_TOAST_LEVEL_COUNT] = {
+    [MINIGUI_TOAST_INFO]    = LV_PALETTE_BLUE,
+    [MINIGUI_TOAST_SUCCESS] = LV_PALETTE_GREEN,
+    [MINIGUI_TOAST_WARNING] = LV_PALETTE_ORANGE,
+    [MINIGUI_TOAST_ERROR]   = LV_PALETTE_RED,
+};
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Claims a free inbox slot and publishes one post.
+ **
+ ** @section call_site Called from:
+ ** - minigui_toast_post(), minigui_toast_dismiss() (any task).
+ **
+ ** @section dependencies Required Headers:
+ ** - stdatomic.h (slot states, counters)
+ ** - minigui_fmt.h (bounded copy)
+ **
+ ** @param level (uint8_t): Toast level.
+ ** @param text (const char*): Message.
+ ** @param duration_ms (uint32_t): Display time.
+ ** @param dismiss (bool): Remove instead of show.
+ **
+ ** @section pointers
+ ** - text: Copied into the slot.
+ **
+ ** @section variables Internal Variables:
+ ** - @c start (uint32_t): Rotating first slot, spreads producers.
+ ** - @c expected (unsigned char): FREE, for the claim.
+ **
+ ** @return bool: false if every slot is taken.
+ **
+ ** Implementation Steps:
+ ** 1. Claim a FREE slot with a compare-and-swap (FREE -> WRITING).
+ ** 2. Fill it, take the next sequence number and publish it as READY.
+ ******************************************************************************
+ ******************************************************************************/
+static bool inbox_put(uint8_t level, const char *text, uint32_t duration_ms, bool dismiss) {
+    uint32_t start = atomic_fetch_add_explicit(&inbox_hint, 1, memory_order_relaxed);
+
+    for (uint32_t i = 0; i < MINIGUI_TOAST_INBOX; i++) {
+        inbox_slot_t *slot = &inbox[(start + i) % MINIGUI_TOAST_INBOX];
+        unsigned char expected = SLOT_FREE;
+        if (!atomic_compare_exchange_strong_explicit(&slot->state, &expected, SLOT_WRITING,
+                                                     memory_order_acquire, memory_order_relaxed)) {
+            continue;
+        }
+        slot->level = level;
+        slot->dismiss = dismiss;
+        slot->duration_ms = duration_ms;
+        slot->seq = atomic_fetch_add_explicit(&post_seq, 1, memory_order_relaxed);
+        minigui_fmt_str(slot->text, sizeof(slot->text), text);
+        atomic_store_explicit(&slot->state, SLOT_READY, memory_order_release);
+        return true;
+    }
+    return false;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Whether an entry is a live toast with this level and text.
+ **
+ ** @section call_site Called from:
+ ** - accept() when merging repeats.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param item (const toast_item_t*): Queued or visible entry.
+ ** @param level (uint8_t): Level of the post.
+ ** @param text (const char*): Text of the post.
+ **
+ ** @section pointers
+ ** - item, text: Read-only.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return bool: true for a repeat.
+ **
+ ** Implementation Steps:
+ ** 1. Compare the used flag, the level and the text.
+ ******************************************************************************
+ ******************************************************************************/
+static bool same_toast(const toast_item_t *item, uint8_t level, const char *text) {
+    return item->used && item->level == level && strcmp(item->text, text) == 0;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Formats the label text of a toast.
+ **
+ ** @section call_site Called from:
+ ** - place_render().
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_fmt.h (string and number formatting)
+ **
+ ** @param item (const toast_item_t*): Toast.
+ ** @param buf (char*): Output.
+ ** @param size (size_t): Capacity of @p buf.
+ **
+ ** @section pointers
+ ** - item: Read-only.
+ ** - buf: Owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c n (size_t): Characters written so far.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Copy the message; append " (count)" when repeats were merged.
+ ******************************************************************************
+ ******************************************************************************/
+static void item_text(const toast_item_t *item, char *buf, size_t size) {
+    size_t n = minigui_fmt_str(buf, size, item->text);
+    if (item->count > 1) {
+        n += minigui_fmt_str(buf + n, size - n, " (");
+        n += minigui_fmt_u32(buf + n, size - n, item->count);
+        minigui_fmt_str(buf + n, size - n, ")");
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Takes a toast off every display.
+ **
+ ** @section call_site Called from:
+ ** - Expiry in poll_cb(), dismisses, taps, minigui_toast_clear().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (hidden flag)
+ **
+ ** @param view (toast_view_t*): Place to free.
+ **
+ ** @section pointers
+ ** - view: Element of @c views.
+ **
+ ** @section variables Internal Variables:
+ ** - @c index (uint8_t): Place index, selects the objects per display.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Free the place.
+ ** 2. Hide its object on each display that created one.
+ ******************************************************************************
+ ******************************************************************************/
+static void view_hide(toast_view_t *view) {
+    uint8_t index = (uint8_t)(view - views);
+    view->item.used = false;
+    for (uint8_t d = 0; d < MINIGUI_MAX_CONTEXTS; d++) {
+        lv_obj_t *obj = displays[d].places[index].obj;
+        if (obj) lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Tap handler of a toast object.
+ **
+ ** @section call_site Called from:
+ ** - LV_EVENT_CLICKED of any display's toast object.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (event user data)
+ **
+ ** @param e (lv_event_t*): LVGL event object.
+ **
+ ** @section pointers
+ ** - e: Owned by LVGL; its user data is the place.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Hide the place on every display.
+ ******************************************************************************
+ ******************************************************************************/
+static void toast_clicked_cb(lv_event_t *e) {
+    toast_view_t *view = (toast_view_t *)lv_event_get_user_data(e);
+    view_hide(view);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Creates the pooled objects of one place on one display.
+ **
+ ** @section call_site Called from:
+ ** - place_render() on the first use of a place on that display.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (objects on the display's top layer)
+ ** - minigui_theme.h (text color on accent backgrounds)
+ **
+ ** @param d (toast_display_t*): Display to create the objects on.
+ ** @param index (uint8_t): Place, 0 is the bottom one.
+ **
+ ** @section pointers
+ ** - d->places[index]: Owned by the display's top layer, deleted by
+ **   minigui_toast_stop().
+ **
+ ** @section variables Internal Variables:
+ ** - @c w, @c h (int32_t): Toast size, fixed for its lifetime.
+ **
+ ** @return bool: false if the object could not be created.
+ **
+ ** Implementation Steps:
+ ** 1. Size from the display: centered, at most TOAST_MAX_W wide, one line
+ **    of TOAST_FONT high; places are stacked upwards from the bottom.
+ ** 2. Fixed size and position, no scrolling, label cut with dots: changing
+ **    the text never resizes anything, so only the toast area is redrawn.
+ ** 3. A tap hides the toast.
+ ******************************************************************************
+ ******************************************************************************/
+static bool place_create(toast_display_t *d, uint8_t index) {
+    toast_obj_t *place = &d->places[index];
+
+    if (!style_ready) {
+        lv_style_init(&toast_style);
+        lv_style_set_radius(&toast_style, 8);
+        lv_style_set_border_width(&toast_style, 0);
+        lv_style_set_pad_hor(&toast_style, TOAST_PAD_HOR);
+        lv_style_set_pad_ver(&toast_style, TOAST_PAD_VER);
+        lv_style_set_bg_opa(&toast_style, LV_OPA_COVER);
+        lv_style_set_text_font(&toast_style, TOAST_FONT);
+        style_ready = true;
+    }
+
+    int32_t hor = lv_display_get_horizontal_resolution(d->disp);
+    int32_t ver = lv_display_get_vertical_resolution(d->disp);
+    int32_t w = hor - 2 * TOAST_MARGIN;
+    if (w > TOAST_MAX_W) w = TOAST_MAX_W;
+    int32_t h = lv_font_get_line_height(TOAST_FONT) + 2 * TOAST_PAD_VER;
+
+    place->obj = lv_obj_create(lv_display_get_layer_top(d->disp));
+    if (!place->obj) return false;
+    lv_obj_add_style(place->obj, &toast_style, 0);
+    lv_obj_add_style(place->obj, minigui_theme_style(MINIGUI_THEME_CARD), 0);
+    lv_obj_set_size(place->obj, w, h);
+    lv_obj_set_pos(place->obj, (hor - w) / 2, ver - (int32_t)(index + 1) * (h + TOAST_MARGIN));
+    lv_obj_remove_flag(place->obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(place->obj, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(place->obj, toast_clicked_cb, LV_EVENT_CLICKED, &views[index]);
+
+    place->label = lv_label_create(place->obj);
+    lv_obj_set_width(place->label, lv_pct(100));
+    lv_label_set_long_mode(place->label, LV_LABEL_LONG_DOT);
+    lv_obj_align(place->label, LV_ALIGN_LEFT_MID, 0, 0);
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Shows one place on one display.
+ **
+ ** @section call_site Called from:
+ ** - view_render() for every display, minigui_toast_start() to catch up.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (label, background color, hidden flag)
+ **
+ ** @param d (toast_display_t*): Display.
+ ** @param index (uint8_t): Place to show.
+ **
+ ** @section pointers
+ ** - d: Element of @c displays.
+ **
+ ** @section variables Internal Variables:
+ ** - @c buf (char[]): Label text.
+ **
+ ** @return bool: false if the objects could not be created.
+ **
+ ** Implementation Steps:
+ ** 1. Create the objects on first use.
+ ** 2. Set the level color and the text, then unhide.
+ ******************************************************************************
+ ******************************************************************************/
+static bool place_render(toast_display_t *d, uint8_t index) {
+    const toast_item_t *item = &views[index].item;
+    toast_obj_t *place = &d->places[index];
+    if (!place->obj && !place_create(d, index)) return false;
+
+    char buf[MINIGUI_TOAST_TEXT_LEN + 16];
+    item_text(item, buf, sizeof(buf));
+    lv_obj_set_style_bg_color(place->obj, lv_palette_darken(level_palette[item->level], 2), 0);
+    lv_label_set_text(place->label, buf);
+    lv_obj_remove_flag(place->obj, LV_OBJ_FLAG_HIDDEN);
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Shows one place on every display.
+ **
+ ** @section call_site Called from:
+ ** - view_show(), accept() when a repeat changes the count.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param index (uint8_t): Place to show.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c shown (bool): At least one display shows it.
+ **
+ ** @return bool: false if no display could show it (none attached yet).
+ **
+ ** Implementation Steps:
+ ** 1. Render the place on each attached display.
+ ******************************************************************************
+ ******************************************************************************/
+static bool view_render(uint8_t index) {
+    bool shown = false;
+    for (uint8_t d = 0; d < MINIGUI_MAX_CONTEXTS; d++) {
+        if (displays[d].disp && place_render(&displays[d], index)) shown = true;
+    }
+    return shown;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Puts a queued toast into a place.
+ **
+ ** @section call_site Called from:
+ ** - fill_views().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (tick)
+ **
+ ** @param view (toast_view_t*): Target place.
+ ** @param index (uint8_t): Its index.
+ ** @param item (const toast_item_t*): Toast to show.
+ **
+ ** @section pointers
+ ** - item: Copied.
+ **
+ ** @section variables Internal Variables:
+ ** - @c previous (toast_item_t): Restored if nothing shows it.
+ **
+ ** @return bool: false if no display could show it; the place is unchanged.
+ **
+ ** Implementation Steps:
+ ** 1. Copy the toast into the place and render it on every display.
+ ** 2. On success start the display time and count it as shown.
+ ******************************************************************************
+ ******************************************************************************/
+static bool view_show(toast_view_t *view, uint8_t index, const toast_item_t *item) {
+    toast_item_t previous = view->item;
+    view->item = *item;
+    if (!view_render(index)) {
+        view->item = previous;
+        return false;
+    }
+    view->shown_ms = lv_tick_get();
+    stats.shown++;
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Dismiss bucket of a text.
+ **
+ ** @section call_site Called from:
+ ** - minigui_toast_dismiss() (any task), apply_overflow_dismisses().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param text (const char*): Message.
+ **
+ ** @section pointers
+ ** - text: Read-only.
+ **
+ ** @section variables Internal Variables:
+ ** - @c hash (uint32_t): FNV-1a state.
+ **
+ ** @return uint8_t: Bucket index below DISMISS_BUCKETS.
+ **
+ ** Implementation Steps:
+ ** 1. Hash the text as stored (at most MINIGUI_TOAST_TEXT_LEN - 1 bytes), so a
+ **    long text hashes the same before and after the copy.
+ ******************************************************************************
+ ******************************************************************************/
+static uint8_t text_bucket(const char *text) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < MINIGUI_TOAST_TEXT_LEN - 1 && text[i]; i++) {
+        hash ^= (uint8_t)text[i];
+        hash *= 16777619u;
+    }
+    return (uint8_t)(hash % DISMISS_BUCKETS);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Applies the dismisses that found the inbox full.
+ **
+ ** @section call_site Called from:
+ ** - poll_cb() after the inbox drain.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdatomic.h (bucket exchange)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c seq (uint32_t): Sequence number of the bucket's dismiss.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Take each pending bucket (exchange with 0).
+ ** 2. Remove the visible and queued toasts of the bucket whose latest post
+ **    is older than the dismiss. A different text in the same bucket goes
+ **    too: a rare extra dismiss is preferred over a critical toast that
+ **    never leaves.
+ ******************************************************************************
+ ******************************************************************************/
+static void apply_overflow_dismisses(void) {
+    for (uint8_t b = 0; b < DISMISS_BUCKETS; b++) {
+        uint32_t seq = atomic_exchange_explicit(&dismiss_pending[b], 0, memory_order_acquire);
+        if (!seq) continue;
+        seq--;
+        for (uint8_t i = 0; i < MINIGUI_TOAST_VISIBLE; i++) {
+            toast_item_t *item = &views[i].item;
+            if (item->used && text_bucket(item->text) == b && (int32_t)(item->last_seq - seq) < 0) {
+                view_hide(&views[i]);
+            }
+        }
+        for (uint8_t i = 0; i < MINIGUI_TOAST_QUEUE; i++) {
+            toast_item_t *item = &queue[i];
+            if (item->used && text_bucket(item->text) == b && (int32_t)(item->last_seq - seq) < 0) {
+                item->used = false;
+            }
+        }
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Applies one post to the queue and the visible toasts.
+ **
+ ** @section call_site Called from:
+ ** - poll_cb() for each ready inbox slot, in post order.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param slot (const inbox_slot_t*): Published post.
+ **
+ ** @section pointers
+ ** - slot: Read-only; released by the caller afterwards.
+ **
+ ** @section variables Internal Variables:
+ ** - @c victim (toast_item_t*): Queue entry to reuse when the queue is full.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Dismiss: hide the visible toasts and drop the queued ones with the text.
+ ** 2. Repeat of a visible toast: raise its count and restart its time.
+ ** 3. Repeat of a queued toast: raise its count.
+ ** 4. Otherwise queue it. A full queue gives up (evicts) its lowest level,
+ **    oldest entry, unless that one outranks the post, which is then
+ **    dropped instead.
+ ******************************************************************************
+ ******************************************************************************/
+static void accept(const inbox_slot_t *slot) {
+    if (slot->dismiss) {
+        for (uint8_t i = 0; i < MINIGUI_TOAST_VISIBLE; i++) {
+            if (views[i].item.used && strcmp(views[i].item.text, slot->text) == 0) view_hide(&views[i]);
+        }
+        for (uint8_t i = 0; i < MINIGUI_TOAST_QUEUE; i++) {
+            if (queue[i].used && strcmp(queue[i].text, slot->text) == 0) queue[i].used = false;
+        }
+        return;
+    }
+
+    for (uint8_t i = 0; i < MINIGUI_TOAST_VISIBLE; i++) {
+        toast_view_t *view = &views[i];
+        if (!same_toast(&view->item, slot->level, slot->text)) continue;
+        if (view->item.count < UINT16_MAX) view->item.count++;
+        view->item.duration_ms = slot->duration_ms;
+        view->item.last_seq = slot->seq;
+        view->shown_ms = lv_tick_get();
+        view_render(i);
+        stats.coalesced++;
+        return;
+    }
+
+    toast_item_t *victim = NULL;
+    for (uint8_t i = 0; i < MINIGUI_TOAST_QUEUE; i++) {
+        toast_item_t *q = &queue[i];
+        if (same_toast(q, slot->level, slot->text)) {
+            if (q->count < UINT16_MAX) q->count++;
+            q->duration_ms = slot->duration_ms;
+            q->last_seq = slot->seq;
+            stats.coalesced++;
+            return;
+        }
+        if (!q->used && !victim) victim = q;
+    }
+
+    if (!victim) {
+        victim = &queue[0];
+        for (uint8_t i = 1; i < MINIGUI_TOAST_QUEUE; i++) {
+            toast_item_t *q = &queue[i];
+            if (q->level < victim->level || (q->level == victim->level && q->seq < victim->seq)) victim = q;
+        }
+        if (victim->level > slot->level) {
+            atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+            return;
+        }
+        stats.evicted++;
+    }
+
+    memcpy(victim->text, slot->text, sizeof(victim->text));
+    victim->duration_ms = slot->duration_ms;
+    victim->seq = slot->seq;
+    victim->last_seq = slot->seq;
+    victim->count = 1;
+    victim->level = slot->level;
+    victim->used = true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Picks the next queued toast to show.
+ **
+ ** @section call_site Called from:
+ ** - fill_views().
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c best (toast_item_t*): Best entry so far.
+ **
+ ** @return toast_item_t*: Highest level, oldest entry, or NULL if the queue is empty.
+ **
+ ** Implementation Steps:
+ ** 1. Scan the queue, preferring the higher level, then the lower sequence.
+ ******************************************************************************
+ ******************************************************************************/
+static toast_item_t *queue_best(void) {
+    toast_item_t *best = NULL;
+    for (uint8_t i = 0; i < MINIGUI_TOAST_QUEUE; i++) {
+        toast_item_t *q = &queue[i];
+        if (!q->used) continue;
+        if (!best || q->level > best->level || (q->level == best->level && q->seq < best->seq)) best = q;
+    }
+    return best;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Moves queued toasts to the screen.
+ **
+ ** @section call_site Called from:
+ ** - poll_cb() after expiry.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c target (toast_view_t*): Free place, or the visible toast to preempt.
+ ** - @c displaced (toast_item_t): Preempted toast, requeued.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Fill free places with the best queued toast first.
+ ** 2. With none left, a queued toast takes the place of a visible one of
+ **    lower level (the oldest of the lowest), which goes back to the queue
+ **    entry it just left and is shown again later.
+ ** 3. Stop when nothing is queued, nothing can be preempted or no display
+ **    is attached yet.
+ ******************************************************************************
+ ******************************************************************************/
+static void fill_views(void) {
+    toast_item_t *best;
+    while ((best = queue_best()) != NULL) {
+        toast_view_t *target = NULL;
+        uint8_t index = 0;
+        for (uint8_t i = 0; i < MINIGUI_TOAST_VISIBLE; i++) {
+            toast_view_t *v = &views[i];
+            if (!v->item.used) {
+                target = v;
+                index = i;
+                break;
+            }
+            if (v->item.level < best->level &&
+                (!target || v->item.level < target->item.level ||
+                 (v->item.level == target->item.level && v->item.seq < target->item.seq))) {
+                target = v;
+                index = i;
+            }
+        }
+        if (!target) return;
+
+        toast_item_t next = *best;
+        toast_item_t displaced = target->item;
+        if (!view_show(target, index, &next)) return;   // No display yet, retry next poll
+        *best = displaced;                             // Requeue the preempted toast (or free the entry)
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Moves posts into the queue, expires toasts and refills the screen.
+ **
+ ** @section call_site Called from:
+ ** - LVGL timer (MINIGUI_TOAST_POLL_MS), with the LVGL lock held.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (timer, tick)
+ **
+ ** @param timer (lv_timer_t*): Unused.
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c ready (uint8_t[]): Ready inbox slots, sorted by post order.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Collect the ready slots and sort them by sequence number, so posts
+ **    are applied in the order they were made.
+ ** 2. Apply each post and hand its slot back to the producers, then the
+ **    dismisses that overflowed the inbox.
+ ** 3. Hide the toasts whose time ran out, then fill the free places.
+ ******************************************************************************
+ ******************************************************************************/
+static void poll_cb(lv_timer_t *timer) {
+    (void)timer;
+    uint8_t ready[MINIGUI_TOAST_INBOX];
+    uint8_t n = 0;
+
+    // 1. Ready slots in post order (insertion sort, the inbox is small)
+    for (uint8_t i = 0; i < MINIGUI_TOAST_INBOX; i++) {
+        if (atomic_load_explicit(&inbox[i].state, memory_order_acquire) != SLOT_READY) continue;
+        uint8_t j = n++;
+        while (j > 0 && (int32_t)(inbox[ready[j - 1]].seq - inbox[i].seq) > 0) {
+            ready[j] = ready[j - 1];
+            j--;
+        }
+        ready[j] = i;
+    }
+
+    // 2. Apply and release
+    for (uint8_t k = 0; k < n; k++) {
+        inbox_slot_t *slot = &inbox[ready[k]];
+        accept(slot);
+        atomic_store_explicit(&slot->state, SLOT_FREE, memory_order_release);
+    }
+    apply_overflow_dismisses();
+
+    // 3. Expire and refill
+    for (uint8_t i = 0; i < MINIGUI_TOAST_VISIBLE; i++) {
+        toast_view_t *view = &views[i];
+        if (!view->item.used || view->item.duration_ms == MINIGUI_TOAST_FOREVER) continue;
+        if (lv_tick_elaps(view->shown_ms) >= view->item.duration_ms) view_hide(view);
+    }
+    fill_views();
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Post a toast.
+ **
+ ** @section call_site Called from:
+ ** - Any task, with or without the LVGL lock.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdatomic.h (counters)
+ **
+ ** @param level (minigui_toast_level_t): Priority and color.
+ ** @param text (const char*): Message.
+ ** @param duration_ms (uint32_t): Display time, 0 for the default.
+ **
+ ** @section pointers
+ ** - text: Copied.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return bool: false for invalid arguments or a full inbox.
+ **
+ ** Implementation Steps:
+ ** 1. Validate and default the duration.
+ ** 2. Put it in the inbox; count it as posted, or as dropped when the inbox
+ **    is full.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_toast_post(minigui_toast_level_t level, const char *text, uint32_t duration_ms) {
+    if (!text || (unsigned)level >= MINIGUI_TOAST_LEVEL_COUNT) return false;
+    if (duration_ms == 0) duration_ms = MINIGUI_TOAST_DURATION_MS;
+
+    if (!inbox_put((uint8_t)level, text, duration_ms, false)) {
+        atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+        return false;
+    }
+    atomic_fetch_add_explicit(&posted, 1, memory_order_relaxed);
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Remove the toasts showing or waiting with a text.
+ **
+ ** @section call_site Called from:
+ ** - Any task (e.g. minigui_alert when a rule clears).
+ **
+ ** @section dependencies Required Headers:
+ ** - stdatomic.h
+ **
+ ** @param text (const char*): Message of the toasts to remove.
+ **
+ ** @section pointers
+ ** - text: Copied or hashed, not kept.
+ **
+ ** @section variables Internal Variables:
+ ** - @c seq (uint32_t): Post order of the dismiss.
+ ** - @c cur (unsigned): Dismiss already pending in the bucket.
+ **
+ ** @return bool: false only for a NULL text.
+ **
+ ** Implementation Steps:
+ ** 1. Queue the dismiss in the inbox, ordered with the posts.
+ ** 2. If the inbox is full, store its sequence number in the text's bucket,
+ **    keeping the newer one when another dismiss is already pending. It
+ **    cannot be lost, so a FOREVER toast always leaves.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_toast_dismiss(const char *text) {
+    if (!text) return false;
+    if (inbox_put(0, text, 0, true)) return true;
+
+    uint32_t seq = atomic_fetch_add_explicit(&post_seq, 1, memory_order_relaxed) + 1u;
+    if (seq == 0) seq = 1;
+    atomic_uint *bucket = &dismiss_pending[text_bucket(text)];
+    unsigned cur = atomic_load_explicit(bucket, memory_order_relaxed);
+    while ((cur == 0 || (int32_t)(seq - cur) > 0) &&
+           !atomic_compare_exchange_weak_explicit(bucket, &cur, seq, memory_order_release, memory_order_relaxed)) {
+    }
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Remove every toast and waiting post.
+ **
+ ** @section call_site Called from:
+ ** - Application (e.g. on a mode change).
+ **
+ ** @section dependencies Required Headers:
+ ** - stdatomic.h (slot states)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c discarded (uint32_t): Posts thrown away before they were shown.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Under the lock (the UI task is the only consumer), free the READY inbox
+ **    slots and drop the pending overflow dismisses.
+ ** 2. Free the queue and hide the visible toasts.
+ ** 3. Count the discarded posts (inbox and queue, not dismisses) as dropped,
+ **    so posted = shown + coalesced + evicted + dropped once idle.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_toast_clear(void) {
+    uint32_t discarded = 0;
+
+    MINIGUI_LOCK();
+    for (uint8_t i = 0; i < MINIGUI_TOAST_INBOX; i++) {
+        inbox_slot_t *slot = &inbox[i];
+        if (atomic_load_explicit(&slot->state, memory_order_acquire) != SLOT_READY) continue;
+        bool post = !slot->dismiss;   // Stable while READY: only the UI task frees it
+        atomic_store_explicit(&slot->state, SLOT_FREE, memory_order_release);
+        if (post) discarded++;
+    }
+    for (uint8_t i = 0; i < DISMISS_BUCKETS; i++) atomic_store_explicit(&dismiss_pending[i], 0, memory_order_relaxed);
+    for (uint8_t i = 0; i < MINIGUI_TOAST_QUEUE; i++) {
+        if (queue[i].used) discarded++;
+        queue[i].used = false;
+    }
+    for (uint8_t i = 0; i < MINIGUI_TOAST_VISIBLE; i++) view_hide(&views[i]);
+    MINIGUI_UNLOCK();
+
+    atomic_fetch_add_explicit(&dropped, discarded, memory_order_relaxed);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Copy the toast counters.
+ **
+ ** @section call_site Called from:
+ ** - Application, metrics or diagnostics (any task).
+ **
+ ** @section dependencies Required Headers:
+ ** - stdatomic.h (producer counters)
+ **
+ ** @param out (minigui_toast_stats_t*): Output.
+ **
+ ** @section pointers
+ ** - out: Owned by caller.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Copy the UI-side counters under the lock.
+ ** 2. Add the atomic producer counters.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_toast_get_stats(minigui_toast_stats_t *out) {
+    if (!out) return;
+    MINIGUI_LOCK();
+    *out = stats;
+    MINIGUI_UNLOCK();
+    out->posted = atomic_load_explicit(&posted, memory_order_relaxed);
+    out->dropped = atomic_load_explicit(&dropped, memory_order_relaxed);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Start showing toasts on a display.
+ **
+ ** @section call_site Called from:
+ ** - minigui_ctx_create().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (timer)
+ **
+ ** @param disp (lv_display_t*): Display, NULL for the default one.
+ **
+ ** @section pointers
+ ** - disp: Owned by the application; referenced until minigui_toast_stop().
+ **
+ ** @section variables Internal Variables:
+ ** - @c d (toast_display_t*): Free slot for the display.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Ignore a display already attached; warn when every slot is taken.
+ ** 2. Attach it and show the toasts already visible on the others.
+ ** 3. Start the poll timer with the first display.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_toast_start(lv_display_t *disp) {
+    if (!disp) disp = lv_display_get_default();
+    if (!disp) return;
+
+    MINIGUI_LOCK();
+    toast_display_t *d = NULL;
+    for (uint8_t i = 0; i < MINIGUI_MAX_CONTEXTS; i++) {
+        if (displays[i].disp == disp) {
+            MINIGUI_UNLOCK();
+            return;
+        }
+        if (!displays[i].disp && !d) d = &displays[i];
+    }
+    if (!d) {
+        LV_LOG_WARN("Toast: all %d displays in use", MINIGUI_MAX_CONTEXTS);
+        MINIGUI_UNLOCK();
+        return;
+    }
+    d->disp = disp;
+    for (uint8_t i = 0; i < MINIGUI_TOAST_VISIBLE; i++) {
+        if (views[i].item.used) place_render(d, i);   // Catch up with the other displays
+    }
+    if (!poll_timer) poll_timer = lv_timer_create(poll_cb, MINIGUI_TOAST_POLL_MS, NULL);
+    MINIGUI_UNLOCK();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Stop showing toasts on a display.
+ **
+ ** @section call_site Called from:
+ ** - minigui_ctx_destroy().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (object and timer deletion)
+ **
+ ** @param disp (lv_display_t*): Display, NULL for the default one.
+ **
+ ** @section pointers
+ ** - disp: No longer referenced afterwards.
+ **
+ ** @section variables Internal Variables:
+ ** - @c any (bool): Another display is still attached.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Delete the display's toast objects and free its slot.
+ ** 2. With no display left, stop the poll timer and drop the places and the
+ **    queue (waiting posts stay in the inbox for the next start).
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_toast_stop(lv_display_t *disp) {
+    if (!disp) disp = lv_display_get_default();
+
+    MINIGUI_LOCK();
+    bool any = false;
+    for (uint8_t i = 0; i < MINIGUI_MAX_CONTEXTS; i++) {
+        toast_display_t *d = &displays[i];
+        if (d->disp && d->disp != disp) any = true;
+        if (!d->disp || d->disp != disp) continue;
+        for (uint8_t p = 0; p < MINIGUI_TOAST_VISIBLE; p++) {
+            if (d->places[p].obj) lv_obj_delete(d->places[p].obj);
+        }
+        memset(d, 0, sizeof(*d));
+    }
+    if (!any) {
+        if (poll_timer) {
+            lv_timer_delete(poll_timer);
+            poll_timer = NULL;
+        }
+        memset(views, 0, sizeof(views));
+        for (uint8_t i = 0; i < MINIGUI_TOAST_QUEUE; i++) queue[i].used = false;
+    }
+    MINIGUI_UNLOCK();
+}
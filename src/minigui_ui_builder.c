@@ -0,0 +1,208 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Declarative UI Builder Implementation.
+ **
+ **            Walks a node table once, creating each widget, attaching its
+ **            shared style and static text, and wiring its event handler.
+ **
+ **            @section minigui_ui_builder.c - Node table builder.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None directly here, lvgl is included via minigui_ui_builder.h
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_ui_builder.h"
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Creates the widget for one node.
+ **
+ ** @section call_site Called from:
+ ** - minigui_ui_build() for every node.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (widget constructors)
+ **
+ ** @param node (const minigui_ui_node_t*): Node to instantiate.
+ ** @param parent (lv_obj_t*): Resolved parent object.
+ **
+ ** @section pointers
+ ** - node: Read-only, text referenced (not copied) where LVGL allows it.
+ ** - parent: Owned by LVGL.
+ **
+ ** @section variables Internal Variables:
+ ** - @c obj (lv_obj_t*): Created widget.
+ **
+ ** @return lv_obj_t*: The widget.
+ **
+ ** Implementation Steps:
+ ** 1. Dispatch on the node type.
+ ** 2. Attach text: static for labels/options, copied for placeholders.
+ ******************************************************************************
+ ******************************************************************************/
+static lv_obj_t *create_node(const minigui_ui_node_t *node, lv_obj_t *parent) {
+    lv_obj_t *obj;
+
+    switch (node->type) {
+        case MINIGUI_UI_LABEL:
+            obj = lv_label_create(parent);
+            if (node->text) lv_label_set_text_static(obj, node->text);
+            break;
+        case MINIGUI_UI_BUTTON:
+            obj = lv_button_create(parent);
+            if (node->text) {
+                lv_obj_t *lbl = lv_label_create(obj);
+                lv_label_set_text_static(lbl, node->text);
+                lv_obj_center(lbl);
+            }
+            break;
+        case MINIGUI_UI_SLIDER:
+            obj = lv_slider_create(parent);
+            break;
+        case MINIGUI_UI_DROPDOWN:
+            obj = lv_dropdown_create(parent);
+            if (node->text) lv_dropdown_set_options_static(obj, node->text);
+            break;
+        case MINIGUI_UI_TEXTAREA:
+            obj = lv_textarea_create(parent);
+            if (node->flags & MINIGUI_UI_F_ONE_LINE) lv_textarea_set_one_line(obj, true);
+            if (node->flags & MINIGUI_UI_F_PASSWORD) lv_textarea_set_password_mode(obj, true);
+            if (node->text) lv_textarea_set_placeholder_text(obj, node->text);
+            break;
+        case MINIGUI_UI_BAR:
+            obj = lv_bar_create(parent);
+            break;
+        case MINIGUI_UI_CHART:
+            obj = lv_chart_create(parent);
+            lv_chart_set_type(obj, LV_CHART_TYPE_BAR);
+            break;
+        case MINIGUI_UI_OBJ:
+        default:
+            obj = lv_obj_create(parent);
+            break;
+    }
+    return obj;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Instantiate a node table under a parent.
+ **
+ ** @section call_site Called from:
+ ** - Screen and panel builders (LVGL lock held).
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (styles, flags, events)
+ **
+ ** @param parent (lv_obj_t*): Root parent.
+ ** @param desc (const minigui_ui_desc_t*): Table and handlers.
+ ** @param objs (lv_obj_t**): Output handles.
+ **
+ ** @section pointers
+ ** - desc: Read-only.
+ ** - objs: Owned by caller, desc->count entries.
+ **
+ ** @section variables Internal Variables:
+ ** - @c node (const minigui_ui_node_t*): Current node.
+ ** - @c p (lv_obj_t*): Resolved parent.
+ **
+ ** @return bool: true if every node was valid.
+ **
+ ** Implementation Steps:
+ ** 1. Validate arguments.
+ ** 2. For each node: resolve parent (only earlier nodes are legal).
+ ** 3. Create the widget, add the shared style, apply the hidden flag.
+ ** 4. Register the handler for the node's event code.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_ui_build(lv_obj_t *parent, const minigui_ui_desc_t *desc, lv_obj_t **objs) {
+    if (!parent || !desc || !objs) return false;
+
+    for (uint16_t i = 0; i < desc->count; i++) {
+        const minigui_ui_node_t *node = &desc->nodes[i];
+
+        lv_obj_t *p = parent;
+        if (node->parent != MINIGUI_UI_ROOT) {
+            if (node->parent < 0 || node->parent >= (int)i) {
+                LV_LOG_ERROR("UI builder: node %u has invalid parent %d", i, node->parent);
+                return false;
+            }
+            p = objs[node->parent];
+        }
+
+        lv_obj_t *obj = create_node(node, p);
+        objs[i] = obj;
+
+        if (node->style) lv_obj_add_style(obj, node->style, 0);
+        if (node->flags & MINIGUI_UI_F_HIDDEN) lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+
+        if (node->event) {
+            if (node->event > desc->handler_count || !desc->handlers[node->event - 1]) {
+                LV_LOG_ERROR("UI builder: node %u has invalid event %u", i, node->event);
+                return false;
+            }
+            lv_obj_add_event_cb(obj, desc->handlers[node->event - 1],
+                                (lv_event_code_t)node->event_code, NULL);
+        }
+    }
+    return true;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Number of LVGL objects a table creates.
+ **
+ ** @section call_site Called from:
+ ** - Benchmarks and size accounting.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param desc (const minigui_ui_desc_t*): Table.
+ **
+ ** @section pointers
+ ** - desc: Read-only.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return uint32_t: Object count.
+ **
+ ** Implementation Steps:
+ ** 1. One object per node, plus one label per button with text.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_ui_count_objects(const minigui_ui_desc_t *desc) {
+    if (!desc) return 0;
+
+    uint32_t n = desc->count;
+    for (uint16_t i = 0; i < desc->count; i++) {
+        if (desc->nodes[i].type == MINIGUI_UI_BUTTON && desc->nodes[i].text) n++;
+    }
+    return n;
+}
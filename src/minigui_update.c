@@ -0,0 +1,709 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Firmware Update Pipeline Implementation.
+ **
+ **            One job at a time, allocated at start and freed at the end.
+ **            Without a worker, each LVGL timer tick reads, hashes and writes
+ **            chunks until its time slice is used up or the source has
+ **            nothing ready. With a worker, the application task calling
+ **            minigui_update_run() does the streaming (including the
+ **            blocking sink calls) without the LVGL lock, which it only takes
+ **            to publish progress.
+ **
+ **            @section minigui_update.c - Streaming update with verification.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None (lvgl included via header)
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_update.h"
+#include "minigui_alloc.h"
+#include "minigui_config.h"
+#include "minigui_lock.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+#define UPDATE_PATH_MAX 128
+
+/**
+ * @brief Running update
+ */
+typedef struct {
+    const minigui_update_source_t *source;
+    const minigui_update_sink_t *sink;
+    lv_timer_t *timer;                  // Time-sliced mode only
+    bool worker;                        // Streamed by minigui_update_run()
+    bool claimed;                       // Worker picked the job up
+    bool cancel;                        // Worker mode: cancel requested
+    bool slow_warned;                   // Time-sliced mode: blocking call reported
+    minigui_sha256_t sha;
+    uint8_t expected[MINIGUI_SHA256_SIZE];
+    uint8_t digest[MINIGUI_SHA256_SIZE];
+    bool verify;
+    uint32_t start_ms;
+    uint32_t last_ui_ms;                // Last progress notification
+    uint32_t last_ui_bytes;
+    uint8_t buf[MINIGUI_UPDATE_CHUNK];
+} update_job_t;
+
+static update_job_t *job;
+static minigui_update_status_t status;
+static lv_subject_t progress_subject;
+static bool subject_ready;
+static int32_t progress_seq;
+static minigui_update_check_cb_t check_cb;
+static minigui_update_wake_cb_t worker_wake;
+
+static const char *source_path;
+static FILE *source_file;
+static const char *sink_path;
+static FILE *sink_file;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static lv_subject_t *subject(void) {
+    if (!subject_ready) {
+        lv_subject_init_int(&progress_subject, 0);
+        subject_ready = true;
+    }
+    return &progress_subject;
+}
+
+static void publish(void) {
+    lv_subject_set_int(subject(), ++progress_seq);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Updates throughput, elapsed time and ETA.
+ **
+ ** @section call_site Called from:
+ ** - tick_cb() and minigui_update_run() at most every MINIGUI_UPDATE_UI_MS,
+ **   release_job() (LVGL lock held).
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (tick, subject)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c inst (uint32_t): Throughput since the previous notification.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Smooth the throughput (3:1 with the previous value).
+ ** 2. Derive the ETA from the remaining bytes when the size is known.
+ ******************************************************************************
+ ******************************************************************************/
+static void update_rates(void) {
+    uint32_t now = lv_tick_get();
+    uint32_t dt = now - job->last_ui_ms;
+    if (dt) {
+        uint32_t inst = (uint32_t)(((uint64_t)(status.received - job->last_ui_bytes) * 1000u) / dt);
+        status.bytes_per_s = status.bytes_per_s ? (status.bytes_per_s * 3u + inst) / 4u : inst;
+    }
+    job->last_ui_ms = now;
+    job->last_ui_bytes = status.received;
+    status.elapsed_ms = now - job->start_ms;
+    status.eta_s = (status.total && status.bytes_per_s) ? (status.total - status.received) / status.bytes_per_s
+                                                        : UINT32_MAX;
+}
+
+/**
+ * @brief Closes the source and commits (DONE) or discards the sink
+ *
+ * No lock needed in worker mode: only the streaming side touches them. A
+ * failed commit turns DONE into FAILED.
+ */
+static void close_streams(update_job_t *j, minigui_update_state_t *state, const char **error) {
+    if (j->source->close) j->source->close(j->source->ctx);
+    bool committed = j->sink->finish ? j->sink->finish(j->sink->ctx, *state == MINIGUI_UPDATE_DONE) : true;
+    if (*state == MINIGUI_UPDATE_DONE && !committed) {
+        *state = MINIGUI_UPDATE_FAILED;
+        *error = "Could not finalize image";
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Releases the job and publishes its final state.
+ **
+ ** @section call_site Called from:
+ ** - end_job(), minigui_update_cancel(), worker_end() (LVGL lock held).
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_alloc.h (job storage)
+ **
+ ** @param state (minigui_update_state_t): DONE, FAILED or CANCELLED.
+ ** @param error (const char*): Reason for FAILED, or NULL.
+ **
+ ** @section pointers
+ ** - error: Static string.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Delete the timer (time-sliced mode), free the job.
+ ** 2. Log and publish the final state.
+ ******************************************************************************
+ ******************************************************************************/
+static void release_job(minigui_update_state_t state, const char *error) {
+    update_rates();
+    if (job->timer) lv_timer_delete(job->timer);
+    minigui_free(MINIGUI_POOL_INTERNAL, job);
+    job = NULL;
+
+    status.state = state;
+    status.error = error;
+    status.eta_s = state == MINIGUI_UPDATE_DONE ? 0 : UINT32_MAX;
+    if (state == MINIGUI_UPDATE_FAILED) {
+        LV_LOG_WARN("Update: failed after %lu bytes: %s", (unsigned long)status.received, error);
+    } else {
+        LV_LOG_USER("Update: %s, %lu bytes in %lu ms", state == MINIGUI_UPDATE_DONE ? "done" : "cancelled",
+                    (unsigned long)status.received, (unsigned long)status.elapsed_ms);
+    }
+    publish();
+}
+
+/**
+ * @brief Ends a time-sliced job
+ */
+static void end_job(minigui_update_state_t state, const char *error) {
+    close_streams(job, &state, &error);
+    release_job(state, error);
+}
+
+/**
+ * @brief Checks the complete image; returns the reason it is bad, or NULL
+ */
+static const char *verify(update_job_t *j, uint32_t received, uint32_t total) {
+    if (total && received != total) return "Image truncated";
+    minigui_sha256_final(&j->sha, j->digest);
+    if (j->verify && memcmp(j->digest, j->expected, MINIGUI_SHA256_SIZE) != 0) return "SHA-256 mismatch";
+    return NULL;
+}
+
+static void verify_and_end(void) {
+    const char *error = verify(job, status.received, status.total);
+    memcpy(status.sha256, job->digest, MINIGUI_SHA256_SIZE);
+    end_job(error ? MINIGUI_UPDATE_FAILED : MINIGUI_UPDATE_DONE, error);
+}
+
+/**
+ * @brief Reports a source or sink call that blocked the LVGL task
+ *
+ * Time-sliced mode only: such calls (e.g. a flash erase in the sink) freeze
+ * the UI and need a worker (minigui_update_set_worker()).
+ */
+static void check_slow(update_job_t *j, uint32_t t0, const char *what) {
+    LV_UNUSED(what);   // Only read by LV_LOG_WARN, which may be compiled out
+    uint32_t dt = lv_tick_elaps(t0);
+    if (dt <= MINIGUI_UPDATE_SLICE_MS || j->slow_warned) return;
+    j->slow_warned = true;
+    LV_LOG_WARN("Update: %s blocked the UI for %lu ms, register a worker", what, (unsigned long)dt);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Streams chunks for one time slice.
+ **
+ ** @section call_site Called from:
+ ** - Job timer every MINIGUI_UPDATE_TICK_MS.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_sha256.h (incremental hash)
+ **
+ ** @param timer (lv_timer_t*): The job timer.
+ **
+ ** @section pointers
+ ** - timer: Deleted by end_job().
+ **
+ ** @section variables Internal Variables:
+ ** - @c t0 (uint32_t): Slice start.
+ ** - @c n (int32_t): Source result for one read.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Read, hash and write chunks until MINIGUI_UPDATE_SLICE_MS passed or
+ **    the source has nothing ready.
+ ** 2. End of image (END, or all announced bytes received): verify.
+ ** 3. Read/write errors and oversize images end the job as FAILED.
+ ** 4. Publish progress if MINIGUI_UPDATE_UI_MS passed; warn once about a
+ **    sink write that took longer than a slice.
+ ******************************************************************************
+ ******************************************************************************/
+static void tick_cb(lv_timer_t *timer) {
+    (void)timer;
+    uint32_t t0 = lv_tick_get();
+    do {
+        int32_t n = job->source->read(job->source->ctx, job->buf, sizeof(job->buf));
+        if (n == 0) break;
+        if (n == MINIGUI_UPDATE_END) {
+            verify_and_end();
+            return;
+        }
+        if (n < 0) {
+            end_job(MINIGUI_UPDATE_FAILED, "Read error");
+            return;
+        }
+        if (status.total && (uint32_t)n > status.total - status.received) {
+            end_job(MINIGUI_UPDATE_FAILED, "Image larger than announced");
+            return;
+        }
+
+        minigui_sha256_update(&job->sha, job->buf, (size_t)n);
+        uint32_t tw = lv_tick_get();
+        if (!job->sink->write(job->sink->ctx, job->buf, (size_t)n)) {
+            end_job(MINIGUI_UPDATE_FAILED, "Write error");
+            return;
+        }
+        check_slow(job, tw, "sink write");
+        status.received += (uint32_t)n;
+        if (status.total && status.received == status.total) {
+            verify_and_end();
+            return;
+        }
+    } while (lv_tick_elaps(t0) < MINIGUI_UPDATE_SLICE_MS);
+
+    if (lv_tick_elaps(job->last_ui_ms) >= MINIGUI_UPDATE_UI_MS) {
+        update_rates();
+        publish();
+    }
+}
+
+#if MINIGUI_ENABLE_MOCKS
+#define MOCK_IMAGE_SIZE (1536u * 1024u)
+#define MOCK_RATE       (384u * 1024u)     // Bytes per second
+
+static uint32_t mock_pos;
+static uint32_t mock_start_ms;
+
+static bool mock_open(void *ctx, uint32_t *size) {
+    (void)ctx;
+    mock_pos = 0;
+    mock_start_ms = lv_tick_get();
+    *size = MOCK_IMAGE_SIZE;
+    return true;
+}
+
+/**
+ * @brief Pattern bytes at MOCK_RATE; 0 when the "network" has nothing yet
+ */
+static int32_t mock_read(void *ctx, uint8_t *buf, size_t max) {
+    (void)ctx;
+    if (mock_pos >= MOCK_IMAGE_SIZE) return MINIGUI_UPDATE_END;
+
+    uint64_t arrived = ((uint64_t)lv_tick_elaps(mock_start_ms) * MOCK_RATE) / 1000u;
+    if (arrived > MOCK_IMAGE_SIZE) arrived = MOCK_IMAGE_SIZE;
+    if (arrived <= mock_pos) return 0;
+    uint32_t n = (uint32_t)arrived - mock_pos;
+    if (n > max) n = (uint32_t)max;
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t p = mock_pos + i;
+        buf[i] = (uint8_t)(p * 31u ^ (p >> 8));
+    }
+    mock_pos += n;
+    return (int32_t)n;
+}
+
+static bool mock_begin(void *ctx, uint32_t size) {
+    (void)ctx;
+    (void)size;
+    return true;
+}
+
+static bool mock_write(void *ctx, const uint8_t *data, size_t len) {
+    (void)ctx;
+    (void)data;
+    (void)len;
+    return true;
+}
+
+static const minigui_update_source_t mock_source = { mock_open, mock_read, NULL, NULL };
+static const minigui_update_sink_t mock_sink = { mock_begin, mock_write, NULL, NULL };
+#endif // MINIGUI_ENABLE_MOCKS
+
+static bool file_open(void *ctx, uint32_t *size) {
+    (void)ctx;
+    source_file = fopen(source_path, "rb");
+    if (!source_file) return false;
+    long len = -1;
+    if (fseek(source_file, 0, SEEK_END) == 0) len = ftell(source_file);
+    if (len < 0 || fseek(source_file, 0, SEEK_SET) != 0) len = 0;
+    *size = (uint32_t)len;
+    return true;
+}
+
+static int32_t file_read(void *ctx, uint8_t *buf, size_t max) {
+    (void)ctx;
+    size_t n = fread(buf, 1, max, source_file);
+    if (n) return (int32_t)n;
+    return ferror(source_file) ? -2 : MINIGUI_UPDATE_END;
+}
+
+static void file_close(void *ctx) {
+    (void)ctx;
+    if (source_file) fclose(source_file);
+    source_file = NULL;
+}
+
+static void part_path(char *buf, size_t size) {
+    snprintf(buf, size, "%s.part", sink_path);
+}
+
+static bool file_begin(void *ctx, uint32_t size) {
+    (void)ctx;
+    (void)size;
+    char part[UPDATE_PATH_MAX];
+    part_path(part, sizeof(part));
+    sink_file = fopen(part, "wb");
+    return sink_file != NULL;
+}
+
+static bool file_write(void *ctx, const uint8_t *data, size_t len) {
+    (void)ctx;
+    return fwrite(data, 1, len, sink_file) == len;
+}
+
+static bool file_finish(void *ctx, bool commit) {
+    (void)ctx;
+    char part[UPDATE_PATH_MAX];
+    part_path(part, sizeof(part));
+    bool ok = sink_file && fclose(sink_file) == 0;
+    sink_file = NULL;
+    if (commit && ok) return rename(part, sink_path) == 0;
+    remove(part);
+    return !commit;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+void minigui_register_update_check_cb(minigui_update_check_cb_t cb) {
+    check_cb = cb;
+}
+
+bool minigui_update_check(minigui_update_offer_t *offer) {
+    if (!offer) return false;
+    if (check_cb) return check_cb(offer);
+
+#if MINIGUI_ENABLE_MOCKS
+    // Alternate between "up to date" and an update, like a server would over time
+    static bool mock_update_found = false;
+    mock_update_found = !mock_update_found;
+    if (mock_update_found) {
+        offer->version = "v1.2.0";
+        offer->source = &mock_source;
+        offer->sink = &mock_sink;
+        offer->sha256 = NULL;
+    }
+    return mock_update_found;
+#else
+    return false;
+#endif
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Start streaming an update.
+ **
+ ** @section call_site Called from:
+ ** - Settings System panel, application code.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_alloc.h (job storage)
+ ** - lvgl.h (timer)
+ **
+ ** @param offer (const minigui_update_offer_t*): Update to install.
+ **
+ ** @section pointers
+ ** - offer: Source, sink and version referenced until the job ends.
+ **
+ ** @section variables Internal Variables:
+ ** - @c j (update_job_t*): New job.
+ ** - @c size (uint32_t): Size announced by the source.
+ **
+ ** @return bool: true if the update started.
+ **
+ ** Implementation Steps:
+ ** 1. Reject a second update and incomplete offers.
+ ** 2. Allocate the job, init the hash, copy the expected digest.
+ ** 3. With a worker: publish RUNNING and wake it; it opens the streams.
+ ** 4. Otherwise open the source and begin the sink (on failure publish
+ **    FAILED), start the work timer and publish RUNNING.
+ ******************************************************************************
+ ******************************************************************************/
+bool minigui_update_start(const minigui_update_offer_t *offer) {
+    if (!offer || !offer->source || !offer->source->read || !offer->sink || !offer->sink->write) return false;
+
+    MINIGUI_LOCK();
+    if (job) {
+        MINIGUI_UNLOCK();
+        return false;
+    }
+
+    update_job_t *j = (update_job_t *)minigui_malloc(MINIGUI_POOL_INTERNAL, sizeof(update_job_t));
+    if (!j) {
+        LV_LOG_ERROR("Update: out of memory (%lu bytes)", (unsigned long)sizeof(update_job_t));
+        MINIGUI_UNLOCK();
+        return false;
+    }
+    memset(j, 0, offsetof(update_job_t, buf));
+    j->source = offer->source;
+    j->sink = offer->sink;
+    j->verify = offer->sha256 != NULL;
+    if (j->verify) memcpy(j->expected, offer->sha256, MINIGUI_SHA256_SIZE);
+    minigui_sha256_init(&j->sha);
+
+    memset(&status, 0, sizeof(status));
+    status.version = offer->version;
+    status.eta_s = UINT32_MAX;
+
+    if (worker_wake) {
+        j->worker = true;
+        job = j;
+        j->start_ms = j->last_ui_ms = lv_tick_get();
+        status.state = MINIGUI_UPDATE_RUNNING;
+        LV_LOG_USER("Update: installing %s", offer->version ? offer->version : "?");
+        publish();
+        MINIGUI_UNLOCK();
+        worker_wake();
+        return true;
+    }
+
+    uint32_t size = 0;
+    const char *error = NULL;
+    uint32_t tb = lv_tick_get();
+    if (j->source->open && !j->source->open(j->source->ctx, &size)) {
+        error = "Cannot open image";
+    } else if (j->sink->begin && !j->sink->begin(j->sink->ctx, size)) {
+        if (j->source->close) j->source->close(j->source->ctx);
+        error = "Cannot start writing";
+    } else if (!(j->timer = lv_timer_create(tick_cb, MINIGUI_UPDATE_TICK_MS, NULL))) {
+        if (j->source->close) j->source->close(j->source->ctx);
+        if (j->sink->finish) j->sink->finish(j->sink->ctx, false);
+        error = "Out of memory";
+    }
+    if (error) {
+        minigui_free(MINIGUI_POOL_INTERNAL, j);
+        status.state = MINIGUI_UPDATE_FAILED;
+        status.error = error;
+        LV_LOG_WARN("Update: %s", error);
+        publish();
+        MINIGUI_UNLOCK();
+        return false;
+    }
+
+    check_slow(j, tb, "opening the image");
+    job = j;
+    j->start_ms = j->last_ui_ms = lv_tick_get();
+    status.state = MINIGUI_UPDATE_RUNNING;
+    status.total = size;
+    LV_LOG_USER("Update: installing %s (%lu bytes)", offer->version ? offer->version : "?", (unsigned long)size);
+    publish();
+    MINIGUI_UNLOCK();
+    return true;
+}
+
+void minigui_update_cancel(void) {
+    MINIGUI_LOCK();
+    if (job && !job->worker) {
+        end_job(MINIGUI_UPDATE_CANCELLED, NULL);
+    } else if (job && !job->claimed) {
+        release_job(MINIGUI_UPDATE_CANCELLED, NULL);   // Streams not opened yet
+    } else if (job) {
+        job->cancel = true;                             // The worker ends it after its current call
+    }
+    MINIGUI_UNLOCK();
+}
+
+void minigui_update_set_worker(minigui_update_wake_cb_t wake) {
+    MINIGUI_LOCK();
+    worker_wake = wake;
+    MINIGUI_UNLOCK();
+}
+
+/**
+ * @brief Publishes the end of a worker job (streams already closed)
+ */
+static void worker_end(update_job_t *j, uint32_t received, minigui_update_state_t state, const char *error) {
+    MINIGUI_LOCK();
+    status.received = received;
+    memcpy(status.sha256, j->digest, MINIGUI_SHA256_SIZE);
+    release_job(state, error);
+    MINIGUI_UNLOCK();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Stream the pending update on the calling task.
+ **
+ ** @section call_site Called from:
+ ** - Application worker task, after the wake callback fired.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_sha256.h (incremental hash)
+ ** - minigui_lock.h (progress updates only)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c j (update_job_t*): Job claimed by this call.
+ ** - @c received (uint32_t): Bytes written, published under the lock.
+ ** - @c cancel (bool): Cancel request seen at the last progress update.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Claim the pending worker job under the lock; return if there is none.
+ ** 2. Open the source and begin the sink without the lock.
+ ** 3. Read, hash and write chunks; sleep MINIGUI_UPDATE_TICK_MS when the
+ **    source has nothing ready. After each step take the lock to store the
+ **    byte count, pick up a cancel and publish every MINIGUI_UPDATE_UI_MS.
+ ** 4. Verify, close the streams without the lock, then publish the end.
+ ******************************************************************************
+ ******************************************************************************/
+void minigui_update_run(void) {
+    MINIGUI_LOCK();
+    update_job_t *j = job;
+    if (!j || !j->worker || j->claimed) {
+        MINIGUI_UNLOCK();
+        return;
+    }
+    j->claimed = true;
+    MINIGUI_UNLOCK();
+
+    uint32_t size = 0;
+    if (j->source->open && !j->source->open(j->source->ctx, &size)) {
+        worker_end(j, 0, MINIGUI_UPDATE_FAILED, "Cannot open image");
+        return;
+    }
+    if (j->sink->begin && !j->sink->begin(j->sink->ctx, size)) {
+        if (j->source->close) j->source->close(j->source->ctx);
+        worker_end(j, 0, MINIGUI_UPDATE_FAILED, "Cannot start writing");
+        return;
+    }
+
+    MINIGUI_LOCK();
+    status.total = size;
+    bool cancel = j->cancel;
+    publish();
+    MINIGUI_UNLOCK();
+
+    uint32_t received = 0;
+    minigui_update_state_t state = MINIGUI_UPDATE_FAILED;
+    const char *error = NULL;
+    for (;;) {
+        if (cancel) {
+            state = MINIGUI_UPDATE_CANCELLED;
+            break;
+        }
+        int32_t n = j->source->read(j->source->ctx, j->buf, sizeof(j->buf));
+        if (n == MINIGUI_UPDATE_END) {
+            error = verify(j, received, size);
+            break;
+        }
+        if (n < 0) {
+            error = "Read error";
+            break;
+        }
+        if (n == 0) {
+            lv_delay_ms(MINIGUI_UPDATE_TICK_MS);
+        } else {
+            if (size && (uint32_t)n > size - received) {
+                error = "Image larger than announced";
+                break;
+            }
+            minigui_sha256_update(&j->sha, j->buf, (size_t)n);
+            if (!j->sink->write(j->sink->ctx, j->buf, (size_t)n)) {
+                error = "Write error";
+                break;
+            }
+            received += (uint32_t)n;
+            if (size && received == size) {
+                error = verify(j, received, size);
+                break;
+            }
+        }
+
+        MINIGUI_LOCK();
+        status.received = received;
+        cancel = j->cancel;
+        if (lv_tick_elaps(j->last_ui_ms) >= MINIGUI_UPDATE_UI_MS) {
+            update_rates();
+            publish();
+        }
+        MINIGUI_UNLOCK();
+    }
+    if (state != MINIGUI_UPDATE_CANCELLED && !error) state = MINIGUI_UPDATE_DONE;
+
+    close_streams(j, &state, &error);
+    worker_end(j, received, state, error);
+}
+
+bool minigui_update_is_running(void) {
+    MINIGUI_LOCK();
+    bool running = job != NULL;
+    MINIGUI_UNLOCK();
+    return running;
+}
+
+void minigui_update_get_status(minigui_update_status_t *out) {
+    if (!out) return;
+    MINIGUI_LOCK();
+    *out = status;
+    MINIGUI_UNLOCK();
+}
+
+lv_subject_t *minigui_update_subject(void) {
+    MINIGUI_LOCK();
+    lv_subject_t *s = subject();
+    MINIGUI_UNLOCK();
+    return s;
+}
+
+const minigui_update_source_t *minigui_update_file_source(const char *path) {
+    static const minigui_update_source_t source = { file_open, file_read, file_close, NULL };
+    source_path = path;
+    return &source;
+}
+
+const minigui_update_sink_t *minigui_update_file_sink(const char *path) {
+    static const minigui_update_sink_t sink = { file_begin, file_write, file_finish, NULL };
+    sink_path = path;
+    return &sink;
+}
@@ -0,0 +1,209 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Virtualized List Implementation.
+ **
+ **            Row k of the pool always shows an entry with index % pool == k,
+ **            so when the first visible entry moves by one, exactly one row
+ **            is repositioned and rebound; rows that stay in view are not
+ **            touched.
+ **
+ **            @section minigui_vlist.c - Row pool and recycling.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <string.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None (lvgl included via header)
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_vlist.h"
+#include "minigui_alloc.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+#define VLIST_UNBOUND UINT32_MAX
+
+/**
+ * @brief List state (user data of the list object)
+ */
+typedef struct {
+    int32_t row_h;
+    uint32_t count;
+    minigui_vlist_create_cb_t create_cb;
+    minigui_vlist_bind_cb_t bind_cb;
+    void *user_data;
+    uint8_t pool;                                // Row objects created
+    lv_obj_t *rows[MINIGUI_VLIST_MAX_ROWS];
+    uint32_t bound[MINIGUI_VLIST_MAX_ROWS];      // Entry shown by each row
+} vlist_t;
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Brings every row to the entry it must show.
+ **
+ ** @section call_site Called from:
+ ** - Scroll, size and count changes, minigui_vlist_refresh().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (scroll position, hidden flag)
+ **
+ ** @param list (lv_obj_t*): List object.
+ ** @param v (vlist_t*): Its state.
+ ** @param force (bool): Rebind rows even if their entry did not change.
+ **
+ ** @section pointers
+ ** - list, v: Owned by the list.
+ **
+ ** @section variables Internal Variables:
+ ** - @c first (uint32_t): First entry at least partly in view.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Derive the first visible entry from the scroll position.
+ ** 2. Give row k the entry in [first, first + pool) congruent to k.
+ ** 3. Hide rows past the end; move and rebind rows whose entry changed.
+ ******************************************************************************
+ ******************************************************************************/
+static void sync_rows(lv_obj_t *list, vlist_t *v, bool force) {
+    if (v->pool == 0) return;
+
+    int32_t scroll = lv_obj_get_scroll_y(list);
+    uint32_t first = scroll > 0 ? (uint32_t)(scroll / v->row_h) : 0;
+
+    for (uint32_t k = 0; k < v->pool; k++) {
+        uint32_t index = first + (k + v->pool - first % v->pool) % v->pool;
+        lv_obj_t *row = v->rows[k];
+
+        if (index >= v->count) {
+            if (v->bound[k] != VLIST_UNBOUND) {
+                lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+                v->bound[k] = VLIST_UNBOUND;
+            }
+            continue;
+        }
+        if (!force && v->bound[k] == index) continue;
+
+        if (v->bound[k] == VLIST_UNBOUND) lv_obj_remove_flag(row, LV_OBJ_FLAG_HIDDEN);
+        v->bound[k] = index;
+        lv_obj_set_user_data(row, (void *)(uintptr_t)index);
+        lv_obj_set_y(row, (int32_t)index * v->row_h);
+        v->bind_cb(row, index, v->user_data);
+    }
+}
+
+static void ensure_pool(lv_obj_t *list, vlist_t *v) {
+    int32_t h = lv_obj_get_content_height(list);
+    if (h <= 0) return;
+
+    uint32_t needed = (uint32_t)((h + v->row_h - 1) / v->row_h) + 1;
+    if (needed > MINIGUI_VLIST_MAX_ROWS) needed = MINIGUI_VLIST_MAX_ROWS;
+    if (needed <= v->pool) return;
+
+    while (v->pool < needed) {
+        lv_obj_t *row = v->create_cb(list, v->user_data);
+        if (!row) break;
+        lv_obj_set_size(row, lv_pct(100), v->row_h);
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        v->rows[v->pool] = row;
+        v->bound[v->pool] = VLIST_UNBOUND;
+        v->pool++;
+    }
+    sync_rows(list, v, true);  // The congruence classes changed with the pool size
+}
+
+static void vlist_event_cb(lv_event_t *e) {
+    lv_obj_t *list = lv_event_get_target(e);
+    vlist_t *v = (vlist_t *)lv_event_get_user_data(e);
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_SCROLL:
+            sync_rows(list, v, false);
+            break;
+        case LV_EVENT_SIZE_CHANGED:
+            ensure_pool(list, v);
+            break;
+        case LV_EVENT_GET_SELF_SIZE: {
+            lv_point_t *p = (lv_point_t *)lv_event_get_param(e);
+            int32_t h = (int32_t)v->count * v->row_h;
+            if (h > p->y) p->y = h;
+            break;
+        }
+        case LV_EVENT_DELETE:
+            minigui_free(MINIGUI_POOL_INTERNAL, v);
+            break;
+        default:
+            break;
+    }
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+lv_obj_t *minigui_vlist_create(lv_obj_t *parent, int32_t row_h, minigui_vlist_create_cb_t create_cb,
+                               minigui_vlist_bind_cb_t bind_cb, void *user_data) {
+    if (!create_cb || !bind_cb || row_h <= 0) return NULL;
+
+    vlist_t *v = (vlist_t *)minigui_malloc(MINIGUI_POOL_INTERNAL, sizeof(*v));
+    if (!v) {
+        LV_LOG_ERROR("VList: allocation failed");
+        return NULL;
+    }
+    memset(v, 0, sizeof(*v));
+    v->row_h = row_h;
+    v->create_cb = create_cb;
+    v->bind_cb = bind_cb;
+    v->user_data = user_data;
+
+    lv_obj_t *list = lv_obj_create(parent);
+    lv_obj_set_user_data(list, v);
+    lv_obj_set_scroll_dir(list, LV_DIR_VER);
+    lv_obj_add_event_cb(list, vlist_event_cb, LV_EVENT_ALL, v);
+    return list;
+}
+
+void minigui_vlist_set_count(lv_obj_t *list, uint32_t count) {
+    vlist_t *v = (vlist_t *)lv_obj_get_user_data(list);
+    if (!v) return;
+
+    v->count = count;
+    lv_obj_refresh_self_size(list);
+    lv_obj_scroll_to_y(list, 0, LV_ANIM_OFF);
+    ensure_pool(list, v);
+    sync_rows(list, v, true);
+}
+
+void minigui_vlist_refresh(lv_obj_t *list) {
+    vlist_t *v = (vlist_t *)lv_obj_get_user_data(list);
+    if (v) sync_rows(list, v, true);
+}
+
+uint32_t minigui_vlist_get_index(const lv_obj_t *row) {
+    return (uint32_t)(uintptr_t)lv_obj_get_user_data((lv_obj_t *)row);
+}
+
+uint32_t minigui_vlist_get_row_count(const lv_obj_t *list) {
+    const vlist_t *v = (const vlist_t *)lv_obj_get_user_data((lv_obj_t *)list);
+    return v ? v->pool : 0;
+}
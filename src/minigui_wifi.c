@@ -0,0 +1,233 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Wi-Fi Apply Flow Implementation.
+ **
+ **            One request at a time. Each request gets a new id, so reports
+ **            that arrive after a cancel, timeout or newer request are
+ **            dropped instead of overwriting the visible state.
+ **
+ **            @section minigui_wifi.c - Asynchronous credential apply.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+// None
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+// None (lvgl included via header)
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui_wifi.h"
+#include "minigui_lock.h"
+
+// ============================================================================
+//  TYPES & STATE
+// ============================================================================
+
+static minigui_wifi_apply_cb_t apply_cb;
+static minigui_wifi_cancel_cb_t cancel_cb;
+
+static uint32_t current_request;      // Running request, 0 when idle
+static uint32_t last_request;
+static lv_timer_t *timeout_timer;
+static lv_subject_t stage_subject;
+static bool subject_ready;
+
+static const char *const stage_text[MINIGUI_WIFI_APPLY_STAGE_COUNT] = {
+    [MINIGUI_WIFI_APPLY_IDLE]        = "",
+    [MINIGUI_WIFI_APPLY_SAVING]      = "Saving...",
+    [MINIGUI_WIFI_APPLY_SAVED]       = "Saved",
+    [MINIGUI_WIFI_APPLY_ASSOCIATING] = "Connecting...",
+    [MINIGUI_WIFI_APPLY_DHCP]        = "Getting IP address...",
+    [MINIGUI_WIFI_APPLY_CONNECTED]   = "Connected",
+    [MINIGUI_WIFI_APPLY_FAILED]      = "Connection failed",
+    [MINIGUI_WIFI_APPLY_TIMEOUT]     = "Timed out",
+    [MINIGUI_WIFI_APPLY_CANCELLED]   = "Cancelled",
+};
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static lv_subject_t *subject(void) {
+    if (!subject_ready) {
+        lv_subject_init_int(&stage_subject, MINIGUI_WIFI_APPLY_IDLE);
+        subject_ready = true;
+    }
+    return &stage_subject;
+}
+
+static bool is_final(minigui_wifi_apply_stage_t stage) {
+    return stage >= MINIGUI_WIFI_APPLY_CONNECTED;
+}
+
+static void publish(minigui_wifi_apply_stage_t stage) {
+    LV_LOG_USER("WiFi apply #%lu: %s", (unsigned long)last_request, stage_text[stage]);
+    lv_subject_set_int(subject(), stage);
+}
+
+/**
+ * @brief Ends the running request with @p stage (caller holds the lock)
+ */
+static void finish(minigui_wifi_apply_stage_t stage) {
+    if (timeout_timer) {
+        lv_timer_delete(timeout_timer);
+        timeout_timer = NULL;
+    }
+    current_request = 0;
+    publish(stage);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Ends a request that did not reach a final stage in time.
+ **
+ ** @section call_site Called from:
+ ** - LVGL timer, MINIGUI_WIFI_APPLY_TIMEOUT_MS after minigui_wifi_apply().
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (timer)
+ **
+ ** @param timer (lv_timer_t*): The timeout timer (deleted here).
+ **
+ ** @section pointers
+ ** - timer: Owned by this module.
+ **
+ ** @section variables Internal Variables:
+ ** - @c request (uint32_t): Id handed to the cancel handler.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Publish TIMEOUT, which also deletes the timer.
+ ** 2. Tell the integration to stop connecting.
+ ******************************************************************************
+ ******************************************************************************/
+static void timeout_cb(lv_timer_t *timer) {
+    (void)timer;
+    uint32_t request = current_request;
+    finish(MINIGUI_WIFI_APPLY_TIMEOUT);
+    if (request && cancel_cb) cancel_cb(request);
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+void minigui_register_wifi_apply_cb(minigui_wifi_apply_cb_t apply, minigui_wifi_cancel_cb_t cancel) {
+    MINIGUI_LOCK();
+    apply_cb = apply;
+    cancel_cb = cancel;
+    MINIGUI_UNLOCK();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Start applying credentials.
+ **
+ ** @section call_site Called from:
+ ** - Settings Wi-Fi form, application code.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (timer, subject)
+ ** - minigui.h (legacy save callback)
+ **
+ ** @param creds (const minigui_wifi_credentials_t*): Credentials.
+ **
+ ** @section pointers
+ ** - creds: Only read during the call.
+ **
+ ** @section variables Internal Variables:
+ ** - @c request (uint32_t): New request id.
+ **
+ ** @return uint32_t: Request id (never 0), or 0 for NULL credentials.
+ **
+ ** Implementation Steps:
+ ** 1. Cancel a running request; take the next non-zero id.
+ ** 2. Publish SAVING and arm the one-shot timeout.
+ ** 3. Async handler: pass the request on, FAILED if it is rejected.
+ **    Otherwise run the legacy save callback and end at SAVED, or FAILED
+ **    when nothing is registered.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t minigui_wifi_apply(const minigui_wifi_credentials_t *creds) {
+    if (!creds) return 0;
+
+    MINIGUI_LOCK();
+    if (current_request) minigui_wifi_apply_cancel();
+
+    uint32_t request = ++last_request;
+    if (request == 0) request = last_request = 1;
+    current_request = request;
+    publish(MINIGUI_WIFI_APPLY_SAVING);
+
+    if (apply_cb) {
+        timeout_timer = lv_timer_create(timeout_cb, MINIGUI_WIFI_APPLY_TIMEOUT_MS, NULL);
+        if (!apply_cb(creds, request) && current_request == request) finish(MINIGUI_WIFI_APPLY_FAILED);
+    } else if (minigui_save_wifi_credentials(creds)) {
+        finish(MINIGUI_WIFI_APPLY_SAVED);
+    } else {
+        LV_LOG_WARN("WiFi apply: no handler registered");
+        finish(MINIGUI_WIFI_APPLY_FAILED);
+    }
+    MINIGUI_UNLOCK();
+    return request;
+}
+
+void minigui_wifi_apply_report(uint32_t request, minigui_wifi_apply_stage_t stage) {
+    if (stage <= MINIGUI_WIFI_APPLY_SAVING || stage >= MINIGUI_WIFI_APPLY_STAGE_COUNT) return;
+
+    MINIGUI_LOCK();
+    if (request && request == current_request) {
+        if (is_final(stage)) {
+            finish(stage);
+        } else {
+            publish(stage);
+        }
+    }
+    MINIGUI_UNLOCK();
+}
+
+void minigui_wifi_apply_cancel(void) {
+    MINIGUI_LOCK();
+    uint32_t request = current_request;
+    if (request) {
+        finish(MINIGUI_WIFI_APPLY_CANCELLED);
+        if (cancel_cb) cancel_cb(request);
+    }
+    MINIGUI_UNLOCK();
+}
+
+minigui_wifi_apply_stage_t minigui_wifi_apply_get_stage(void) {
+    MINIGUI_LOCK();
+    minigui_wifi_apply_stage_t stage = (minigui_wifi_apply_stage_t)lv_subject_get_int(subject());
+    MINIGUI_UNLOCK();
+    return stage;
+}
+
+bool minigui_wifi_apply_is_busy(void) {
+    return current_request != 0;
+}
+
+const char *minigui_wifi_apply_stage_text(minigui_wifi_apply_stage_t stage) {
+    return stage < MINIGUI_WIFI_APPLY_STAGE_COUNT ? stage_text[stage] : "";
+}
+
+lv_subject_t *minigui_wifi_apply_subject(void) {
+    MINIGUI_LOCK();
+    lv_subject_t *s = subject();
+    MINIGUI_UNLOCK();
+    return s;
+}
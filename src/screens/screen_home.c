@@ -30,6 +30,9 @@
  ******************************************************************************/
 #include "screens/screen_home.h"
 #include "minigui.h"
+#include "minigui_layout.h"
+#include "minigui_draw.h"
+#include "minigui_theme.h"
 
 // ============================================================================
 // PRIVATE HELPER FUNCTIONS
@@ -44,45 +47,43 @@
  **
  ** @section dependencies Required Headers:
  ** - lvgl.h (for widget construction)
+ ** - minigui_draw.h (card texts are drawn by the card itself)
  **
  ** @param parent (lv_obj_t*): The container object to hold the card.
  ** @param title (const char*): Title text (e.g., "Indoor").
  ** @param value (const char*): Value text (e.g., "72°F").
  ** @param color (lv_color_t): Card background color.
+ ** @param layout (const minigui_layout_t*): Resolved layout metrics.
  **
  ** @section pointers 
  ** - parent: Managed by caller.
  ** - title/value: Read-only string literals.
+ ** - layout: Cached by minigui_layout.c.
  **
  ** @section variables Internal Variables:
- ** - @c card (lv_obj_t*): The primary container for the card.
- ** - @c lbl_title (lv_obj_t*): Label for the card heading.
- ** - @c lbl_val (lv_obj_t*): Label for the main data value.
+ ** - @c card (lv_obj_t*): The only object of the card.
+ ** - @c texts (minigui_draw_list_t*): Title and value, drawn by @c card.
  **
  ** @return void
  **
  ** Implementation Steps:
  ** 1. Create a container object (@c card) on the parent.
- ** 2. Configure card geometry (220x150) and background color.
- ** 3. Create the title label using Montserrat-24 and align top-left.
- ** 4. Create the value label using Montserrat-36 and center it.
+ ** 2. Configure card geometry (profile card size) and background color.
+ ** 3. Draw the title in Montserrat-24 top-left and the value in
+ **    Montserrat-36 centered, without label objects.
  ******************************************************************************
  ******************************************************************************/
-static void create_info_card(lv_obj_t *parent, const char* title, const char* value, lv_color_t color) {
+static void create_info_card(lv_obj_t *parent, const char* title, const char* value, lv_color_t color,
+                             const minigui_layout_t *layout) {
     lv_obj_t *card = lv_obj_create(parent);
-    lv_obj_set_size(card, 220, 150);
-    lv_obj_set_style_bg_color(card, color, 0);
+    lv_obj_set_size(card, layout->card_w, layout->card_h);
+    lv_obj_set_style_bg_color(card, color, 0);  // Accent, same in every theme
     lv_obj_set_style_border_width(card, 0, 0);
+    lv_obj_add_style(card, minigui_theme_style(MINIGUI_THEME_CARD), 0);
 
-    lv_obj_t *lbl_title = lv_label_create(card);
-    lv_label_set_text(lbl_title, title);
-    lv_obj_set_style_text_font(lbl_title, &lv_font_montserrat_24, 0);
-    lv_obj_align(lbl_title, LV_ALIGN_TOP_LEFT, 0, 0);
-
-    lv_obj_t *lbl_val = lv_label_create(card);
-    lv_label_set_text(lbl_val, value);
-    lv_obj_set_style_text_font(lbl_val, &lv_font_montserrat_36, 0);
-    lv_obj_center(lbl_val);
+    minigui_draw_list_t *texts = minigui_draw_attach(card, 2);
+    minigui_draw_add_text(texts, title, &lv_font_montserrat_24, LV_ALIGN_TOP_LEFT, 0);
+    minigui_draw_add_text(texts, value, &lv_font_montserrat_36, LV_ALIGN_CENTER, 0);
 }
 
 // ============================================================================
@@ -118,8 +119,7 @@ static void create_info_card(lv_obj_t *parent, const char* title, const char* va
  ******************************************************************************/
 void create_screen_home(lv_obj_t *parent) {
     // 1. Set styles on the content area specifically for Home
-    lv_obj_set_style_bg_color(parent, lv_color_black(), 0);
-    lv_obj_set_style_bg_opa(parent, LV_OPA_COVER, 0);
+    lv_obj_add_style(parent, minigui_theme_style(MINIGUI_THEME_SCREEN), 0);
 
     // 2. Create Layout Container for Cards
     lv_obj_t *cont = lv_obj_create(parent);
@@ -131,7 +131,8 @@ void create_screen_home(lv_obj_t *parent) {
     lv_obj_set_style_border_width(cont, 0, 0);
 
     // 3. Create Cards
-    create_info_card(cont, "Indoor", "72°F", lv_palette_darken(LV_PALETTE_BLUE, 2));
-    create_info_card(cont, "Outdoor", "85°F", lv_palette_darken(LV_PALETTE_ORANGE, 2));
-    create_info_card(cont, "Status", "Good", lv_palette_darken(LV_PALETTE_GREEN, 2));
+    const minigui_layout_t *layout = minigui_layout_get();
+    create_info_card(cont, "Indoor", "72°F", lv_palette_darken(LV_PALETTE_BLUE, 2), layout);
+    create_info_card(cont, "Outdoor", "85°F", lv_palette_darken(LV_PALETTE_ORANGE, 2), layout);
+    create_info_card(cont, "Status", "Good", lv_palette_darken(LV_PALETTE_GREEN, 2), layout);
 }
@@ -14,7 +14,6 @@
  ** 1. ESP-IDF / FreeRTOS Core (Framework)
  ******************************************************************************
  ******************************************************************************/
-#include <stdlib.h>  // For malloc/free
 #include <string.h>  // For strcpy, strcmp, etc.
 #include <time.h>    // For mock timestamps
 
@@ -32,6 +31,12 @@
  ******************************************************************************/
 #include "screens/screen_logs.h"
 #include "minigui.h"
+#include "minigui_alloc.h"
+#include "minigui_ctx.h"
+#include "minigui_layout.h"
+#include "minigui_log_store.h"
+#include "minigui_metrics.h"
+#include "minigui_theme.h"
 
 /******************************************************************************
  ******************************************************************************
@@ -41,42 +46,24 @@
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Reference to the main data table.
+ ** @brief State of one open Logs screen.
  **
  ** @section scope Internal Scope:
- ** - Internal to screen_logs.c.
- **
- ** @section rationale Rationale:
- ** - Displays the list of log entries. Need handle to update data.
- ******************************************************************************
- ******************************************************************************/
-static lv_obj_t *data_table = NULL;
-
-/******************************************************************************
- ******************************************************************************
- ** @brief Reference to the source filter dropdown.
- **
- ** @section scope Internal Scope:
- ** - Internal to screen_logs.c.
+ ** - Internal to screen_logs.c, one per context showing Logs.
  **
  ** @section rationale Rationale:
- ** - Allows user to filter logs by source (e.g., wifi, system).
+ ** - Each display gets its own table and filter; the log store and provider
+ **   behind them are shared.
+ ** - Allocated by create_screen_logs(), freed when the table is deleted.
  ******************************************************************************
  ******************************************************************************/
-static lv_obj_t *filter_dropdown = NULL;
-
-/******************************************************************************
- ******************************************************************************
- ** @brief Reference to the parent screen object.
- **
- ** @section scope Internal Scope:
- ** - Internal to screen_logs.c.
- **
- ** @section rationale Rationale:
- ** - Used to calculate available width for the table.
- ******************************************************************************
- ******************************************************************************/
-static lv_obj_t *log_screen_parent = NULL;
+typedef struct {
+    minigui_ctx_t *ctx;       // Context the screen was built in
+    lv_obj_t *parent;         // Content area; used to calculate available table width
+    lv_obj_t *table;          // Displays the list of log entries
+    lv_obj_t *filter;         // Source filter dropdown (e.g., wifi, system)
+    lv_timer_t *load_timer;   // Pending deferred first load, NULL once it ran
+} logs_view_t;
 
 /******************************************************************************
  ******************************************************************************
@@ -137,10 +124,10 @@ void minigui_set_log_provider(minigui_log_provider_t provider) {
  ** @section dependencies Required Headers:
  ** - lvgl.h (table manipulation)
  **
- ** @param None
+ ** @param view (logs_view_t*): Screen whose table is cleared.
  **
  ** @section pointers 
- ** - None
+ ** - view: Owned by the screen.
  **
  ** @section variables 
  ** - None
@@ -148,20 +135,20 @@ void minigui_set_log_provider(minigui_log_provider_t provider) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Iterate through all rows in the data_table.
+ ** 1. Iterate through all rows in the view's table.
  ** 2. Set columns 0-3 (Time, Source, Level, Message) to empty strings.
  ******************************************************************************
  ******************************************************************************/
-static void clear_table_cells(void) {
-    if (!data_table) return;
+static void clear_table_cells(logs_view_t *view) {
+    if (!view->table) return;
 
     // Clear all existing cells
-    uint16_t row_count = lv_table_get_row_cnt(data_table);
+    uint16_t row_count = lv_table_get_row_cnt(view->table);
     for (uint16_t row = 0; row < row_count; row++) {
-        lv_table_set_cell_value(data_table, row, 0, "");
-        lv_table_set_cell_value(data_table, row, 1, "");
-        lv_table_set_cell_value(data_table, row, 2, "");
-        lv_table_set_cell_value(data_table, row, 3, "");
+        lv_table_set_cell_value(view->table, row, 0, "");
+        lv_table_set_cell_value(view->table, row, 1, "");
+        lv_table_set_cell_value(view->table, row, 2, "");
+        lv_table_set_cell_value(view->table, row, 3, "");
     }
 }
 
@@ -170,7 +157,8 @@ static void clear_table_cells(void) {
  ** @brief Internal mock data provider for standalone UI development.
  **
  ** @section call_site Called from:
- ** - update_table_with_logs() if no provider is registered.
+ ** - update_table_with_logs() if no provider is registered and the log
+ **   store is empty.
  **
  ** @section dependencies Required Headers:
  ** - time.h (for simulation)
@@ -241,82 +229,96 @@ static size_t internal_get_logs(minigui_log_entry_t *logs, size_t max_count, con
  ** - deferred_load_cb()
  **
  ** @section dependencies Required Headers:
- ** - stdlib.h (malloc/free)
+ ** - minigui_alloc.h (minigui_malloc/minigui_free)
  **
+ ** @param view (logs_view_t*): Screen to fill.
  ** @param filter (const char*): The source string to filter by (or "ALL").
  **
  ** @section pointers 
+ ** - view: Owned by the screen.
  ** - filter: Read-only string.
  **
  ** @section variables Internal Variables:
- ** - @c logs (minigui_log_entry_t*): Heap-allocated temp buffer for fetch.
+ ** - @c logs (minigui_log_entry_t*): Temp fetch buffer from the internal pool.
  **
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Show "Loading..." message and force immediate screen refresh.
- ** 2. Allocate heap buffer for log retrieval.
- ** 3. Fetch data from global provider or fallback mock.
+ ** 1. Show "Loading..." message and force an immediate refresh of the
+ **    view's display.
+ ** 2. Allocate the fetch buffer from the internal RAM pool.
+ ** 3. Fetch data from global provider, the log store, or fallback mock.
  ** 4. Update table row count and populate cells.
- ** 5. Free temporary heap memory.
+ ** 5. Return the buffer to the pool.
  ******************************************************************************
  ******************************************************************************/
-static void update_table_with_logs(const char *filter) {
-    if (!data_table) return;
+static void update_table_with_logs(logs_view_t *view, const char *filter) {
+    if (!view->table) return;
 
     LV_LOG_USER("Refreshing log table with filter: %s", filter ? filter : "ALL");
 
     // Clear the table first for better UX
-    clear_table_cells();
-    lv_table_set_row_cnt(data_table, 1);
-    lv_table_set_cell_value(data_table, 0, 3, "Loading...");
+    clear_table_cells(view);
+    lv_table_set_row_cnt(view->table, 1);
+    lv_table_set_cell_value(view->table, 0, 3, "Loading...");
 
     // Force LVGL to update immediately
-    lv_refr_now(NULL);
+    lv_refr_now(lv_obj_get_display(view->table));
 
-    // Allocate formatted logs on HEAP
-    minigui_log_entry_t *logs = (minigui_log_entry_t*)malloc(
-        MINIGUI_MAX_LOGS * sizeof(minigui_log_entry_t));
+    // Allocate formatted logs from the internal RAM pool
+    minigui_log_entry_t *logs = (minigui_log_entry_t*)minigui_malloc(
+        MINIGUI_POOL_INTERNAL, MINIGUI_MAX_LOGS * sizeof(minigui_log_entry_t));
 
     if (!logs) {
         LV_LOG_ERROR("Failed to allocate memory for logs");
-        lv_table_set_row_cnt(data_table, 1);
-        lv_table_set_cell_value(data_table, 0, 3, "Memory error");
+        lv_table_set_row_cnt(view->table, 1);
+        lv_table_set_cell_value(view->table, 0, 3, "Memory error");
         return;
     }
 
     // 1. Try the external registered provider first
     size_t count = 0;
     if (global_log_provider) {
+        uint32_t t0 = MINIGUI_METRICS_START();
         count = global_log_provider(logs, MINIGUI_MAX_LOGS, filter);
+        MINIGUI_METRICS_STOP(MINIGUI_METRICS_PROVIDER_LOGS, t0);
     }
-    // 2. Fall back to internal mock (only compiled/active if MINIGUI_USE_MOCK_LOGS is defined)
+    // 2. Fall back to the built-in log store once producers have pushed into it
     else {
-        count = internal_get_logs(logs, MINIGUI_MAX_LOGS, filter);
+        minigui_log_store_stats_t store_stats;
+        minigui_log_store_get_stats(&store_stats);
+
+        if (store_stats.retained > 0) {
+            count = minigui_log_store_query(logs, MINIGUI_MAX_LOGS, filter);
+        }
+        // 3. Fall back to internal mock (only compiled/active if MINIGUI_USE_MOCK_LOGS is defined)
+        else {
+            count = internal_get_logs(logs, MINIGUI_MAX_LOGS, filter);
+        }
     }
 
     // Update table
-    lv_table_set_row_cnt(data_table, count);
+    lv_table_set_row_cnt(view->table, count);
 
     // Fill table with data
     for (size_t i = 0; i < count; i++) {
-        lv_table_set_cell_value(data_table, i, 0, logs[i].timestamp);
-        lv_table_set_cell_value(data_table, i, 1, logs[i].source);
-        lv_table_set_cell_value(data_table, i, 2, logs[i].level);
-        lv_table_set_cell_value(data_table, i, 3, logs[i].message);
+        lv_table_set_cell_value(view->table, i, 0, logs[i].timestamp);
+        lv_table_set_cell_value(view->table, i, 1, logs[i].source);
+        lv_table_set_cell_value(view->table, i, 2, logs[i].level);
+        lv_table_set_cell_value(view->table, i, 3, logs[i].message);
     }
 
     // Show message if no logs
     if (count == 0) {
-        lv_table_set_row_cnt(data_table, 1);
-        lv_table_set_cell_value(data_table, 0, 0, "No logs");
-        lv_table_set_cell_value(data_table, 0, 1, "for");
-        lv_table_set_cell_value(data_table, 0, 2, "filter");
-        lv_table_set_cell_value(data_table, 0, 3, filter ? filter : "ALL");
+        lv_table_set_row_cnt(view->table, 1);
+        lv_table_set_cell_value(view->table, 0, 0, "No logs");
+        lv_table_set_cell_value(view->table, 0, 1, "for");
+        lv_table_set_cell_value(view->table, 0, 2, "filter");
+        lv_table_set_cell_value(view->table, 0, 3, filter ? filter : "ALL");
     }
 
-    // CRITICAL: Free heap memory
-    free(logs);
+    // CRITICAL: Return the buffer to its pool
+    minigui_free(MINIGUI_POOL_INTERNAL, logs);
 
     LV_LOG_USER("Log table refreshed with %zu entries", count);
 }
@@ -335,6 +337,7 @@ static void update_table_with_logs(const char *filter) {
  **
  ** @section pointers 
  ** - e: Owned by LVGL.
+ ** - User data: The screen's logs_view_t.
  **
  ** @section variables 
  ** - None
@@ -347,18 +350,18 @@ static void update_table_with_logs(const char *filter) {
  ******************************************************************************
  ******************************************************************************/
 static void refresh_button_cb(lv_event_t * e) {
-    (void)e; // Unused parameter
+    logs_view_t *view = (logs_view_t *)lv_event_get_user_data(e);
 
     // Get current filter
     char filter_buf[16];
-    if (filter_dropdown) {
-        lv_dropdown_get_selected_str(filter_dropdown, filter_buf, sizeof(filter_buf));
+    if (view->filter) {
+        lv_dropdown_get_selected_str(view->filter, filter_buf, sizeof(filter_buf));
     } else {
         strcpy(filter_buf, "ALL");
     }
 
     // Refresh the table immediately
-    update_table_with_logs(filter_buf);
+    update_table_with_logs(view, filter_buf);
 }
 
 /******************************************************************************
@@ -375,6 +378,7 @@ static void refresh_button_cb(lv_event_t * e) {
  **
  ** @section pointers 
  ** - e: Owned by LVGL.
+ ** - User data: The screen's logs_view_t.
  **
  ** @section variables 
  ** - None
@@ -391,7 +395,7 @@ static void filter_event_cb(lv_event_t * e) {
     char filter_buf[16];
     lv_dropdown_get_selected_str(dropdown, filter_buf, sizeof(filter_buf));
 
-    update_table_with_logs(filter_buf);
+    update_table_with_logs((logs_view_t *)lv_event_get_user_data(e), filter_buf);
 }
 
 /******************************************************************************
@@ -407,7 +411,7 @@ static void filter_event_cb(lv_event_t * e) {
  ** @param t (lv_timer_t*): Pointer to the triggering timer.
  **
  ** @section pointers 
- ** - t: Managed by LVGL.
+ ** - t: Managed by LVGL; user data is the screen's logs_view_t.
  **
  ** @section variables 
  ** - None
@@ -415,13 +419,16 @@ static void filter_event_cb(lv_event_t * e) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Call update_table_with_logs("ALL").
- ** 2. Self-destruct the timer handle.
+ ** 1. Forget the timer handle (it self-destructs below).
+ ** 2. Call update_table_with_logs("ALL").
+ ** 3. Self-destruct the timer handle.
  ******************************************************************************
  ******************************************************************************/
 static void deferred_load_cb(lv_timer_t * t) {
-    update_table_with_logs("ALL");
-    lv_timer_del(t);
+    logs_view_t *view = (logs_view_t *)lv_timer_get_user_data(t);
+    view->load_timer = NULL;
+    update_table_with_logs(view, "ALL");
+    lv_timer_delete(t);
 }
 
 // ============================================================================
@@ -436,7 +443,7 @@ static void deferred_load_cb(lv_timer_t * t) {
  ** - External modules to force a sync.
  **
  ** @section dependencies Required Headers:
- ** - None
+ ** - minigui_ctx.h (default context)
  **
  ** @param filter (const char*): Source filter string or NULL/ALL.
  **
@@ -449,11 +456,14 @@ static void deferred_load_cb(lv_timer_t * t) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Transparently proxy callers to internal update logic.
+ ** 1. Find the Logs view of the default context (none if Logs is not open).
+ ** 2. Transparently proxy callers to internal update logic.
  ******************************************************************************
  ******************************************************************************/
 void refresh_log_table(const char *filter) {
-    update_table_with_logs(filter ? filter : "ALL");
+    logs_view_t *view = (logs_view_t *)minigui_ctx_get_view(minigui_ctx_get_default(), MINIGUI_SCREEN_LOGS);
+    if (!view) return;
+    update_table_with_logs(view, filter ? filter : "ALL");
 }
 
 // ============================================================================
@@ -471,10 +481,10 @@ void refresh_log_table(const char *filter) {
  ** @section dependencies Required Headers:
  ** - lvgl.h (geometry API)
  **
- ** @param None
+ ** @param view (logs_view_t*): Screen whose columns are sized.
  **
  ** @section pointers 
- ** - None
+ ** - view: Owned by the screen.
  **
  ** @section variables 
  ** - None
@@ -482,37 +492,34 @@ void refresh_log_table(const char *filter) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Determine actual width (defaulting to 800px if unknown).
+ ** 1. Determine actual width (defaulting to the display width if unknown).
  ** 2. Subtract padding for available drawing area.
- ** 3. Apply static widths for small columns and flexible remainder for message.
+ ** 3. Apply profile widths for small columns and flexible remainder for message.
  ******************************************************************************
  ******************************************************************************/
-static void calculate_table_layout(void) {
-    if (!data_table || !log_screen_parent) return;
+static void calculate_table_layout(logs_view_t *view) {
+    if (!view->table || !view->parent) return;
+
+    const minigui_layout_t *layout = minigui_layout_get_for(lv_obj_get_display(view->parent));
 
     // Get the actual width available for the table
-    int32_t parent_width = lv_obj_get_width(log_screen_parent);
+    int32_t parent_width = lv_obj_get_width(view->parent);
     if (parent_width <= 0) {
-        parent_width = 800; // Default for ESP32-S3-LCD-EV-Board2
+        parent_width = layout->hor_res; // Not laid out yet: content area spans the display
     }
 
     // Subtract padding (5px left + 5px right = 10px)
     int32_t available_width = parent_width - 10;
 
-    // Fixed column widths that fit 800px screen perfectly:
-    // 800px - 10px padding = 790px available
-    // Column breakdown:
-    // - Time: 100px (12.7%)
-    // - Source: 80px (10.1%)
-    // - Level: 60px (7.6%)
-    // - Message: 550px (69.6%)
-    // Total: 790px
+    // Time/Source/Level come from the layout profile (100/80/60 at 800x480),
+    // the message column takes the remainder.
+    int32_t fixed = layout->logs_col_time + layout->logs_col_source + layout->logs_col_level;
 
     // Set column widths
-    lv_table_set_col_width(data_table, 0, 100);   // Time
-    lv_table_set_col_width(data_table, 1, 80);    // Source
-    lv_table_set_col_width(data_table, 2, 60);    // Level
-    lv_table_set_col_width(data_table, 3, available_width - 240); // Message (remaining)
+    lv_table_set_col_width(view->table, 0, layout->logs_col_time);   // Time
+    lv_table_set_col_width(view->table, 1, layout->logs_col_source); // Source
+    lv_table_set_col_width(view->table, 2, layout->logs_col_level);  // Level
+    lv_table_set_col_width(view->table, 3, available_width - fixed); // Message (remaining)
 }
 
 /******************************************************************************
@@ -529,6 +536,7 @@ static void calculate_table_layout(void) {
  **
  ** @section pointers 
  ** - e: Owned by LVGL.
+ ** - User data: The screen's logs_view_t.
  **
  ** @section variables 
  ** - None
@@ -540,8 +548,51 @@ static void calculate_table_layout(void) {
  ******************************************************************************
  ******************************************************************************/
 static void parent_size_changed_cb(lv_event_t * e) {
-    (void)e; // Unused parameter
-    calculate_table_layout();
+    calculate_table_layout((logs_view_t *)lv_event_get_user_data(e));
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Release the screen state when its table is deleted.
+ **
+ ** @section call_site Called from:
+ ** - Data table LV_EVENT_DELETE (screen switch or context destroy).
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_alloc.h (minigui_free)
+ ** - minigui_ctx.h (view registration)
+ **
+ ** @param e (lv_event_t*): LVGL event object.
+ **
+ ** @section pointers 
+ ** - e: Owned by LVGL.
+ ** - User data: The screen's logs_view_t, freed here.
+ **
+ ** @section variables 
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Cancel a pending deferred load.
+ ** 2. Detach the size handler from the content area, which outlives the
+ **    screen.
+ ** 3. Unregister the view if its context still points at it, then free it.
+ ******************************************************************************
+ ******************************************************************************/
+static void logs_view_delete_cb(lv_event_t * e) {
+    logs_view_t *view = (logs_view_t *)lv_event_get_user_data(e);
+
+    if (view->load_timer) {
+        lv_timer_delete(view->load_timer);
+        view->load_timer = NULL;
+    }
+    lv_obj_remove_event_cb_with_user_data(view->parent, parent_size_changed_cb, view);
+
+    if (minigui_ctx_get_view(view->ctx, MINIGUI_SCREEN_LOGS) == view) {
+        minigui_ctx_set_view(view->ctx, NULL);
+    }
+    minigui_free(MINIGUI_POOL_INTERNAL, view);
 }
 
 // ============================================================================
@@ -561,38 +612,50 @@ static void parent_size_changed_cb(lv_event_t * e) {
  ** @param parent (lv_obj_t*): The content area container.
  **
  ** @section pointers 
- ** - parent: Owned by minigui.c.
+ ** - parent: Owned by minigui.c (a context's content area).
  **
  ** @section variables Internal Variables:
+ ** - @c view (logs_view_t*): Per-context screen state (internal pool).
  ** - @c header_cont (lv_obj_t*): Top control bar.
- ** - @c data_table (lv_obj_t*): Core log display widget.
  **
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Style the parent with 100% black background.
- ** 2. Construct the 40px fixed header with filter dropdown and refresh button.
- ** 3. Create and configure the LVGL table widget for the remainder.
- ** 4. Initialize "Loading" state and trigger deferred data fetch.
+ ** 1. Allocate the view and register it with the parent's context.
+ ** 2. Style the parent with 100% black background.
+ ** 3. Construct the fixed header (profile height) with filter dropdown and
+ **    refresh button at profile positions.
+ ** 4. Create and configure the LVGL table widget for the remainder.
+ ** 5. Initialize "Loading" state and trigger deferred data fetch.
+ ** 6. Free the view from the table's LV_EVENT_DELETE.
  ******************************************************************************
  ******************************************************************************/
 void create_screen_logs(lv_obj_t *parent) {
-    log_screen_parent = parent; // Store for later calculations
+    logs_view_t *view = (logs_view_t *)minigui_malloc(MINIGUI_POOL_INTERNAL, sizeof(*view));
+    if (!view) {
+        LV_LOG_ERROR("Logs: view allocation failed");
+        return;
+    }
+    memset(view, 0, sizeof(*view));
+    view->ctx = minigui_ctx_from_obj(parent);
+    view->parent = parent; // Store for later calculations
+    minigui_ctx_set_view(view->ctx, view);
+
+    const minigui_layout_t *layout = minigui_layout_get_for(lv_obj_get_display(parent));
 
     // SIMPLIFY: Use simple vertical layout without flex complications
     lv_obj_set_style_pad_all(parent, 0, 0);
     lv_obj_set_style_radius(parent, 0, 0);
-    lv_obj_set_style_bg_color(parent, lv_color_black(), 0);
-    lv_obj_set_style_bg_opa(parent, LV_OPA_COVER, 0);
+    lv_obj_add_style(parent, minigui_theme_style(MINIGUI_THEME_SCREEN), 0);
     lv_obj_set_scrollbar_mode(parent, LV_SCROLLBAR_MODE_OFF); // No scroll on parent
 
     // ========== HEADER CONTAINER (Fixed height at top) ==========
     lv_obj_t *header_cont = lv_obj_create(parent);
-    lv_obj_set_size(header_cont, lv_pct(100), 40);  // Full width, 40px height
-    lv_obj_set_style_bg_color(header_cont, lv_color_hex(0x333333), 0);
+    lv_obj_set_size(header_cont, lv_pct(100), layout->logs_header_h);
+    lv_obj_add_style(header_cont, minigui_theme_style(MINIGUI_THEME_HEADER), 0);
     lv_obj_set_style_border_width(header_cont, 0, 0);
     lv_obj_set_style_radius(header_cont, 0, 0);
-    lv_obj_set_style_pad_all(header_cont, 5, 0);
+    lv_obj_set_style_pad_all(header_cont, MINIGUI_LAYOUT_LOGS_HEADER_PAD, 0);
     lv_obj_set_style_pad_gap(header_cont, 0, 0);
     lv_obj_set_scrollbar_mode(header_cont, LV_SCROLLBAR_MODE_OFF);
 
@@ -600,81 +663,77 @@ void create_screen_logs(lv_obj_t *parent) {
     lv_obj_t *header_lbl = lv_label_create(header_cont);
     lv_label_set_text(header_lbl, "TIME | FROM | LVL | MESSAGE");
     lv_obj_set_style_text_font(header_lbl, &lv_font_montserrat_16, 0);
-    lv_obj_set_style_text_color(header_lbl, lv_color_white(), 0);
-    lv_obj_set_pos(header_lbl, 5, 5); // Fixed position
-    lv_obj_set_size(header_lbl, 400, 30);
+    lv_obj_set_pos(header_lbl, 5, layout->logs_ctrl_y);
+    lv_obj_set_size(header_lbl, layout->logs_header_label_w, layout->logs_ctrl_h);
 
     // FILTER DROPDOWN (right side)
-    filter_dropdown = lv_dropdown_create(header_cont);
-    lv_dropdown_set_options(filter_dropdown, "ALL\nESP\nLVGL\nUSER");
-    lv_obj_set_size(filter_dropdown, 100, 30);
-    lv_obj_set_pos(filter_dropdown, 600, 5); // Right-aligned
-    lv_obj_set_style_text_font(filter_dropdown, &lv_font_montserrat_16, 0);
-    lv_obj_set_style_radius(filter_dropdown, 4, 0);
-    lv_obj_set_style_bg_color(filter_dropdown, lv_color_hex(0x444444), 0);
-    lv_obj_set_style_text_color(filter_dropdown, lv_color_white(), 0);
-    lv_obj_add_event_cb(filter_dropdown, filter_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    view->filter = lv_dropdown_create(header_cont);
+    lv_dropdown_set_options(view->filter, "ALL\nESP\nLVGL\nUSER");
+    lv_obj_set_size(view->filter, layout->logs_filter_w, layout->logs_ctrl_h);
+    lv_obj_set_pos(view->filter, layout->logs_filter_x, layout->logs_ctrl_y); // Right-aligned
+    lv_obj_set_style_text_font(view->filter, &lv_font_montserrat_16, 0);
+    lv_obj_set_style_radius(view->filter, 4, 0);
+    lv_obj_add_style(view->filter, minigui_theme_style(MINIGUI_THEME_CONTROL), 0);
+    lv_obj_add_event_cb(view->filter, filter_event_cb, LV_EVENT_VALUE_CHANGED, view);
 
     // REFRESH BUTTON (next to filter)
     lv_obj_t *refresh_btn = lv_button_create(header_cont);
-    lv_obj_set_size(refresh_btn, 30, 30);
-    lv_obj_set_pos(refresh_btn, 705, 5); // Right of filter
+    lv_obj_set_size(refresh_btn, layout->logs_refresh_w, layout->logs_ctrl_h);
+    lv_obj_set_pos(refresh_btn, layout->logs_refresh_x, layout->logs_ctrl_y); // Right of filter
     lv_obj_set_style_radius(refresh_btn, 4, 0);
-    lv_obj_set_style_bg_color(refresh_btn, lv_color_hex(0x444444), 0);
-    lv_obj_set_style_bg_color(refresh_btn, lv_color_hex(0x555555), LV_STATE_PRESSED);
+    lv_obj_add_style(refresh_btn, minigui_theme_style(MINIGUI_THEME_CONTROL), 0);
+    lv_obj_add_style(refresh_btn, minigui_theme_style(MINIGUI_THEME_CONTROL_PRESSED), LV_STATE_PRESSED);
 
     lv_obj_t *refresh_label = lv_label_create(refresh_btn);
     lv_label_set_text(refresh_label, LV_SYMBOL_REFRESH);
     lv_obj_set_style_text_font(refresh_label, &lv_font_montserrat_20, 0);
-    lv_obj_set_style_text_color(refresh_label, lv_color_white(), 0);
     lv_obj_center(refresh_label);
 
-    lv_obj_add_event_cb(refresh_btn, refresh_button_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(refresh_btn, refresh_button_cb, LV_EVENT_CLICKED, view);
 
     // ========== DATA TABLE (Fixed size below header) ==========
-    data_table = lv_table_create(parent);
+    view->table = lv_table_create(parent);
 
     // Calculate position and size: below header, full remaining height
     int32_t parent_height = lv_obj_get_height(parent);
-    int32_t table_height = parent_height - 40; // Header is 40px
+    int32_t table_height = parent_height - layout->logs_header_h;
 
-    lv_obj_set_pos(data_table, 0, 40); // Below header
-    lv_obj_set_size(data_table, lv_pct(100), table_height);
+    lv_obj_set_pos(view->table, 0, layout->logs_header_h); // Below header
+    lv_obj_set_size(view->table, lv_pct(100), table_height);
 
     // Table styling
-    lv_obj_set_style_bg_color(data_table, lv_color_black(), 0);
-    lv_obj_set_style_bg_opa(data_table, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(data_table, 0, 0);
-    lv_obj_set_style_radius(data_table, 0, 0);
-    lv_obj_set_style_pad_all(data_table, 5, 0);
-    lv_obj_set_scrollbar_mode(data_table, LV_SCROLLBAR_MODE_AUTO);
+    lv_obj_add_style(view->table, minigui_theme_style(MINIGUI_THEME_TABLE), 0);
+    lv_obj_set_style_border_width(view->table, 0, 0);
+    lv_obj_set_style_radius(view->table, 0, 0);
+    lv_obj_set_style_pad_all(view->table, 5, 0);
+    lv_obj_set_scrollbar_mode(view->table, LV_SCROLLBAR_MODE_AUTO);
 
     // Set column count
-    lv_table_set_col_cnt(data_table, 4);
+    lv_table_set_col_cnt(view->table, 4);
 
     // Calculate and set optimal column widths
-    calculate_table_layout();
+    calculate_table_layout(view);
 
     // Set text properties
-    lv_obj_set_style_text_font(data_table, &lv_font_montserrat_16, 0);
-    lv_obj_set_style_text_color(data_table, lv_color_white(), 0);
+    lv_obj_set_style_text_font(view->table, &lv_font_montserrat_16, 0);
 
     // Cell styling
-    lv_obj_set_style_pad_all(data_table, 4, LV_PART_ITEMS);
-    lv_obj_set_style_border_width(data_table, 1, LV_PART_ITEMS);
-    lv_obj_set_style_border_color(data_table, lv_color_hex(0x444444), LV_PART_ITEMS);
+    lv_obj_set_style_pad_all(view->table, 4, LV_PART_ITEMS);
+    lv_obj_set_style_border_width(view->table, 1, LV_PART_ITEMS);
+    lv_obj_add_style(view->table, minigui_theme_style(MINIGUI_THEME_TABLE_ITEMS), LV_PART_ITEMS);
 
     // Initial loading message
-    lv_table_set_row_cnt(data_table, 1);
-    lv_table_set_cell_value(data_table, 0, 0, "Loading...");
-    lv_table_set_cell_value(data_table, 0, 1, "");
-    lv_table_set_cell_value(data_table, 0, 2, "");
-    lv_table_set_cell_value(data_table, 0, 3, "Retrieving logs");
+    lv_table_set_row_cnt(view->table, 1);
+    lv_table_set_cell_value(view->table, 0, 0, "Loading...");
+    lv_table_set_cell_value(view->table, 0, 1, "");
+    lv_table_set_cell_value(view->table, 0, 2, "");
+    lv_table_set_cell_value(view->table, 0, 3, "Retrieving logs");
 
     // Listen for parent size changes (if screen rotates or resizes)
-    lv_obj_add_event_cb(parent, parent_size_changed_cb, LV_EVENT_SIZE_CHANGED, NULL);
+    lv_obj_add_event_cb(parent, parent_size_changed_cb, LV_EVENT_SIZE_CHANGED, view);
+    lv_obj_add_event_cb(view->table, logs_view_delete_cb, LV_EVENT_DELETE, view);
 
     // Create timer to load logs (delayed to ensure UI is ready)
-    lv_timer_t * t = lv_timer_create(deferred_load_cb, 100, NULL);
-    lv_timer_set_repeat_count(t, 1);
+    view->load_timer = lv_timer_create(deferred_load_cb, 100, view);
+    lv_timer_set_repeat_count(view->load_timer, 1);
 }
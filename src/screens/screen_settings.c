@@ -3,7 +3,8 @@
  ** @brief     Settings Screen Implementation.
  **
  **            Provides a multi-category settings interface (Screen, Network,
- **            System, Monitor) with a split-pane layout and on-screen keyboard.
+ **            System, Monitor) with a split-pane layout; text fields use the
+ **            shared on-screen keyboard.
  **
  **            @section screen_settings.c - Settings UI implementation.
  ******************************************************************************
@@ -15,7 +16,6 @@
  ******************************************************************************
  ******************************************************************************/
 #include <string.h>
-#include <stdio.h>
 
 /******************************************************************************
  ******************************************************************************
@@ -31,19 +31,58 @@
  ******************************************************************************/
 #include "screens/screen_settings.h"
 #include "minigui.h"
+#include "minigui_abs_layout.h"
+#include "minigui_alloc.h"
+#include "minigui_ctx.h"
+#include "minigui_draw.h"
+#include "minigui_fmt.h"
+#include "minigui_keyboard.h"
+#include "minigui_layout.h"
+#include "minigui_lock.h"
+#include "minigui_netdiag.h"
+#include "minigui_settings.h"
+#include "minigui_store.h"
+#include "minigui_theme.h"
+#include "minigui_ui_builder.h"
+#include "minigui_update.h"
+#include "minigui_vlist.h"
+#include "minigui_wifi.h"
 
 // ============================================================================
 //  TYPES & STATE
 // ============================================================================
 
+/**
+ * @brief Settings categories: X(id, nav label, log name, panel builder)
+ *
+ * Panels disabled in minigui_config.h drop out of the enum, the navigation
+ * pane and the builder table.
+ */
+#if MINIGUI_ENABLE_NETWORK
+#define SETTINGS_X_NETWORK(X) X(NETWORK, LV_SYMBOL_WIFI " Network", "Network", create_network_panel)
+#else
+#define SETTINGS_X_NETWORK(X)
+#endif
+
+#if MINIGUI_ENABLE_MONITOR
+#define SETTINGS_X_MONITOR(X) X(MONITOR, LV_SYMBOL_EYE_OPEN " Monitor", "Monitor", create_monitor_panel)
+#else
+#define SETTINGS_X_MONITOR(X)
+#endif
+
+#define SETTINGS_CATEGORY_LIST(X)                                                   \
+    X(SCREEN, LV_SYMBOL_IMAGE " Screen", "Screen", create_screen_panel)            \
+    SETTINGS_X_NETWORK(X)                                                          \
+    X(SYSTEM, LV_SYMBOL_SETTINGS " System", "System", create_system_panel)         \
+    SETTINGS_X_MONITOR(X)
+
 /**
  * @brief Enumeration of available settings sub-categories
  */
 typedef enum {
-    SETTINGS_CAT_SCREEN = 0,
-    SETTINGS_CAT_NETWORK,
-    SETTINGS_CAT_SYSTEM,
-    SETTINGS_CAT_MONITOR,
+#define SETTINGS_CAT_ENUM(id, label, name, builder) SETTINGS_CAT_##id,
+    SETTINGS_CATEGORY_LIST(SETTINGS_CAT_ENUM)
+#undef SETTINGS_CAT_ENUM
     SETTINGS_CAT_COUNT
 } settings_category_t;
 
@@ -55,137 +94,136 @@ typedef enum {
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Dynamic content container for the right side of the split view.
- **
- ** @section scope Internal Scope:
- ** - Internal to screen_settings.c.
- **
- ** @section rationale Rationale:
- ** - Cleared and repopulated when switching categories.
- ******************************************************************************
- ******************************************************************************/
-static lv_obj_t *content_pane = NULL;
-
-/******************************************************************************
- ******************************************************************************
- ** @brief Shared on-screen keyboard.
+ ** @brief State of one open Settings screen.
  **
  ** @section scope Internal Scope:
- ** - Internal to screen_settings.c.
+ ** - Internal to screen_settings.c, one per context showing Settings.
  **
  ** @section rationale Rationale:
- ** - Reused across any input fields in the settings screen.
+ ** - Each display keeps its own panels and monitor timer; the providers
+ **   feeding them are shared. The keyboard belongs to minigui_keyboard.c.
+ ** - Allocated by create_screen_settings(), freed when the split view is
+ **   deleted. Handlers find it through the context of their target object.
  ******************************************************************************
  ******************************************************************************/
-static lv_obj_t *kb = NULL;
-
-// UI References for Network Panel
-static lv_obj_t *dd_ssid = NULL;
-static lv_obj_t *ta_pass = NULL;
-static lv_obj_t *btn_scan = NULL;
-static lv_obj_t *lbl_scan = NULL;
-
-// UI References for Monitor Panel
-static lv_timer_t *monitor_timer = NULL;
-static lv_obj_t *lbl_voltage = NULL;
-static lv_obj_t *lbl_cpu = NULL;
-static lv_obj_t *lbl_flash = NULL;
-static lv_obj_t *lbl_ram = NULL;
-
-// UI References for System Panel
-static lv_obj_t *lbl_fw_version = NULL;
-static lv_obj_t *lbl_fw_status = NULL;
-static lv_obj_t *btn_fw_update = NULL;
-static bool update_available = false;
-
-// State
-static settings_category_t current_category = SETTINGS_CAT_SCREEN;
+typedef struct {
+    minigui_ctx_t *ctx;                   // Context the screen was built in
+    lv_obj_t *content_pane;               // Right side of the split view, repopulated per category
+    settings_category_t current_category;
+#if MINIGUI_ENABLE_WIFI_FORM
+    // UI References for Network Panel
+    lv_obj_t *dd_ssid;
+    lv_obj_t *ta_pass;
+    lv_obj_t *btn_scan;
+    lv_obj_t *lbl_scan;
+    lv_obj_t *lbl_save;                   // "Save WiFi" / "Cancel" while an apply runs
+#endif
+#if MINIGUI_ENABLE_NETDIAG
+    // UI References for the diagnostics section of the Network Panel
+    struct {
+        lv_obj_t *ta_endpoint;
+        lv_obj_t *lbl_run;                // "Run" / "Stop" while a run is in progress
+        lv_obj_t *chart_lat;
+        lv_chart_series_t *ser_loop;      // Loopback RTT histogram
+        lv_chart_series_t *ser_lat;       // Endpoint RTT histogram
+        lv_obj_t *chart_thr;
+        lv_chart_series_t *ser_thr;       // Transfer rate histogram
+        minigui_draw_list_t *rows;        // Drawn by the results block
+        int32_t row_status;
+        int32_t row_loop;
+        int32_t row_lat;
+        int32_t row_loss;
+        int32_t row_thr;
+    } diag;
+#endif
+#if MINIGUI_ENABLE_MONITOR
+    // UI References for Monitor Panel
+    lv_timer_t *monitor_timer;
+    minigui_draw_list_t *monitor_rows;    // Drawn by the monitor container, NULL when hidden
+    int32_t row_voltage;
+    int32_t row_cpu;
+    int32_t row_flash;
+    int32_t row_ram;
+#endif
+    // UI References for schema group panels
+    lv_obj_t *schema_list;                // Virtualized rows, NULL when no group is shown
+    lv_obj_t *schema_editor;              // Text editor for STRING items (hidden)
+    lv_obj_t *schema_stepper;             // -/+ buttons, moved into the selected row
+    uint16_t schema_first;                // First item id of the open group
+    uint16_t schema_group_count;          // Items in the open group
+    uint16_t *schema_hits;                // Search results being listed, NULL for the group
+    uint16_t *schema_hit_buf;             // Result storage (internal pool), allocated on first use
+    uint16_t schema_hit_cap;
+    uint16_t schema_edit_id;              // Item the editor writes to
+    uint16_t schema_sel_id;               // INT/ENUM item the stepper acts on
+#if MINIGUI_ENABLE_FIRMWARE
+    // UI References for System Panel
+    lv_obj_t *lbl_fw_version;
+    lv_obj_t *lbl_fw_status;
+    lv_obj_t *bar_fw;                     // Download progress, shown while an update runs
+    lv_obj_t *btn_fw_update;              // "Install Update" / "Cancel" while an update runs
+    minigui_update_offer_t fw_offer;      // Last offer from minigui_update_check()
+    bool update_available;
+#endif
+} settings_view_t;
 
 // ============================================================================
 //  FORWARD DECLARATIONS
 // ============================================================================
 
 static void create_screen_panel(lv_obj_t *parent);
+#if MINIGUI_ENABLE_NETWORK
 static void create_network_panel(lv_obj_t *parent);
+#endif
 static void create_system_panel(lv_obj_t *parent);
+#if MINIGUI_ENABLE_MONITOR
 static void create_monitor_panel(lv_obj_t *parent);
-
-// ============================================================================
-//  SHARED EVENT HANDLERS (WiFi, Keyboard)
-// ============================================================================
+#endif
+
+// Navigation labels and panel builders, indexed by settings_category_t
+#define SETTINGS_CAT_LABEL(id, label, name, builder) label,
+#define SETTINGS_CAT_NAME(id, label, name, builder) name,
+#define SETTINGS_CAT_BUILDER(id, label, name, builder) builder,
+static const char *const category_labels[SETTINGS_CAT_COUNT] = { SETTINGS_CATEGORY_LIST(SETTINGS_CAT_LABEL) };
+static const char *const category_log_names[SETTINGS_CAT_COUNT] = { SETTINGS_CATEGORY_LIST(SETTINGS_CAT_NAME) };
+static void (*const category_builders[SETTINGS_CAT_COUNT])(lv_obj_t *) = { SETTINGS_CATEGORY_LIST(SETTINGS_CAT_BUILDER) };
+#undef SETTINGS_CAT_LABEL
+#undef SETTINGS_CAT_NAME
+#undef SETTINGS_CAT_BUILDER
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Handle keyboard events (close on OK/Cancel).
+ ** @brief Settings state of the context an object belongs to.
  **
  ** @section call_site Called from:
- ** - Virtual keyboard (LV_EVENT_READY or LV_EVENT_CANCEL).
+ ** - Event handlers and panel builders.
  **
  ** @section dependencies Required Headers:
- ** - lvgl.h (keyboard API)
+ ** - minigui_ctx.h (context lookup by display)
  **
- ** @param e (lv_event_t*): LVGL event object.
+ ** @param obj (const lv_obj_t*): Any object of the screen.
  **
  ** @section pointers 
- ** - e: Owned by LVGL.
+ ** - obj: Owned by LVGL.
  **
  ** @section variables 
  ** - None
  **
- ** @return void
+ ** @return settings_view_t*: The view, or NULL while it is being torn down.
  **
  ** Implementation Steps:
- ** 1. Check if the "Done" (Ready) or "Cancel" button was pressed.
- ** 2. Hide the keyboard object.
- ** 3. Remove focus state from the associated text area (@c ta_pass).
+ ** 1. Resolve the context from the object's display and ask it for the
+ **    Settings view.
  ******************************************************************************
  ******************************************************************************/
-static void kb_event_cb(lv_event_t * e) {
-    lv_event_code_t code = lv_event_get_code(e);
-    lv_obj_t * keyboard = lv_event_get_target(e);
-
-    if(code == LV_EVENT_READY || code == LV_EVENT_CANCEL) {
-        lv_obj_add_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
-        if(ta_pass) lv_obj_remove_state(ta_pass, LV_STATE_FOCUSED);
-    }
+static settings_view_t *view_of(const lv_obj_t *obj) {
+    return (settings_view_t *)minigui_ctx_get_view(minigui_ctx_from_obj(obj), MINIGUI_SCREEN_SETTINGS);
 }
 
-/******************************************************************************
- ******************************************************************************
- ** @brief Handle text area focus to show keyboard.
- **
- ** @section call_site Called from:
- ** - Text area (LV_EVENT_FOCUSED).
- **
- ** @section dependencies Required Headers:
- ** - lvgl.h (textarea and keyboard linking)
- **
- ** @param e (lv_event_t*): LVGL event object.
- **
- ** @section pointers 
- ** - e: Owned by LVGL.
- **
- ** @section variables 
- ** - None
- **
- ** @return void
- **
- ** Implementation Steps:
- ** 1. Link the global keyboard (@c kb) to the focused text area.
- ** 2. Unhide the keyboard.
- ******************************************************************************
- ******************************************************************************/
-static void ta_event_cb(lv_event_t * e) {
-    lv_event_code_t code = lv_event_get_code(e);
-    lv_obj_t * ta = lv_event_get_target(e);
-
-    if(code == LV_EVENT_FOCUSED) {
-        if(kb) {
-            lv_keyboard_set_textarea(kb, ta);
-            lv_obj_remove_flag(kb, LV_OBJ_FLAG_HIDDEN);
-        }
-    }
-}
+#if MINIGUI_ENABLE_WIFI_FORM
+// ============================================================================
+//  SHARED EVENT HANDLERS (WiFi)
+// ============================================================================
 
 /******************************************************************************
  ******************************************************************************
@@ -203,7 +241,7 @@ static void ta_event_cb(lv_event_t * e) {
  ** - e: Owned by LVGL.
  **
  ** @section variables Internal Variables:
- ** - @c networks (minigui_wifi_network_t[10]): Temp storage for scan results.
+ ** - @c networks (minigui_wifi_network_t[]): Static storage for scan results.
  **
  ** @return void
  **
@@ -215,39 +253,43 @@ static void ta_event_cb(lv_event_t * e) {
  ******************************************************************************
  ******************************************************************************/
 static void scan_wifi_event_cb(lv_event_t * e) {
+    settings_view_t *view = view_of(lv_event_get_target(e));
+    if (!view) return;
+
     LV_LOG_USER("Scanning for WiFi networks...");
-    lv_label_set_text(lbl_scan, "Scanning...");
-    lv_obj_add_state(btn_scan, LV_STATE_DISABLED);
+    lv_label_set_text(view->lbl_scan, "Scanning...");
+    lv_obj_add_state(view->btn_scan, LV_STATE_DISABLED);
     lv_timer_handler();
 
-    minigui_wifi_network_t networks[10];
-    size_t count = minigui_scan_wifi(networks, 10);
+    // Static: a full scan result is too large for the LVGL task stack
+    static minigui_wifi_network_t networks[MINIGUI_MAX_WIFI_NETWORKS];
+    size_t count = minigui_scan_wifi(networks, MINIGUI_MAX_WIFI_NETWORKS);
 
-    lv_dropdown_clear_options(dd_ssid);
+    lv_dropdown_clear_options(view->dd_ssid);
     for (size_t i = 0; i < count; i++) {
-        lv_dropdown_add_option(dd_ssid, networks[i].ssid, i);
+        lv_dropdown_add_option(view->dd_ssid, networks[i].ssid, i);
     }
 
     if (count > 0) {
-        lv_dropdown_set_selected(dd_ssid, 0);
+        lv_dropdown_set_selected(view->dd_ssid, 0);
     } else {
-        lv_dropdown_add_option(dd_ssid, "No networks found", 0);
+        lv_dropdown_add_option(view->dd_ssid, "No networks found", 0);
     }
 
-    lv_label_set_text(lbl_scan, "Scan");
-    lv_obj_remove_state(btn_scan, LV_STATE_DISABLED);
+    lv_label_set_text(view->lbl_scan, "Scan");
+    lv_obj_remove_state(view->btn_scan, LV_STATE_DISABLED);
     LV_LOG_USER("Scan complete, found %d networks", (int)count);
 }
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Handle "Save WiFi" button click.
+ ** @brief Handle "Save WiFi" / "Cancel" button click.
  **
  ** @section call_site Called from:
  ** - Save button LV_EVENT_CLICKED.
  **
  ** @section dependencies Required Headers:
- ** - minigui.h (for saving credentials)
+ ** - minigui_wifi.h (asynchronous apply)
  **
  ** @param e (lv_event_t*): LVGL event object.
  **
@@ -260,20 +302,30 @@ static void scan_wifi_event_cb(lv_event_t * e) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Extract selected SSID from dropdown and text from password area.
- ** 2. Validate that a real network is selected.
- ** 3. Pass credentials structure to the bridge saver.
+ ** 1. While an apply is running the button cancels it.
+ ** 2. Extract selected SSID from dropdown and text from password area.
+ ** 3. Validate that a real network is selected.
+ ** 4. Start the apply; it returns at once and progress arrives through
+ **    wifi_apply_observer_cb().
  ******************************************************************************
  ******************************************************************************/
 static void save_wifi_event_cb(lv_event_t * e) {
+    settings_view_t *view = view_of(lv_event_get_target(e));
+    if (!view) return;
+
+    if (minigui_wifi_apply_is_busy()) {
+        minigui_wifi_apply_cancel();
+        return;
+    }
+
     minigui_wifi_credentials_t creds;
 
     char ssid_buf[64];
-    lv_dropdown_get_selected_str(dd_ssid, ssid_buf, sizeof(ssid_buf));
+    lv_dropdown_get_selected_str(view->dd_ssid, ssid_buf, sizeof(ssid_buf));
     strncpy(creds.ssid, ssid_buf, sizeof(creds.ssid) - 1);
     creds.ssid[sizeof(creds.ssid) - 1] = '\0';
 
-    strncpy(creds.password, lv_textarea_get_text(ta_pass), sizeof(creds.password) - 1);
+    strncpy(creds.password, lv_textarea_get_text(view->ta_pass), sizeof(creds.password) - 1);
     creds.password[sizeof(creds.password) - 1] = '\0';
 
     if (strcmp(creds.ssid, "No networks found") == 0 || strlen(creds.ssid) == 0 || strcmp(creds.ssid, "Scan to see networks...") == 0) {
@@ -282,50 +334,242 @@ static void save_wifi_event_cb(lv_event_t * e) {
     }
 
     LV_LOG_USER("Saving WiFi: SSID='%s'", creds.ssid);
-    minigui_save_wifi_credentials(&creds);
+    minigui_wifi_apply(&creds);
 }
 
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Show the apply stage under the Save button.
+ **
+ ** @section call_site Called from:
+ ** - The apply subject, when bound and on every reported stage (under the
+ **   LVGL lock, on the reporting task).
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_wifi.h (stage text)
+ **
+ ** @param observer (lv_observer_t*): Bound to the status label.
+ ** @param subject (lv_subject_t*): Apply stage.
+ **
+ ** @section pointers
+ ** - observer: Removed by LVGL when the label is deleted.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Set the stage text on the label.
+ ** 2. Turn the Save button into Cancel while a request runs.
+ ******************************************************************************
+ ******************************************************************************/
+static void wifi_apply_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
+    settings_view_t *view = (settings_view_t *)lv_observer_get_user_data(observer);
+    minigui_wifi_apply_stage_t stage = (minigui_wifi_apply_stage_t)lv_subject_get_int(subject);
+
+    lv_label_set_text_static(lv_observer_get_target_obj(observer), minigui_wifi_apply_stage_text(stage));
+    lv_label_set_text_static(view->lbl_save, minigui_wifi_apply_is_busy() ? "Cancel" : "Save WiFi");
+}
+#endif // MINIGUI_ENABLE_WIFI_FORM
+
+#if MINIGUI_ENABLE_NETDIAG
 // ============================================================================
-//  UI HELPERS
+//  NETWORK DIAGNOSTICS
 // ============================================================================
 
+/**
+ * @brief Handle "Run" / "Stop": persist the endpoint and start, or cancel
+ */
+static void diag_run_event_cb(lv_event_t *e) {
+    settings_view_t *view = view_of(lv_event_get_target(e));
+    if (!view) return;
+
+    if (minigui_netdiag_is_running()) {
+        minigui_netdiag_cancel();
+        return;
+    }
+    const char *endpoint = lv_textarea_get_text(view->diag.ta_endpoint);
+    if (endpoint[0]) minigui_netdiag_set_endpoint(endpoint);
+    minigui_keyboard_hide(lv_obj_get_display(view->diag.ta_endpoint));
+    minigui_netdiag_start();
+}
+
+/**
+ * @brief Formats microseconds as "12.3 ms"
+ */
+static size_t format_ms(char *buf, size_t size, uint32_t us) {
+    size_t n = minigui_fmt_fixed(buf, size, (int32_t)LV_MIN(us / 100u, (uint32_t)INT32_MAX), 1);
+    return n + minigui_fmt_str(buf + n, size - n, " ms");
+}
+
+/**
+ * @brief Formats "p50 <x> / p95 <y>" for a latency histogram, "--" without replies
+ */
+static void format_latency(char *buf, size_t size, const minigui_netdiag_hist_t *h) {
+    if (!h->count) {
+        minigui_fmt_str(buf, size, "--");
+        return;
+    }
+    size_t n = minigui_fmt_str(buf, size, "p50 ");
+    n += format_ms(buf + n, size - n, h->p50);
+    n += minigui_fmt_str(buf + n, size - n, " / p95 ");
+    format_ms(buf + n, size - n, h->p95);
+}
+
 /******************************************************************************
  ******************************************************************************
- ** @brief Helper to create a horizontal separator line.
+ ** @brief Show diagnostics progress and results.
  **
  ** @section call_site Called from:
- ** - Various panel builders to segment UI areas.
+ ** - The diagnostics subject, when bound and on every notification (LVGL
+ **   lock held, on the reporting task).
  **
  ** @section dependencies Required Headers:
- ** - lvgl.h (basic object styling)
+ ** - minigui_netdiag.h (status)
+ ** - minigui_draw.h (result rows)
+ ** - minigui_fmt.h (number formatting)
  **
- ** @param parent (lv_obj_t*): Parent container.
- ** @param margin_top (uint16_t): Space above the line.
- ** @param margin_bottom (uint16_t): Space below the line.
+ ** @param observer (lv_observer_t*): Bound to the results block.
+ ** @param subject (lv_subject_t*): Notification counter.
  **
- ** @section pointers 
- ** - parent: Managed by caller.
+ ** @section pointers
+ ** - observer: Removed by LVGL when the results block is deleted.
  **
- ** @section variables 
- ** - None
+ ** @section variables Internal Variables:
+ ** - @c st (minigui_netdiag_status_t): Status snapshot.
+ ** - @c buf (char[MINIGUI_DRAW_VALUE_LEN]): Row value.
  **
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Create a 1px tall object spanning 100% width.
- ** 2. Configure background color (hex 0x555555) and cover opacity.
- ** 3. Apply the specified vertical margins.
+ ** 1. Copy the bucket counts into the chart series, scale each chart to
+ **    its tallest bucket.
+ ** 2. Status row: phase while running, verdict or reason afterwards.
+ ** 3. Loopback, latency, loss and throughput rows.
+ ** 4. Label the button "Stop" while running.
  ******************************************************************************
  ******************************************************************************/
-static void create_separator(lv_obj_t *parent, uint16_t margin_top, uint16_t margin_bottom) {
-    lv_obj_t *sep = lv_obj_create(parent);
-    lv_obj_set_size(sep, lv_pct(100), 1);
-    lv_obj_set_style_bg_color(sep, lv_color_hex(0x555555), 0);
-    lv_obj_set_style_bg_opa(sep, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(sep, 0, 0);
-    lv_obj_set_style_margin_top(sep, margin_top, 0);
-    lv_obj_set_style_margin_bottom(sep, margin_bottom, 0);
+static void diag_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
+    (void)subject;
+    settings_view_t *view = (settings_view_t *)lv_observer_get_user_data(observer);
+    minigui_netdiag_status_t st;
+    minigui_netdiag_get_status(&st);
+    const minigui_netdiag_hist_t *loop = &st.hist[MINIGUI_NETDIAG_LOOPBACK];
+    const minigui_netdiag_hist_t *lat = &st.hist[MINIGUI_NETDIAG_LATENCY];
+    const minigui_netdiag_hist_t *thr = &st.hist[MINIGUI_NETDIAG_THROUGHPUT];
+
+    // 1. Histograms
+    uint32_t top_lat = 1, top_thr = 1;
+    for (uint32_t b = 0; b < MINIGUI_NETDIAG_BUCKETS; b++) {
+        lv_chart_set_value_by_id(view->diag.chart_lat, view->diag.ser_loop, b, (int32_t)loop->buckets[b]);
+        lv_chart_set_value_by_id(view->diag.chart_lat, view->diag.ser_lat, b, (int32_t)lat->buckets[b]);
+        lv_chart_set_value_by_id(view->diag.chart_thr, view->diag.ser_thr, b, (int32_t)thr->buckets[b]);
+        top_lat = LV_MAX(top_lat, LV_MAX(loop->buckets[b], lat->buckets[b]));
+        top_thr = LV_MAX(top_thr, thr->buckets[b]);
+    }
+    lv_chart_set_axis_range(view->diag.chart_lat, LV_CHART_AXIS_PRIMARY_Y, 0, (int32_t)top_lat);
+    lv_chart_set_axis_range(view->diag.chart_thr, LV_CHART_AXIS_PRIMARY_Y, 0, (int32_t)top_thr);
+    lv_chart_refresh(view->diag.chart_lat);
+    lv_chart_refresh(view->diag.chart_thr);
+
+    // 2. Status
+    char buf[MINIGUI_DRAW_VALUE_LEN];
+    static const char *const phase_text[MINIGUI_NETDIAG_PHASE_COUNT] = {
+        "Measuring device...", "Probing endpoint...", "Measuring throughput...",
+    };
+    switch (st.state) {
+        case MINIGUI_NETDIAG_RUNNING:   minigui_fmt_str(buf, sizeof(buf), phase_text[st.phase]); break;
+        case MINIGUI_NETDIAG_DONE:      minigui_fmt_str(buf, sizeof(buf), minigui_netdiag_verdict_text(st.verdict)); break;
+        case MINIGUI_NETDIAG_FAILED:    minigui_fmt_str(buf, sizeof(buf), st.error ? st.error : "Failed"); break;
+        case MINIGUI_NETDIAG_TIMEOUT:   minigui_fmt_str(buf, sizeof(buf), "Timed out"); break;
+        case MINIGUI_NETDIAG_CANCELLED: minigui_fmt_str(buf, sizeof(buf), "Stopped"); break;
+        default:                        minigui_fmt_str(buf, sizeof(buf), "Not run"); break;
+    }
+    minigui_draw_set_value(view->diag.rows, view->diag.row_status, buf);
+
+    // 3. Results
+    format_latency(buf, sizeof(buf), loop);
+    minigui_draw_set_value(view->diag.rows, view->diag.row_loop, buf);
+    format_latency(buf, sizeof(buf), lat);
+    minigui_draw_set_value(view->diag.rows, view->diag.row_lat, buf);
+
+    uint32_t probes = lat->count + lat->lost;
+    if (probes) {
+        size_t n = minigui_fmt_u32(buf, sizeof(buf), lat->lost);
+        n += minigui_fmt_str(buf + n, sizeof(buf) - n, " / ");
+        n += minigui_fmt_u32(buf + n, sizeof(buf) - n, probes);
+        n += minigui_fmt_str(buf + n, sizeof(buf) - n, " (");
+        n += minigui_fmt_percent(buf + n, sizeof(buf) - n, lat->lost, probes);
+        minigui_fmt_str(buf + n, sizeof(buf) - n, ")");
+    } else {
+        minigui_fmt_str(buf, sizeof(buf), "--");
+    }
+    minigui_draw_set_value(view->diag.rows, view->diag.row_loss, buf);
+
+    if (thr->count) {
+        size_t n = minigui_fmt_bytes(buf, sizeof(buf), thr->avg);
+        n += minigui_fmt_str(buf + n, sizeof(buf) - n, "/s, peak ");
+        n += minigui_fmt_bytes(buf + n, sizeof(buf) - n, thr->max);
+        minigui_fmt_str(buf + n, sizeof(buf) - n, "/s");
+    } else {
+        minigui_fmt_str(buf, sizeof(buf), "--");
+    }
+    minigui_draw_set_value(view->diag.rows, view->diag.row_thr, buf);
+
+    // 4. Button
+    lv_label_set_text_static(view->diag.lbl_run, minigui_netdiag_is_running() ? "Stop" : "Run");
 }
+#endif // MINIGUI_ENABLE_NETDIAG
+
+// ============================================================================
+//  UI HELPERS
+// ============================================================================
+
+/**
+ * @brief Constant panel styles shared by the node tables below (flash-resident)
+ */
+static const lv_style_const_prop_t title_24_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_24), LV_STYLE_CONST_MARGIN_BOTTOM(15),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_title_24, title_24_props);
+
+static const lv_style_const_prop_t full_width_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_full_width, full_width_props);
+
+static const lv_style_const_prop_t wide_button_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_wide_button, wide_button_props);
+
+#if MINIGUI_ENABLE_WIFI_FORM || MINIGUI_ENABLE_NETDIAG || MINIGUI_ENABLE_FIRMWARE
+static const lv_style_const_prop_t header_20_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20), LV_STYLE_CONST_MARGIN_BOTTOM(8),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_header_20, header_20_props);
+
+#define SEPARATOR_PROPS(top, bottom)                                               \
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_HEIGHT(1),                   \
+    LV_STYLE_CONST_BORDER_WIDTH(0), /* Color: MINIGUI_THEME_SEPARATOR */           \
+    LV_STYLE_CONST_MARGIN_TOP(top), LV_STYLE_CONST_MARGIN_BOTTOM(bottom),          \
+    LV_STYLE_CONST_PROPS_END
+#endif
+
+#if MINIGUI_ENABLE_WIFI_FORM || MINIGUI_ENABLE_NETDIAG
+static const lv_style_const_prop_t separator_15_props[] = { SEPARATOR_PROPS(15, 15) };
+static LV_STYLE_CONST_INIT(style_separator_15, separator_15_props);
+#endif
+
+#if MINIGUI_ENABLE_FIRMWARE
+static const lv_style_const_prop_t separator_20_props[] = { SEPARATOR_PROPS(20, 20) };
+static LV_STYLE_CONST_INIT(style_separator_20, separator_20_props);
+#endif
 
 // ============================================================================
 //  CATEGORY PANEL BUILDERS
@@ -363,6 +607,31 @@ static void slider_event_cb(lv_event_t * e) {
     minigui_set_brightness(brightness);
 }
 
+static void theme_event_cb(lv_event_t * e) {
+    lv_obj_t * dd = lv_event_get_target(e);
+    minigui_theme_apply(lv_dropdown_get_selected(dd) ? &minigui_theme_light : &minigui_theme_dark);
+}
+
+/**
+ * @brief Screen panel: title, brightness label, slider, theme selector
+ */
+enum { SCR_TITLE, SCR_BRIGHTNESS, SCR_SLIDER, SCR_THEME_LABEL, SCR_THEME, SCR_NODE_COUNT };
+enum { SCR_EV_SLIDER = 1 };
+
+static const minigui_ui_node_t screen_panel_nodes[SCR_NODE_COUNT] = {
+    [SCR_TITLE]       = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, &style_title_24, "Display Settings"),
+    [SCR_BRIGHTNESS]  = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, NULL, "Screen Brightness"),
+    [SCR_SLIDER]      = MINIGUI_UI_NODE_SLIDER(MINIGUI_UI_ROOT, &style_full_width, SCR_EV_SLIDER),
+    [SCR_THEME_LABEL] = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, NULL, "Theme"),
+    [SCR_THEME]       = MINIGUI_UI_NODE_DROPDOWN(MINIGUI_UI_ROOT, &style_full_width, "Dark\nLight"),
+};
+
+static const lv_event_cb_t screen_panel_handlers[] = {
+    [SCR_EV_SLIDER - 1] = slider_event_cb,
+};
+
+static const minigui_ui_desc_t screen_panel_desc = MINIGUI_UI_DESC(screen_panel_nodes, screen_panel_handlers);
+
 /******************************************************************************
  ******************************************************************************
  ** @brief Create the "Screen" settings panel.
@@ -384,25 +653,225 @@ static void slider_event_cb(lv_event_t * e) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Create Display Settings header label.
- ** 2. Create Brightness label and Slider widget.
- ** 3. Attach slider_event_cb for real-time updates.
+ ** 1. Build @c screen_panel_desc (header, brightness label, slider wired
+ **    to slider_event_cb, theme dropdown).
+ ** 2. Set the initial slider value (stored brightness, 70 if none) and the
+ **    active theme, then wire the dropdown to minigui_theme_apply() (no
+ **    rebuild on change).
  ******************************************************************************
  ******************************************************************************/
 static void create_screen_panel(lv_obj_t *parent) {
-    lv_obj_t *lbl = lv_label_create(parent);
-    lv_label_set_text(lbl, "Display Settings");
-    lv_obj_set_style_text_font(lbl, &lv_font_montserrat_24, 0);
-    lv_obj_set_style_margin_bottom(lbl, 15, 0);
+    lv_obj_t *ui[SCR_NODE_COUNT];
+    minigui_ui_build(parent, &screen_panel_desc, ui);
+    lv_slider_set_value(ui[SCR_SLIDER], minigui_store_get_i32(MINIGUI_STORE_KEY_BRIGHTNESS, 70), LV_ANIM_OFF);
+    lv_dropdown_set_selected(ui[SCR_THEME], minigui_theme_get() == &minigui_theme_light ? 1 : 0);
+    lv_obj_add_event_cb(ui[SCR_THEME], theme_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+}
 
-    lv_obj_t *lbl_bright = lv_label_create(parent);
-    lv_label_set_text(lbl_bright, "Screen Brightness");
+#if MINIGUI_ENABLE_NETWORK
+static const lv_style_const_prop_t status_block_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_BG_OPA(0), LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PAD_TOP(0), LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0), LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_status_block, status_block_props);
+
+#if MINIGUI_ENABLE_WIFI_FORM || MINIGUI_ENABLE_NETDIAG
+static const lv_style_const_prop_t input_row_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX), LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_FLEX_MAIN_PLACE(LV_FLEX_ALIGN_START),
+    LV_STYLE_CONST_FLEX_CROSS_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_FLEX_TRACK_PLACE(LV_FLEX_ALIGN_CENTER),
+    LV_STYLE_CONST_BG_OPA(0), LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PAD_TOP(0), LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0), LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(10), LV_STYLE_CONST_PAD_COLUMN(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_input_row, input_row_props);
+
+static const lv_style_const_prop_t grow_props[] = {
+    LV_STYLE_CONST_FLEX_GROW(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_grow, grow_props);
+
+static const lv_style_const_prop_t font_20_props[] = {
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_font_20, font_20_props);
+#endif
+
+#if MINIGUI_ENABLE_WIFI_FORM
+
+static const lv_style_const_prop_t pass_label_props[] = {
+    LV_STYLE_CONST_MARGIN_TOP(15),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_pass_label, pass_label_props);
+
+static const lv_style_const_prop_t save_button_props[] = {
+    LV_STYLE_CONST_MARGIN_TOP(20), LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_save_button, save_button_props);
+
+static const lv_style_const_prop_t apply_status_props[] = {
+    LV_STYLE_CONST_MARGIN_TOP(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_apply_status, apply_status_props);
+
+/**
+ * @brief Wi-Fi form: separator, SSID row (dropdown + scan), password, save, apply status
+ */
+enum {
+    WIFI_SEPARATOR,
+    WIFI_HEADER,
+    WIFI_LBL_SSID,
+    WIFI_SSID_ROW,
+    WIFI_DD_SSID,
+    WIFI_BTN_SCAN,
+    WIFI_LBL_PASS,
+    WIFI_TA_PASS,
+    WIFI_BTN_SAVE,
+    WIFI_LBL_APPLY,
+    WIFI_NODE_COUNT
+};
+enum { WIFI_EV_SCAN = 1, WIFI_EV_PASS, WIFI_EV_SAVE };
+
+static const minigui_ui_node_t wifi_form_nodes[WIFI_NODE_COUNT] = {
+    [WIFI_SEPARATOR] = MINIGUI_UI_NODE_OBJ(MINIGUI_UI_ROOT, &style_separator_15),
+    [WIFI_HEADER]    = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, &style_header_20, "Connect to Network"),
+    [WIFI_LBL_SSID]  = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, NULL, "WiFi Network (SSID)"),
+    [WIFI_SSID_ROW]  = MINIGUI_UI_NODE_OBJ(MINIGUI_UI_ROOT, &style_input_row),
+    [WIFI_DD_SSID]   = MINIGUI_UI_NODE_DROPDOWN(WIFI_SSID_ROW, &style_grow, "Scan to see networks..."),
+    [WIFI_BTN_SCAN]  = MINIGUI_UI_NODE_BUTTON(WIFI_SSID_ROW, &style_font_20, "Scan", WIFI_EV_SCAN),
+    [WIFI_LBL_PASS]  = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, &style_pass_label, "Password"),
+    [WIFI_TA_PASS]   = MINIGUI_UI_NODE_TEXTAREA(MINIGUI_UI_ROOT, &style_full_width, "Enter Password...",
+                                                MINIGUI_UI_F_ONE_LINE | MINIGUI_UI_F_PASSWORD, WIFI_EV_PASS),
+    [WIFI_BTN_SAVE]  = MINIGUI_UI_NODE_BUTTON(MINIGUI_UI_ROOT, &style_save_button, "Save WiFi", WIFI_EV_SAVE),
+    [WIFI_LBL_APPLY] = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, &style_apply_status, ""),
+};
+
+static const lv_event_cb_t wifi_form_handlers[] = {
+    [WIFI_EV_SCAN - 1] = scan_wifi_event_cb,
+    [WIFI_EV_PASS - 1] = minigui_keyboard_focus_cb,
+    [WIFI_EV_SAVE - 1] = save_wifi_event_cb,
+};
+
+static const minigui_ui_desc_t wifi_form_desc = MINIGUI_UI_DESC(wifi_form_nodes, wifi_form_handlers);
+#endif // MINIGUI_ENABLE_WIFI_FORM
+
+#if MINIGUI_ENABLE_NETDIAG
+static const lv_style_const_prop_t diag_chart_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_HEIGHT(90),
+    LV_STYLE_CONST_MARGIN_BOTTOM(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_diag_chart, diag_chart_props);
+
+/**
+ * @brief Diagnostics: separator, endpoint row (text area + run), histograms, results block
+ */
+enum {
+    DIAG_SEPARATOR,
+    DIAG_HEADER,
+    DIAG_ROW,
+    DIAG_TA_ENDPOINT,
+    DIAG_BTN_RUN,
+    DIAG_LBL_LAT,
+    DIAG_CHART_LAT,
+    DIAG_LBL_THR,
+    DIAG_CHART_THR,
+    DIAG_RESULTS,
+    DIAG_NODE_COUNT
+};
+enum { DIAG_EV_ENDPOINT = 1, DIAG_EV_RUN };
+
+static const minigui_ui_node_t diag_nodes[DIAG_NODE_COUNT] = {
+    [DIAG_SEPARATOR]   = MINIGUI_UI_NODE_OBJ(MINIGUI_UI_ROOT, &style_separator_15),
+    [DIAG_HEADER]      = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, &style_header_20, "Diagnostics"),
+    [DIAG_ROW]         = MINIGUI_UI_NODE_OBJ(MINIGUI_UI_ROOT, &style_input_row),
+    [DIAG_TA_ENDPOINT] = MINIGUI_UI_NODE_TEXTAREA(DIAG_ROW, &style_grow, "Endpoint",
+                                                  MINIGUI_UI_F_ONE_LINE, DIAG_EV_ENDPOINT),
+    [DIAG_BTN_RUN]     = MINIGUI_UI_NODE_BUTTON(DIAG_ROW, &style_font_20, "Run", DIAG_EV_RUN),
+    [DIAG_LBL_LAT]     = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, NULL, NULL),
+    [DIAG_CHART_LAT]   = MINIGUI_UI_NODE_CHART(MINIGUI_UI_ROOT, &style_diag_chart),
+    [DIAG_LBL_THR]     = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, NULL, NULL),
+    [DIAG_CHART_THR]   = MINIGUI_UI_NODE_CHART(MINIGUI_UI_ROOT, &style_diag_chart),
+    [DIAG_RESULTS]     = MINIGUI_UI_NODE_OBJ(MINIGUI_UI_ROOT, &style_status_block),
+};
+
+static const lv_event_cb_t diag_handlers[] = {
+    [DIAG_EV_ENDPOINT - 1] = minigui_keyboard_focus_cb,
+    [DIAG_EV_RUN - 1]      = diag_run_event_cb,
+};
+
+static const minigui_ui_desc_t diag_desc = MINIGUI_UI_DESC(diag_nodes, diag_handlers);
 
-    lv_obj_t *slider = lv_slider_create(parent);
-    lv_obj_set_width(slider, lv_pct(100));
-    lv_slider_set_value(slider, 70, LV_ANIM_OFF);
-    lv_obj_add_event_cb(slider, slider_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+/**
+ * @brief Sets "<title>: <bucket labels>" on a histogram caption
+ */
+static void set_bucket_caption(lv_obj_t *label, const char *title, minigui_netdiag_phase_t phase) {
+    char buf[96];
+    size_t n = minigui_fmt_str(buf, sizeof(buf), title);
+    for (uint8_t b = 0; b < MINIGUI_NETDIAG_BUCKETS; b++) {
+        n += minigui_fmt_str(buf + n, sizeof(buf) - n, " ");
+        n += minigui_fmt_str(buf + n, sizeof(buf) - n, minigui_netdiag_bucket_label(phase, b));
+    }
+    lv_label_set_text(label, buf);
+}
+
+/******************************************************************************
+ * @brief Create the diagnostics section of the "Network" panel.
+ *
+ * @param parent Content pane.
+ * @param view   Screen state receiving the handles.
+ *
+ * Implementation Steps
+ * 1. Build @c diag_desc; fill the endpoint and the histogram captions.
+ * 2. Give the charts one point per bucket: two series (loopback grey,
+ *    endpoint blue) for latency, one for throughput.
+ * 3. Attach the results rows and bind the block to the diagnostics
+ *    subject (shows the last run right away).
+ ******************************************************************************/
+static void create_diag_section(lv_obj_t *parent, settings_view_t *view) {
+    lv_obj_t *ui[DIAG_NODE_COUNT];
+    minigui_ui_build(parent, &diag_desc, ui);
+    lv_obj_add_style(ui[DIAG_SEPARATOR], minigui_theme_style(MINIGUI_THEME_SEPARATOR), 0);
+    lv_textarea_set_text(ui[DIAG_TA_ENDPOINT], minigui_netdiag_get_endpoint());
+    set_bucket_caption(ui[DIAG_LBL_LAT], "RTT ms:", MINIGUI_NETDIAG_LATENCY);
+    set_bucket_caption(ui[DIAG_LBL_THR], "Rate B/s:", MINIGUI_NETDIAG_THROUGHPUT);
+
+    view->diag.ta_endpoint = ui[DIAG_TA_ENDPOINT];
+    view->diag.lbl_run = lv_obj_get_child(ui[DIAG_BTN_RUN], 0);
+    view->diag.chart_lat = ui[DIAG_CHART_LAT];
+    view->diag.chart_thr = ui[DIAG_CHART_THR];
+    lv_chart_set_point_count(ui[DIAG_CHART_LAT], MINIGUI_NETDIAG_BUCKETS);
+    lv_chart_set_point_count(ui[DIAG_CHART_THR], MINIGUI_NETDIAG_BUCKETS);
+    view->diag.ser_loop = lv_chart_add_series(ui[DIAG_CHART_LAT], lv_palette_main(LV_PALETTE_GREY),
+                                              LV_CHART_AXIS_PRIMARY_Y);
+    view->diag.ser_lat = lv_chart_add_series(ui[DIAG_CHART_LAT], lv_palette_main(LV_PALETTE_BLUE),
+                                             LV_CHART_AXIS_PRIMARY_Y);
+    view->diag.ser_thr = lv_chart_add_series(ui[DIAG_CHART_THR], lv_palette_main(LV_PALETTE_GREEN),
+                                             LV_CHART_AXIS_PRIMARY_Y);
+
+    minigui_draw_list_t *rows = minigui_draw_attach(ui[DIAG_RESULTS], 5);
+    view->diag.row_status = minigui_draw_add_kv(rows, "Result: ", "--", 5);
+    view->diag.row_loop = minigui_draw_add_kv(rows, "Device RTT: ", "--", 5);
+    view->diag.row_lat = minigui_draw_add_kv(rows, "Endpoint RTT: ", "--", 5);
+    view->diag.row_loss = minigui_draw_add_kv(rows, "Lost: ", "--", 5);
+    view->diag.row_thr = minigui_draw_add_kv(rows, "Throughput: ", "--", 0);
+    view->diag.rows = rows;
+    lv_subject_add_observer_obj(minigui_netdiag_subject(), diag_observer_cb, ui[DIAG_RESULTS], view);
 }
+#endif // MINIGUI_ENABLE_NETDIAG
 
 /******************************************************************************
  * @brief Create the "Network" settings panel.
@@ -410,107 +879,179 @@ static void create_screen_panel(lv_obj_t *parent) {
  * @param parent Content pane.
  *
  * Implementation Steps
- * 1. Display current connection status (SSID/IP or "Disconnected").
- * 2. Add Scan button and SSID dropdown.
- * 3. Add Password field.
- * 4. Add Save button.
+ * 1. Draw the title and current connection status (SSID/IP/MAC or
+ *    "Not connected") in one block object instead of one label per line.
+ * 2. Build @c wifi_form_desc (SSID dropdown + Scan, password, Save, apply
+ *    status) and keep handles to the widgets the event handlers update.
+ * 3. Bind the status label to the apply subject.
+ * 4. Add the diagnostics section (MINIGUI_ENABLE_NETDIAG).
  ******************************************************************************/
 static void create_network_panel(lv_obj_t *parent) {
-    lv_obj_t *lbl = lv_label_create(parent);
-    lv_label_set_text(lbl, "Network Configuration");
-    lv_obj_set_style_text_font(lbl, &lv_font_montserrat_20, 0);
-    lv_obj_set_style_margin_bottom(lbl, 15, 0);
-
-    // Current Network Status Section
-    lv_obj_t *lbl_status_hdr = lv_label_create(parent);
-    lv_label_set_text(lbl_status_hdr, "Current Connection");
-    lv_obj_set_style_text_font(lbl_status_hdr, &lv_font_montserrat_20, 0);
-    lv_obj_set_style_margin_bottom(lbl_status_hdr, 8, 0);
+#if MINIGUI_ENABLE_WIFI_FORM || MINIGUI_ENABLE_NETDIAG
+    settings_view_t *view = view_of(parent);
+#endif
+    // Title and connection status are drawn by one transparent block
+    lv_obj_t *status = lv_obj_create(parent);
+    lv_obj_add_style(status, &style_status_block, 0);
+    minigui_draw_list_t *rows = minigui_draw_attach(status, 5);
+    minigui_draw_add_text(rows, "Network Configuration", &lv_font_montserrat_20, LV_ALIGN_DEFAULT, 15);
+    minigui_draw_add_text(rows, "Current Connection", &lv_font_montserrat_20, LV_ALIGN_DEFAULT, 8);
 
     minigui_network_status_t net_status;
     minigui_get_network_status(&net_status);
 
-    char status_buf[128];
     if (net_status.connected) {
-        lv_obj_t *lbl_ssid_status = lv_label_create(parent);
-        snprintf(status_buf, sizeof(status_buf), LV_SYMBOL_WIFI " SSID: %s", net_status.ssid);
-        lv_label_set_text(lbl_ssid_status, status_buf);
-        lv_obj_set_style_margin_bottom(lbl_ssid_status, 5, 0);
-
-        lv_obj_t *lbl_ip = lv_label_create(parent);
-        snprintf(status_buf, sizeof(status_buf), "IP Address: %s", net_status.ip_address);
-        lv_label_set_text(lbl_ip, status_buf);
-        lv_obj_set_style_margin_bottom(lbl_ip, 5, 0);
-
-        lv_obj_t *lbl_mac = lv_label_create(parent);
-        snprintf(status_buf, sizeof(status_buf), "MAC Address: %s", net_status.mac_address);
-        lv_label_set_text(lbl_mac, status_buf);
-        lv_obj_set_style_margin_bottom(lbl_mac, 5, 0);
+        minigui_draw_add_kv(rows, LV_SYMBOL_WIFI " SSID: ", net_status.ssid, 5);
+        minigui_draw_add_kv(rows, "IP Address: ", net_status.ip_address, 5);
+        minigui_draw_add_kv(rows, "MAC Address: ", net_status.mac_address, 5);
     } else {
-        lv_obj_t *lbl_disconnected = lv_label_create(parent);
-        lv_label_set_text(lbl_disconnected, LV_SYMBOL_CLOSE " Not connected");
-        lv_obj_set_style_margin_bottom(lbl_disconnected, 5, 0);
+        minigui_draw_add_text(rows, LV_SYMBOL_CLOSE " Not connected", NULL, LV_ALIGN_DEFAULT, 5);
     }
 
-    // Separator before scan section
-    create_separator(parent, 15, 15);
-
+#if MINIGUI_ENABLE_WIFI_FORM
     // WiFi Scan & Connect Section
-    lv_obj_t *lbl_connect_hdr = lv_label_create(parent);
-    lv_label_set_text(lbl_connect_hdr, "Connect to Network");
-    lv_obj_set_style_text_font(lbl_connect_hdr, &lv_font_montserrat_20, 0);
-    lv_obj_set_style_margin_bottom(lbl_connect_hdr, 8, 0);
-
-    // SSID Selection with Scan
-    lv_obj_t *lbl_ssid = lv_label_create(parent);
-    lv_label_set_text(lbl_ssid, "WiFi Network (SSID)");
-
-    lv_obj_t *ssid_row = lv_obj_create(parent);
-    lv_obj_set_size(ssid_row, lv_pct(100), LV_SIZE_CONTENT);
-    lv_obj_set_flex_flow(ssid_row, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(ssid_row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_bg_opa(ssid_row, 0, 0);
-    lv_obj_set_style_border_width(ssid_row, 0, 0);
-    lv_obj_set_style_pad_all(ssid_row, 0, 0);
-    lv_obj_set_style_pad_gap(ssid_row, 10, 0);
-
-    dd_ssid = lv_dropdown_create(ssid_row);
-    lv_obj_set_flex_grow(dd_ssid, 1);
-    lv_dropdown_set_options(dd_ssid, "Scan to see networks...");
-
-    btn_scan = lv_button_create(ssid_row);
-    lbl_scan = lv_label_create(btn_scan);
-    lv_label_set_text(lbl_scan, "Scan");
-    lv_obj_set_style_text_font(lbl_scan, &lv_font_montserrat_20, 0);
-    lv_obj_add_event_cb(btn_scan, scan_wifi_event_cb, LV_EVENT_CLICKED, NULL);
-
-    // Password
-    lv_obj_t *lbl_pass = lv_label_create(parent);
-    lv_label_set_text(lbl_pass, "Password");
-    lv_obj_set_style_margin_top(lbl_pass, 15, 0);
-
-    ta_pass = lv_textarea_create(parent);
-    lv_obj_set_width(ta_pass, lv_pct(100));
-    lv_textarea_set_one_line(ta_pass, true);
-    lv_textarea_set_password_mode(ta_pass, true);
-    lv_textarea_set_placeholder_text(ta_pass, "Enter Password...");
-    lv_obj_add_event_cb(ta_pass, ta_event_cb, LV_EVENT_FOCUSED, NULL);
-
-    // Save Button
-    lv_obj_t *btn_save = lv_button_create(parent);
-    lv_obj_set_style_margin_top(btn_save, 20, 0);
-    lv_obj_t *lbl_save = lv_label_create(btn_save);
-    lv_label_set_text(lbl_save, "Save WiFi");
-    lv_obj_set_style_text_font(lbl_save, &lv_font_montserrat_20, 0);
-    lv_obj_add_event_cb(btn_save, save_wifi_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_t *ui[WIFI_NODE_COUNT];
+    minigui_ui_build(parent, &wifi_form_desc, ui);
+    lv_obj_add_style(ui[WIFI_SEPARATOR], minigui_theme_style(MINIGUI_THEME_SEPARATOR), 0);
+
+    view->dd_ssid = ui[WIFI_DD_SSID];
+    view->btn_scan = ui[WIFI_BTN_SCAN];
+    view->lbl_scan = lv_obj_get_child(view->btn_scan, 0);
+    view->ta_pass = ui[WIFI_TA_PASS];
+    view->lbl_save = lv_obj_get_child(ui[WIFI_BTN_SAVE], 0);
+    lv_subject_add_observer_obj(minigui_wifi_apply_subject(), wifi_apply_observer_cb, ui[WIFI_LBL_APPLY], view);
+#endif // MINIGUI_ENABLE_WIFI_FORM
+#if MINIGUI_ENABLE_NETDIAG
+    create_diag_section(parent, view);
+#endif
 }
+#endif // MINIGUI_ENABLE_NETWORK
 
 static void reboot_event_cb(lv_event_t * e) {
     LV_LOG_USER("Reboot requested (placeholder)");
 }
 
+#if MINIGUI_ENABLE_FIRMWARE
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Handle "Install Update" / "Cancel" button click.
+ **
+ ** @section call_site Called from:
+ ** - Install Update button LV_EVENT_CLICKED.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_update.h (update pipeline)
+ **
+ ** @param e (lv_event_t*): LVGL event object.
+ **
+ ** @section pointers
+ ** - e: Owned by LVGL.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Cancel a running update.
+ ** 2. Otherwise start the offer found by the last check; progress and
+ **    errors reach the panel through update_observer_cb().
+ ******************************************************************************
+ ******************************************************************************/
 static void firmware_update_event_cb(lv_event_t * e) {
-    LV_LOG_USER("Firmware update requested (placeholder)");
+    settings_view_t *view = view_of(lv_event_get_target(e));
+    if (!view) return;
+
+    if (minigui_update_is_running()) {
+        minigui_update_cancel();
+    } else if (view->update_available) {
+        minigui_update_start(&view->fw_offer);
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Show update progress in the Firmware section.
+ **
+ ** @section call_site Called from:
+ ** - The update subject, when bound and at most every MINIGUI_UPDATE_UI_MS
+ **   while an update runs (LVGL task).
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_update.h (status)
+ ** - minigui_fmt.h (percent, bytes, duration)
+ **
+ ** @param observer (lv_observer_t*): Bound to the status label.
+ ** @param subject (lv_subject_t*): Update notification counter.
+ **
+ ** @section pointers
+ ** - observer: Removed by LVGL when the label is deleted.
+ **
+ ** @section variables Internal Variables:
+ ** - @c st (minigui_update_status_t): Status snapshot.
+ ** - @c buf (char[96]): Status line.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Format the state: progress, throughput and time left while running,
+ **    the outcome afterwards. IDLE leaves the check result in place.
+ ** 2. Show the bar only while running; the button reads "Cancel" while
+ **    running and stays available for a retry after a failure or cancel.
+ ******************************************************************************
+ ******************************************************************************/
+static void update_observer_cb(lv_observer_t *observer, lv_subject_t *subject) {
+    (void)subject;
+    settings_view_t *view = (settings_view_t *)lv_observer_get_user_data(observer);
+    minigui_update_status_t st;
+    minigui_update_get_status(&st);
+    if (st.state == MINIGUI_UPDATE_IDLE) return;
+
+    char buf[96];
+    size_t n;
+    bool running = st.state == MINIGUI_UPDATE_RUNNING;
+    if (running) {
+        n = minigui_fmt_str(buf, sizeof(buf), LV_SYMBOL_DOWNLOAD " ");
+        if (st.total) {
+            n += minigui_fmt_percent(buf + n, sizeof(buf) - n, st.received, st.total);
+        } else {
+            n += minigui_fmt_bytes(buf + n, sizeof(buf) - n, st.received);
+        }
+        n += minigui_fmt_str(buf + n, sizeof(buf) - n, ", ");
+        n += minigui_fmt_bytes(buf + n, sizeof(buf) - n, st.bytes_per_s);
+        n += minigui_fmt_str(buf + n, sizeof(buf) - n, "/s");
+        if (st.eta_s != UINT32_MAX) {
+            n += minigui_fmt_str(buf + n, sizeof(buf) - n, ", ");
+            n += minigui_fmt_duration(buf + n, sizeof(buf) - n, st.eta_s);
+            n += minigui_fmt_str(buf + n, sizeof(buf) - n, " left");
+        }
+    } else if (st.state == MINIGUI_UPDATE_DONE) {
+        n = minigui_fmt_str(buf, sizeof(buf), LV_SYMBOL_OK " Installed ");
+        n += minigui_fmt_str(buf + n, sizeof(buf) - n, st.version ? st.version : "update");
+        n += minigui_fmt_str(buf + n, sizeof(buf) - n, ", reboot to apply");
+        view->update_available = false;
+    } else if (st.state == MINIGUI_UPDATE_FAILED) {
+        n = minigui_fmt_str(buf, sizeof(buf), LV_SYMBOL_WARNING " Update failed: ");
+        n += minigui_fmt_str(buf + n, sizeof(buf) - n, st.error ? st.error : "unknown error");
+    } else {
+        n = minigui_fmt_str(buf, sizeof(buf), LV_SYMBOL_CLOSE " Update cancelled");
+    }
+    lv_label_set_text(lv_observer_get_target_obj(observer), buf);
+
+    if (running) {
+        lv_bar_set_value(view->bar_fw, st.total ? (int32_t)(((uint64_t)st.received * 100u) / st.total) : 0,
+                         LV_ANIM_OFF);
+        lv_obj_remove_flag(view->bar_fw, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(view->bar_fw, LV_OBJ_FLAG_HIDDEN);
+    }
+    lv_label_set_text_static(lv_obj_get_child(view->btn_fw_update, 0),
+                             running ? LV_SYMBOL_STOP " Cancel" : LV_SYMBOL_DOWNLOAD " Install Update");
+    if (running || view->update_available) {
+        lv_obj_remove_flag(view->btn_fw_update, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(view->btn_fw_update, LV_OBJ_FLAG_HIDDEN);
+    }
 }
 
 /******************************************************************************
@@ -521,7 +1062,7 @@ static void firmware_update_event_cb(lv_event_t * e) {
  ** - Check Updates button LV_EVENT_CLICKED.
  **
  ** @section dependencies Required Headers:
- ** - None (Simulation)
+ ** - minigui_update.h (check callback, mock when none is registered)
  **
  ** @param e (lv_event_t*): LVGL event object.
  **
@@ -534,30 +1075,100 @@ static void firmware_update_event_cb(lv_event_t * e) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Simulate a network check.
- ** 2. Toggle the visibility of the "Install Update" button based on result.
- ** 3. Update status text label.
+ ** 1. Ignore clicks while an update runs.
+ ** 2. Ask the update check; keep the offer for the Install button.
+ ** 3. Toggle the visibility of the "Install Update" button based on result.
+ ** 4. Update status text label.
  ******************************************************************************
  ******************************************************************************/
 static void check_firmware_event_cb(lv_event_t * e) {
-    LV_LOG_USER("Checking for firmware updates...");
-    lv_label_set_text(lbl_fw_status, "Checking for updates...");
+    settings_view_t *view = view_of(lv_event_get_target(e));
+    if (!view) return;
 
-    // Simulate update check (in real app, this would query a server)
-    // For demo purposes, alternate between "up to date" and "update available"
-    static bool mock_update_found = false;
-    mock_update_found = !mock_update_found;
+    if (minigui_update_is_running()) return;
 
-    if (mock_update_found) {
-        update_available = true;
-        lv_label_set_text(lbl_fw_status, LV_SYMBOL_WARNING " Update available: v1.2.0");
-        lv_obj_remove_flag(btn_fw_update, LV_OBJ_FLAG_HIDDEN);
+    LV_LOG_USER("Checking for firmware updates...");
+    memset(&view->fw_offer, 0, sizeof(view->fw_offer));
+    view->update_available = minigui_update_check(&view->fw_offer);
+
+    if (view->update_available) {
+        char buf[64];
+        size_t n = minigui_fmt_str(buf, sizeof(buf), LV_SYMBOL_WARNING " Update available: ");
+        minigui_fmt_str(buf + n, sizeof(buf) - n, view->fw_offer.version ? view->fw_offer.version : "?");
+        lv_label_set_text(view->lbl_fw_status, buf);
+        lv_obj_remove_flag(view->btn_fw_update, LV_OBJ_FLAG_HIDDEN);
     } else {
-        update_available = false;
-        lv_label_set_text(lbl_fw_status, LV_SYMBOL_OK " Firmware is up to date");
-        lv_obj_add_flag(btn_fw_update, LV_OBJ_FLAG_HIDDEN);
+        lv_label_set_text(view->lbl_fw_status, LV_SYMBOL_OK " Firmware is up to date");
+        lv_obj_add_flag(view->btn_fw_update, LV_OBJ_FLAG_HIDDEN);
     }
 }
+#endif // MINIGUI_ENABLE_FIRMWARE
+
+#if MINIGUI_ENABLE_FIRMWARE
+static const lv_style_const_prop_t margin_b8_props[] = {
+    LV_STYLE_CONST_MARGIN_BOTTOM(8),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_margin_b8, margin_b8_props);
+
+static const lv_style_const_prop_t margin_tb8_props[] = {
+    LV_STYLE_CONST_MARGIN_TOP(8), LV_STYLE_CONST_MARGIN_BOTTOM(8),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_margin_tb8, margin_tb8_props);
+
+static const lv_style_const_prop_t fw_bar_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_HEIGHT(12), LV_STYLE_CONST_MARGIN_BOTTOM(8),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_fw_bar, fw_bar_props);
+#endif
+
+/**
+ * @brief System panel: title, reboot, firmware section (MINIGUI_ENABLE_FIRMWARE)
+ */
+enum {
+    SYS_TITLE,
+    SYS_REBOOT,
+#if MINIGUI_ENABLE_FIRMWARE
+    SYS_SEPARATOR,
+    SYS_FW_HEADER,
+    SYS_FW_VERSION,
+    SYS_FW_CHECK,
+    SYS_FW_STATUS,
+    SYS_FW_BAR,
+    SYS_FW_UPDATE,
+#endif
+    SYS_NODE_COUNT
+};
+enum { SYS_EV_REBOOT = 1, SYS_EV_CHECK, SYS_EV_UPDATE };
+
+static const minigui_ui_node_t system_panel_nodes[SYS_NODE_COUNT] = {
+    [SYS_TITLE]      = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, &style_title_24, "System Management"),
+    [SYS_REBOOT]     = MINIGUI_UI_NODE_BUTTON(MINIGUI_UI_ROOT, &style_wide_button,
+                                              LV_SYMBOL_POWER " Reboot Device", SYS_EV_REBOOT),
+#if MINIGUI_ENABLE_FIRMWARE
+    [SYS_SEPARATOR]  = MINIGUI_UI_NODE_OBJ(MINIGUI_UI_ROOT, &style_separator_20),
+    [SYS_FW_HEADER]  = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, &style_header_20, "Firmware"),
+    [SYS_FW_VERSION] = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, &style_margin_b8, "Current Version: v1.0.0"),
+    [SYS_FW_CHECK]   = MINIGUI_UI_NODE_BUTTON(MINIGUI_UI_ROOT, &style_wide_button,
+                                              LV_SYMBOL_REFRESH " Check for Updates", SYS_EV_CHECK),
+    [SYS_FW_STATUS]  = MINIGUI_UI_NODE_LABEL(MINIGUI_UI_ROOT, &style_margin_tb8, ""),
+    [SYS_FW_BAR]     = MINIGUI_UI_NODE_BAR(MINIGUI_UI_ROOT, &style_fw_bar, MINIGUI_UI_F_HIDDEN),
+    [SYS_FW_UPDATE]  = { MINIGUI_UI_BUTTON, MINIGUI_UI_ROOT, MINIGUI_UI_F_HIDDEN, SYS_EV_UPDATE,
+                         LV_EVENT_CLICKED, &style_wide_button, LV_SYMBOL_DOWNLOAD " Install Update" },
+#endif
+};
+
+static const lv_event_cb_t system_panel_handlers[] = {
+    [SYS_EV_REBOOT - 1] = reboot_event_cb,
+#if MINIGUI_ENABLE_FIRMWARE
+    [SYS_EV_CHECK - 1]  = check_firmware_event_cb,
+    [SYS_EV_UPDATE - 1] = firmware_update_event_cb,
+#endif
+};
+
+static const minigui_ui_desc_t system_panel_desc = MINIGUI_UI_DESC(system_panel_nodes, system_panel_handlers);
 
 /******************************************************************************
  ******************************************************************************
@@ -580,56 +1191,41 @@ static void check_firmware_event_cb(lv_event_t * e) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Add Reboot button at the top.
- ** 2. Construct Firmware section with version info and action buttons.
+ ** 1. Build @c system_panel_desc: Reboot button, then the Firmware section
+ **    with version info and action buttons (MINIGUI_ENABLE_FIRMWARE).
+ ** 2. Keep handles to the firmware widgets the handlers update and bind
+ **    the status label to the update subject (shows a running update when
+ **    the panel is reopened).
  ******************************************************************************
  ******************************************************************************/
 static void create_system_panel(lv_obj_t *parent) {
-    lv_obj_t *lbl = lv_label_create(parent);
-    lv_label_set_text(lbl, "System Management");
-    lv_obj_set_style_text_font(lbl, &lv_font_montserrat_24, 0);
-    lv_obj_set_style_margin_bottom(lbl, 15, 0);
-
-    // Reboot section
-    lv_obj_t *btn_reboot = lv_button_create(parent);
-    lv_obj_set_width(btn_reboot, lv_pct(100));
-    lv_obj_t *lbl_reboot = lv_label_create(btn_reboot);
-    lv_label_set_text(lbl_reboot, LV_SYMBOL_POWER " Reboot Device");
-    lv_obj_set_style_text_font(lbl_reboot, &lv_font_montserrat_20, 0);
-    lv_obj_add_event_cb(btn_reboot, reboot_event_cb, LV_EVENT_CLICKED, NULL);
-
-    // Separator
-    create_separator(parent, 20, 20);
-
-    // Firmware Update section
-    lv_obj_t *lbl_fw_hdr = lv_label_create(parent);
-    lv_label_set_text(lbl_fw_hdr, "Firmware");
-    lv_obj_set_style_text_font(lbl_fw_hdr, &lv_font_montserrat_20, 0);
-    lv_obj_set_style_margin_bottom(lbl_fw_hdr, 8, 0);
-
-    lbl_fw_version = lv_label_create(parent);
-    lv_label_set_text(lbl_fw_version, "Current Version: v1.0.0");
-    lv_obj_set_style_margin_bottom(lbl_fw_version, 8, 0);
-
-    lv_obj_t *btn_check = lv_button_create(parent);
-    lv_obj_set_width(btn_check, lv_pct(100));
-    lv_obj_t *lbl_check = lv_label_create(btn_check);
-    lv_label_set_text(lbl_check, LV_SYMBOL_REFRESH " Check for Updates");
-    lv_obj_set_style_text_font(lbl_check, &lv_font_montserrat_20, 0);
-    lv_obj_add_event_cb(btn_check, check_firmware_event_cb, LV_EVENT_CLICKED, NULL);
-
-    lbl_fw_status = lv_label_create(parent);
-    lv_label_set_text(lbl_fw_status, "");
-    lv_obj_set_style_margin_top(lbl_fw_status, 8, 0);
-    lv_obj_set_style_margin_bottom(lbl_fw_status, 8, 0);
-
-    btn_fw_update = lv_button_create(parent);
-    lv_obj_set_width(btn_fw_update, lv_pct(100));
-    lv_obj_t *lbl_fw = lv_label_create(btn_fw_update);
-    lv_label_set_text(lbl_fw, LV_SYMBOL_DOWNLOAD " Install Update");
-    lv_obj_set_style_text_font(lbl_fw, &lv_font_montserrat_20, 0);
-    lv_obj_add_event_cb(btn_fw_update, firmware_update_event_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_add_flag(btn_fw_update, LV_OBJ_FLAG_HIDDEN);  // Hidden until update is found
+    lv_obj_t *ui[SYS_NODE_COUNT];
+    minigui_ui_build(parent, &system_panel_desc, ui);
+
+#if MINIGUI_ENABLE_FIRMWARE
+    lv_obj_add_style(ui[SYS_SEPARATOR], minigui_theme_style(MINIGUI_THEME_SEPARATOR), 0);
+
+    settings_view_t *view = view_of(parent);
+    view->lbl_fw_version = ui[SYS_FW_VERSION];
+    view->lbl_fw_status = ui[SYS_FW_STATUS];
+    view->bar_fw = ui[SYS_FW_BAR];
+    view->btn_fw_update = ui[SYS_FW_UPDATE];  // Hidden until update is found
+    lv_subject_add_observer_obj(minigui_update_subject(), update_observer_cb, ui[SYS_FW_STATUS], view);
+#endif
+}
+
+#if MINIGUI_ENABLE_MONITOR
+/**
+ * @brief Formats "<used> / <total> KB (<pct>%)" for the Monitor panel
+ */
+static size_t format_usage_kb(char *buf, size_t size, uint32_t used_kb, uint32_t total_kb) {
+    size_t n = minigui_fmt_u32(buf, size, used_kb);
+    n += minigui_fmt_str(buf + n, size - n, " / ");
+    n += minigui_fmt_u32(buf + n, size - n, total_kb);
+    n += minigui_fmt_str(buf + n, size - n, " KB (");
+    n += minigui_fmt_percent(buf + n, size - n, used_kb, total_kb);
+    n += minigui_fmt_str(buf + n, size - n, ")");
+    return n;
 }
 
 /******************************************************************************
@@ -641,11 +1237,13 @@ static void create_system_panel(lv_obj_t *parent) {
  **
  ** @section dependencies Required Headers:
  ** - minigui.h (for stats bridge fetch)
+ ** - minigui_fmt.h (integer formatters instead of snprintf)
+ ** - minigui_draw.h (rows are drawn by the monitor container)
  **
  ** @param timer (lv_timer_t*): The trigger timer.
  **
  ** @section pointers 
- ** - timer: Owned by LVGL.
+ ** - timer: Owned by LVGL; user data is the screen's settings_view_t.
  **
  ** @section variables Internal Variables:
  ** - @c stats (minigui_system_stats_t): Freshly fetched data.
@@ -654,38 +1252,37 @@ static void create_system_panel(lv_obj_t *parent) {
  **
  ** Implementation Steps:
  ** 1. Call @c minigui_get_system_stats.
- ** 2. Format and update labels for Voltage, CPU, Flash, and RAM.
+ ** 2. Format the Voltage, CPU, Flash and RAM values with the fixed-point
+ **    formatters (percentages are 0% for zero totals) and update the rows;
+ **    only rows whose value changed are invalidated.
  ******************************************************************************
  ******************************************************************************/
 static void monitor_timer_cb(lv_timer_t *timer) {
-    if (!lbl_voltage || !lbl_cpu || !lbl_flash || !lbl_ram) return;
+    settings_view_t *view = (settings_view_t *)lv_timer_get_user_data(timer);
+    if (!view->monitor_rows) return;
 
     minigui_system_stats_t stats;
     minigui_get_system_stats(&stats);
 
-    char buf[64];
-    snprintf(buf, sizeof(buf), "Voltage: %.2fV", stats.voltage);
-    lv_label_set_text(lbl_voltage, buf);
+    char buf[MINIGUI_DRAW_VALUE_LEN];
+    size_t n = minigui_fmt_float(buf, sizeof(buf), stats.voltage, 2);
+    minigui_fmt_str(buf + n, sizeof(buf) - n, "V");
+    minigui_draw_set_value(view->monitor_rows, view->row_voltage, buf);
 
-    snprintf(buf, sizeof(buf), "CPU Usage: %d%%", stats.cpu_usage);
-    lv_label_set_text(lbl_cpu, buf);
+    minigui_fmt_percent(buf, sizeof(buf), stats.cpu_usage, 100);
+    minigui_draw_set_value(view->monitor_rows, view->row_cpu, buf);
 
-    snprintf(buf, sizeof(buf), "Flash: %lu / %lu KB (%d%%)",
-             (unsigned long)stats.flash_used_kb,
-             (unsigned long)stats.flash_total_kb,
-             (int)((stats.flash_used_kb * 100) / stats.flash_total_kb));
-    lv_label_set_text(lbl_flash, buf);
+    // minigui_fmt_percent() reports 0% for the all-zero totals of a failed provider
+    format_usage_kb(buf, sizeof(buf), stats.flash_used_kb, stats.flash_total_kb);
+    minigui_draw_set_value(view->monitor_rows, view->row_flash, buf);
 
-    snprintf(buf, sizeof(buf), "RAM: %lu / %lu KB (%d%%)",
-             (unsigned long)stats.ram_used_kb,
-             (unsigned long)stats.ram_total_kb,
-             (int)((stats.ram_used_kb * 100) / stats.ram_total_kb));
-    lv_label_set_text(lbl_ram, buf);
+    format_usage_kb(buf, sizeof(buf), stats.ram_used_kb, stats.ram_total_kb);
+    minigui_draw_set_value(view->monitor_rows, view->row_ram, buf);
 }
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Clean up monitor panel resources.
+ ** @brief Clean up monitor panel resources on a category switch.
  **
  ** @section call_site Called from:
  ** - Content container LV_EVENT_DELETE.
@@ -704,19 +1301,21 @@ static void monitor_timer_cb(lv_timer_t *timer) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Delete @c monitor_timer to stop polling.
- ** 2. Nullify all UI pointers associated with the monitor panel.
+ ** 1. Return if the whole screen is going away (the view is already
+ **    detached; settings_view_delete_cb stops the timer then).
+ ** 2. Delete @c monitor_timer to stop polling.
+ ** 3. Drop the row list handle (the list is freed with the container).
  ******************************************************************************
  ******************************************************************************/
 static void monitor_panel_delete_cb(lv_event_t * e) {
-    if (monitor_timer) {
-        lv_timer_del(monitor_timer);
-        monitor_timer = NULL;
+    settings_view_t *view = view_of(lv_event_get_target(e));
+    if (!view) return;
+
+    if (view->monitor_timer) {
+        lv_timer_delete(view->monitor_timer);
+        view->monitor_timer = NULL;
     }
-    lbl_voltage = NULL;
-    lbl_cpu = NULL;
-    lbl_flash = NULL;
-    lbl_ram = NULL;
+    view->monitor_rows = NULL;  // Freed with the container
 }
 
 /******************************************************************************
@@ -728,70 +1327,390 @@ static void monitor_panel_delete_cb(lv_event_t * e) {
  **
  ** @section dependencies Required Headers:
  ** - lvgl.h (widgets)
+ ** - minigui_draw.h (draw-only rows)
  **
  ** @param parent (lv_obj_t*): The content pane container.
  **
  ** @section pointers 
  ** - parent: Owned by screen_settings.
  **
- ** @section variables 
- ** - None
+ ** @section variables Internal Variables:
+ ** - @c rows (minigui_draw_list_t*): Title, statistic rows and separators.
  **
  ** @return void
  **
  ** Implementation Steps:
  ** 1. Create a dedicated @c monitor_cont to leverage LV_EVENT_DELETE.
- ** 2. Populate container with statistics labels.
+ ** 2. Attach a draw list with the title and one key/value row per
+ **    statistic, separated by drawn lines (one object instead of nine).
  ** 3. Start high-frequency refresh timer (1s).
  ******************************************************************************
  ******************************************************************************/
 static void create_monitor_panel(lv_obj_t *parent) {
+    settings_view_t *view = view_of(parent);
+
     // Create a container specifically for the monitor contents
     // This allows us to handle deletion of exactly these components
     lv_obj_t * monitor_cont = lv_obj_create(parent);
     lv_obj_set_size(monitor_cont, lv_pct(100), lv_pct(100));
-    lv_obj_set_flex_flow(monitor_cont, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_style_pad_all(monitor_cont, 0, 0);
-    lv_obj_set_style_pad_gap(monitor_cont, 10, 0);
+    lv_obj_set_style_pad_gap(monitor_cont, 10, 0);  // Row gap of the drawn flow
     lv_obj_set_style_bg_opa(monitor_cont, 0, 0);
     lv_obj_set_style_border_width(monitor_cont, 0, 0);
 
     // Add delete event to the container
     lv_obj_add_event_cb(monitor_cont, monitor_panel_delete_cb, LV_EVENT_DELETE, NULL);
 
-    lv_obj_t *lbl = lv_label_create(monitor_cont);
-    lv_label_set_text(lbl, "System Monitor");
-    lv_obj_set_style_text_font(lbl, &lv_font_montserrat_24, 0);
-    lv_obj_set_style_margin_bottom(lbl, 15, 0);
+    // Title, rows and separators are drawn by the container (one object)
+    minigui_draw_list_t *rows = minigui_draw_attach(monitor_cont, 8);
+    minigui_draw_add_text(rows, "System Monitor", &lv_font_montserrat_24, LV_ALIGN_DEFAULT, 15);
+    view->row_voltage = minigui_draw_add_kv(rows, "Voltage: ", "--", 8);
+    minigui_draw_add_separator(rows, 0, 8);
+    view->row_cpu = minigui_draw_add_kv(rows, "CPU Usage: ", "--", 8);
+    minigui_draw_add_separator(rows, 0, 8);
+    view->row_flash = minigui_draw_add_kv(rows, "Flash: ", "--", 8);
+    minigui_draw_add_separator(rows, 0, 8);
+    view->row_ram = minigui_draw_add_kv(rows, "RAM: ", "--", 0);
+    view->monitor_rows = rows;
 
-    lbl_voltage = lv_label_create(monitor_cont);
-    lv_label_set_text(lbl_voltage, "Voltage: --");
-    lv_obj_set_style_margin_bottom(lbl_voltage, 8, 0);
+    // Create 1-second update timer
+    if (!view->monitor_timer) {
+        view->monitor_timer = lv_timer_create(monitor_timer_cb, 1000, view);
+    }
 
-    create_separator(monitor_cont, 0, 8);
+    // Initial update
+    monitor_timer_cb(view->monitor_timer);
+}
+#endif // MINIGUI_ENABLE_MONITOR
 
-    lbl_cpu = lv_label_create(monitor_cont);
-    lv_label_set_text(lbl_cpu, "CPU Usage: --");
-    lv_obj_set_style_margin_bottom(lbl_cpu, 8, 0);
+// ============================================================================
+//  SCHEMA GROUP PANELS
+// ============================================================================
 
-    create_separator(monitor_cont, 0, 8);
+/**
+ * @brief Schema rows: name | value, recycled by the virtualized list
+ *
+ * Rows are three objects each. INT and ENUM rows are stepped with one
+ * shared -/+ stepper that moves into the selected row.
+ */
+#define SCHEMA_ROW_H 52
+#define SCHEMA_BTN_W 44
+
+enum { SCHEMA_ROW_NAME, SCHEMA_ROW_VALUE };
+
+static const lv_style_const_prop_t schema_row_props[] = {
+    LV_STYLE_CONST_BG_OPA(0), LV_STYLE_CONST_RADIUS(0),
+    LV_STYLE_CONST_BORDER_WIDTH(1), LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    LV_STYLE_CONST_PAD_TOP(0), LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(8), LV_STYLE_CONST_PAD_RIGHT(8),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_20),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_schema_row, schema_row_props);
+
+static const lv_style_const_prop_t schema_list_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_FLEX_GROW(1),
+    LV_STYLE_CONST_BG_OPA(0), LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PAD_TOP(0), LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0), LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_schema_list, schema_list_props);
+
+static const lv_style_const_prop_t schema_stepper_props[] = {
+    LV_STYLE_CONST_WIDTH(2 * SCHEMA_BTN_W + 8), LV_STYLE_CONST_HEIGHT(SCHEMA_ROW_H - 12),
+    LV_STYLE_CONST_BG_OPA(0), LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PAD_TOP(0), LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0), LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_schema_stepper, schema_stepper_props);
+
+static uint16_t schema_row_id(const settings_view_t *view, uint32_t index) {
+    return view->schema_hits ? view->schema_hits[index] : (uint16_t)(view->schema_first + index);
+}
 
-    lbl_flash = lv_label_create(monitor_cont);
-    lv_label_set_text(lbl_flash, "Flash: --");
-    lv_obj_set_style_margin_bottom(lbl_flash, 8, 0);
+static bool schema_is_stepped(const minigui_setting_item_t *item) {
+    return item->type == MINIGUI_SETTING_TYPE_INT || item->type == MINIGUI_SETTING_TYPE_ENUM;
+}
 
-    create_separator(monitor_cont, 0, 8);
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Fill a recycled row with an item.
+ **
+ ** @section call_site Called from:
+ ** - Virtualized list when a row comes into view or the data changed.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_settings.h (item, formatted value)
+ **
+ ** @param row (lv_obj_t*): Row object.
+ ** @param index (uint32_t): Entry in the group or the search results.
+ ** @param user_data (void*): The settings_view_t.
+ **
+ ** @section pointers
+ ** - row: Owned by the list.
+ **
+ ** @section variables Internal Variables:
+ ** - @c buf (char[]): Formatted value.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Resolve the item id and set name and value.
+ ** 2. Move the stepper into the row of the selected item, or hide it if
+ **    its row now shows another item; place the value left of it.
+ ******************************************************************************
+ ******************************************************************************/
+static void schema_row_bind(lv_obj_t *row, uint32_t index, void *user_data) {
+    settings_view_t *view = (settings_view_t *)user_data;
+    uint16_t id = schema_row_id(view, index);
+    const minigui_setting_item_t *item = minigui_settings_get_item(id);
+    if (!item) return;
+
+    char buf[MINIGUI_SETTING_TEXT_MAX + 1];
+    minigui_settings_format(id, buf, sizeof(buf));
+    lv_label_set_text_static(lv_obj_get_child(row, SCHEMA_ROW_NAME), item->label);
+    lv_label_set_text(lv_obj_get_child(row, SCHEMA_ROW_VALUE), buf);
+
+    lv_obj_t *stepper = view->schema_stepper;
+    bool selected = id == view->schema_sel_id && schema_is_stepped(item);
+    if (selected) {
+        if (lv_obj_get_parent(stepper) != row) lv_obj_set_parent(stepper, row);
+        lv_obj_align(stepper, LV_ALIGN_RIGHT_MID, 0, 0);
+        lv_obj_remove_flag(stepper, LV_OBJ_FLAG_HIDDEN);
+    } else if (lv_obj_get_parent(stepper) == row) {
+        lv_obj_add_flag(stepper, LV_OBJ_FLAG_HIDDEN);
+    }
+    lv_obj_align(lv_obj_get_child(row, SCHEMA_ROW_VALUE), LV_ALIGN_RIGHT_MID,
+                 selected ? -(2 * SCHEMA_BTN_W + 16) : 0, 0);
+}
 
-    lbl_ram = lv_label_create(monitor_cont);
-    lv_label_set_text(lbl_ram, "RAM: --");
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Handle taps on a row.
+ **
+ ** @section call_site Called from:
+ ** - Schema row (LV_EVENT_CLICKED).
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_settings.h (validated setters)
+ ** - minigui_keyboard.h (text editing)
+ **
+ ** @param e (lv_event_t*): LVGL event object.
+ **
+ ** @section pointers
+ ** - e: Owned by LVGL.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Resolve view, row and item id.
+ ** 2. Toggle BOOL, open the text editor for STRING, or select INT/ENUM
+ **    items for the stepper.
+ ** 3. Rebind the visible rows.
+ ******************************************************************************
+ ******************************************************************************/
+static void schema_row_event_cb(lv_event_t *e) {
+    lv_obj_t *row = lv_event_get_target(e);
+    settings_view_t *view = view_of(row);
+    if (!view || !view->schema_list) return;
+
+    uint16_t id = schema_row_id(view, minigui_vlist_get_index(row));
+    const minigui_setting_item_t *item = minigui_settings_get_item(id);
+    if (!item) return;
+
+    if (item->type == MINIGUI_SETTING_TYPE_BOOL) {
+        minigui_settings_set_int(id, !minigui_settings_get_int(id));
+    } else if (item->type == MINIGUI_SETTING_TYPE_STRING) {
+        char buf[MINIGUI_SETTING_TEXT_MAX + 1];
+        minigui_settings_get_str(id, buf, sizeof(buf));
+        view->schema_edit_id = id;
+        lv_textarea_set_max_length(view->schema_editor, (uint32_t)item->max);
+        lv_textarea_set_text(view->schema_editor, buf);
+        lv_textarea_set_placeholder_text(view->schema_editor, item->label);
+        lv_obj_remove_flag(view->schema_editor, LV_OBJ_FLAG_HIDDEN);
+        minigui_keyboard_show(view->schema_editor);
+    } else {
+        view->schema_sel_id = id;
+    }
+    minigui_vlist_refresh(view->schema_list);
+}
 
-    // Create 1-second update timer
-    if (!monitor_timer) {
-        monitor_timer = lv_timer_create(monitor_timer_cb, 1000, NULL);
+static void schema_step_event_cb(lv_event_t *e) {
+    settings_view_t *view = view_of(lv_event_get_target(e));
+    if (!view || !view->schema_list) return;
+
+    int32_t dir = (int32_t)(intptr_t)lv_event_get_user_data(e);
+    const minigui_setting_item_t *item = minigui_settings_get_item(view->schema_sel_id);
+    if (!item) return;
+
+    int32_t step = item->type == MINIGUI_SETTING_TYPE_INT ? item->step : 1;
+    minigui_settings_set_int(view->schema_sel_id, minigui_settings_get_int(view->schema_sel_id) + dir * step);
+    minigui_vlist_refresh(view->schema_list);
+}
+
+static lv_obj_t *schema_row_create(lv_obj_t *list, void *user_data) {
+    LV_UNUSED(user_data);
+    lv_obj_t *row = lv_obj_create(list);
+    lv_obj_add_style(row, &style_schema_row, 0);
+    lv_obj_add_style(row, minigui_theme_style(MINIGUI_THEME_TABLE_ITEMS), 0);
+    lv_obj_remove_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(row, schema_row_event_cb, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t *name = lv_label_create(row);
+    lv_obj_set_width(name, lv_pct(55));
+    lv_label_set_long_mode(name, LV_LABEL_LONG_DOT);
+    lv_obj_align(name, LV_ALIGN_LEFT_MID, 0, 0);
+    lv_label_create(row);
+    return row;
+}
+
+static lv_obj_t *schema_stepper_create(lv_obj_t *parent) {
+    static const char *const symbols[2] = { LV_SYMBOL_MINUS, LV_SYMBOL_PLUS };
+
+    lv_obj_t *stepper = lv_obj_create(parent);
+    lv_obj_add_style(stepper, &style_schema_stepper, 0);
+    lv_obj_remove_flag(stepper, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(stepper, LV_OBJ_FLAG_HIDDEN);
+    for (int i = 0; i < 2; i++) {
+        lv_obj_t *btn = lv_button_create(stepper);
+        lv_obj_set_size(btn, SCHEMA_BTN_W, lv_pct(100));
+        lv_obj_align(btn, i ? LV_ALIGN_RIGHT_MID : LV_ALIGN_LEFT_MID, 0, 0);
+        lv_obj_add_event_cb(btn, schema_step_event_cb, LV_EVENT_CLICKED, (void *)(intptr_t)(i ? 1 : -1));
+        lv_obj_t *lbl = lv_label_create(btn);
+        lv_label_set_text_static(lbl, symbols[i]);
+        lv_obj_center(lbl);
     }
+    return stepper;
+}
 
-    // Initial update
-    monitor_timer_cb(NULL);
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Handle the search field and the text editor.
+ **
+ ** @section call_site Called from:
+ ** - Search text area (LV_EVENT_VALUE_CHANGED).
+ ** - Editor text area (LV_EVENT_READY, LV_EVENT_CANCEL).
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_settings.h (search index, setters)
+ **
+ ** @param e (lv_event_t*): LVGL event object.
+ **
+ ** @section pointers
+ ** - e: Owned by LVGL.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Search: list the hits of the word index (all groups), or the open
+ **    group again when the query is empty.
+ ** 2. Editor: store the text on Ready (rejected text is logged and the old
+ **    value stays), then hide the editor and the keyboard.
+ ******************************************************************************
+ ******************************************************************************/
+static void schema_text_event_cb(lv_event_t *e) {
+    lv_obj_t *ta = lv_event_get_target(e);
+    lv_event_code_t code = lv_event_get_code(e);
+    settings_view_t *view = view_of(ta);
+    if (!view || !view->schema_list) return;
+
+    if (ta != view->schema_editor) {
+        const char *query = lv_textarea_get_text(ta);
+        if (query[0] && view->schema_hit_buf) {
+            view->schema_hits = view->schema_hit_buf;
+            minigui_vlist_set_count(view->schema_list,
+                                    minigui_settings_search(query, view->schema_hits, view->schema_hit_cap));
+        } else {
+            view->schema_hits = NULL;
+            minigui_vlist_set_count(view->schema_list, view->schema_group_count);
+        }
+        return;
+    }
+
+    if (code == LV_EVENT_READY &&
+        !minigui_settings_set_str(view->schema_edit_id, lv_textarea_get_text(ta))) {
+        LV_LOG_WARN("Settings: rejected value for %s", minigui_settings_get_item(view->schema_edit_id)->key);
+    }
+    lv_obj_add_flag(ta, LV_OBJ_FLAG_HIDDEN);
+    minigui_keyboard_hide(lv_obj_get_display(ta));
+    minigui_vlist_refresh(view->schema_list);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Create the panel of a schema group.
+ **
+ ** @section call_site Called from:
+ ** - switch_category() for categories past the built-in ones.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_settings.h (schema)
+ ** - minigui_vlist.h (virtualized rows)
+ ** - minigui_keyboard.h (search and text input)
+ **
+ ** @param view (settings_view_t*): Screen state.
+ ** @param group (uint8_t): Schema group index.
+ **
+ ** @section pointers
+ ** - view: Owned by the screen.
+ **
+ ** @section variables
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Allocate the search result buffer once per view.
+ ** 2. Create the search field, the hidden text editor, the list and the
+ **    shared stepper; the list creates only the rows that fit, whatever
+ **    the group size.
+ ** 3. Bind the list to the group's id range.
+ ******************************************************************************
+ ******************************************************************************/
+static void create_schema_panel(settings_view_t *view, uint8_t group) {
+    lv_obj_t *parent = view->content_pane;
+    const minigui_settings_schema_t *schema = minigui_settings_get_schema();
+    if (!schema || group >= schema->group_count) return;
+
+    if (view->schema_hit_cap < minigui_settings_get_count()) {
+        minigui_free(MINIGUI_POOL_INTERNAL, view->schema_hit_buf);
+        view->schema_hit_cap = minigui_settings_get_count();
+        view->schema_hit_buf = (uint16_t *)minigui_malloc(MINIGUI_POOL_INTERNAL,
+                                                          view->schema_hit_cap * sizeof(uint16_t));
+        if (!view->schema_hit_buf) view->schema_hit_cap = 0;
+    }
+    view->schema_first = minigui_settings_group_first(group);
+    view->schema_group_count = schema->groups[group].count;
+    view->schema_hits = NULL;
+    view->schema_sel_id = MINIGUI_SETTING_NONE;
+
+    lv_obj_t *search = lv_textarea_create(parent);
+    lv_obj_add_style(search, &style_full_width, 0);
+    lv_textarea_set_one_line(search, true);
+    lv_textarea_set_placeholder_text(search, "Search settings...");
+    lv_obj_add_event_cb(search, minigui_keyboard_focus_cb, LV_EVENT_FOCUSED, NULL);
+    lv_obj_add_event_cb(search, schema_text_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+
+    view->schema_editor = lv_textarea_create(parent);
+    lv_obj_add_style(view->schema_editor, &style_full_width, 0);
+    lv_textarea_set_one_line(view->schema_editor, true);
+    lv_obj_add_flag(view->schema_editor, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(view->schema_editor, schema_text_event_cb, LV_EVENT_READY, NULL);
+    lv_obj_add_event_cb(view->schema_editor, schema_text_event_cb, LV_EVENT_CANCEL, NULL);
+
+    view->schema_list = minigui_vlist_create(parent, SCHEMA_ROW_H, schema_row_create, schema_row_bind, view);
+    if (!view->schema_list) return;
+    view->schema_stepper = schema_stepper_create(view->schema_list);
+    lv_obj_add_style(view->schema_list, &style_schema_list, 0);
+    minigui_vlist_set_count(view->schema_list, view->schema_group_count);
 }
 
 // ============================================================================
@@ -809,10 +1728,11 @@ static void create_monitor_panel(lv_obj_t *parent) {
  ** @section dependencies Required Headers:
  ** - None
  **
+ ** @param view (settings_view_t*): Screen to update.
  ** @param cat (settings_category_t): The category to switch to.
  **
  ** @section pointers 
- ** - None
+ ** - view: Owned by the screen.
  **
  ** @section variables 
  ** - None
@@ -821,38 +1741,53 @@ static void create_monitor_panel(lv_obj_t *parent) {
  **
  ** Implementation Steps:
  ** 1. Log the navigation action.
- ** 2. Call lv_obj_clean() on content_pane.
- ** 3. Call the appropriate panel factory function.
+ ** 2. Drop the previous panel's handles so nothing points into the
+ **    deleted panel (the keyboard detaches from a deleted text area itself).
+ ** 3. Call lv_obj_clean() on content_pane.
+ ** 4. Call the panel builder from @c category_builders and freeze its
+ **    layout (MINIGUI_ABSOLUTE_LAYOUT); categories past the built-in ones
+ **    are schema groups, built by create_schema_panel().
  ******************************************************************************
  ******************************************************************************/
-static void switch_category(settings_category_t cat) {
-    current_category = cat;
+static void switch_category(settings_view_t *view, settings_category_t cat) {
+    view->current_category = cat;
 
     // Log user navigation
-    const char* cat_names[] = {"Screen", "Network", "System", "Monitor"};
     if (cat < SETTINGS_CAT_COUNT) {
-        LV_LOG_USER("Settings: Switching to %s panel", cat_names[cat]);
+        LV_LOG_USER("Settings: Switching to %s panel", category_log_names[cat]);
+    } else if (minigui_settings_get_schema() && cat - SETTINGS_CAT_COUNT < minigui_settings_get_schema()->group_count) {
+        LV_LOG_USER("Settings: Switching to %s group", minigui_settings_get_schema()->groups[cat - SETTINGS_CAT_COUNT].name);
     }
 
+#if MINIGUI_ENABLE_WIFI_FORM
+    view->dd_ssid = NULL;
+    view->ta_pass = NULL;
+    view->btn_scan = NULL;
+    view->lbl_scan = NULL;
+    view->lbl_save = NULL;
+#endif
+#if MINIGUI_ENABLE_NETDIAG
+    memset(&view->diag, 0, sizeof(view->diag));
+#endif
+#if MINIGUI_ENABLE_FIRMWARE
+    view->lbl_fw_version = NULL;
+    view->lbl_fw_status = NULL;
+    view->bar_fw = NULL;
+    view->btn_fw_update = NULL;
+#endif
+    view->schema_list = NULL;
+    view->schema_editor = NULL;
+    view->schema_stepper = NULL;
+
     // Clean content pane
-    lv_obj_clean(content_pane);
+    lv_obj_clean(view->content_pane);
 
     // Create new panel
-    switch(cat) {
-        case SETTINGS_CAT_SCREEN:
-            create_screen_panel(content_pane);
-            break;
-        case SETTINGS_CAT_NETWORK:
-            create_network_panel(content_pane);
-            break;
-        case SETTINGS_CAT_SYSTEM:
-            create_system_panel(content_pane);
-            break;
-        case SETTINGS_CAT_MONITOR:
-            create_monitor_panel(content_pane);
-            break;
-        default:
-            break;
+    if (cat < SETTINGS_CAT_COUNT) {
+        category_builders[cat](view->content_pane);
+        minigui_abs_layout_apply(view->content_pane, MINIGUI_ABS_KEY_SETTINGS_CAT(cat));
+    } else {
+        create_schema_panel(view, (uint8_t)(cat - SETTINGS_CAT_COUNT));
     }
 }
 
@@ -878,13 +1813,15 @@ static void switch_category(settings_category_t cat) {
  **
  ** Implementation Steps:
  ** 1. Extract category ID from the button's user data.
- ** 2. Delegate to @c switch_category.
+ ** 2. Resolve the button's Settings view.
+ ** 3. Delegate to @c switch_category.
  ******************************************************************************
  ******************************************************************************/
 static void category_event_cb(lv_event_t * e) {
     lv_obj_t * btn = lv_event_get_target(e);
     settings_category_t cat = (settings_category_t)(uintptr_t)lv_event_get_user_data(e);
-    switch_category(cat);
+    settings_view_t *view = view_of(btn);
+    if (view) switch_category(view, cat);
 }
 
 // ============================================================================
@@ -893,18 +1830,19 @@ static void category_event_cb(lv_event_t * e) {
 
 /******************************************************************************
  ******************************************************************************
- ** @brief Handle screen delete to clean up globals.
+ ** @brief Handle screen delete to release the view.
  **
  ** @section call_site Called from:
- ** - Main settings object LV_EVENT_DELETE.
+ ** - Split view root LV_EVENT_DELETE (screen switch or context destroy).
  **
  ** @section dependencies Required Headers:
- ** - None
+ ** - minigui_alloc.h (minigui_free)
  **
  ** @param e (lv_event_t*): LVGL event object.
  **
  ** @section pointers 
  ** - e: Owned by LVGL.
+ ** - User data: The screen's settings_view_t, freed here.
  **
  ** @section variables 
  ** - None
@@ -912,17 +1850,80 @@ static void category_event_cb(lv_event_t * e) {
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Zero out global pointers that reference destroyed objects.
+ ** 1. Stop the monitor timer (LVGL deletes the root before the panel, so
+ **    the panel's own handler sees the view detached).
+ ** 2. Unregister the view if its context still points at it, then free it
+ **    and its search result buffer.
  ******************************************************************************
  ******************************************************************************/
-static void settings_screen_event_cb(lv_event_t * e) {
-    lv_event_code_t code = lv_event_get_code(e);
-    if (code == LV_EVENT_DELETE) {
-        content_pane = NULL;
-        kb = NULL;
+static void settings_view_delete_cb(lv_event_t * e) {
+    settings_view_t *view = (settings_view_t *)lv_event_get_user_data(e);
+
+#if MINIGUI_ENABLE_MONITOR
+    if (view->monitor_timer) {
+        lv_timer_delete(view->monitor_timer);
+        view->monitor_timer = NULL;
+    }
+#endif
+
+    if (minigui_ctx_get_view(view->ctx, MINIGUI_SCREEN_SETTINGS) == view) {
+        minigui_ctx_set_view(view->ctx, NULL);
     }
+    minigui_free(MINIGUI_POOL_INTERNAL, view->schema_hit_buf);
+    minigui_free(MINIGUI_POOL_INTERNAL, view);
 }
 
+/**
+ * @brief Split-pane skeleton styles and node table
+ */
+static const lv_style_const_prop_t main_cont_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_HEIGHT(LV_PCT(100)),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX), LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_ROW),
+    LV_STYLE_CONST_PAD_TOP(0), LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0), LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0), LV_STYLE_CONST_PAD_COLUMN(0),
+    LV_STYLE_CONST_BORDER_WIDTH(0), LV_STYLE_CONST_BG_OPA(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_main_cont, main_cont_props);
+
+static const lv_style_const_prop_t nav_pane_props[] = {
+    LV_STYLE_CONST_HEIGHT(LV_PCT(100)), // Width comes from the layout profile
+    LV_STYLE_CONST_BORDER_WIDTH(1), LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_RIGHT),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX), LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_PAD_TOP(10), LV_STYLE_CONST_PAD_BOTTOM(10),
+    LV_STYLE_CONST_PAD_LEFT(10), LV_STYLE_CONST_PAD_RIGHT(10),
+    LV_STYLE_CONST_PAD_ROW(8), LV_STYLE_CONST_PAD_COLUMN(8),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_nav_pane, nav_pane_props);
+
+static const lv_style_const_prop_t nav_button_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)), LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_24),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_nav_button, nav_button_props);
+
+static const lv_style_const_prop_t content_pane_props[] = {
+    LV_STYLE_CONST_FLEX_GROW(1), LV_STYLE_CONST_HEIGHT(LV_PCT(100)),
+    LV_STYLE_CONST_LAYOUT(LV_LAYOUT_FLEX), LV_STYLE_CONST_FLEX_FLOW(LV_FLEX_FLOW_COLUMN),
+    LV_STYLE_CONST_PAD_TOP(20), LV_STYLE_CONST_PAD_BOTTOM(20),
+    LV_STYLE_CONST_PAD_LEFT(20), LV_STYLE_CONST_PAD_RIGHT(20),
+    LV_STYLE_CONST_PAD_ROW(10), LV_STYLE_CONST_PAD_COLUMN(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(style_content_pane, content_pane_props);
+
+enum { LAYOUT_MAIN_CONT, LAYOUT_NAV_PANE, LAYOUT_CONTENT_PANE, LAYOUT_NODE_COUNT };
+
+static const minigui_ui_node_t settings_layout_nodes[LAYOUT_NODE_COUNT] = {
+    [LAYOUT_MAIN_CONT]    = MINIGUI_UI_NODE_OBJ(MINIGUI_UI_ROOT, &style_main_cont),
+    [LAYOUT_NAV_PANE]     = MINIGUI_UI_NODE_OBJ(LAYOUT_MAIN_CONT, &style_nav_pane),
+    [LAYOUT_CONTENT_PANE] = MINIGUI_UI_NODE_OBJ(LAYOUT_MAIN_CONT, &style_content_pane),
+};
+
+static const minigui_ui_desc_t settings_layout_desc = MINIGUI_UI_DESC_NO_EVENTS(settings_layout_nodes);
+
 /******************************************************************************
  ******************************************************************************
  ** @brief Creates the Settings screen object with its multi-pane layout.
@@ -936,74 +1937,125 @@ static void settings_screen_event_cb(lv_event_t * e) {
  ** @param parent (lv_obj_t*): The content_area container.
  **
  ** @section pointers 
- ** - parent: Owned by minigui.c.
+ ** - parent: Owned by minigui.c (a context's content area).
  **
- ** @section variables 
- ** - None
+ ** @section variables Internal Variables:
+ ** - @c view (settings_view_t*): Per-context screen state (internal pool).
  **
  ** @return void
  **
  ** Implementation Steps:
- ** 1. Define split layout (Nav/Content).
- ** 2. Populate left pane with category routing buttons.
- ** 3. Initialize keyboard for user input.
+ ** 1. Allocate the view and register it with the parent's context.
+ ** 2. Define split layout (Nav/Content); its root frees the view on delete.
+ ** 3. Populate left pane with category routing buttons (built-in panels,
+ **    then one per registered schema group).
  ** 4. Trigger default (Screen) category view.
  ******************************************************************************
  ******************************************************************************/
 void create_screen_settings(lv_obj_t *parent) {
-    lv_obj_add_event_cb(parent, settings_screen_event_cb, LV_EVENT_DELETE, NULL);
-    lv_obj_set_style_bg_color(parent, lv_color_hex(0x1a1a1a), 0);
-    lv_obj_set_style_bg_opa(parent, LV_OPA_COVER, 0);
-
-    // Main horizontal container (two-pane layout)
-    lv_obj_t *main_cont = lv_obj_create(parent);
-    lv_obj_set_size(main_cont, lv_pct(100), lv_pct(100));
-    lv_obj_set_flex_flow(main_cont, LV_FLEX_FLOW_ROW);
-    lv_obj_set_style_pad_all(main_cont, 0, 0);
-    lv_obj_set_style_pad_gap(main_cont, 0, 0);
-    lv_obj_set_style_border_width(main_cont, 0, 0);
-    lv_obj_set_style_bg_opa(main_cont, 0, 0);
-
-    // LEFT PANE: Navigation (fixed 200px)
-    lv_obj_t *nav_pane = lv_obj_create(main_cont);
-    lv_obj_set_size(nav_pane, 200, lv_pct(100));
-    lv_obj_set_style_bg_color(nav_pane, lv_color_hex(0x2a2a2a), 0);
-    lv_obj_set_style_border_width(nav_pane, 1, 0);
-    lv_obj_set_style_border_side(nav_pane, LV_BORDER_SIDE_RIGHT, 0);
-    lv_obj_set_style_border_color(nav_pane, lv_color_hex(0x444444), 0);
-    lv_obj_set_flex_flow(nav_pane, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_pad_all(nav_pane, 10, 0);
-    lv_obj_set_style_pad_gap(nav_pane, 8, 0);
-
-    const char *category_names[] = {
-        LV_SYMBOL_IMAGE " Screen",
-        LV_SYMBOL_WIFI " Network",
-        LV_SYMBOL_SETTINGS " System",
-        LV_SYMBOL_EYE_OPEN " Monitor"
-    };
+    settings_view_t *view = (settings_view_t *)minigui_malloc(MINIGUI_POOL_INTERNAL, sizeof(*view));
+    if (!view) {
+        LV_LOG_ERROR("Settings: view allocation failed");
+        return;
+    }
+    memset(view, 0, sizeof(*view));
+    view->ctx = minigui_ctx_from_obj(parent);
+    minigui_ctx_set_view(view->ctx, view);
+
+    lv_obj_add_style(parent, minigui_theme_style(MINIGUI_THEME_PANEL), 0);
+
+    // Two-pane layout: navigation (profile width) | content (flexible)
+    lv_obj_t *ui[LAYOUT_NODE_COUNT];
+    minigui_ui_build(parent, &settings_layout_desc, ui);
+    lv_obj_add_event_cb(ui[LAYOUT_MAIN_CONT], settings_view_delete_cb, LV_EVENT_DELETE, view);
+    lv_obj_add_style(ui[LAYOUT_NAV_PANE], minigui_theme_style(MINIGUI_THEME_NAV), 0);
+    lv_obj_set_width(ui[LAYOUT_NAV_PANE], minigui_layout_get_for(lv_obj_get_display(parent))->nav_pane_w);
+    view->content_pane = ui[LAYOUT_CONTENT_PANE];
 
     for (int i = 0; i < SETTINGS_CAT_COUNT; i++) {
-        lv_obj_t *btn = lv_button_create(nav_pane);
-        lv_obj_set_width(btn, lv_pct(100));
+        lv_obj_t *btn = lv_button_create(ui[LAYOUT_NAV_PANE]);
+        lv_obj_add_style(btn, &style_nav_button, 0);
         lv_obj_t *lbl = lv_label_create(btn);
-        lv_label_set_text(lbl, category_names[i]);
-        lv_obj_set_style_text_font(lbl, &lv_font_montserrat_24, 0);
+        lv_label_set_text_static(lbl, category_labels[i]);
         lv_obj_add_event_cb(btn, category_event_cb, LV_EVENT_CLICKED, (void*)(uintptr_t)i);
     }
 
-    // RIGHT PANE: Content (flexible)
-    content_pane = lv_obj_create(main_cont);
-    lv_obj_set_flex_grow(content_pane, 1);
-    lv_obj_set_height(content_pane, lv_pct(100));
-    lv_obj_set_flex_flow(content_pane, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_pad_all(content_pane, 20, 0);
-    lv_obj_set_style_pad_gap(content_pane, 10, 0);
-
-    // Shared Keyboard (hidden by default)
-    kb = lv_keyboard_create(parent);
-    lv_obj_add_flag(kb, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_event_cb(kb, kb_event_cb, LV_EVENT_ALL, NULL);
+    // One more category per schema group, after the built-in panels
+    const minigui_settings_schema_t *schema = minigui_settings_get_schema();
+    for (uint8_t g = 0; schema && g < schema->group_count; g++) {
+        lv_obj_t *btn = lv_button_create(ui[LAYOUT_NAV_PANE]);
+        lv_obj_add_style(btn, &style_nav_button, 0);
+        lv_obj_t *lbl = lv_label_create(btn);
+        lv_label_set_text_static(lbl, schema->groups[g].name);
+        lv_obj_add_event_cb(btn, category_event_cb, LV_EVENT_CLICKED, (void*)(uintptr_t)(SETTINGS_CAT_COUNT + g));
+    }
 
     // Load default category
-    switch_category(SETTINGS_CAT_SCREEN);
+    switch_category(view, SETTINGS_CAT_SCREEN);
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Shows a settings category on the default context's Settings screen.
+ **
+ ** @section call_site Called from:
+ ** - Regression runner / external navigation.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (thread-safe locking)
+ ** - minigui_ctx.h (default context)
+ **
+ ** @param category (uint32_t): Category index.
+ **
+ ** @section pointers 
+ ** - None
+ **
+ ** @section variables 
+ ** - None
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Acquire LVGL lock (MINIGUI_LOCK).
+ ** 2. Ignore the request if Settings is not open or the index is invalid.
+ ** 3. Delegate to @c switch_category.
+ ** 4. Release LVGL lock (MINIGUI_UNLOCK).
+ ******************************************************************************
+ ******************************************************************************/
+void screen_settings_show_category(uint32_t category) {
+    MINIGUI_LOCK();
+    settings_view_t *view = (settings_view_t *)minigui_ctx_get_view(minigui_ctx_get_default(), MINIGUI_SCREEN_SETTINGS);
+    if (view && category < screen_settings_get_category_count()) {
+        switch_category(view, (settings_category_t)category);
+    }
+    MINIGUI_UNLOCK();
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Returns the number of settings categories.
+ **
+ ** @section call_site Called from:
+ ** - Regression runner.
+ **
+ ** @section dependencies Required Headers:
+ ** - None
+ **
+ ** @param None
+ **
+ ** @section pointers 
+ ** - None
+ **
+ ** @section variables 
+ ** - None
+ **
+ ** @return uint32_t: Built-in categories plus schema groups.
+ **
+ ** Implementation Steps:
+ ** 1. Add the registered schema's group count to the enum sentinel.
+ ******************************************************************************
+ ******************************************************************************/
+uint32_t screen_settings_get_category_count(void) {
+    const minigui_settings_schema_t *schema = minigui_settings_get_schema();
+    return SETTINGS_CAT_COUNT + (schema ? schema->group_count : 0);
 }
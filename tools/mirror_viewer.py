@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""
+File: tools/mirror_viewer.py
+Description: Reference viewer for the MiniGUI screen mirror (minigui_mirror.h).
+Responsibilities:
+1. Connect to a mirroring panel over TCP or a UNIX socket.
+2. Decode frames (rectangle headers + run/index codec) into a framebuffer.
+3. Write the framebuffer as a PPM image after every frame and print counters.
+
+Usage:
+    mirror_viewer.py tcp <host> <port> [out.ppm]
+    mirror_viewer.py unix <path> [out.ppm]
+"""
+
+import os
+import socket
+import struct
+import sys
+import time
+
+MAGIC = 0x464D474D
+FRAME_HDR = struct.Struct("<IBBHIHHB3x")
+RECT_HDR = struct.Struct("<HHHHI")
+
+OP_INDEX, OP_RAW, OP_RUN, OP_MASK = 0x00, 0x80, 0xC0, 0xC0
+
+# lv_color_format_t values of the formats the viewer can convert
+CF_L8, CF_RGB888, CF_ARGB8888, CF_XRGB8888, CF_RGB565 = 0x06, 0x0F, 0x10, 0x11, 0x12
+
+
+def recv_exact(sock, n):
+    buf = bytearray()
+    while len(buf) < n:
+        chunk = sock.recv(n - len(buf))
+        if not chunk:
+            raise ConnectionError("panel closed the connection")
+        buf += chunk
+    return bytes(buf)
+
+
+def pixel_hash(px):
+    return sum(b * (2 * i + 1) for i, b in enumerate(px)) % 64
+
+
+def decode(payload, bpp, count):
+    """Mirror of minigui_mirror_decode()."""
+    index = [bytes(bpp)] * 64
+    prev = bytes(bpp)
+    out = bytearray()
+    i = 0
+    while i < len(payload):
+        tag = payload[i]
+        i += 1
+        arg = tag & 0x3F
+        op = tag & OP_MASK
+        if op == OP_RUN:
+            out += prev * (arg + 1)
+        elif op == OP_INDEX:
+            prev = index[arg]
+            out += prev
+        elif op == OP_RAW:
+            for _ in range(arg + 1):
+                prev = payload[i:i + bpp]
+                i += bpp
+                index[pixel_hash(prev)] = prev
+                out += prev
+        else:
+            raise ValueError("reserved tag 0x%02x" % tag)
+    if len(out) != count * bpp:
+        raise ValueError("rect decoded to %d bytes, expected %d" % (len(out), count * bpp))
+    return out
+
+
+def to_rgb(px, cf):
+    if cf == CF_RGB565:
+        v = px[0] | (px[1] << 8)
+        return bytes((((v >> 11) & 0x1F) << 3, ((v >> 5) & 0x3F) << 2, (v & 0x1F) << 3))
+    if cf in (CF_RGB888, CF_ARGB8888, CF_XRGB8888):
+        return bytes((px[2], px[1], px[0]))
+    return bytes((px[0],) * 3)
+
+
+def write_ppm(path, fb, w, h, bpp, cf):
+    rgb = bytearray()
+    for o in range(0, w * h * bpp, bpp):
+        rgb += to_rgb(fb[o:o + bpp], cf)
+    tmp = path + ".tmp"
+    with open(tmp, "wb") as f:
+        f.write(b"P6\n%d %d\n255\n" % (w, h))
+        f.write(rgb)
+    os.replace(tmp, path)
+
+
+def main(argv):
+    if len(argv) >= 4 and argv[1] == "tcp":
+        sock = socket.create_connection((argv[2], int(argv[3])))
+        out = argv[4] if len(argv) > 4 else "mirror.ppm"
+    elif len(argv) >= 3 and argv[1] == "unix":
+        sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        sock.connect(argv[2])
+        out = argv[3] if len(argv) > 3 else "mirror.ppm"
+    else:
+        print(__doc__)
+        return 2
+
+    fb = None
+    frames = wire = raw = 0
+    start = time.monotonic()
+    while True:
+        magic, ver, bpp, nrect, seq, w, h, cf = FRAME_HDR.unpack(recv_exact(sock, FRAME_HDR.size))
+        if magic != MAGIC or ver != 1:
+            raise ValueError("bad frame header")
+        if fb is None or len(fb) != w * h * bpp:
+            fb = bytearray(w * h * bpp)
+        wire += FRAME_HDR.size
+
+        for _ in range(nrect):
+            x, y, rw, rh, length = RECT_HDR.unpack(recv_exact(sock, RECT_HDR.size))
+            pixels = decode(recv_exact(sock, length), bpp, rw * rh)
+            row = rw * bpp
+            for r in range(rh):
+                o = ((y + r) * w + x) * bpp
+                fb[o:o + row] = pixels[r * row:(r + 1) * row]
+            wire += RECT_HDR.size + length
+            raw += rw * rh * bpp
+
+        frames += 1
+        write_ppm(out, fb, w, h, bpp, cf)
+        elapsed = max(time.monotonic() - start, 1e-3)
+        print("frame %u: %d rects, %.1f fps, ratio %.2f, %.1f kB/s"
+              % (seq, nrect, frames / elapsed, wire / max(raw, 1), wire / elapsed / 1024))
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,700 @@
+/******************************************************************************
+ ******************************************************************************
+ ** @brief     MiniGUI Performance & Visual Regression Runner.
+ **
+ **            Host executable (CTest target minigui_perf_regression) that
+ **            renders every screen and every Settings category on a headless
+ **            800x480 display, checks each view against the committed
+ **            baseline (golden hash + budgets) and writes the actual frame and
+ **            a diff image for every view that is out of tolerance.
+ **
+ **            Usage:
+ **              minigui_perf_runner --baseline FILE [--golden-dir DIR]
+ **                                  [--out DIR] [--tolerance PCT] [--runs N]
+ **                                  [--settle MS] [--update]
+ **
+ **            Exit status: 0 all views within tolerance, 1 regression or
+ **            missing baseline entry, 2 usage or setup error.
+ **
+ **            @section perf_runner.c - Regression runner.
+ ******************************************************************************
+ ******************************************************************************/
+
+/******************************************************************************
+ ******************************************************************************
+ ** 1. ESP-IDF / FreeRTOS Core (Framework)
+ ******************************************************************************
+ ******************************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/******************************************************************************
+ ******************************************************************************
+ ** 2. Managed Espressif Components (External Managed Components)
+ ******************************************************************************
+ ******************************************************************************/
+#include "lvgl.h"
+
+/******************************************************************************
+ ******************************************************************************
+ ** 3. Project-Specific Components (Local)
+ ******************************************************************************
+ ******************************************************************************/
+#include "minigui.h"
+#include "minigui_perf.h"
+#if MINIGUI_ENABLE_SETTINGS
+#include "screens/screen_settings.h"
+#endif
+
+/******************************************************************************
+ ******************************************************************************
+ * FILE GLOBALS
+ ******************************************************************************
+ ******************************************************************************/
+
+#define RUNNER_HOR_RES 800
+#define RUNNER_VER_RES 480
+
+#define MAX_VIEWS 64
+#define LINE_LEN 160
+
+// Exit code reported to CTest as "skipped" (SKIP_RETURN_CODE)
+#define RUNNER_SKIP 77
+
+// "MGF1", w, h, color format, pixel size, then runs of (count, pixel)
+static const char GOLDEN_MAGIC[4] = { 'M', 'G', 'F', '1' };
+
+typedef struct {
+    const char *baseline_path;
+    const char *golden_dir;
+    const char *out_dir;
+    uint8_t tolerance_pct;
+    uint32_t runs;
+    uint32_t settle_ms;
+    bool update;
+} runner_opts_t;
+
+typedef struct {
+    minigui_screen_t screen;
+    int32_t category;
+} view_t;
+
+static const char *const screen_ids[] = {
+#define SCREEN_ID(id, title, label, creator) #id,
+    MINIGUI_SCREEN_LIST(SCREEN_ID)
+#undef SCREEN_ID
+};
+
+static minigui_perf_baseline_t baselines[MAX_VIEWS];
+static size_t baseline_count;
+
+static uint8_t draw_buf[RUNNER_HOR_RES * RUNNER_VER_RES / 10 * 4];
+
+// ============================================================================
+// PRIVATE HELPER FUNCTIONS
+// ============================================================================
+
+static uint32_t clock_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u);
+}
+
+static uint32_t clock_ms(void) {
+    return clock_us() / 1000u;
+}
+
+static void delay_ms(uint32_t ms) {
+    usleep(ms * 1000u);
+}
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    (void)area;
+    (void)px_map;
+    lv_display_flush_ready(disp);
+}
+
+/**
+ * @brief Fixed provider data, so frames only change when the code does
+ */
+static size_t fixed_logs(minigui_log_entry_t *logs, size_t max_count, const char *filter) {
+    static const char *const levels[] = { "INFO", "WARN", "ERROR" };
+    static const char *const sources[] = { "WIFI", "SYS", "HTTP" };
+    size_t n = 0;
+
+    for (size_t i = 0; i < 24 && n < max_count; i++) {
+        const char *source = sources[i % 3];
+        if (filter && strcmp(filter, "ALL") != 0 && strcmp(filter, source) != 0) continue;
+        snprintf(logs[n].timestamp, sizeof(logs[n].timestamp), "12:%02u:%02u", (unsigned)(i / 60),
+                 (unsigned)(i % 60));
+        snprintf(logs[n].source, sizeof(logs[n].source), "%s", source);
+        snprintf(logs[n].level, sizeof(logs[n].level), "%s", levels[i % 3]);
+        snprintf(logs[n].message, sizeof(logs[n].message), "Regression log line %u", (unsigned)i);
+        n++;
+    }
+    return n;
+}
+
+static void fixed_time(char *buf, size_t max_len) {
+    snprintf(buf, max_len, "12:00:00");
+}
+
+static void fixed_stats(minigui_system_stats_t *stats) {
+    stats->voltage = 5.02f;
+    stats->cpu_usage = 37;
+    stats->flash_used_kb = 512;
+    stats->flash_total_kb = 4096;
+    stats->ram_used_kb = 128;
+    stats->ram_total_kb = 520;
+}
+
+static void fixed_network(minigui_network_status_t *status) {
+    status->connected = true;
+    snprintf(status->ssid, sizeof(status->ssid), "MiniGUI-Lab");
+    snprintf(status->ip_address, sizeof(status->ip_address), "192.168.1.100");
+    snprintf(status->mac_address, sizeof(status->mac_address), "02:00:00:5E:10:01");
+}
+
+static size_t fixed_scan(minigui_wifi_network_t *networks, size_t max_count) {
+    static const char *const ssids[] = { "MiniGUI-Lab", "Office", "Guest" };
+    static const int8_t rssi[] = { -42, -67, -80 };
+    size_t n = 0;
+
+    for (; n < 3 && n < max_count; n++) {
+        snprintf(networks[n].ssid, sizeof(networks[n].ssid), "%s", ssids[n]);
+        networks[n].rssi = rssi[n];
+    }
+    return n;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Creates the headless display and the UI.
+ **
+ ** @section call_site Called from:
+ ** - main() before the first measurement.
+ **
+ ** @section dependencies Required Headers:
+ ** - lvgl.h (display, tick and delay hooks)
+ ** - minigui.h (providers, minigui_init)
+ **
+ ** @param None
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c disp (lv_display_t*): 800x480 display with a no-op flush.
+ **
+ ** @return bool: false if the display could not be created.
+ **
+ ** Implementation Steps:
+ ** 1. Initialize LVGL with the monotonic clock as tick and delay source.
+ ** 2. Create the display with a partial draw buffer.
+ ** 3. Register deterministic providers and build the UI.
+ ******************************************************************************
+ ******************************************************************************/
+static bool setup_ui(void) {
+    lv_init();
+    lv_tick_set_cb(clock_ms);
+    lv_delay_set_cb(delay_ms);
+
+    lv_display_t *disp = lv_display_create(RUNNER_HOR_RES, RUNNER_VER_RES);
+    if (!disp) return false;
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    minigui_perf_set_clock(clock_us);
+    minigui_set_log_provider(fixed_logs);
+    minigui_set_time_provider(fixed_time);
+    minigui_register_system_stats_provider(fixed_stats);
+    minigui_register_network_status_provider(fixed_network);
+    minigui_register_wifi_scan_provider(fixed_scan);
+    minigui_init();
+    return minigui_get_content_area() != NULL;
+}
+
+static size_t list_views(view_t *views, size_t max) {
+    size_t n = 0;
+
+    for (int s = 0; s < MINIGUI_SCREEN_COUNT; s++) {
+#if MINIGUI_ENABLE_SETTINGS
+        if (s == MINIGUI_SCREEN_SETTINGS) {
+            uint32_t count = screen_settings_get_category_count();
+            for (uint32_t c = 0; c < count && n < max; c++) {
+                views[n++] = (view_t){ (minigui_screen_t)s, (int32_t)c };
+            }
+            continue;
+        }
+#endif
+        if (n < max) views[n++] = (view_t){ (minigui_screen_t)s, MINIGUI_PERF_CATEGORY_DEFAULT };
+    }
+    return n;
+}
+
+static void view_name(const view_t *view, char *buf, size_t len) {
+    if (view->category < 0) {
+        snprintf(buf, len, "%s", screen_ids[view->screen]);
+    } else {
+        snprintf(buf, len, "%s_%ld", screen_ids[view->screen], (long)view->category);
+    }
+    for (char *p = buf; *p; p++) {
+        if (*p >= 'A' && *p <= 'Z') *p = (char)(*p - 'A' + 'a');
+    }
+}
+
+static bool load_baseline(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+
+    char line[LINE_LEN];
+    baseline_count = 0;
+    while (fgets(line, sizeof(line), f) && baseline_count < MAX_VIEWS) {
+        if (minigui_perf_parse_baseline(line, &baselines[baseline_count])) baseline_count++;
+    }
+    fclose(f);
+    return true;
+}
+
+static const minigui_perf_baseline_t *find_baseline(const view_t *view) {
+    for (size_t i = 0; i < baseline_count; i++) {
+        if (baselines[i].screen == (int32_t)view->screen && baselines[i].category == view->category) {
+            return &baselines[i];
+        }
+    }
+    return NULL;
+}
+
+static bool ensure_dir(const char *path) {
+    return mkdir(path, 0755) == 0 || errno == EEXIST;
+}
+
+/**
+ * @brief Converts one pixel of a native frame to 8-bit RGB
+ */
+static void pixel_rgb(const uint8_t *px, lv_color_format_t cf, uint8_t rgb[3]) {
+    switch (cf) {
+        case LV_COLOR_FORMAT_RGB565: {
+            uint16_t v = (uint16_t)(px[0] | (px[1] << 8));
+            rgb[0] = (uint8_t)(((v >> 11) & 0x1F) * 255 / 31);
+            rgb[1] = (uint8_t)(((v >> 5) & 0x3F) * 255 / 63);
+            rgb[2] = (uint8_t)((v & 0x1F) * 255 / 31);
+            break;
+        }
+        case LV_COLOR_FORMAT_RGB888:
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_ARGB8888:
+            rgb[0] = px[2];
+            rgb[1] = px[1];
+            rgb[2] = px[0];
+            break;
+        default:
+            rgb[0] = rgb[1] = rgb[2] = px[0];
+            break;
+    }
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Writes a frame, or a diff overlay on it, as a binary PPM.
+ **
+ ** @section call_site Called from:
+ ** - report_failure() for the actual frame and the diff image.
+ **
+ ** @section dependencies Required Headers:
+ ** - stdio.h (file output)
+ **
+ ** @param path (const char*): Output file.
+ ** @param frame (const lv_draw_buf_t*): Rendered frame.
+ ** @param mask (const lv_draw_buf_t*): Diff mask from minigui_perf_frame_diff,
+ **                                      or NULL for the plain frame.
+ **
+ ** @section pointers
+ ** - frame/mask: Read-only, owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c px_size (uint32_t): Bytes per native pixel.
+ **
+ ** @return bool: false if the file could not be written.
+ **
+ ** Implementation Steps:
+ ** 1. Write the P6 header.
+ ** 2. Convert every pixel to RGB; with a mask, paint changed pixels red and
+ **    dim the unchanged ones so the changes stand out.
+ ******************************************************************************
+ ******************************************************************************/
+static bool write_ppm(const char *path, const lv_draw_buf_t *frame, const lv_draw_buf_t *mask) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+
+    uint32_t w = frame->header.w, h = frame->header.h;
+    uint32_t px_size = lv_color_format_get_size(frame->header.cf);
+    fprintf(f, "P6\n%u %u\n255\n", (unsigned)w, (unsigned)h);
+
+    for (uint32_t y = 0; y < h; y++) {
+        const uint8_t *row = frame->data + (size_t)y * frame->header.stride;
+        const uint8_t *mrow = mask ? mask->data + (size_t)y * mask->header.stride : NULL;
+        for (uint32_t x = 0; x < w; x++) {
+            uint8_t rgb[3];
+            pixel_rgb(row + x * px_size, frame->header.cf, rgb);
+            if (mrow && mrow[x * px_size]) {
+                rgb[0] = 0xFF;
+                rgb[1] = rgb[2] = 0x00;
+            } else if (mrow) {
+                for (int i = 0; i < 3; i++) rgb[i] = (uint8_t)(rgb[i] / 4);
+            }
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    return fclose(f) == 0;
+}
+
+/**
+ * @brief Saves a frame run-length encoded (UI frames are mostly flat colors)
+ */
+static bool save_golden(const char *path, const lv_draw_buf_t *frame) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+
+    uint32_t px_size = lv_color_format_get_size(frame->header.cf);
+    uint8_t head[8] = {
+        (uint8_t)(frame->header.w & 0xFF), (uint8_t)(frame->header.w >> 8),
+        (uint8_t)(frame->header.h & 0xFF), (uint8_t)(frame->header.h >> 8),
+        (uint8_t)frame->header.cf, (uint8_t)px_size, 0, 0,
+    };
+    fwrite(GOLDEN_MAGIC, 1, sizeof(GOLDEN_MAGIC), f);
+    fwrite(head, 1, sizeof(head), f);
+
+    for (uint32_t y = 0; y < frame->header.h; y++) {
+        const uint8_t *row = frame->data + (size_t)y * frame->header.stride;
+        uint32_t x = 0;
+        while (x < frame->header.w) {
+            uint32_t run = 1;
+            while (x + run < frame->header.w && run < 255 &&
+                   memcmp(row + (x + run) * px_size, row + x * px_size, px_size) == 0) {
+                run++;
+            }
+            uint8_t count = (uint8_t)run;
+            fwrite(&count, 1, 1, f);
+            fwrite(row + x * px_size, 1, px_size, f);
+            x += run;
+        }
+    }
+    return fclose(f) == 0;
+}
+
+/**
+ * @brief Loads a frame written by save_golden(); NULL if missing or corrupt
+ */
+static lv_draw_buf_t *load_golden(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    char magic[4];
+    uint8_t head[8];
+    if (fread(magic, 1, 4, f) != 4 || memcmp(magic, GOLDEN_MAGIC, 4) != 0 || fread(head, 1, 8, f) != 8) {
+        fclose(f);
+        return NULL;
+    }
+    uint32_t w = head[0] | (head[1] << 8);
+    uint32_t h = head[2] | (head[3] << 8);
+    lv_color_format_t cf = (lv_color_format_t)head[4];
+    uint32_t px_size = head[5];
+
+    lv_draw_buf_t *frame = lv_draw_buf_create(w, h, cf, LV_STRIDE_AUTO);
+    if (!frame || lv_color_format_get_size(cf) != px_size) {
+        if (frame) lv_draw_buf_destroy(frame);
+        fclose(f);
+        return NULL;
+    }
+
+    bool ok = true;
+    for (uint32_t y = 0; y < h && ok; y++) {
+        uint8_t *row = frame->data + (size_t)y * frame->header.stride;
+        uint32_t x = 0;
+        while (x < w && ok) {
+            uint8_t count, px[4];
+            ok = fread(&count, 1, 1, f) == 1 && count != 0 && x + count <= w &&
+                 px_size <= sizeof(px) && fread(px, 1, px_size, f) == px_size;
+            for (uint32_t i = 0; ok && i < count; i++, x++) memcpy(row + x * px_size, px, px_size);
+        }
+    }
+    fclose(f);
+    if (!ok) {
+        lv_draw_buf_destroy(frame);
+        return NULL;
+    }
+    return frame;
+}
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Prints a failing view and writes its images.
+ **
+ ** @section call_site Called from:
+ ** - main() for every view out of tolerance.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_perf.h (frame diff)
+ **
+ ** @param opts (const runner_opts_t*): Directories.
+ ** @param name (const char*): View name used in file names.
+ ** @param flags (uint32_t): MINIGUI_PERF_FAIL_* bits.
+ ** @param frame (const lv_draw_buf_t*): Actual frame (may be NULL).
+ **
+ ** @section pointers
+ ** - frame: Read-only, owned by caller.
+ **
+ ** @section variables Internal Variables:
+ ** - @c golden (lv_draw_buf_t*): Stored golden frame, if any.
+ ** - @c mask (lv_draw_buf_t*): Per-pixel diff.
+ **
+ ** @return void
+ **
+ ** Implementation Steps:
+ ** 1. Write <name>_actual.ppm.
+ ** 2. On a hash failure, diff against the golden frame and write
+ **    <name>_diff.ppm with the changed pixels in red.
+ ******************************************************************************
+ ******************************************************************************/
+static void report_failure(const runner_opts_t *opts, const char *name, uint32_t flags,
+                           const lv_draw_buf_t *frame) {
+    char path[512];
+
+    if (!frame || !ensure_dir(opts->out_dir)) return;
+    snprintf(path, sizeof(path), "%s/%s_actual.ppm", opts->out_dir, name);
+    if (write_ppm(path, frame, NULL)) printf("    actual frame: %s\n", path);
+
+    if (!(flags & MINIGUI_PERF_FAIL_HASH)) return;
+    snprintf(path, sizeof(path), "%s/%s.mgf", opts->golden_dir, name);
+    lv_draw_buf_t *golden = load_golden(path);
+    if (!golden) {
+        printf("    no golden frame at %s (run --update on the reference tree)\n", path);
+        return;
+    }
+
+    lv_draw_buf_t *mask = lv_draw_buf_create(golden->header.w, golden->header.h, golden->header.cf,
+                                             LV_STRIDE_AUTO);
+    uint32_t changed = minigui_perf_frame_diff(golden, frame, mask);
+    if (changed == UINT32_MAX) {
+        printf("    golden frame geometry differs (%ux%u)\n", (unsigned)golden->header.w,
+               (unsigned)golden->header.h);
+    } else if (mask) {
+        snprintf(path, sizeof(path), "%s/%s_diff.ppm", opts->out_dir, name);
+        if (write_ppm(path, frame, mask)) printf("    %u pixels differ: %s\n", (unsigned)changed, path);
+    }
+    if (mask) lv_draw_buf_destroy(mask);
+    lv_draw_buf_destroy(golden);
+}
+
+/**
+ * @brief Measures a view @p runs times; timings keep the fastest run
+ */
+static bool measure_view(const view_t *view, const runner_opts_t *opts, minigui_perf_sample_t *out,
+                         lv_draw_buf_t **frame) {
+    *frame = NULL;
+    for (uint32_t i = 0; i < opts->runs; i++) {
+        minigui_perf_sample_t s;
+        lv_draw_buf_t *f = NULL;
+        if (!minigui_perf_measure(view->screen, view->category, opts->settle_ms, &s, i == 0 ? &f : NULL)) {
+            return false;
+        }
+        if (i == 0) {
+            *out = s;
+            *frame = f;
+            continue;
+        }
+        if (s.build_us < out->build_us) out->build_us = s.build_us;
+        if (s.render_us < out->render_us) out->render_us = s.render_us;
+    }
+    return true;
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s --baseline FILE [--golden-dir DIR] [--out DIR] [--tolerance PCT]\n"
+            "          [--runs N] [--settle MS] [--update]\n",
+            argv0);
+}
+
+static bool parse_args(int argc, char **argv, runner_opts_t *opts) {
+    *opts = (runner_opts_t){ NULL, "perf_golden", "perf_out", 25, 3, 200, false };
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *val = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--update") == 0) {
+            opts->update = true;
+            continue;
+        }
+        if (!val) return false;
+        i++;
+        if (strcmp(arg, "--baseline") == 0) {
+            opts->baseline_path = val;
+        } else if (strcmp(arg, "--golden-dir") == 0) {
+            opts->golden_dir = val;
+        } else if (strcmp(arg, "--out") == 0) {
+            opts->out_dir = val;
+        } else if (strcmp(arg, "--tolerance") == 0) {
+            opts->tolerance_pct = (uint8_t)atoi(val);
+        } else if (strcmp(arg, "--runs") == 0) {
+            opts->runs = (uint32_t)atoi(val);
+        } else if (strcmp(arg, "--settle") == 0) {
+            opts->settle_ms = (uint32_t)atoi(val);
+        } else {
+            return false;
+        }
+    }
+    if (opts->runs == 0) opts->runs = 1;
+    return opts->baseline_path != NULL;
+}
+
+// ============================================================================
+// PUBLIC API FUNCTIONS
+// ============================================================================
+
+/******************************************************************************
+ ******************************************************************************
+ ** @brief Runner entry point.
+ **
+ ** @section call_site Called from:
+ ** - CTest (minigui_perf_regression) or a developer shell.
+ **
+ ** @section dependencies Required Headers:
+ ** - minigui_perf.h (measure, check, baseline format)
+ **
+ ** @param argc (int): Argument count.
+ ** @param argv (char**): Arguments, see usage().
+ **
+ ** @section pointers
+ ** - None
+ **
+ ** @section variables Internal Variables:
+ ** - @c views (view_t[]): Every screen and Settings category.
+ ** - @c out (FILE*): New baseline in --update mode.
+ ** - @c failed (size_t): Views out of tolerance or without a baseline.
+ **
+ ** @return int: 0 pass, 1 regression, 2 usage or setup error, RUNNER_SKIP
+ **         if the baseline has no entries yet.
+ **
+ ** Implementation Steps:
+ ** 1. Parse options, load the baseline (not needed with --update; an empty
+ **    one skips the check) and build the UI on the headless display.
+ **    Without LV_USE_SNAPSHOT there are no frames: only timings, objects
+ **    and heap are checked.
+ ** 2. Measure every view.
+ ** 3. --update: write the baseline line and the golden frame.
+ ** 4. Otherwise check against the baseline; print and write images for
+ **    every failure, counting missing baseline entries as failures.
+ ******************************************************************************
+ ******************************************************************************/
+int main(int argc, char **argv) {
+    runner_opts_t opts;
+    if (!parse_args(argc, argv, &opts)) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (!opts.update && !load_baseline(opts.baseline_path)) {
+        fprintf(stderr, "cannot read baseline %s\n", opts.baseline_path);
+        return 2;
+    }
+    if (!opts.update && baseline_count == 0) {
+        printf("SKIP no entries in %s, generate them with --update\n", opts.baseline_path);
+        return RUNNER_SKIP;
+    }
+#if !LV_USE_SNAPSHOT
+    printf("LV_USE_SNAPSHOT is off: frames are not hashed or saved\n");
+#endif
+    if (!setup_ui()) {
+        fprintf(stderr, "UI setup failed\n");
+        return 2;
+    }
+
+    FILE *out = NULL;
+    if (opts.update) {
+        out = fopen(opts.baseline_path, "w");
+        if (!out || !ensure_dir(opts.golden_dir)) {
+            fprintf(stderr, "cannot write %s / %s\n", opts.baseline_path, opts.golden_dir);
+            if (out) fclose(out);
+            return 2;
+        }
+        fprintf(out, "# MiniGUI perf baseline, %dx%d, regenerate with minigui_perf_runner --update\n"
+                     "# screen category build_us render_us objects heap hash_hex\n"
+                     "# Category -1 is the screen's default view; views without a line fail.\n"
+                     "# Without any line the check is skipped. Hash 00000000 skips the frame check.\n",
+                RUNNER_HOR_RES, RUNNER_VER_RES);
+    }
+
+    view_t views[MAX_VIEWS];
+    size_t view_count = list_views(views, MAX_VIEWS);
+    size_t failed = 0;
+
+    for (size_t i = 0; i < view_count; i++) {
+        char name[48], path[512], line[LINE_LEN];
+        minigui_perf_sample_t sample;
+        lv_draw_buf_t *frame = NULL;
+
+        view_name(&views[i], name, sizeof(name));
+        if (!measure_view(&views[i], &opts, &sample, &frame)) {
+            printf("FAIL %-20s not built\n", name);
+            failed++;
+            continue;
+        }
+
+        if (opts.update) {
+            minigui_perf_format_baseline(line, sizeof(line), views[i].screen, views[i].category, &sample);
+            fputs(line, out);
+            snprintf(path, sizeof(path), "%s/%s.mgf", opts.golden_dir, name);
+            if (frame && !save_golden(path, frame)) fprintf(stderr, "cannot write %s\n", path);
+            printf("SAVE %-20s %s", name, line);
+        } else {
+            const minigui_perf_baseline_t *base = find_baseline(&views[i]);
+#if !LV_USE_SNAPSHOT
+            minigui_perf_baseline_t timing_only;
+            if (base) {
+                timing_only = *base;
+                timing_only.frame_hash = 0;   // No frame to compare
+                base = &timing_only;
+            }
+#endif
+            uint32_t flags = base ? minigui_perf_check(base, &sample, opts.tolerance_pct) : 0;
+            if (!base) {
+                printf("FAIL %-20s no baseline entry\n", name);
+                failed++;
+            } else if (flags) {
+                printf("FAIL %-20s%s%s%s%s%s (build %u/%u us, render %u/%u us, objects %u/%u, "
+                       "heap %u/%u, hash %08x/%08x)\n",
+                       name, flags & MINIGUI_PERF_FAIL_HASH ? " hash" : "",
+                       flags & MINIGUI_PERF_FAIL_BUILD ? " build" : "",
+                       flags & MINIGUI_PERF_FAIL_RENDER ? " render" : "",
+                       flags & MINIGUI_PERF_FAIL_OBJECTS ? " objects" : "",
+                       flags & MINIGUI_PERF_FAIL_HEAP ? " heap" : "",
+                       (unsigned)sample.build_us, (unsigned)base->max_build_us,
+                       (unsigned)sample.render_us, (unsigned)base->max_render_us,
+                       (unsigned)sample.obj_count, (unsigned)base->max_obj_count,
+                       (unsigned)sample.heap_used, (unsigned)base->max_heap_used,
+                       (unsigned)sample.frame_hash, (unsigned)base->frame_hash);
+                report_failure(&opts, name, flags, frame);
+                failed++;
+            } else {
+                printf("ok   %-20s build %u us, render %u us, %u objects\n", name,
+                       (unsigned)sample.build_us, (unsigned)sample.render_us, (unsigned)sample.obj_count);
+            }
+        }
+        if (frame) lv_draw_buf_destroy(frame);
+    }
+
+    if (out) {
+        fclose(out);
+        printf("%u views written to %s\n", (unsigned)view_count, opts.baseline_path);
+        return 0;
+    }
+    printf("%u of %u views out of tolerance (%u%%)\n", (unsigned)failed, (unsigned)view_count,
+           (unsigned)opts.tolerance_pct);
+    return failed ? 1 : 0;
+}